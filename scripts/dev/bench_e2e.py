@@ -0,0 +1,219 @@
+#!/usr/bin/env python
+###############################################################################
+#    - FILE: 	bench_e2e.py
+#   BRIEF: 	End-to-end throughput benchmark of the mmore stage.
+#           Generates synthetic databases with `mmoreseqs_bench --gen`, runs
+#           `mmoreseqs mmore-search` on them at several scales (number of m8
+#           hits), and records hits/sec, peak RSS and per-stage breakdown (from
+#           --perfout) to a JSON baseline. If a baseline is given, compares this
+#           run against it and exits non-zero on regression.
+#           Needs no network access and no MMseqs/HMMER installation.
+###############################################################################
+
+import os
+import sys
+import json
+import time
+import shutil
+import argparse
+import platform
+import subprocess
+
+FORMAT_NAME = "mmoreseqs-bench-e2e"
+FORMAT_VERSION = 1
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="End-to-end throughput benchmark of the mmore stage on synthetic data.")
+    parser.add_argument("--bindir", default="build/bin",
+                        help="directory containing mmoreseqs and mmoreseqs_bench [build/bin]")
+    parser.add_argument("--workdir", default="bench-e2e",
+                        help="directory for generated data and run outputs [bench-e2e]")
+    parser.add_argument("--scales", default="1000,100000,1000000",
+                        help="comma-separated numbers of m8 hits to run [1000,100000,1000000]")
+    parser.add_argument("--profiles", type=int, default=None,
+                        help="number of profiles [hits/100, clamped to 10..2000]")
+    parser.add_argument("--seqs", type=int, default=None,
+                        help="number of sequences [hits/10, clamped to 100..20000]")
+    parser.add_argument("--homologs", type=float, default=0.8,
+                        help="fraction of sequences and hits which are homologous [0.8]")
+    parser.add_argument("--tlen", default="100,200,400",
+                        help="profile lengths [100,200,400]")
+    parser.add_argument("--qlen", default="100,400,1600",
+                        help="sequence lengths [100,400,1600]")
+    parser.add_argument("--seed", type=int, default=1,
+                        help="random seed for generated data [1]")
+    parser.add_argument("--threads", type=int, default=1,
+                        help="number of mmore-search threads [1]")
+    parser.add_argument("--mmore-args", default="",
+                        help="extra options passed to mmore-search, e.g. \"--cloud-i16 1\" []")
+    parser.add_argument("--output", default=None,
+                        help="write results of this run to file [<workdir>/bench-e2e.json]")
+    parser.add_argument("--baseline", default=None,
+                        help="compare against baseline file written by a previous run")
+    parser.add_argument("--tolerance", type=float, default=0.10,
+                        help="allowed relative loss in hits/sec or growth in peak RSS [0.10]")
+    parser.add_argument("--keep", action="store_true",
+                        help="keep generated data after run")
+    return parser.parse_args()
+
+
+def clamp(value, lo, hi):
+    return max(lo, min(hi, value))
+
+
+def generate(args, scale, data_dir):
+    """Generate synthetic database for <scale> hits into <data_dir>."""
+    num_profiles = args.profiles if args.profiles else clamp(scale // 100, 10, 2000)
+    num_seqs = args.seqs if args.seqs else clamp(scale // 10, 100, 20000)
+    if os.path.exists(data_dir):
+        shutil.rmtree(data_dir)
+    cmd = [os.path.join(args.bindir, "mmoreseqs_bench"),
+           "--gen", data_dir,
+           "--gen-profiles", str(num_profiles),
+           "--gen-seqs", str(num_seqs),
+           "--gen-hits", str(scale),
+           "--gen-homologs", str(args.homologs),
+           "--tlen", args.tlen,
+           "--qlen", args.qlen,
+           "--seed", str(args.seed)]
+    subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+    return {"profiles": num_profiles, "seqs": num_seqs}
+
+
+def run_mmore(args, data_dir):
+    """Run mmore-search on <data_dir>. Returns wall time (secs) and peak RSS (kB)."""
+    cmd = [os.path.join(args.bindir, "mmoreseqs"), "mmore-search",
+           os.path.join(data_dir, "target.hmm"),
+           os.path.join(data_dir, "query.fasta"),
+           os.path.join(data_dir, "hits.m8"),
+           "--num-threads", str(args.threads),
+           "--perfout", os.path.join(data_dir, "results.perfout"),
+           "--myout", os.path.join(data_dir, "results.myout")]
+    cmd += args.mmore_args.split()
+    t_beg = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL)
+    # rusage of the child only, so peak RSS is not polluted by this script
+    _, status, usage = os.wait4(proc.pid, 0)
+    t_end = time.perf_counter()
+    if os.WIFEXITED(status) == False or os.WEXITSTATUS(status) != 0:
+        print("ERROR: mmore-search failed on '{}'.".format(data_dir))
+        sys.exit(1)
+    # ru_maxrss is in kB on linux, bytes on macos
+    peak_rss_kb = usage.ru_maxrss if platform.system() != "Darwin" else usage.ru_maxrss // 1024
+    return t_end - t_beg, peak_rss_kb
+
+
+def parse_perfout(perfout_file):
+    """Parse per-stage summary table at top of perfout file."""
+    stages = {}
+    num_headers = 0
+    with open(perfout_file, "r") as fp:
+        for line in fp:
+            if line.startswith("#"):
+                num_headers += 1
+                # histograms follow the summary table
+                if num_headers > 1:
+                    break
+                continue
+            fields = line.rstrip("\n").split("\t")
+            stages[fields[0]] = {
+                "runs": int(fields[1]),
+                "time_total": float(fields[2]),
+                "time_mean": float(fields[3]),
+                "time_p50": float(fields[4]),
+                "time_p99": float(fields[6]),
+                "cells": int(fields[8]),
+                "gcups_mean": float(fields[9]),
+            }
+    return stages
+
+
+def compare(results, baseline, tolerance):
+    """Compare <results> to <baseline> per scale. Returns number of regressions."""
+    base_runs = {run["hits"]: run for run in baseline["runs"]}
+    num_regressions = 0
+    print("#{}\t{}\t{}\t{}\t{}\t{}".format(
+        "hits", "metric", "baseline", "current", "change", "status"))
+    for run in results["runs"]:
+        base = base_runs.get(run["hits"])
+        if base is None:
+            print("{}\t-\t-\t-\t-\tno-baseline".format(run["hits"]))
+            continue
+        # (metric, is higher better)
+        for metric, is_higher_better in [("hits_per_sec", True), ("peak_rss_kb", False)]:
+            old, new = base[metric], run[metric]
+            change = (new - old) / old if old else 0.0
+            loss = -change if is_higher_better else change
+            status = "REGRESSION" if loss > tolerance else "ok"
+            if status != "ok":
+                num_regressions += 1
+            print("{}\t{}\t{:.4g}\t{:.4g}\t{:+.1%}\t{}".format(
+                run["hits"], metric, old, new, change, status))
+    return num_regressions
+
+
+def main():
+    args = parse_args()
+    scales = [int(x) for x in args.scales.split(",")]
+    os.makedirs(args.workdir, exist_ok=True)
+    output = args.output if args.output else os.path.join(args.workdir, "bench-e2e.json")
+
+    results = {
+        "format": FORMAT_NAME,
+        "version": FORMAT_VERSION,
+        "date": time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "host": platform.node(),
+        "params": {
+            "homologs": args.homologs,
+            "tlen": args.tlen,
+            "qlen": args.qlen,
+            "seed": args.seed,
+            "threads": args.threads,
+            "mmore_args": args.mmore_args,
+        },
+        "runs": [],
+    }
+
+    print("#{}\t{}\t{}\t{}\t{}\t{}".format(
+        "hits", "profiles", "seqs", "wall-secs", "hits-per-sec", "peak-rss-kb"))
+    for scale in scales:
+        data_dir = os.path.join(args.workdir, "hits-{}".format(scale))
+        sizes = generate(args, scale, data_dir)
+        wall_secs, peak_rss_kb = run_mmore(args, data_dir)
+        run = {
+            "hits": scale,
+            "profiles": sizes["profiles"],
+            "seqs": sizes["seqs"],
+            "wall_secs": wall_secs,
+            "hits_per_sec": scale / wall_secs if wall_secs > 0 else 0.0,
+            "peak_rss_kb": peak_rss_kb,
+            "stages": parse_perfout(os.path.join(data_dir, "results.perfout")),
+        }
+        results["runs"].append(run)
+        print("{}\t{}\t{}\t{:.3f}\t{:.1f}\t{}".format(
+            scale, run["profiles"], run["seqs"], wall_secs, run["hits_per_sec"], peak_rss_kb))
+        sys.stdout.flush()
+        if not args.keep:
+            shutil.rmtree(data_dir)
+
+    with open(output, "w") as fp:
+        json.dump(results, fp, indent=2)
+    print("# results written to: {}".format(output))
+
+    if args.baseline:
+        with open(args.baseline, "r") as fp:
+            baseline = json.load(fp)
+        if baseline.get("format") != FORMAT_NAME or baseline.get("params") != results["params"]:
+            print("ERROR: baseline '{}' was not run with the same format and parameters.".format(args.baseline))
+            sys.exit(1)
+        num_regressions = compare(results, baseline, args.tolerance)
+        if num_regressions > 0:
+            print("# {} regression(s) beyond tolerance of {:.0%}.".format(num_regressions, args.tolerance))
+            sys.exit(1)
+        print("# no regressions beyond tolerance of {:.0%}.".format(args.tolerance))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+###############################################################################
+#    - FILE: 	stream_m8.py
+#   BRIEF: 	Stand-in for MMseqs producing .m8 hits into a pipe.
+#           Replays an existing .m8 file into a named FIFO (created if missing),
+#           in batches of lines with a delay between them, so that
+#           `mmoreseqs mmore-search` can be tested reading hits as they arrive:
+#
+#             python scripts/dev/stream_m8.py hits.m8 hits.fifo --delay 0.1 &
+#             mmoreseqs mmore-search target.hmm query.fasta hits.fifo ...
+#
+#           With --run, starts the given mmore-search command itself (its m8
+#           argument should be the FIFO) and reports wall time of producer and
+#           consumer, to check how much of the search overlaps the producer.
+###############################################################################
+
+import os
+import sys
+import time
+import stat
+import argparse
+import subprocess
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Replay .m8 hits into a FIFO, as a stand-in for a running MMseqs search.")
+    parser.add_argument("m8", help=".m8 file to replay")
+    parser.add_argument("fifo", help="named pipe to write to (created if missing)")
+    parser.add_argument("--batch", type=int, default=1,
+                        help="number of lines written at a time [1]")
+    parser.add_argument("--delay", type=float, default=0.0,
+                        help="seconds to wait before each batch [0.0]")
+    parser.add_argument("--run", nargs=argparse.REMAINDER, default=None,
+                        help="consumer command to run against the FIFO (all remaining arguments)")
+    return parser.parse_args()
+
+
+def make_fifo(path):
+    """Create FIFO at <path>, unless one is already there."""
+    if os.path.exists(path):
+        if not stat.S_ISFIFO(os.stat(path).st_mode):
+            print("ERROR: '{}' exists and is not a FIFO.".format(path))
+            sys.exit(1)
+        return False
+    os.mkfifo(path)
+    return True
+
+
+def replay(args):
+    """Write lines of <args.m8> into <args.fifo>, <args.batch> at a time. Blocks until a reader opens the FIFO."""
+    with open(args.m8, "r") as fp:
+        lines = fp.readlines()
+    with open(args.fifo, "w") as out:
+        for i in range(0, len(lines), args.batch):
+            if args.delay > 0:
+                time.sleep(args.delay)
+            out.writelines(lines[i:i + args.batch])
+            out.flush()
+    return len(lines)
+
+
+def main():
+    args = parse_args()
+    is_created = make_fifo(args.fifo)
+
+    try:
+        consumer = None
+        beg = time.time()
+        if args.run:
+            consumer = subprocess.Popen(args.run)
+        num_lines = replay(args)
+        produce_time = time.time() - beg
+        print("# producer: wrote {} lines in {:.3f} sec".format(num_lines, produce_time), file=sys.stderr)
+        if consumer is not None:
+            ret = consumer.wait()
+            total_time = time.time() - beg
+            print("# consumer: exited {} after {:.3f} sec ({:.3f} sec after producer)".format(
+                ret, total_time, total_time - produce_time), file=sys.stderr)
+            sys.exit(ret)
+    finally:
+        if is_created:
+            os.remove(args.fifo)
+
+
+if __name__ == "__main__":
+    main()
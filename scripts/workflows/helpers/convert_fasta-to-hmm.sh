@@ -35,57 +35,27 @@ SCRIPT_DIR=$(GET_SCRIPT_DIR)
 NUM_ARGS=$#
 if (( NUM_ARGS < 2 )); then
 	echo "convert_fasta-to-hmm: Converts file of FASTA sequences to file of single HMM profiles."
-	echo "Usage: <i:fasta_file> <o:hmm_file> | <o:tmp_folder> <hmmbuild_cmd> <splitfile_cmd>"
+	echo "Usage: <i:fasta_file> <o:hmm_file> | <num_threads> <mmoreseqs_cmd>"
 	exit
 fi
 
 # main file args
 INPUT_FILE="$1"
 OUTPUT_FILE="$2"
-TMP_DIR="${3:-"${BENCH_DIR}/tmp_convert/"}"
+NUM_THREADS="${3:-1}"
 
 # external programs/scripts
-HMMBUILD="${4:-"hmmbuild"}"
-SPLIT_FILE="${5:-"${SCRIPT_DIR}/split_fasta.py"}"
+MMORESEQS="${4:-"mmoreseqs"}"
 
 # size of input
 NUM_MODELS=$(grep ">" $INPUT_FILE | wc -l)
 
 echo_v 3 "#  INPUT_- FILE:  $INPUT_FILE"
 echo_v 3 "# OUTPUT_- FILE:  $OUTPUT_FILE"
-echo_v 3 "#  SCRIPT_DIR:  $SCRIPT_DIR"
-echo_v 3 "#     TMP_DIR:  $TMP_DIR"
 echo_v 3 "#  NUM_MODELS:  $NUM_MODELS"
-echo_v 3 "#    HMMBUILD:  $HMMBUILD"
-echo_v 3 "#  SPLIT_- FILE:  $SPLIT_FILE"
-
-mkdir ${TMP_DIR}
-cp ${INPUT_FILE} ${TMP_DIR}/${INPUT_FILE}
-cd ${TMP_DIR}
-
-python ${SPLIT_FILE} ${INPUT_FILE} 1
-touch ${OUTPUT_FILE}
-echo_v 3 "# File split. Begin converting to hmm..."
-
-for (( CNT = 0; CNT < NUM_MODELS; CNT += 1 ))
-do
-	FILE=${INPUT_FILE}.${CNT}
-	echo_v 3 "#   CHILD_- FILE:  $FILE"
-	NAME=$(grep ">" $FILE)
-	NAME=$(echo $NAME | awk '{ print $1 }' | cut -c 2- )
-	echo_v 3 "#         NAME:  $NAME"
-	mv ${FILE} ${NAME}
-	HMM_FILE="${FILE}.hmm"
-	$HMMBUILD --singlemx -o hmmbuild.tmp.out $HMM_FILE $NAME 
-	cat $HMM_FILE >> $OUTPUT_FILE
-	rm $NAME
-	rm $HMM_FILE
-done
+echo_v 3 "# NUM_THREADS:  $NUM_THREADS"
+echo_v 3 "#   MMORESEQS:  $MMORESEQS"
 
+# profiles are built and calibrated by mmoreseqs, in order of input file
+$MMORESEQS fasta-to-hmm "$INPUT_FILE" "$OUTPUT_FILE" --num-threads $NUM_THREADS
 echo_v 3 "# Files converted."
-rm hmmbuild.tmp.out
-rm $INPUT_FILE
-mv $OUTPUT_FILE ../
-cd ../
-rmdir $TMP_DIR
-
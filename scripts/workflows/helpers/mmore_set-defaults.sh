@@ -244,6 +244,8 @@ function SET_ENV_ARG_DEFAULTS
 		RM_TEMP="${DO_RM_TEMP:-0}" 
 		DO_PREP="${DO_PREP:-0}"
 		DO_COPY="${DO_COPY:-1}"
+		DO_DEDUP="${DO_DEDUP:-0}"
+		DO_NATIVE="${DO_NATIVE:-0}"
 		DO_STATS="${DO_STATS:-0}"
 		DO_OVERWRITE="${DO_OVERWRITE:-1}"
 		DO_IGNORE_WARNINGS="${DO_IGNORE_WARNINGS:-1}"
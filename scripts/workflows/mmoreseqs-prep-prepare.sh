@@ -233,6 +233,7 @@ function PREP_PREPARE
 			QUERY_MSA="${TMP_DB}/query.msa"
 			QUERY_HMM="${TMP_DB}/query.hmm"
 			QUERY_FASTA="${TMP_DB}/query.fasta"
+			QUERY_UNIQUE="${TMP_DB}/query.unique.fasta"
 			# mmore db (soft link to main db)
 			QUERY_MMORE="${TMP_MMORE_DB}/query.fasta" 
 			# mmseqs db
@@ -309,14 +310,24 @@ function PREP_PREPARE
 				# search type
 				SEARCH_TYPE="P2S"
 
-				# convert msa to hmm file 
-				echo_v 3 "# TARGET: MSA => HMM"
-				$HMMBUILD "$TARGET_HMM" "$TARGET_MSA" \
+				if [ "$DO_NATIVE" == "1" ]
+				then
+					# convert msa to hmm file and consensus fasta in one pass 
+					echo_v 3 "# TARGET: MSA => HMM, FASTA"
+					$MMORESEQS msa-to-hmm \
+					"$TARGET_MSA" "$TARGET_HMM" "$TARGET_FASTA" \
+					${NUM_THREADS:+--num-threads $NUM_THREADS} \
 
-				# convert hmm to fasta
-				echo_v 3 "# TARGET: HMM => FASTA"
-				$HMMEMIT -c "$TARGET_HMM" > "$TARGET_FASTA"	
-				sed -i 's/-consensus//g' "$TARGET_FASTA"
+				else
+					# convert msa to hmm file 
+					echo_v 3 "# TARGET: MSA => HMM"
+					$HMMBUILD "$TARGET_HMM" "$TARGET_MSA" \
+
+					# convert hmm to fasta
+					echo_v 3 "# TARGET: HMM => FASTA"
+					$HMMEMIT -c "$TARGET_HMM" > "$TARGET_FASTA"	
+					sed -i 's/-consensus//g' "$TARGET_FASTA"
+				fi
 
 				# link hmm to mmore
 				echo_v 3 "# TARGET: HMM => MMORE"
@@ -351,10 +362,15 @@ function PREP_PREPARE
 				# search type
 				SEARCH_TYPE="S2S"
 
-				# convert fasta to hmm
+				# convert fasta to hmm (single-sequence profiles)
 				echo_v 3 "# TARGET: FASTA => HMM"
-				${SCRIPT_DIR}/helpers/convert_fasta-to-hmm.sh \
-				"$TARGET_FASTA" "$TARGET_HMM" "tmp_split" \
+				$MMORESEQS fasta-to-hmm \
+				"$TARGET_FASTA" "$TARGET_HMM" \
+				${NUM_THREADS:+--num-threads $NUM_THREADS} \
+
+				# link hmm to mmore
+				echo_v 3 "# TARGET: HMM => MMORE"
+				$LINK $TARGET_HMM $TARGET_MMORE
 
 				# convert fasta to sequence mmdb 
 				echo_v 3 "# TARGET: FASTA => S_MMDB"
@@ -373,13 +389,22 @@ function PREP_PREPARE
 			# If query is a msa file
 			if [ "$QUERY_IN_TYPE" == "MSA" ]
 			then
-				# convert msa to hmm
-				$HMMBUILD \
-				"$QUERY_HMM" "$QUERY_MSA" \
+				if [ "$DO_NATIVE" == "1" ]
+				then
+					# convert msa to hmm and consensus fasta in one pass
+					$MMORESEQS msa-to-hmm \
+					"$QUERY_MSA" "$QUERY_HMM" "$QUERY_FASTA" \
+					${NUM_THREADS:+--num-threads $NUM_THREADS} \
 
-				# convert hmm to fasta
-				$HMMEMIT -c "$QUERY_HMM" > "$QUERY_FASTA"	
-				sed -i 's/-consensus//g' "$QUERY_FASTA"
+				else
+					# convert msa to hmm
+					$HMMBUILD \
+					"$QUERY_HMM" "$QUERY_MSA" \
+
+					# convert hmm to fasta
+					$HMMEMIT -c "$QUERY_HMM" > "$QUERY_FASTA"	
+					sed -i 's/-consensus//g' "$QUERY_FASTA"
+				fi
 
 				# link fasta to mmore
 				$LINK "$QUERY_FASTA" "$QUERY_MMORE"
@@ -395,6 +420,16 @@ function PREP_PREPARE
 			# if query is a fasta file
 			if [ "$QUERY_IN_TYPE" == "FASTA" ]
 			then
+				# remove duplicate queries, so each is only searched once (map lets search report them all)
+				if [ "$DO_DEDUP" == "1" ]
+				then
+					$MMORESEQS dedup \
+					"$QUERY_FASTA" "$QUERY_UNIQUE" "${QUERY_MMORE}.dupmap"
+					QUERY_FASTA="$QUERY_UNIQUE"
+				else
+					rm -f "${QUERY_MMORE}.dupmap"
+				fi
+
 				# link fasta to mmore
 				$LINK "$QUERY_FASTA" "$QUERY_MMORE"
 				# $COPY "$QUERY_FASTA" "$QUERY_MMORE"
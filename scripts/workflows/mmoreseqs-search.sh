@@ -386,6 +386,14 @@
 
 		# get query database size
 		QUERY_DBSIZE=$( grep "^>" ${QUERY_MMORE} | wc -l )
+		# duplicate queries removed during prep still count towards query database
+		QUERY_DUPMAP="${QUERY_MMORE}.dupmap"
+		DO_DUPMAP=0
+		if [ -f "$QUERY_DUPMAP" ]
+		then
+			DO_DUPMAP=1
+			QUERY_DBSIZE=$(( QUERY_DBSIZE + $( grep -v "^#" ${QUERY_DUPMAP} | wc -l ) ))
+		fi
 		echo_v 3 "      QUERY_DBSIZE: $QUERY_DBSIZE"
 
     # set getting database sizes to true for now.
@@ -676,6 +684,7 @@
 			$(IF_SET_ARGOPT 1 1 --run-domains $MMORE_DO_DOMAIN) \
 			$(IF_SET_ARGOPT 1 2 --dbsizes $TARGET_DBSIZE $QUERY_DBSIZE) \
 			$(IF_SET_ARGOPT $DO_STATS 2 --mmseqs-dbsizes $PREFILTER_DBSIZE $P2S_DBSIZE) \
+			$(IF_SET_ARGOPT $DO_DUPMAP 1 --dupmap $QUERY_DUPMAP) \
 			$(IF_SET_ARGOPT 1 1 --alpha $MMORE_ALPHA) \
 			$(IF_SET_ARGOPT 1 1 --beta $MMORE_BETA) \
 			$(IF_SET_ARGOPT 1 1 --gamma $MMORE_GAMMA) \
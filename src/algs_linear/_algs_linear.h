@@ -10,6 +10,7 @@
 
 #include "bound_fwdbck_linear.h"
 #include "cloud_search_linear.h"
+#include "cloud_search_linear_i16.h"
 #include "fwdback_linear.h"
 #include "pruning_linear.h"
 #include "viterbi_linear.h"
@@ -152,6 +152,9 @@ run_Cloud_Forward_Linear(const SEQUENCE* query,     /* query sequence */
   float hard_limit;
   /* antidiag range for the start/end points in the input viterbi alignment */
   RANGE vit_range;
+  /* anchor path of input alignment, if given */
+  bool is_path;
+  int p_path;
 
   /* in order to approximate the score accurately, we need to know the high score position */
   COORDS coords_max;
@@ -225,6 +228,9 @@ run_Cloud_Forward_Linear(const SEQUENCE* query,     /* query sequence */
   hard_limit = params->hard_limit;
   /* start and end points of input viterbi alignment */
   vit_range = (RANGE){beg->q_0 + beg->t_0, end->q_0 + end->t_0};
+  /* only prune to path if input alignment is a full path (each step moves one or two antidiags) */
+  is_path = (params->path_band >= 0 && 2 * (tr->end - tr->beg) >= vit_range.end - vit_range.beg);
+  p_path = tr->beg;
   /* position of maximum score in cloud */
   coords_innermax = (COORDS){-1, -1};
   coords_max = (COORDS){-1, -1};
@@ -370,6 +376,15 @@ run_Cloud_Forward_Linear(const SEQUENCE* query,     /* query sequence */
     }
 #endif
 
+    /* prune to band around input alignment path */
+    if (is_path == true) {
+      PRUNER_clip_to_path_Linear(tr, params->path_band, d_1, &p_path, lb_vec, rb_vec);
+    }
+    /* prune to cloud of int16 search */
+    if (params->edg_lim != NULL) {
+      PRUNER_clip_to_edgebounds_Linear(params->edg_lim, d_1, lb_vec, rb_vec);
+    }
+
     /* if currently inside viterbi range, update max inner_sc */
     if (d_0 < vit_range.end) {
       inner_max = total_max;
@@ -794,6 +809,9 @@ run_Cloud_Backward_Linear(const SEQUENCE* query,     /* query sequence */
   int gamma;
   float hard_limit;
   RANGE vit_range;
+  /* anchor path of input alignment, if given */
+  bool is_path;
+  int p_path;
 
   /* in order to approximate the score accurately, we need to know the high score position */
   COORDS coords_max;
@@ -869,6 +887,9 @@ run_Cloud_Backward_Linear(const SEQUENCE* query,     /* query sequence */
   hard_limit = params->hard_limit;
   /* antidiag range for the start/end points in the input viterbi alignment */
   vit_range = (RANGE){beg->q_0 + beg->t_0, end->q_0 + end->t_0};
+  /* only prune to path if input alignment is a full path (each step moves one or two antidiags) */
+  is_path = (params->path_band >= 0 && 2 * (tr->end - tr->beg) >= vit_range.end - vit_range.beg);
+  p_path = tr->end;
 
   /* initialize edges and bounds */
   le_0 = 0;
@@ -1007,6 +1028,15 @@ run_Cloud_Backward_Linear(const SEQUENCE* query,     /* query sequence */
     }
 #endif
 
+    /* prune to band around input alignment path */
+    if (is_path == true) {
+      PRUNER_clip_to_path_Linear(tr, params->path_band, d_1, &p_path, lb_vec, rb_vec);
+    }
+    /* prune to cloud of int16 search */
+    if (params->edg_lim != NULL) {
+      PRUNER_clip_to_edgebounds_Linear(params->edg_lim, d_1, lb_vec, rb_vec);
+    }
+
     /* if currently inside viterbi range, update max inner_sc */
     if (d_0 >= vit_range.beg) {
       inner_max = total_max;
@@ -0,0 +1,1104 @@
+/*******************************************************************************
+ *    - FILE:       cloud_search_linear_i16.c
+ *    - DESC:     Reduced-precision Cloud Search prefilter for Forward-Backward Pruning Algorithm
+ *                (Linear Space Alg)
+ *    NOTES:
+ *       - Cloud search only needs to locate the x-drop boundary, not exact Forward values.
+ *         This variant scales scores by <CLOUD_I16_SCALE> and runs max-plus recurrence
+ *         over saturating int16, giving 8 cells per SSE vector (vs 4 for float).
+ *       - Max-plus underestimates the log-sum, so pruning thresholds are widened by the
+ *         <i16_margin> in CLOUD_PARAMS.  Max-plus can fall arbitrarily far below the log-sum
+ *         where many paths merge, so no margin guarantees the edgebounds are a superset of
+ *         the float search; the default margin covers the float cloud on the test set.
+ *       - Output scores are max-plus, so are only lower bounds on the float cloud scores,
+ *         and must not be used for filtering.  Instead, the caller reruns the float search
+ *         pruned to the int16 cloud (see <edg_lim> in CLOUD_PARAMS) for its scores and cloud.
+ *       - If upper end of int16 range is reached, the search reports <is_saturated> and the
+ *         caller should rerun the float cloud search.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+
+/* header */
+#include "_algs_linear.h"
+#include "cloud_search_linear_i16.h"
+
+/* int16 floor and ceiling (floor acts as -INF) */
+#define I16_NEG INT16_MIN
+#define I16_POS INT16_MAX
+/* number of int16 cells per simd vector */
+#define I16_PER_VEC 8
+
+/* access int16 dp matrix (linear space, antidiag-wise) */
+#define MMX16(dx, k) (mx[((MAT_ST * 3) + (dx)) * W + (k)])
+#define IMX16(dx, k) (mx[((INS_ST * 3) + (dx)) * W + (k)])
+#define DMX16(dx, k) (mx[((DEL_ST * 3) + (dx)) * W + (k)])
+/* access int16 transition scores (reversed, indexed by <T - t>) */
+#define TSC16(tr, r) (tsc_rev[(tr)*Wt + (r)])
+/* access int16 emission scores */
+#define MSC16(t, A) (msc[(t)*NUM_AMINO_PLUS_SPEC + (A)])
+#define ISC16(t, A) (isc[(t)*NUM_AMINO_PLUS_SPEC + (A)])
+
+/* private functions */
+static inline int16_t
+I16_Add(const int16_t x, const int16_t y);
+
+static inline int16_t
+I16_Max(const int16_t x, const int16_t y);
+
+static inline int16_t
+I16_FromScore(const float sc);
+
+static inline float
+I16_ToScore(const int sc);
+
+static void
+CLOUD_I16_BuildProfile(const HMM_PROFILE* target,
+                       const int T,
+                       const int Wt,
+                       int16_t* tsc_rev,
+                       int16_t* msc,
+                       int16_t* isc);
+
+static STATUS_FLAG
+PRUNER_I16_edgetrim_by_global_and_diag(const int16_t* mx,
+                                       const int W,
+                                       const int alpha,
+                                       const int beta,
+                                       const int gamma,
+                                       const int hard_limit,
+                                       const RANGE vit_range,
+                                       const int d_1,
+                                       const int d_0,
+                                       const int dx1,
+                                       const int d_cnt,
+                                       int* total_max,
+                                       COORDS* coords_max,
+                                       bool* is_term_flag,
+                                       bool* is_saturated,
+                                       VECTOR_INT* lb_vec[3],
+                                       VECTOR_INT* rb_vec[3]);
+
+/*! FUNCTION: run_Cloud_Forward_Linear_I16()
+ *  SYNOPSIS: Perform Forward part of Cloud Search Algorithm using reduced-precision arithmetic.
+ *  RETURN:   Returns <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Cloud_Forward_Linear_I16(const SEQUENCE* query,     /* query sequence */
+                             const HMM_PROFILE* target, /* target hmm model */
+                             const int Q,               /* query length */
+                             const int T,               /* target length */
+                             MATRIX_I16* i16_MX,        /* int16 work buffers */
+                             const ALIGNMENT* tr,       /* viterbi traceback */
+                             EDGEBOUND_ROWS* rows,      /* temporary edgebounds by-row vector */
+                             EDGEBOUNDS* edg,           /* OUTPUT: edgebounds of cloud search space */
+                             CLOUD_PARAMS* params,      /* pruning parameters */
+                             float* inner_sc,           /* OUTPUT: maximum score inside viterbi bounds */
+                             float* max_sc,             /* OUTPUT: highest score found during search */
+                             bool* is_saturated)        /* OUTPUT: if search saturated int16 range */
+{
+  /* vars for accessing query/target data structs */
+  int A;         /* store int value of character */
+  char* seq;     /* alias for getting seq */
+  int* qA;       /* digitized query sequence */
+
+  /* vars for indexing into data matrices by row-col */
+  int i, j;     /* indices */
+  int q_0;      /* real index of current row (query) */
+  int t_0, t_1; /* real index of current and previous columns (target) */
+  int r_0, r_1; /* reversed index of current and previous columns (target) */
+
+  /* vars for indexing into data matrices by anti-diag */
+  int d_0, d_1, d_2;         /* real index of current and previous antidiagonals */
+  int dx0, dx1, dx2;         /* mod mapping of antidiagonal index into data matrix */
+  int k_0;                   /* offset into antidiagonal */
+  int d_st, d_end, d_cnt;    /* starting and ending diagonal indices */
+  int dim_T, dim_Q;          /* dimensions of submatrix being searched */
+  int dim_min, dim_max;      /* diagonal index where num cells reaches highest point and diminishing point */
+  int num_cells;             /* number of cells in current diagonal */
+
+  /* vars for indexing into edgebound lists */
+  BOUND bnd_new;  /* for adding new bound to edgebound list */
+  int le_0, re_0; /* right/left matrix bounds of current diag */
+  int lb_0, rb_0; /* bounds of current search space on current diag */
+  int lb_2, rb_2; /* bounds of current search space on 2-back diag */
+
+  /* int16 work buffers */
+  int W;            /* width of each antidiag row in dp matrix */
+  int Wt;           /* width of each transition row */
+  int16_t* mx;      /* dp matrix: 3 states x 3 antidiags */
+  int16_t* tsc_rev; /* transition scores */
+  int16_t* msc;     /* match emission scores */
+  int16_t* isc;     /* insert emission scores */
+
+  /* vars for recurrance scores */
+  int16_t prv_M, prv_I, prv_D; /* previous (M) match, (I) insert, (D) delete states */
+  int16_t prv_B;               /* previous (B) begin state */
+  int16_t prv_sum;             /* temp subtotaling vars */
+
+  /* vars for traceback */
+  TRACE* beg; /* beginning of the alignment */
+  TRACE* end; /* end of the alignment */
+
+  /* vars for pruning */
+  bool is_term_flag;          /* termination flag for end of search */
+  int inner_max, total_max;   /* maximum score found in matrix (scaled) */
+  VECTOR_INT* lb_vec[3];      /* left bound list for previous 3 antdiags */
+  VECTOR_INT* rb_vec[3];      /* right bound list for previous 3 antidiags */
+  VECTOR_INT* lb_vec_tmp;     /* left swap pointer */
+  VECTOR_INT* rb_vec_tmp;     /* right swap pointer */
+  float total_sc, inner_sc_0; /* unscaled scores */
+
+  /* pruning parameters (scaled) */
+  int alpha;
+  int beta;
+  int gamma;
+  int hard_limit;
+  /* antidiag range for the start/end points in the input viterbi alignment */
+  RANGE vit_range;
+  /* anchor path of input alignment, if given */
+  bool is_path;
+  int p_path;
+
+  /* in order to approximate the score accurately, we need to know the high score position */
+  COORDS coords_max;
+  COORDS coords_innermax;
+
+  /* query sequence */
+  seq = query->seq;
+  *is_saturated = false;
+
+  /* get start and end points of viterbi alignment */
+  beg = &(tr->traces->data[tr->beg]);
+  end = &(tr->traces->data[tr->end]);
+
+  /* get pruning parameters: loosened by margin, then scaled */
+  alpha = (int)((params->alpha + params->i16_margin) * CLOUD_I16_SCALE);
+  beta = (int)((params->beta + params->i16_margin) * CLOUD_I16_SCALE);
+  gamma = params->gamma;
+  hard_limit = (int)((params->hard_limit - params->i16_margin) * CLOUD_I16_SCALE);
+  /* start and end points of input viterbi alignment */
+  vit_range = (RANGE){beg->q_0 + beg->t_0, end->q_0 + end->t_0};
+  /* only prune to path if input alignment is a full path (each step moves one or two antidiags) */
+  is_path = (params->path_band >= 0 && 2 * (tr->end - tr->beg) >= vit_range.end - vit_range.beg);
+  p_path = tr->beg;
+  /* position of maximum score in cloud */
+  coords_innermax = (COORDS){-1, -1};
+  coords_max = (COORDS){-1, -1};
+
+  /* set edgebound dimensions and orientation */
+  EDGEBOUNDS_Reuse(edg, Q, T);
+#if (CLOUD_METHOD == CLOUD_DIAGS)
+  {
+    edg->edg_mode = EDG_DIAG;
+  }
+#elif (CLOUD_METHOD == CLOUD_ROWS)
+  {
+    EDGEBOUND_ROWS_Reuse(rows, Q, T, (RANGE){0, Q});
+    edg->edg_mode = EDG_ROW;
+  }
+#endif
+
+  /* verify that starting points are valid */
+  if (beg->q_0 < 0 || beg->q_0 > Q || beg->t_0 < 0 || beg->t_0 > T) {
+    fprintf(stderr, "# ERROR: Invalid start points for Cloud Forward Search: BEG(%d,%d) -> END(%d,%d)\n", beg->q_0, beg->t_0, end->q_0, end->t_0);
+    fprintf(stderr, "# Query Length: %d, Target Length: %d\n", Q, T);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  /* We don't want to start on the edge and risk out-of-bounds (go to next match state) */
+  if (beg->q_0 == 0 || beg->t_0 == 0) {
+    beg->q_0 += 1;
+    beg->t_0 += 1;
+  }
+
+  /* size work buffers (matrix is cleared to int16 floor) */
+  MATRIX_I16_Reuse(i16_MX, Q, T);
+  W = i16_MX->W;
+  Wt = i16_MX->Wt;
+  mx = i16_MX->mx;
+  tsc_rev = i16_MX->tsc_rev;
+  msc = i16_MX->msc;
+  isc = i16_MX->isc;
+  qA = i16_MX->qA->data;
+  for (i = 0; i < 3; i++) {
+    lb_vec[i] = i16_MX->lb_vec[i];
+    rb_vec[i] = i16_MX->rb_vec[i];
+  }
+  /* scale profile and digitize query */
+  CLOUD_I16_BuildProfile(target, T, Wt, tsc_rev, msc, isc);
+  /* NOTE: unmapped symbols (incl. terminator at <Q>) are scored as AMINO_X, not off the end of the profile row */
+  for (q_0 = 0; q_0 <= Q; q_0++) {
+    qA[q_0] = AA_REV[(int)seq[q_0]];
+    if (qA[q_0] < 0) {
+      qA[q_0] = AMINO_X;
+    }
+  }
+
+  /* dimension of submatrix */
+  dim_Q = Q - beg->q_0;
+  dim_T = T - beg->t_0;
+
+  /* diag index of different start points, creating submatrix */
+  d_st = beg->q_0 + beg->t_0;
+  d_end = Q + T;
+
+  /* diag index where num cells reaches highest point and begins diminishing */
+  dim_min = MIN(d_st + dim_Q, d_st + dim_T);
+  dim_max = MAX(d_st + dim_Q, d_st + dim_T);
+
+  /* set bounds of starting cell */
+  lb_0 = beg->q_0;
+  rb_0 = beg->q_0;
+  VECTOR_INT_Pushback(lb_vec[1], lb_0);
+  VECTOR_INT_Pushback(rb_vec[1], rb_0);
+  num_cells = 0;
+
+  is_term_flag = false;
+  total_max = I16_NEG;
+  inner_max = I16_NEG;
+  d_cnt = 0;
+
+  /* begin state is free at start of alignment */
+  prv_B = 0;
+
+  /* ITERATE THROUGH ANTI-DIAGONALS */
+  for (d_0 = d_st; d_0 <= d_end + 1; d_0++, d_cnt++) {
+    d_1 = d_0 - 1;
+    d_2 = d_0 - 2;
+    dx0 = d_0 % 3;
+    dx1 = d_1 % 3;
+    dx2 = d_2 % 3;
+
+    /* is dp matrix diagonal growing or shrinking? */
+    if (d_0 <= dim_min) {
+      num_cells++;
+    }
+    if (d_0 > dim_max) {
+      num_cells--;
+    }
+
+    /* Edgecheck updates: determine antidiag indices within matrix bounds */
+    le_0 = MAX(beg->q_0, d_0 - T);
+    re_0 = le_0 + num_cells;
+
+    /* prune bounds using local and global x-drop, edgetrimming or terminating search */
+    PRUNER_I16_edgetrim_by_global_and_diag(
+        mx, W, alpha, beta, gamma, hard_limit, vit_range, d_1, d_0, dx1, d_cnt,
+        &total_max, &coords_max, &is_term_flag, is_saturated, lb_vec, rb_vec);
+
+    /* if int16 range overflowed, results are not trustworthy */
+    if (*is_saturated == true) {
+      break;
+    }
+
+    /* prune to band around input alignment path */
+    if (is_path == true) {
+      PRUNER_clip_to_path_Linear(tr, params->path_band, d_1, &p_path, lb_vec, rb_vec);
+    }
+
+    /* if currently inside viterbi range, update max inner_sc */
+    if (d_0 < vit_range.end) {
+      inner_max = total_max;
+      coords_innermax = coords_max;
+    }
+
+    /* Add pruned bounds to edgebound list */
+    for (i = 0; i < lb_vec[0]->N; i++) {
+      lb_0 = VEC_X(lb_vec[0], i);
+      rb_0 = VEC_X(rb_vec[0], i) + 1;
+      lb_0 = MAX(lb_0, le_0);
+      rb_0 = MIN(rb_0, re_0);
+      VEC_X(lb_vec[0], i) = lb_0;
+      VEC_X(rb_vec[0], i) = rb_0;
+
+      bnd_new = (BOUND){d_0, lb_0, rb_0};
+#if (CLOUD_METHOD == CLOUD_DIAGS)
+      {
+        EDGEBOUNDS_Pushback(edg, bnd_new);
+      }
+#elif (CLOUD_METHOD == CLOUD_ROWS)
+      {
+        EDGEBOUND_ROWS_IntegrateDiag_Fwd(rows, &bnd_new);
+      }
+#endif
+    }
+
+    /* If diagonal set is empty, then all branches have been pruned, so we're done */
+    if (lb_vec[0]->N <= 0) {
+      break;
+    }
+
+    /* MAIN RECURSION */
+    for (i = 0; i < lb_vec[0]->N; i++) {
+      lb_0 = VEC_X(lb_vec[0], i);
+      rb_0 = VEC_X(rb_vec[0], i);
+      k_0 = lb_0;
+
+/* vectorized: <I16_PER_VEC> cells at a time */
+#if (SIMD_METHOD == SIMD_SSE)
+      {
+        __m128i v_prv, v_M, v_I, v_D, v_B;
+        int16_t e_M[I16_PER_VEC], e_I[I16_PER_VEC];
+
+        v_B = _mm_set1_epi16(prv_B);
+        for (; k_0 + I16_PER_VEC <= rb_0; k_0 += I16_PER_VEC) {
+          /* gather emissions: (q,t) moves (+1,-1) per lane */
+          for (j = 0; j < I16_PER_VEC; j++) {
+            t_0 = d_0 - (k_0 + j);
+            A = qA[k_0 + j];
+            e_M[j] = MSC16(t_0, A);
+            e_I[j] = ISC16(t_0, A);
+          }
+          /* transitions are stored reversed, so lanes are contiguous */
+          r_0 = T - (d_0 - k_0);
+          r_1 = r_0 + 1;
+
+          /* match: from (q-1,t-1) <=> (d-2,k-1) */
+          v_prv = _mm_max_epi16(
+              _mm_adds_epi16(_mm_loadu_si128((__m128i*)&MMX16(dx2, k_0 - 1)), _mm_loadu_si128((__m128i*)&TSC16(M2M, r_1))),
+              _mm_adds_epi16(_mm_loadu_si128((__m128i*)&IMX16(dx2, k_0 - 1)), _mm_loadu_si128((__m128i*)&TSC16(I2M, r_1))));
+          v_prv = _mm_max_epi16(v_prv,
+                                _mm_adds_epi16(_mm_loadu_si128((__m128i*)&DMX16(dx2, k_0 - 1)), _mm_loadu_si128((__m128i*)&TSC16(D2M, r_1))));
+          v_prv = _mm_max_epi16(v_prv, v_B);
+          v_M = _mm_adds_epi16(v_prv, _mm_loadu_si128((__m128i*)e_M));
+
+          /* insert: from (q-1,t) <=> (d-1,k-1) */
+          v_prv = _mm_max_epi16(
+              _mm_adds_epi16(_mm_loadu_si128((__m128i*)&MMX16(dx1, k_0 - 1)), _mm_loadu_si128((__m128i*)&TSC16(M2I, r_0))),
+              _mm_adds_epi16(_mm_loadu_si128((__m128i*)&IMX16(dx1, k_0 - 1)), _mm_loadu_si128((__m128i*)&TSC16(I2I, r_0))));
+          v_I = _mm_adds_epi16(v_prv, _mm_loadu_si128((__m128i*)e_I));
+
+          /* delete: from (q,t-1) <=> (d-1,k) */
+          v_D = _mm_max_epi16(
+              _mm_adds_epi16(_mm_loadu_si128((__m128i*)&MMX16(dx1, k_0)), _mm_loadu_si128((__m128i*)&TSC16(M2D, r_1))),
+              _mm_adds_epi16(_mm_loadu_si128((__m128i*)&DMX16(dx1, k_0)), _mm_loadu_si128((__m128i*)&TSC16(D2D, r_1))));
+
+          _mm_storeu_si128((__m128i*)&MMX16(dx0, k_0), v_M);
+          _mm_storeu_si128((__m128i*)&IMX16(dx0, k_0), v_I);
+          _mm_storeu_si128((__m128i*)&DMX16(dx0, k_0), v_D);
+        }
+      }
+#endif
+
+      /* remaining cells in range */
+      for (; k_0 < rb_0; k_0++) {
+        t_0 = d_0 - k_0;
+        A = qA[k_0];
+        r_0 = T - t_0;
+        r_1 = r_0 + 1;
+
+        /* match: from (q-1,t-1) <=> (d-2,k-1) */
+        prv_M = I16_Add(MMX16(dx2, k_0 - 1), TSC16(M2M, r_1));
+        prv_I = I16_Add(IMX16(dx2, k_0 - 1), TSC16(I2M, r_1));
+        prv_D = I16_Add(DMX16(dx2, k_0 - 1), TSC16(D2M, r_1));
+        prv_sum = I16_Max(I16_Max(prv_M, prv_I), I16_Max(prv_D, prv_B));
+        MMX16(dx0, k_0) = I16_Add(prv_sum, MSC16(t_0, A));
+
+        /* insert: from (q-1,t) <=> (d-1,k-1) */
+        prv_M = I16_Add(MMX16(dx1, k_0 - 1), TSC16(M2I, r_0));
+        prv_I = I16_Add(IMX16(dx1, k_0 - 1), TSC16(I2I, r_0));
+        IMX16(dx0, k_0) = I16_Add(I16_Max(prv_M, prv_I), ISC16(t_0, A));
+
+        /* delete: from (q,t-1) <=> (d-1,k) */
+        prv_M = I16_Add(MMX16(dx1, k_0), TSC16(M2D, r_1));
+        prv_D = I16_Add(DMX16(dx1, k_0), TSC16(D2D, r_1));
+        DMX16(dx0, k_0) = I16_Max(prv_M, prv_D);
+      }
+    }
+
+    /* Scrub values from 2-back bound data */
+    for (i = 0; i < lb_vec[2]->N; i++) {
+      lb_2 = VEC_X(lb_vec[2], i);
+      rb_2 = VEC_X(rb_vec[2], i);
+      for (k_0 = lb_2; k_0 < rb_2; k_0++) {
+        MMX16(dx2, k_0) = IMX16(dx2, k_0) = DMX16(dx2, k_0) = I16_NEG;
+      }
+    }
+
+    /* Shift bounds */
+    lb_vec_tmp = lb_vec[2];
+    rb_vec_tmp = rb_vec[2];
+    lb_vec[2] = lb_vec[1];
+    rb_vec[2] = rb_vec[1];
+    lb_vec[1] = lb_vec[0];
+    rb_vec[1] = rb_vec[0];
+    lb_vec[0] = lb_vec_tmp;
+    rb_vec[0] = rb_vec_tmp;
+    VECTOR_INT_Reuse(lb_vec[0]);
+    VECTOR_INT_Reuse(rb_vec[0]);
+
+    /* disallow starting new alignments after first pass */
+    prv_B = I16_NEG;
+
+    if (is_term_flag == true) {
+      break;
+    }
+  }
+
+#if (CLOUD_METHOD == CLOUD_ROWS)
+  {
+    EDGEBOUND_ROWS_Convert(rows, edg);
+  }
+#endif
+
+  /* bound lists are rotated during search, so return them to work buffers */
+  for (i = 0; i < 3; i++) {
+    i16_MX->lb_vec[i] = lb_vec[i];
+    i16_MX->rb_vec[i] = rb_vec[i];
+  }
+
+  /* unscale scores */
+  total_sc = I16_ToScore(total_max);
+  inner_sc_0 = I16_ToScore(inner_max);
+
+  /* score correction: same as float cloud search */
+  {
+    float presc, postsc;
+
+    /* pre-core model: S->N->...->N->B->(M */
+    presc = 0.0f;
+    for (q_0 = 1; q_0 < beg->q_0; q_0++) {
+      presc += XSC(SP_N, SP_LOOP);
+    }
+    t_1 = beg->t_0 - 1;
+    presc = MATH_LogProd(presc, TSC(t_1, B2M));
+    total_sc = MATH_LogProd(total_sc, presc);
+    inner_sc_0 = MATH_LogProd(inner_sc_0, presc);
+
+    /* post-core model: M)->E->C->...->C->T */
+    postsc = XSC(SP_E, SP_MOVE);
+    for (q_0 = coords_max.q_0; q_0 <= Q; q_0++) {
+      postsc = MATH_LogProd(postsc, XSC(SP_C, SP_LOOP));
+    }
+    postsc = MATH_LogProd(postsc, XSC(SP_C, SP_MOVE));
+    total_sc = MATH_LogProd(total_sc, postsc);
+
+    postsc = XSC(SP_E, SP_MOVE);
+    for (q_0 = coords_innermax.q_0; q_0 <= Q; q_0++) {
+      postsc = MATH_LogProd(postsc, XSC(SP_C, SP_LOOP));
+    }
+    postsc = MATH_LogProd(postsc, XSC(SP_C, SP_MOVE));
+    inner_sc_0 = MATH_LogProd(inner_sc_0, postsc);
+  }
+
+  *max_sc = total_sc;
+  *inner_sc = inner_sc_0;
+
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION: run_Cloud_Backward_Linear_I16()
+ *  SYNOPSIS: Perform Backward part of Cloud Search Algorithm using reduced-precision arithmetic.
+ *  RETURN:   Returns <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Cloud_Backward_Linear_I16(const SEQUENCE* query,     /* query sequence */
+                              const HMM_PROFILE* target, /* target hmm model */
+                              const int Q,               /* query length */
+                              const int T,               /* target length */
+                              MATRIX_I16* i16_MX,        /* int16 work buffers */
+                              const ALIGNMENT* tr,       /* viterbi traceback */
+                              EDGEBOUND_ROWS* rows,      /* temporary edgebounds by-row vector */
+                              EDGEBOUNDS* edg,           /* OUTPUT: edgebounds of cloud search space */
+                              CLOUD_PARAMS* params,      /* pruning parameters */
+                              float* inner_sc,           /* OUTPUT: maximum score inside viterbi bounds */
+                              float* max_sc,             /* OUTPUT: highest score found during search */
+                              bool* is_saturated)        /* OUTPUT: if search saturated int16 range */
+{
+  /* vars for accessing query/target data structs */
+  int A;         /* store int value of character */
+  char* seq;     /* alias for getting seq */
+  int* qA;       /* digitized query sequence */
+
+  /* vars for indexing into data matrices by row-col */
+  int i, j;     /* indices */
+  int q_0;      /* real index of current row (query) */
+  int t_0, t_1; /* real index of current and next columns (target) */
+  int r_0;      /* reversed index of current column (target) */
+
+  /* vars for indexing into data matrices by anti-diag */
+  int d_0, d_1, d_2;         /* real index of current and previous antidiagonals */
+  int dx0, dx1, dx2;         /* mod mapping of antidiagonal index into data matrix */
+  int k_0;                   /* offset into antidiagonal */
+  int d_st, d_end, d_cnt;    /* starting and ending diagonal indices */
+  int dim_T, dim_Q;          /* dimensions of submatrix being searched */
+  int dim_min, dim_max;      /* diagonal index where num cells reaches highest point and diminishing point */
+  int num_cells;             /* number of cells in current diagonal */
+
+  /* vars for indexing into edgebound lists */
+  BOUND bnd_new;  /* for adding new bound to edgebound list */
+  int le_0, re_0; /* right/left matrix bounds of current diag */
+  int lb_0, rb_0; /* bounds of current search space on current diag */
+  int lb_2, rb_2; /* bounds of current search space on 2-back diag */
+
+  /* int16 work buffers */
+  int W;            /* width of each antidiag row in dp matrix */
+  int Wt;           /* width of each transition row */
+  int16_t* mx;      /* dp matrix: 3 states x 3 antidiags */
+  int16_t* tsc_rev; /* transition scores */
+  int16_t* msc;     /* match emission scores */
+  int16_t* isc;     /* insert emission scores */
+
+  /* vars for recurrance scores */
+  int16_t prv_M, prv_I, prv_D; /* previous (M) match, (I) insert, (D) delete states */
+  int16_t prv_E;               /* previous (E) end state */
+  int16_t sc_M, sc_I;          /* match and insert emissions */
+
+  /* vars for traceback */
+  TRACE* beg; /* beginning of the alignment */
+  TRACE* end; /* end of the alignment */
+
+  /* vars for pruning */
+  bool is_term_flag;          /* termination flag for end of search */
+  int inner_max, total_max;   /* maximum score found in matrix (scaled) */
+  VECTOR_INT* lb_vec[3];      /* left bound list for previous 3 antdiags */
+  VECTOR_INT* rb_vec[3];      /* right bound list for previous 3 antidiags */
+  VECTOR_INT* lb_vec_tmp;     /* left swap pointer */
+  VECTOR_INT* rb_vec_tmp;     /* right swap pointer */
+  float total_sc, inner_sc_0; /* unscaled scores */
+
+  /* pruning parameters (scaled) */
+  int alpha;
+  int beta;
+  int gamma;
+  int hard_limit;
+  RANGE vit_range;
+  /* anchor path of input alignment, if given */
+  bool is_path;
+  int p_path;
+
+  /* in order to approximate the score accurately, we need to know the high score position */
+  COORDS coords_max;
+  COORDS coords_innermax;
+
+  /* query sequence */
+  seq = query->seq;
+  *is_saturated = false;
+
+  /* get start and end points of viterbi alignment */
+  beg = &(tr->traces->data[tr->beg]);
+  end = &(tr->traces->data[tr->end]);
+
+  /* get pruning parameters: loosened by margin, then scaled */
+  alpha = (int)((params->alpha + params->i16_margin) * CLOUD_I16_SCALE);
+  beta = (int)((params->beta + params->i16_margin) * CLOUD_I16_SCALE);
+  gamma = params->gamma;
+  hard_limit = (int)((params->hard_limit - params->i16_margin) * CLOUD_I16_SCALE);
+  vit_range = (RANGE){beg->q_0 + beg->t_0, end->q_0 + end->t_0};
+  /* only prune to path if input alignment is a full path (each step moves one or two antidiags) */
+  is_path = (params->path_band >= 0 && 2 * (tr->end - tr->beg) >= vit_range.end - vit_range.beg);
+  p_path = tr->end;
+  coords_innermax = (COORDS){-1, -1};
+  coords_max = (COORDS){-1, -1};
+
+  /* set edgebound dimensions and orientation */
+  EDGEBOUNDS_Reuse(edg, Q, T);
+#if (CLOUD_METHOD == CLOUD_DIAGS)
+  {
+    edg->edg_mode = EDG_DIAG;
+  }
+#elif (CLOUD_METHOD == CLOUD_ROWS)
+  {
+    EDGEBOUND_ROWS_Reuse(rows, Q, T, (RANGE){0, Q});
+    edg->edg_mode = EDG_ROW;
+  }
+#endif
+
+  /* verify that starting points are valid */
+  if (end->q_0 < 0 || end->q_0 > Q || end->t_0 < 0 || end->t_0 > T) {
+    fprintf(stderr, "# ERROR: Invalid start points for Cloud Backward Search: BEG(%d,%d) -> END(%d,%d)\n", beg->q_0, beg->t_0, end->q_0, end->t_0);
+    fprintf(stderr, "# Query Length: %d, Target Length: %d\n", Q, T);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  /* We don't want to start on the edge and risk out-of-bounds (go to next match state) */
+  if (end->q_0 == Q || end->t_0 == T) {
+    end->q_0 -= 1;
+    end->t_0 -= 1;
+  }
+
+  /* size work buffers (matrix is cleared to int16 floor) */
+  MATRIX_I16_Reuse(i16_MX, Q, T);
+  W = i16_MX->W;
+  Wt = i16_MX->Wt;
+  mx = i16_MX->mx;
+  tsc_rev = i16_MX->tsc_rev;
+  msc = i16_MX->msc;
+  isc = i16_MX->isc;
+  qA = i16_MX->qA->data;
+  for (i = 0; i < 3; i++) {
+    lb_vec[i] = i16_MX->lb_vec[i];
+    rb_vec[i] = i16_MX->rb_vec[i];
+  }
+  /* scale profile and digitize query */
+  CLOUD_I16_BuildProfile(target, T, Wt, tsc_rev, msc, isc);
+  /* NOTE: unmapped symbols (incl. terminator at <Q>) are scored as AMINO_X, not off the end of the profile row */
+  for (q_0 = 0; q_0 <= Q; q_0++) {
+    qA[q_0] = AA_REV[(int)seq[q_0]];
+    if (qA[q_0] < 0) {
+      qA[q_0] = AMINO_X;
+    }
+  }
+
+  /* dimension of submatrix */
+  dim_Q = end->q_0;
+  dim_T = end->t_0;
+
+  /* diag index of different start points, creating submatrix */
+  d_st = 0;
+  d_end = end->q_0 + end->t_0;
+
+  /* diag index where num cells reaches highest point and begins diminishing */
+  dim_min = MIN(dim_T, dim_Q);
+  dim_max = MAX(dim_T, dim_Q);
+
+  /* set bounds of starting cell */
+  lb_0 = end->q_0;
+  rb_0 = end->q_0 + 1;
+  VECTOR_INT_Pushback(lb_vec[1], lb_0);
+  VECTOR_INT_Pushback(rb_vec[1], rb_0);
+  num_cells = 0;
+
+  is_term_flag = false;
+  total_max = I16_NEG;
+  inner_max = I16_NEG;
+  d_cnt = 0;
+
+  /* end state is free at end of alignment */
+  prv_E = 0;
+
+  /* ITERATE THROUGH ANTI-DIAGONALS */
+  for (d_0 = d_end; d_0 >= d_st; d_0--, d_cnt++) {
+    d_1 = d_0 + 1;
+    d_2 = d_0 + 2;
+    dx0 = d_0 % 3;
+    dx1 = d_1 % 3;
+    dx2 = d_2 % 3;
+
+    /* Is dp matrix diagonal growing or shrinking? */
+    if (d_0 >= dim_max) {
+      num_cells++;
+    }
+    if (d_0 < dim_min) {
+      num_cells--;
+    }
+
+    /* Edgecheck updates: determine antidiag indices within matrix bounds */
+    le_0 = MAX(end->q_0 - (d_end - d_0), 0);
+    re_0 = le_0 + num_cells;
+
+    /* prune bounds using local and global x-drop, edgetrimming or terminating search */
+    PRUNER_I16_edgetrim_by_global_and_diag(
+        mx, W, alpha, beta, gamma, hard_limit, vit_range, d_1, d_0, dx1, d_cnt,
+        &total_max, &coords_max, &is_term_flag, is_saturated, lb_vec, rb_vec);
+
+    /* if int16 range overflowed, results are not trustworthy */
+    if (*is_saturated == true) {
+      break;
+    }
+
+    /* prune to band around input alignment path */
+    if (is_path == true) {
+      PRUNER_clip_to_path_Linear(tr, params->path_band, d_1, &p_path, lb_vec, rb_vec);
+    }
+
+    /* if currently inside viterbi range, update max inner_sc */
+    if (d_0 >= vit_range.beg) {
+      inner_max = total_max;
+      coords_innermax = coords_max;
+    }
+
+    /* Add pruned bounds to edgebound list */
+    for (i = 0; i < lb_vec[0]->N; i++) {
+      lb_0 = VEC_X(lb_vec[0], i) - 1;
+      rb_0 = VEC_X(rb_vec[0], i);
+      lb_0 = MAX(lb_0, le_0);
+      rb_0 = MIN(rb_0, re_0);
+      /* zeroth row (when d_0 == k_0) is not a valid state in backward. */
+      rb_0 = MIN(rb_0, d_0);
+      VEC_X(lb_vec[0], i) = lb_0;
+      VEC_X(rb_vec[0], i) = rb_0;
+
+      bnd_new = (BOUND){d_0, lb_0, rb_0};
+#if (CLOUD_METHOD == CLOUD_DIAGS)
+      {
+        EDGEBOUNDS_Pushback(edg, bnd_new);
+      }
+#elif (CLOUD_METHOD == CLOUD_ROWS)
+      {
+        EDGEBOUND_ROWS_IntegrateDiag_Bck(rows, &bnd_new);
+      }
+#endif
+    }
+
+    /* If diagonal set is empty, then all branches have been pruned, so we're done */
+    if (lb_vec[0]->N <= 0) {
+      break;
+    }
+
+    /* MAIN RECURSION */
+    for (i = 0; i < lb_vec[0]->N; i++) {
+      lb_0 = VEC_X(lb_vec[0], i);
+      rb_0 = VEC_X(rb_vec[0], i);
+      k_0 = lb_0;
+
+/* vectorized: <I16_PER_VEC> cells at a time */
+#if (SIMD_METHOD == SIMD_SSE)
+      {
+        __m128i v_prv, v_M, v_I, v_D, v_E, v_eM, v_eI, v_M2, v_I1, v_D1;
+        int16_t e_M[I16_PER_VEC], e_I[I16_PER_VEC];
+
+        v_E = _mm_set1_epi16(prv_E);
+        for (; k_0 + I16_PER_VEC <= rb_0; k_0 += I16_PER_VEC) {
+          /* gather emissions from next column: (q,t+1) */
+          for (j = 0; j < I16_PER_VEC; j++) {
+            t_1 = d_0 - (k_0 + j) + 1;
+            A = qA[k_0 + j];
+            e_M[j] = MSC16(t_1, A);
+            e_I[j] = ISC16(t_1, A);
+          }
+          v_eM = _mm_loadu_si128((__m128i*)e_M);
+          v_eI = _mm_loadu_si128((__m128i*)e_I);
+          r_0 = T - (d_0 - k_0);
+
+          /* (q+1,t+1) <=> (d+2,k+1), (q+1,t) <=> (d+1,k+1), (q,t+1) <=> (d+1,k) */
+          v_M2 = _mm_adds_epi16(_mm_loadu_si128((__m128i*)&MMX16(dx2, k_0 + 1)), v_eM);
+          v_I1 = _mm_adds_epi16(_mm_loadu_si128((__m128i*)&IMX16(dx1, k_0 + 1)), v_eI);
+          v_D1 = _mm_loadu_si128((__m128i*)&DMX16(dx1, k_0));
+
+          /* match */
+          v_prv = _mm_max_epi16(
+              _mm_adds_epi16(v_M2, _mm_loadu_si128((__m128i*)&TSC16(M2M, r_0))),
+              _mm_adds_epi16(v_I1, _mm_loadu_si128((__m128i*)&TSC16(M2I, r_0))));
+          v_prv = _mm_max_epi16(v_prv, _mm_adds_epi16(v_D1, _mm_loadu_si128((__m128i*)&TSC16(M2D, r_0))));
+          v_M = _mm_max_epi16(v_prv, v_E);
+
+          /* insert */
+          v_I = _mm_max_epi16(
+              _mm_adds_epi16(v_M2, _mm_loadu_si128((__m128i*)&TSC16(I2M, r_0))),
+              _mm_adds_epi16(v_I1, _mm_loadu_si128((__m128i*)&TSC16(I2I, r_0))));
+
+          /* delete */
+          v_prv = _mm_max_epi16(
+              _mm_adds_epi16(v_M2, _mm_loadu_si128((__m128i*)&TSC16(D2M, r_0))),
+              _mm_adds_epi16(v_D1, _mm_loadu_si128((__m128i*)&TSC16(D2D, r_0))));
+          v_D = _mm_max_epi16(v_prv, v_E);
+
+          _mm_storeu_si128((__m128i*)&MMX16(dx0, k_0), v_M);
+          _mm_storeu_si128((__m128i*)&IMX16(dx0, k_0), v_I);
+          _mm_storeu_si128((__m128i*)&DMX16(dx0, k_0), v_D);
+        }
+      }
+#endif
+
+      /* remaining cells in range */
+      for (; k_0 < rb_0; k_0++) {
+        t_0 = d_0 - k_0;
+        t_1 = t_0 + 1;
+        A = qA[k_0];
+        r_0 = T - t_0;
+
+        sc_M = MSC16(t_1, A);
+        sc_I = ISC16(t_1, A);
+
+        /* match */
+        prv_M = I16_Add(I16_Add(MMX16(dx2, k_0 + 1), sc_M), TSC16(M2M, r_0));
+        prv_I = I16_Add(I16_Add(IMX16(dx1, k_0 + 1), sc_I), TSC16(M2I, r_0));
+        prv_D = I16_Add(DMX16(dx1, k_0), TSC16(M2D, r_0));
+        MMX16(dx0, k_0) = I16_Max(I16_Max(prv_M, prv_I), I16_Max(prv_D, prv_E));
+
+        /* insert */
+        prv_M = I16_Add(I16_Add(MMX16(dx2, k_0 + 1), sc_M), TSC16(I2M, r_0));
+        prv_I = I16_Add(I16_Add(IMX16(dx1, k_0 + 1), sc_I), TSC16(I2I, r_0));
+        IMX16(dx0, k_0) = I16_Max(prv_M, prv_I);
+
+        /* delete */
+        prv_M = I16_Add(I16_Add(MMX16(dx2, k_0 + 1), sc_M), TSC16(D2M, r_0));
+        prv_D = I16_Add(DMX16(dx1, k_0), TSC16(D2D, r_0));
+        DMX16(dx0, k_0) = I16_Max(I16_Max(prv_M, prv_D), prv_E);
+      }
+    }
+
+    /* Scrub 2-back bound data */
+    for (i = 0; i < lb_vec[2]->N; i++) {
+      lb_2 = VEC_X(lb_vec[2], i);
+      rb_2 = VEC_X(rb_vec[2], i);
+      for (k_0 = lb_2; k_0 < rb_2; k_0++) {
+        MMX16(dx2, k_0) = IMX16(dx2, k_0) = DMX16(dx2, k_0) = I16_NEG;
+      }
+    }
+
+    /* Shift bounds */
+    lb_vec_tmp = lb_vec[2];
+    rb_vec_tmp = rb_vec[2];
+    lb_vec[2] = lb_vec[1];
+    rb_vec[2] = rb_vec[1];
+    lb_vec[1] = lb_vec[0];
+    rb_vec[1] = rb_vec[0];
+    lb_vec[0] = lb_vec_tmp;
+    rb_vec[0] = rb_vec_tmp;
+    VECTOR_INT_Reuse(lb_vec[0]);
+    VECTOR_INT_Reuse(rb_vec[0]);
+
+    /* disallow ending alignments after first pass */
+    prv_E = I16_NEG;
+
+    if (is_term_flag == true) {
+      break;
+    }
+  }
+
+  /* reverse order of diagonals */
+  EDGEBOUNDS_Reverse(edg);
+
+#if (CLOUD_METHOD == CLOUD_ROWS)
+  {
+    EDGEBOUND_ROWS_Convert(rows, edg);
+  }
+#endif
+
+  /* bound lists are rotated during search, so return them to work buffers */
+  for (i = 0; i < 3; i++) {
+    i16_MX->lb_vec[i] = lb_vec[i];
+    i16_MX->rb_vec[i] = rb_vec[i];
+  }
+
+  /* unscale scores */
+  total_sc = I16_ToScore(total_max);
+  inner_sc_0 = I16_ToScore(inner_max);
+
+  /* score correction: same as float cloud search */
+  {
+    float presc, postsc;
+
+    /* pre-core model: S->N->...->N->B->(M */
+    t_1 = beg->t_0 - 1;
+    presc = 0.0f;
+    for (q_0 = 1; q_0 < coords_max.q_0; q_0++) {
+      presc = MATH_LogProd(presc, XSC(SP_N, SP_LOOP));
+    }
+    presc = MATH_LogProd(presc, TSC(t_1, B2M));
+    total_sc = MATH_LogProd(total_sc, presc);
+
+    presc = 0.0f;
+    for (q_0 = 1; q_0 < coords_innermax.q_0; q_0++) {
+      presc = MATH_LogProd(presc, XSC(SP_N, SP_LOOP));
+    }
+    presc = MATH_LogProd(presc, TSC(t_1, B2M));
+    inner_sc_0 = MATH_LogProd(inner_sc_0, presc);
+
+    /* post-core model: M)->E->C->...->C->T */
+    postsc = XSC(SP_E, SP_MOVE);
+    for (q_0 = end->q_0; q_0 <= Q; q_0++) {
+      postsc = MATH_LogProd(postsc, XSC(SP_C, SP_LOOP));
+    }
+    postsc = MATH_LogProd(postsc, XSC(SP_C, SP_MOVE));
+    total_sc = MATH_LogProd(total_sc, postsc);
+    inner_sc_0 = MATH_LogProd(inner_sc_0, postsc);
+  }
+
+  *max_sc = total_sc;
+  *inner_sc = inner_sc_0;
+
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION: CLOUD_I16_BuildProfile()
+ *  SYNOPSIS: Scale <target> profile scores into int16.
+ *            Transitions are stored by reversed column index <T - t>, so that
+ *            cells along an antidiagonal (q+1,t-1) read transitions contiguously.
+ */
+static void
+CLOUD_I16_BuildProfile(const HMM_PROFILE* target, /* target hmm model */
+                       const int T,               /* target length */
+                       const int Wt,              /* width of transition rows */
+                       int16_t* tsc_rev,          /* OUTPUT: transition scores */
+                       int16_t* msc,              /* OUTPUT: match emission scores */
+                       int16_t* isc)              /* OUTPUT: insert emission scores */
+{
+  int t_0, tr, A;
+
+  for (tr = 0; tr < NUM_TRANS_STATES; tr++) {
+    for (t_0 = 0; t_0 < Wt; t_0++) {
+      TSC16(tr, t_0) = I16_NEG;
+    }
+    for (t_0 = 0; t_0 <= T; t_0++) {
+      TSC16(tr, T - t_0) = I16_FromScore(TSC(t_0, tr));
+    }
+  }
+  for (t_0 = 0; t_0 <= T; t_0++) {
+    for (A = 0; A < NUM_AMINO_PLUS_SPEC; A++) {
+      MSC16(t_0, A) = I16_FromScore(MSC(t_0, A));
+      ISC16(t_0, A) = I16_FromScore(ISC(t_0, A));
+    }
+  }
+  /* past end of model */
+  for (A = 0; A < NUM_AMINO_PLUS_SPEC; A++) {
+    MSC16(T + 1, A) = I16_NEG;
+    ISC16(T + 1, A) = I16_NEG;
+  }
+}
+
+/*! FUNCTION: PRUNER_I16_edgetrim_by_global_and_diag()
+ *  SYNOPSIS: int16 port of PRUNER_edgetrim_by_global_and_diag_Linear().
+ *            Thresholds are given pre-scaled. Both left and right edges are trimmed on all states.
+ *            Sets <is_saturated> if previous antidiagonal reached the top of the int16 range.
+ */
+static STATUS_FLAG
+PRUNER_I16_edgetrim_by_global_and_diag(const int16_t* mx,     /* int16 dp matrix */
+                                       const int W,           /* width of dp matrix rows */
+                                       const int alpha,       /* x-drop value for by-diag prune */
+                                       const int beta,        /* x-drop value for global prune */
+                                       const int gamma,       /* number of antidiagonals before pruning */
+                                       const int hard_limit,  /* hard floor value for global prune */
+                                       const RANGE vit_range, /* antidiagonal locations for the start-end of the input viterbi alignment */
+                                       const int d_1,         /* previous antidiagonal */
+                                       const int d_0,         /* current antidiagonal */
+                                       const int dx1,         /* previous antidiag (mod-mapped) */
+                                       const int d_cnt,       /* number of antidiags traversed */
+                                       int* total_max,        /* UPDATED: current maximum score */
+                                       COORDS* coords_max,    /* UPDATED: location of maximum score */
+                                       bool* is_term_flag,    /* UPDATED: if termination trigger has been reached */
+                                       bool* is_saturated,    /* UPDATED: if int16 overflow has occurred */
+                                       VECTOR_INT* lb_vec[3], /* OUTPUT: current list of left-bounds */
+                                       VECTOR_INT* rb_vec[3]) /* OUTPUT: current list of right-bounds */
+{
+  int i, k_0;
+  int lb_0, rb_0, lb_1, rb_1;
+  int diag_max, cell_max, prv_max;
+  int total_limit, diag_limit, cell_limit;
+  COORDS coords_diagmax;
+
+  VECTOR_INT_Reuse(lb_vec[0]);
+  VECTOR_INT_Reuse(rb_vec[0]);
+
+  /* update maximum score using antidiagonal */
+  diag_max = I16_NEG;
+  prv_max = I16_NEG;
+  coords_diagmax = (COORDS){0, 0};
+  for (i = 0; i < lb_vec[1]->N; i++) {
+    lb_1 = VEC_X(lb_vec[1], i);
+    rb_1 = VEC_X(rb_vec[1], i);
+    for (k_0 = lb_1; k_0 < rb_1; k_0++) {
+      diag_max = MAX(MAX(diag_max, MMX16(dx1, k_0)),
+                     MAX(IMX16(dx1, k_0), DMX16(dx1, k_0)));
+      if (diag_max > prv_max) {
+        coords_diagmax.q_0 = k_0;
+        prv_max = diag_max;
+      }
+    }
+  }
+
+  /* reached top of range: scores can no longer be trusted */
+  if (diag_max >= I16_POS) {
+    *is_saturated = true;
+    return STATUS_SUCCESS;
+  }
+
+  /* Update global_max if new maximum found */
+  if (*total_max < diag_max) {
+    *total_max = diag_max;
+    *coords_max = coords_diagmax;
+  }
+
+  total_limit = *total_max - beta;
+  diag_limit = diag_max - alpha;
+  cell_limit = MAX(hard_limit, MAX(total_limit, diag_limit));
+
+  for (i = 0; i < lb_vec[1]->N; i++) {
+    lb_1 = VEC_X(lb_vec[1], i);
+    rb_1 = VEC_X(rb_vec[1], i);
+
+    /* If free passes are not complete, skip pruning */
+    if (d_cnt <= gamma) {
+      VECTOR_INT_Pushback(lb_vec[0], lb_1);
+      VECTOR_INT_Pushback(rb_vec[0], rb_1);
+    }
+    elif (diag_max < total_limit) /* if no cells pass pruning threshold, terminate */
+    {
+      *is_term_flag = true;
+      return STATUS_SUCCESS;
+    }
+    else /* prune and set new edgebounds */
+    {
+      lb_0 = INT_MIN;
+      rb_0 = INT_MIN;
+
+      /* Find the first cell from the left which passes above threshold */
+      for (k_0 = lb_1; k_0 < rb_1; k_0++) {
+        cell_max = MAX(MMX16(dx1, k_0), MAX(IMX16(dx1, k_0), DMX16(dx1, k_0)));
+        if (cell_max >= cell_limit) {
+          lb_0 = k_0;
+          break;
+        }
+      }
+
+      /* If no boundary edges are found on diag, then branch is pruned entirely */
+      if (lb_0 == INT_MIN) {
+        continue;
+      }
+
+      /* Find the first cell from the right which passes above threshold */
+      for (k_0 = rb_1 - 1; k_0 >= lb_0; k_0--) {
+        cell_max = MAX(MMX16(dx1, k_0), MAX(IMX16(dx1, k_0), DMX16(dx1, k_0)));
+        if (cell_max >= cell_limit) {
+          rb_0 = k_0 + 1;
+          break;
+        }
+      }
+
+      VECTOR_INT_Pushback(lb_vec[0], lb_0);
+      VECTOR_INT_Pushback(rb_vec[0], rb_0);
+    }
+  }
+
+  return STATUS_SUCCESS;
+}
+
+/* MATH RULES: saturating int16 arithmetic */
+
+static inline int16_t
+I16_Add(const int16_t x,
+        const int16_t y) {
+  int sum = (int)x + (int)y;
+  return (int16_t)(sum > I16_POS ? I16_POS : (sum < I16_NEG ? I16_NEG : sum));
+}
+
+static inline int16_t
+I16_Max(const int16_t x,
+        const int16_t y) {
+  return (x > y ? x : y);
+}
+
+static inline int16_t
+I16_FromScore(const float sc) {
+  float x = sc * CLOUD_I16_SCALE;
+  if (isinf(x) || isnan(x) || x <= (float)I16_NEG) {
+    return I16_NEG;
+  }
+  if (x >= (float)I16_POS) {
+    return I16_POS;
+  }
+  return (int16_t)roundf(x);
+}
+
+static inline float
+I16_ToScore(const int sc) {
+  if (sc <= I16_NEG) {
+    return -INF;
+  }
+  return (float)sc / CLOUD_I16_SCALE;
+}
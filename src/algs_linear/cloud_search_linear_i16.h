@@ -0,0 +1,55 @@
+/*******************************************************************************
+ *  - FILE:  cloud_search_linear_i16.h
+ *  - DESC:  Reduced-precision (int16) Cloud Search prefilter (linear space).
+ *******************************************************************************/
+
+#ifndef _CLOUD_SEARCH_LINEAR_I16_H
+#define _CLOUD_SEARCH_LINEAR_I16_H
+
+/*! FUNCTION: run_Cloud_Forward_Linear_I16()
+ *  SYNOPSIS: Perform Forward part of Cloud Search Algorithm using reduced-precision arithmetic.
+ *            Scores are scaled by <CLOUD_I16_SCALE> and stored as saturating int16.
+ *            Recurrence uses max-plus (Viterbi) instead of log-sum, so scores are a lower bound
+ *            on the Forward scores. To compensate, x-drop thresholds are loosened by <params->i16_margin>,
+ *            so the resulting edgebounds usually cover the float edgebounds (not guaranteed).
+ *            Output scores are lower bounds, so caller must not filter on them.
+ *            If any cell saturates at the top of the int16 range, search is abandoned and
+ *            <is_saturated> is set, so caller can fall back to run_Cloud_Forward_Linear().
+ *  RETURN:   Returns <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Cloud_Forward_Linear_I16(
+    const SEQUENCE* query,     /* query sequence */
+    const HMM_PROFILE* target, /* target hmm model */
+    const int Q,               /* query length */
+    const int T,               /* target length */
+    MATRIX_I16* i16_MX,        /* int16 work buffers */
+    const ALIGNMENT* tr,       /* viterbi traceback */
+    EDGEBOUND_ROWS* rows,      /* temporary edgebounds by-row vector */
+    EDGEBOUNDS* edg,           /* OUTPUT: edgebounds of cloud search space */
+    CLOUD_PARAMS* params,      /* pruning parameters */
+    float* inner_sc,           /* OUTPUT: maximum score inside viterbi bounds */
+    float* max_sc,             /* OUTPUT: highest score found during search */
+    bool* is_saturated);       /* OUTPUT: if search saturated int16 range */
+
+/*! FUNCTION: run_Cloud_Backward_Linear_I16()
+ *  SYNOPSIS: Perform Backward part of Cloud Search Algorithm using reduced-precision arithmetic.
+ *            See run_Cloud_Forward_Linear_I16().
+ *  RETURN:   Returns <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Cloud_Backward_Linear_I16(
+    const SEQUENCE* query,     /* query sequence */
+    const HMM_PROFILE* target, /* target hmm model */
+    const int Q,               /* query length */
+    const int T,               /* target length */
+    MATRIX_I16* i16_MX,        /* int16 work buffers */
+    const ALIGNMENT* tr,       /* viterbi traceback */
+    EDGEBOUND_ROWS* rows,      /* temporary edgebounds by-row vector */
+    EDGEBOUNDS* edg,           /* OUTPUT: edgebounds of cloud search space */
+    CLOUD_PARAMS* params,      /* pruning parameters */
+    float* inner_sc,           /* OUTPUT: maximum score inside viterbi bounds */
+    float* max_sc,             /* OUTPUT: highest score found during search */
+    bool* is_saturated);       /* OUTPUT: if search saturated int16 range */
+
+#endif /* _CLOUD_SEARCH_LINEAR_I16_H */
@@ -413,3 +413,113 @@ PRUNER_edgetrim_by_global_and_diag_Linear(MATRIX_3D* st_MX3,      /* normal stat
   }
   return STATUS_SUCCESS;
 }
+
+/*! FUNCTION: 	PRUNER_clip_to_path_Linear()
+ *  SYNOPSIS: 	Prunes antidiagonal of Cloud Search to band around input alignment path.
+ *				Clips bounds of surviving cells on antidiagonal <d_1> to within <band> cells
+ *of the path cell on <d_1>, and removes emptied bounds. Antidiagonals outside
+ *the path are not clipped. <p_0> is index into <tr> of the nearest path cell, and
+ *is moved along path as search progresses (in either direction).
+ */
+STATUS_FLAG
+PRUNER_clip_to_path_Linear(const ALIGNMENT* tr,   /* input alignment path */
+                           const int band,        /* max distance from path */
+                           const int d_1,         /* previous antidiagonal */
+                           int* p_0,              /* UPDATED: index of path cell nearest <d_1> */
+                           VECTOR_INT* lb_vec[3], /* UPDATED: current list of left-bounds */
+                           VECTOR_INT* rb_vec[3]) /* UPDATED: current list of right-bounds */
+{
+  TRACE* trace = tr->traces->data;
+  int lb, rb, lb_path, rb_path;
+  int k_path;
+  int N = 0;
+
+  /* only clip inside path */
+  if (d_1 < trace[tr->beg].q_0 + trace[tr->beg].t_0 ||
+      d_1 > trace[tr->end].q_0 + trace[tr->end].t_0) {
+    return STATUS_SUCCESS;
+  }
+
+  /* find last path cell at or before <d_1> */
+  while (*p_0 < tr->end && trace[*p_0 + 1].q_0 + trace[*p_0 + 1].t_0 <= d_1) {
+    (*p_0)++;
+  }
+  while (*p_0 > tr->beg && trace[*p_0].q_0 + trace[*p_0].t_0 > d_1) {
+    (*p_0)--;
+  }
+  /* match steps skip an antidiagonal, so allow one extra cell on each side */
+  k_path = trace[*p_0].q_0;
+  lb_path = k_path - band - 1;
+  rb_path = k_path + band + 2;
+
+  for (int i = 0; i < lb_vec[0]->N; i++) {
+    lb = MAX(VEC_X(lb_vec[0], i), lb_path);
+    rb = MIN(VEC_X(rb_vec[0], i), rb_path);
+    if (lb < rb) {
+      VEC_X(lb_vec[0], N) = lb;
+      VEC_X(rb_vec[0], N) = rb;
+      N++;
+    }
+  }
+  VECTOR_INT_SetSize(lb_vec[0], N);
+  VECTOR_INT_SetSize(rb_vec[0], N);
+
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION: 	PRUNER_clip_to_edgebounds_Linear()
+ *  SYNOPSIS: 	Prunes antidiagonal of Cloud Search to cells of antidiagonal-wise edgebounds <edg_lim>.
+ *				Clips bounds of surviving cells on antidiagonal <d_1> to the span of the bounds of
+ *<edg_lim> on <d_1>, and removes emptied bounds. Antidiagonals outside the range of <edg_lim>
+ *are not clipped; inside it, if <edg_lim> has no bounds on <d_1>, all bounds are removed.
+ *<edg_lim> must be sorted by antidiagonal (as returned by both forward and backward search).
+ */
+STATUS_FLAG
+PRUNER_clip_to_edgebounds_Linear(const EDGEBOUNDS* edg_lim, /* antidiagonal-wise edgebounds to clip to */
+                                 const int d_1,             /* previous antidiagonal */
+                                 VECTOR_INT* lb_vec[3],     /* UPDATED: current list of left-bounds */
+                                 VECTOR_INT* rb_vec[3])     /* UPDATED: current list of right-bounds */
+{
+  BOUND* bnds = edg_lim->bounds->data;
+  int N_lim = edg_lim->bounds->N;
+  int lb, rb, lb_lim, rb_lim;
+  int lo, hi, mid;
+  int N = 0;
+
+  /* search steps in from one antidiag outside <edg_lim>, which is left unclipped */
+  if (N_lim == 0 || d_1 < bnds[0].id || d_1 > bnds[N_lim - 1].id) {
+    return STATUS_SUCCESS;
+  }
+  /* binary search for first bound on <d_1> */
+  lo = 0;
+  hi = N_lim;
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if (bnds[mid].id < d_1) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  /* span of all bounds on <d_1> (empty if none) */
+  lb_lim = INT_MAX;
+  rb_lim = INT_MIN;
+  for (int i = lo; i < N_lim && bnds[i].id == d_1; i++) {
+    lb_lim = MIN(lb_lim, bnds[i].lb);
+    rb_lim = MAX(rb_lim, bnds[i].rb);
+  }
+
+  for (int i = 0; i < lb_vec[0]->N; i++) {
+    lb = MAX(VEC_X(lb_vec[0], i), lb_lim);
+    rb = MIN(VEC_X(rb_vec[0], i), rb_lim);
+    if (lb < rb) {
+      VEC_X(lb_vec[0], N) = lb;
+      VEC_X(rb_vec[0], N) = rb;
+      N++;
+    }
+  }
+  VECTOR_INT_SetSize(lb_vec[0], N);
+  VECTOR_INT_SetSize(rb_vec[0], N);
+
+  return STATUS_SUCCESS;
+}
@@ -95,4 +95,34 @@ PRUNER_edgetrim_by_global_and_diag_Linear(
     VECTOR_INT* lb_vec[3],  /* OUTPUT: current list of left-bounds */
     VECTOR_INT* rb_vec[3]); /* OUTPUT: current list of right-bounds */
 
+/*! FUNCTION: 	PRUNER_clip_to_path_Linear()
+ *  SYNOPSIS: 	Prunes antidiagonal of Cloud Search to band around input alignment path.
+ *				Clips bounds of surviving cells on antidiagonal <d_1> to within <band> cells
+ *of the path cell on <d_1>, and removes emptied bounds. Antidiagonals outside
+ *the path are not clipped. <p_0> is index into <tr> of the nearest path cell, and
+ *is moved along path as search progresses (in either direction).
+ */
+STATUS_FLAG
+PRUNER_clip_to_path_Linear(
+    const ALIGNMENT* tr,    /* input alignment path */
+    const int band,         /* max distance from path */
+    const int d_1,          /* previous antidiagonal */
+    int* p_0,               /* UPDATED: index of path cell nearest <d_1> */
+    VECTOR_INT* lb_vec[3],  /* UPDATED: current list of left-bounds */
+    VECTOR_INT* rb_vec[3]); /* UPDATED: current list of right-bounds */
+
+/*! FUNCTION: 	PRUNER_clip_to_edgebounds_Linear()
+ *  SYNOPSIS: 	Prunes antidiagonal of Cloud Search to cells of antidiagonal-wise edgebounds <edg_lim>.
+ *				Clips bounds of surviving cells on antidiagonal <d_1> to the span of the bounds of
+ *<edg_lim> on <d_1>, and removes emptied bounds. Antidiagonals outside the range of <edg_lim>
+ *are not clipped; inside it, if <edg_lim> has no bounds on <d_1>, all bounds are removed.
+ *<edg_lim> must be sorted by antidiagonal (as returned by both forward and backward search).
+ */
+STATUS_FLAG
+PRUNER_clip_to_edgebounds_Linear(
+    const EDGEBOUNDS* edg_lim, /* antidiagonal-wise edgebounds to clip to */
+    const int d_1,             /* previous antidiagonal */
+    VECTOR_INT* lb_vec[3],     /* UPDATED: current list of left-bounds */
+    VECTOR_INT* rb_vec[3]);    /* UPDATED: current list of right-bounds */
+
 #endif /* _PRUNING_LINEAR_H */
@@ -12,7 +12,6 @@
 #include "posterior_null2_sparse.h"
 #include "posterior_optacc_sparse.h"
 #include "posterior_sparse.h"
-#include "posterior_traceback_sparse.h"
 #include "viterbi_traceback_sparse.h"
 
 #include "bound_fwdbck_sparse_test.h"
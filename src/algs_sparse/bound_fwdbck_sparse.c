@@ -467,7 +467,9 @@ run_Bound_Backward_Sparse(const SEQUENCE* query,                 /* query sequen
                           MATRIX_2D* restrict sp_MX_bck,         /* special state matrix */
                           const EDGEBOUNDS* edg,                 /* edgebounds */
                           const RANGE* dom_range,                /* (OPTIONAL) domain range for computing fwd/bck on specific domain. If NULL, computes complete fwd/bck. */
-                          float* sc_final)                       /* (OUTPUT) final score */
+                          float* sc_final,                       /* (OUTPUT) final score */
+                          MATRIX_2D* sp_MX_fwd,                  /* (OPTIONAL) special state matrix of completed forward, for decoding domains */
+                          DOMAIN_DEF* dom_def)                   /* (OPTIONAL OUTPUT) domain data, decoded row by row. Requires <sp_MX_fwd>, and no <dom_range>. */
 {
   /* vars for matrix access for macros */
   MATRIX_3D_SPARSE* st_SMX = st_SMX_bck; /* normal state matrix */
@@ -590,6 +592,11 @@ run_Bound_Backward_Sparse(const SEQUENCE* query,                 /* query sequen
   T_range.beg = 1;
   T_range.end = T;
 
+  /* domain data is decoded alongside, as each row of special states is completed */
+  if (dom_def != NULL) {
+    run_Decode_Domains_Init(Q, dom_def);
+  }
+
   /* UNROLLED INITIAL QUERY LOOP */
   q_0 = Q_range.end;
   {
@@ -605,6 +612,9 @@ run_Bound_Backward_Sparse(const SEQUENCE* query,                 /* query sequen
     XMX(SP_N, q_0) = MY_Zero();
     XMX(SP_C, q_0) = XSC(SP_C, SP_MOVE);
     XMX(SP_E, q_0) = MY_Prod(XMX(SP_C, q_0), XSC(SP_E, SP_MOVE));
+    if (dom_def != NULL) {
+      run_Decode_Domains_Row(target, Q, q_0, sp_MX_fwd, sp_MX_bck, dom_def);
+    }
 
     /* if sequence position is in domain range */
     if (is_q_0_in_dom_range == true) {
@@ -745,6 +755,9 @@ run_Bound_Backward_Sparse(const SEQUENCE* query,                 /* query sequen
     prv_N = MY_Prod(XMX(SP_N, q_1), XSC(SP_N, SP_LOOP));
     prv_B = MY_Prod(XMX(SP_B, q_0), XSC(SP_N, SP_MOVE));
     XMX(SP_N, q_0) = MY_Sum(prv_N, prv_B);
+    if (dom_def != NULL) {
+      run_Decode_Domains_Row(target, Q, q_0, sp_MX_fwd, sp_MX_bck, dom_def);
+    }
 
     if (is_q_0_in_dom_range == true) {
       /* FOR every SPAN in current ROW */
@@ -901,6 +914,9 @@ run_Bound_Backward_Sparse(const SEQUENCE* query,                 /* query sequen
     prv_N = MY_Prod(XMX(SP_N, q_1), XSC(SP_N, SP_LOOP));
     prv_B = MY_Prod(XMX(SP_B, q_0), XSC(SP_N, SP_MOVE));
     XMX(SP_N, q_0) = MY_Sum(prv_N, prv_B);
+    if (dom_def != NULL) {
+      run_Decode_Domains_Row(target, Q, q_0, sp_MX_fwd, sp_MX_bck, dom_def);
+    }
   }
 
   sc_best = XMX(SP_N, Q_range.beg);
@@ -42,8 +42,9 @@ run_Bound_Forward_Sparse(
  *             Normal state matrix is stored in linear space.
  *             <st_MX3> is size [3 * (Q + T + 1)]. Only requires size [2 * (T +
  * 1)], but is reused from cloud_forward_(). Final score produced by Backward is
- * stored in <sc_final>. RETURN:  Returns the final score of the Backward
- * Algorithm.
+ * stored in <sc_final>. If <dom_def> is given, domain data is decoded for each
+ * row as soon as it is complete (see run_Decode_Domains_Row()).
+ * RETURN:  Returns the final score of the Backward Algorithm.
  */
 STATUS_FLAG
 run_Bound_Backward_Sparse(
@@ -57,6 +58,8 @@ run_Bound_Backward_Sparse(
     const RANGE*
         dom_range,    /* (OPTIONAL) domain range for computing fwd/bck on specific
                       domain. If NULL, computes complete fwd/bck. */
-    float* sc_final); /* (OUTPUT) final score */
+    float* sc_final,      /* (OUTPUT) final score */
+    MATRIX_2D* sp_MX_fwd, /* (OPTIONAL) special state matrix of completed forward, for decoding domains */
+    DOMAIN_DEF* dom_def); /* (OPTIONAL OUTPUT) domain data, decoded row by row. Requires <sp_MX_fwd>, and no <dom_range>. */
 
 #endif /* _BOUND_FWDBCK_LINEAR_H */
@@ -462,6 +462,257 @@ run_Bound_Viterbi_Sparse(const SEQUENCE* query,                 /* query sequenc
   return STATUS_SUCCESS;
 }
 
+/*! FUNCTION: run_Bound_Viterbi_Sparse_Ptrs()
+ *  SYNOPSIS: Perform Edge-Bounded Viterbi, keeping backpointers instead of scores.
+ *            Same recurrence as run_Bound_Viterbi_Sparse(), but normal states are only
+ *             kept for the current and previous row (in <vit_ptrs>). For each cell inside
+ *             <edg>, the best predecessor of each normal state is stored in <vit_ptrs>
+ *             as four bits, and for each row, the best predecessor of each special state.
+ *             Special states are stored in <sp_MX_vit>.
+ *            Traceback is then done by run_Viterbi_Traceback_Sparse_Ptrs().
+ *            Final score produced by Viterbi is stored in <sc_final>.
+ *
+ *  RETURN:   Returns <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Bound_Viterbi_Sparse_Ptrs(const SEQUENCE* query,         /* query sequence */
+                              const HMM_PROFILE* target,     /* target HMM model */
+                              const int Q,                   /* query length */
+                              const int T,                   /* target length */
+                              const EDGEBOUNDS* edg,         /* edgebounds */
+                              VITERBI_PTRS* vit_ptrs,        /* (OUTPUT) backpointers */
+                              MATRIX_2D* restrict sp_MX_vit, /* special state matrix */
+                              float* sc_final)               /* (OUTPUT) final score */
+{
+  /* vars for matrix access for macros */
+  MATRIX_2D* sp_MX = sp_MX_vit; /* special state matrix */
+
+  /* vars for accessing query/target data structs */
+  int A;     /* store int value of character */
+  char* seq; /* alias for getting seq */
+
+  /* vars for indexing into data matrices by row-col */
+  int q_0, q_1; /* real index of current and previous rows (query) */
+  int t_0, t_1; /* real index of current and previous columns (target) */
+  int cx0, cx1; /* current and previous row in working rows */
+  int cell;     /* index of current cell in backpointers */
+
+  /* vars for indexing into edgebound lists */
+  BOUND* bnd;     /* current bound */
+  int r_0;        /* current index for current row */
+  int r_0b, r_0e; /* begin and end indices for current row in edgebound list */
+  int lb_0, rb_0; /* bounds of current search space on current row */
+
+  /* vars for recurrance scores */
+  float prv_M, prv_I, prv_D;    /* previous (M) match, (I) insert, (D) delete states */
+  float prv_B, prv_E;           /* previous (B) begin and (E) end states */
+  float prv_J, prv_N, prv_C;    /* previous (J) jump, (N) initial, and (C) terminal states */
+  float prv_sum;                /* temp subtotaling vars */
+  float sc_E;                   /* end score */
+  uint8_t ptr;                  /* backpointers for current cell */
+  uint8_t sp_ptr;               /* backpointers for special states of current row */
+
+  /* vars for working rows and backpointers */
+  float* row[2][NUM_NORMAL_STATES]; /* normal states of current and previous row */
+  int* stamp[2];                    /* row which set each position of working rows */
+  int* bnd_offset;                  /* offset of each bound into <cells> */
+  CHAR* cells;                      /* packed backpointers for each cell */
+  int e_t;                          /* target position of best predecessor to E state */
+
+  /* --------------------------------------------------------------------------------- */
+
+  /* initialize logsum lookup table if it has not already been */
+  MATH_Logsum_Init();
+
+  /* query sequence */
+  seq = query->seq;
+  /* local or global alignments? */
+  sc_E = (target->isLocal) ? MY_One() : MY_Zero();
+
+  /* map bounds to backpointers, and clear working rows */
+  VITERBI_PTRS_Reuse(vit_ptrs, Q, T, edg);
+  bnd_offset = vit_ptrs->bnd_offset->data;
+  cells = vit_ptrs->cells->data;
+  for (int i = 0; i < 2; i++) {
+    for (int st = 0; st < NUM_NORMAL_STATES; st++) {
+      row[i][st] = &VEC_X(vit_ptrs->rows, (i * NUM_NORMAL_STATES + st) * (T + 2));
+    }
+    stamp[i] = &VEC_X(vit_ptrs->row_stamp, i * (T + 2));
+  }
+
+/* previous row is -inf wherever it was not set */
+#define PRV_ROW(st, t) ((stamp[cx1][t] == q_1) ? row[cx1][st][t] : MY_Zero())
+
+  /* UNROLLED INITIAL QUERY LOOP */
+  /* zero row of normal states is -inf, so is left unset */
+  q_0 = 0;
+  {
+    /* initialize special states */
+    XMX(SP_E, q_0) = MY_Zero();
+    XMX(SP_J, q_0) = MY_Zero();
+    XMX(SP_C, q_0) = MY_Zero();
+    /* S->N, p=1 */
+    XMX(SP_N, q_0) = MY_One();
+    /* S->N->B, no N-tail */
+    XMX(SP_B, q_0) = XSC(SP_N, SP_MOVE);
+  }
+
+  /* MAIN QUERY LOOP */
+  /* FOR every position in QUERY sequence (row in matrix) */
+  for (q_0 = 1; q_0 <= Q; q_0++) {
+    q_1 = q_0 - 1;
+    cx0 = q_0 % 2;
+    cx1 = q_1 % 2;
+
+    /* get edgebound range */
+    r_0b = EDGEBOUNDS_GetIndex_byRow_Fwd(edg, q_0);
+    r_0e = EDGEBOUNDS_GetIndex_byRow_Fwd(edg, q_0 + 1);
+
+    /* Get next sequence character */
+    A = AA_REV[seq[q_1]]; /* off-by-one */
+
+    /* Init E state for current row */
+    XMX(SP_E, q_0) = MY_Zero();
+    e_t = -1;
+    sp_ptr = 0;
+
+    /* FOR every BOUND in current ROW */
+    for (r_0 = r_0b; r_0 < r_0e; r_0++) {
+      /* get bound data */
+      bnd = EDGEBOUNDS_GetX(edg, r_0);
+      lb_0 = MAX(bnd->lb - 1, 0); /* can't overflow left edge. the leftmost cell will be set to zero, so (-1) adds left padding cell.  */
+      rb_0 = MIN(bnd->rb, T + 1); /* can't overflow right edge */
+      /* index of cell <t_0> into backpointers */
+      cell = bnd_offset[r_0] - bnd->lb;
+
+      /* UNROLLED INITIAL TARGET LOOP: special case for left edge of range */
+      t_0 = lb_0;
+      {
+        row[cx0][MAT_ST][t_0] = MY_Zero();
+        row[cx0][INS_ST][t_0] = MY_Zero();
+        row[cx0][DEL_ST][t_0] = MY_Zero();
+        stamp[cx0][t_0] = q_0;
+      }
+
+      /* MAIN TARGET LOOP */
+      /* FOR every position in TARGET profile (last position has no insert state) */
+      for (t_0 = lb_0 + 1; t_0 < rb_0; t_0++) {
+        t_1 = t_0 - 1;
+
+        /* FIND BEST PATH TO MATCH STATE (FROM MATCH, INSERT, DELETE, OR BEGIN) */
+        /* best previous state transition (match takes the diag element of each prev state) */
+        prv_M = MY_Prod(PRV_ROW(MAT_ST, t_1), TSC(t_1, M2M));
+        prv_I = MY_Prod(PRV_ROW(INS_ST, t_1), TSC(t_1, I2M));
+        prv_D = MY_Prod(PRV_ROW(DEL_ST, t_1), TSC(t_1, D2M));
+        prv_B = MY_Prod(XMX(SP_B, q_1), TSC(t_1, B2M)); /* from begin match state (new alignment) */
+        /* best-to-match */
+        prv_sum = prv_M;
+        ptr = VPTR_M_FROM_M;
+        if (prv_I > prv_sum) {
+          prv_sum = prv_I;
+          ptr = VPTR_M_FROM_I;
+        }
+        if (prv_D > prv_sum) {
+          prv_sum = prv_D;
+          ptr = VPTR_M_FROM_D;
+        }
+        if (prv_B > prv_sum) {
+          prv_sum = prv_B;
+          ptr = VPTR_M_FROM_B;
+        }
+        row[cx0][MAT_ST][t_0] = MY_Prod(prv_sum, MSC(t_0, A));
+
+        /* FIND BEST PATH TO INSERT STATE (FROM MATCH OR INSERT) */
+        /* previous states (match takes the previous row (upper) of each state) */
+        if (t_0 < rb_0 - 1) {
+          prv_M = MY_Prod(PRV_ROW(MAT_ST, t_0), TSC(t_0, M2I));
+          prv_I = MY_Prod(PRV_ROW(INS_ST, t_0), TSC(t_0, I2I));
+          /* best-to-insert */
+          if (prv_I > prv_M) {
+            prv_sum = prv_I;
+            ptr |= VPTR_I_FROM_I;
+          } else {
+            prv_sum = prv_M;
+          }
+          row[cx0][INS_ST][t_0] = MY_Prod(prv_sum, ISC(t_0, A));
+        } else {
+          row[cx0][INS_ST][t_0] = MY_Zero();
+        }
+
+        /* FIND BEST PATH TO DELETE STATE (FROM MATCH OR DELETE) */
+        /* previous states (match takes the previous column (left) of each state) */
+        prv_M = MY_Prod(row[cx0][MAT_ST][t_1], TSC(t_1, M2D));
+        prv_D = MY_Prod(row[cx0][DEL_ST][t_1], TSC(t_1, D2D));
+        /* best-to-delete */
+        if (prv_D > prv_M) {
+          prv_sum = prv_D;
+          ptr |= VPTR_D_FROM_D;
+        } else {
+          prv_sum = prv_M;
+        }
+        row[cx0][DEL_ST][t_0] = prv_sum;
+        stamp[cx0][t_0] = q_0;
+
+        VPTR_SET(cells, cell + t_0, ptr);
+
+        /* UPDATE E STATE (last position of range can always exit) */
+        prv_E = (t_0 < rb_0 - 1) ? sc_E : MY_One();
+        prv_M = MY_Prod(row[cx0][MAT_ST][t_0], prv_E);
+        prv_D = MY_Prod(row[cx0][DEL_ST][t_0], prv_E);
+        if (prv_M > XMX(SP_E, q_0)) {
+          XMX(SP_E, q_0) = prv_M;
+          e_t = t_0;
+          sp_ptr &= ~VPTR_E_FROM_D;
+        }
+        if (prv_D > XMX(SP_E, q_0)) {
+          XMX(SP_E, q_0) = prv_D;
+          e_t = t_0;
+          sp_ptr |= VPTR_E_FROM_D;
+        }
+      }
+    }
+
+    /* SPECIAL STATES */
+    /* J state */
+    prv_J = MY_Prod(XMX(SP_J, q_1), XSC(SP_J, SP_LOOP)); /* J->J */
+    prv_E = MY_Prod(XMX(SP_E, q_0), XSC(SP_E, SP_LOOP)); /* E->J is E's "loop" */
+    if (prv_E > prv_J) {
+      sp_ptr |= VPTR_J_FROM_E;
+    }
+    XMX(SP_J, q_0) = MY_Max(prv_J, prv_E);
+
+    /* C state */
+    prv_C = MY_Prod(XMX(SP_C, q_1), XSC(SP_C, SP_LOOP));
+    prv_E = MY_Prod(XMX(SP_E, q_0), XSC(SP_E, SP_MOVE));
+    if (prv_E > prv_C) {
+      sp_ptr |= VPTR_C_FROM_E;
+    }
+    XMX(SP_C, q_0) = MY_Max(prv_C, prv_E);
+
+    /* N state */
+    prv_N = MY_Prod(XMX(SP_N, q_1), XSC(SP_N, SP_LOOP));
+    XMX(SP_N, q_0) = prv_N;
+
+    /* B state */
+    prv_N = MY_Prod(XMX(SP_N, q_0), XSC(SP_N, SP_MOVE)); /* N->B is N's move */
+    prv_J = MY_Prod(XMX(SP_J, q_0), XSC(SP_J, SP_MOVE)); /* J->B is J's move */
+    if (prv_J > prv_N) {
+      sp_ptr |= VPTR_B_FROM_J;
+    }
+    XMX(SP_B, q_0) = MY_Max(prv_N, prv_J);
+
+    VEC_X(vit_ptrs->sp_ptr, q_0) = sp_ptr;
+    VEC_X(vit_ptrs->e_ptr, q_0) = e_t;
+  }
+
+#undef PRV_ROW
+
+  /* T state */
+  *sc_final = MY_Prod(XMX(SP_C, Q), XSC(SP_C, SP_MOVE));
+
+  return STATUS_SUCCESS;
+}
+
 /* MATH RULES: These determine how probilities are summed, multiplied, and certain identities */
 
 static inline float
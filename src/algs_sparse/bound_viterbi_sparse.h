@@ -33,4 +33,27 @@ run_Bound_Viterbi_Sparse(
     MATRIX_2D* restrict sp_MX_vit,         /* special state matrix */
     float* sc_final);                      /* (OUTPUT) final score */
 
+/*! FUNCTION: run_Bound_Viterbi_Sparse_Ptrs()
+ *  SYNOPSIS: Perform Edge-Bounded Viterbi, keeping backpointers instead of scores.
+ *            Same recurrence as run_Bound_Viterbi_Sparse(), but normal states are only
+ *             kept for the current and previous row (in <vit_ptrs>). For each cell inside
+ *             <edg>, the best predecessor of each normal state is stored in <vit_ptrs>
+ *             as four bits, and for each row, the best predecessor of each special state.
+ *             Special states are stored in <sp_MX_vit>.
+ *            Traceback is then done by run_Viterbi_Traceback_Sparse_Ptrs().
+ *            Final score produced by Viterbi is stored in <sc_final>.
+ *
+ *  RETURN:   Returns <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Bound_Viterbi_Sparse_Ptrs(
+    const SEQUENCE* query,         /* query sequence */
+    const HMM_PROFILE* target,     /* target HMM model */
+    const int Q,                   /* query length */
+    const int T,                   /* target length */
+    const EDGEBOUNDS* edg,         /* edgebounds */
+    VITERBI_PTRS* vit_ptrs,        /* (OUTPUT) backpointers */
+    MATRIX_2D* restrict sp_MX_vit, /* special state matrix */
+    float* sc_final);              /* (OUTPUT) final score */
+
 #endif /* _BOUND_VITERBI_SPARSE_H */
@@ -1,6 +1,11 @@
 /*******************************************************************************
  *  - FILE:  posterior_null2_sparse.c
  *  - DESC:  Computer the Null2 Composition Bias of the Posterior Probability.
+ *  - NOTES:
+ *    - Null2 is computed in two steps: posterior probabilities are summed per model position
+ *      into <st_freq> and <sp_freq>, then null2 scores are computed from those sums.
+ *    - run_Decode_Posterior_Sparse() can do the summing while decoding, in which case only
+ *      run_Null2_ByExpectation_FromFreq() needs to be called.
  *******************************************************************************/
 
 /* imports */
@@ -38,14 +43,13 @@ run_Null2_ByExpectation_Sparse(SEQUENCE* query,               /* query sequence
 {
   FILE* fp;
 
-  float bias;
   int Q_beg, Q_end, Q_len;
   int T_beg, T_end, T_len;
   int q_0, q_1;               /* real index of current and previous rows (query) */
   int qx0, qx1;               /* maps column index into data index (query) */
   int t_0, t_1;               /* real index of current and previous columns (target) */
   int tx0, tx1;               /* maps target index into data index (target)  */
-  int st_0, k_0;              /* state and amino acid index */
+  int st_0;                   /* state index */
   int r_0, r_0b, r_0e;        /* edgebound list index, beginning and end */
   int id_0, lb_0, rb_0, rb_T; /* edgebound range indexs */
   float mmx, imx, dmx;        /* {MID} state */
@@ -54,9 +58,6 @@ run_Null2_ByExpectation_Sparse(SEQUENCE* query,               /* query sequence
   bool is_q_0_in_dom_range;
 
   BOUND bnd;
-  float x_factor;
-  float null2sc;
-  float neglog_Q, neglog_cnt;
 
   /* query sequence */
   Q_range.beg = 0;
@@ -77,21 +78,8 @@ run_Null2_ByExpectation_Sparse(SEQUENCE* query,               /* query sequence
   Q_len = Q_range.end - Q_range.beg + 1;
   T_len = T_range.end - T_range.beg + 1;
 
-  /* TODO: temp var */
-  const int NULL2_LEN = NUM_AMINO_PLUS_SPEC;
-
-  /* create data vectors */
-  MATRIX_2D_Reuse(dom_def->st_freq, T + 1, NUM_NORMAL_STATES);
-  VECTOR_FLT_SetSize(dom_def->st_num, T + 1);
-  VECTOR_FLT_SetSize(dom_def->sp_freq, NUM_SPECIAL_STATES);
-  VECTOR_FLT_SetSize(dom_def->null2_sc, NUM_AMINO_PLUS_SPEC);
-  VECTOR_FLT_SetSize(dom_def->null2_exp, Q + 1);
-  /* initialize all vectors to zero */
-  MATRIX_2D_Fill(dom_def->st_freq, 0.0f);
-  VECTOR_FLT_Fill(dom_def->st_num, 0.0f);
-  VECTOR_FLT_Fill(dom_def->sp_freq, 0.0f);
-  VECTOR_FLT_Fill(dom_def->null2_sc, 0.0f);
-  VECTOR_FLT_Fill(dom_def->null2_exp, 0.0f);
+  /* create data vectors, initialized to zero */
+  run_Null2_Init_Freq(dom_def, T);
 
   /* init indexes */
   r_0b = r_0e = 0;
@@ -166,6 +154,78 @@ run_Null2_ByExpectation_Sparse(SEQUENCE* query,               /* query sequence
     }
   }
 
+  run_Null2_ByExpectation_FromFreq(
+      query, target, Q, T, q_range, t_range, dom_range, dom_def, compo_bias);
+
+  return STATUS_SUCCESS;
+}
+
+STATUS_FLAG
+run_Null2_Init_Freq(DOMAIN_DEF* dom_def, /* OUTPUT: domain def's st_freq, st_num and sp_freq vectors */
+                    int T)               /* target length */
+{
+  MATRIX_2D_Reuse(dom_def->st_freq, T + 1, NUM_NORMAL_STATES);
+  VECTOR_FLT_SetSize(dom_def->st_num, T + 1);
+  VECTOR_FLT_SetSize(dom_def->sp_freq, NUM_SPECIAL_STATES);
+  /* initialize all vectors to zero */
+  MATRIX_2D_Fill(dom_def->st_freq, 0.0f);
+  VECTOR_FLT_Fill(dom_def->st_num, 0.0f);
+  VECTOR_FLT_Fill(dom_def->sp_freq, 0.0f);
+
+  return STATUS_SUCCESS;
+}
+
+STATUS_FLAG
+run_Null2_ByExpectation_FromFreq(SEQUENCE* query,     /* query sequence */
+                                 HMM_PROFILE* target, /* target hmm model */
+                                 int Q,               /* query length */
+                                 int T,               /* target length */
+                                 RANGE* q_range,      /* OPTIONAL: query range of edgebound cells */
+                                 RANGE* t_range,      /* OPTIONAL: target range of edgebound cells */
+                                 RANGE* dom_range,    /* OPTIONAL: domain range */
+                                 DOMAIN_DEF* dom_def, /* OUTPUT: domain def's null2_sc vector */
+                                 float* compo_bias)   /* OUTPUT: Null2 composition bias */
+{
+#if DEBUG
+  FILE* fp;
+  int tx0; /* maps target index into data index (target)  */
+#endif
+
+  float bias;
+  int q_0;        /* real index of current row (query) */
+  int qx0;        /* maps column index into data index (query) */
+  int t_0;        /* real index of current column (target) */
+  int st_0, k_0;  /* state and amino acid index */
+  float mmx, imx; /* {MI} state */
+  RANGE Q_range;
+  RANGE T_range;
+
+  float x_factor;
+  float neglog_Q;
+
+  /* query sequence */
+  Q_range.beg = 0;
+  Q_range.end = Q;
+  if (q_range != NULL) {
+    Q_range = *q_range;
+  }
+  if (dom_range != NULL) {
+    Q_range = *dom_range;
+  }
+  /* target range */
+  T_range.beg = 0;
+  T_range.end = T + 1;
+  if (t_range != NULL) {
+    T_range = *t_range;
+  }
+
+  /* create data vectors */
+  VECTOR_FLT_SetSize(dom_def->null2_sc, NUM_AMINO_PLUS_SPEC);
+  VECTOR_FLT_SetSize(dom_def->null2_exp, Q + 1);
+  /* initialize all vectors to zero */
+  VECTOR_FLT_Fill(dom_def->null2_sc, 0.0f);
+  VECTOR_FLT_Fill(dom_def->null2_exp, 0.0f);
+
 #if DEBUG
   {
     fp = fopen(DEBUG_FOLDER "/my.post_vec.1.sparse.000.csv", "w+");
@@ -190,7 +250,6 @@ run_Null2_ByExpectation_Sparse(SEQUENCE* query,               /* query sequence
   /* convert probabilities to log frequencies */
   /* for each position in query domain */
   for (t_0 = 0; t_0 <= T; t_0++) {
-    tx0 = t_0 - T_range.beg;
     /* for each normal state emissions */
     for (st_0 = 0; st_0 < NUM_NORMAL_STATES; st_0++) {
       if (MX_2D(dom_def->st_freq, t_0, st_0) > 0.0) {
@@ -245,7 +304,6 @@ run_Null2_ByExpectation_Sparse(SEQUENCE* query,               /* query sequence
 
   /* for each position in query domain */
   for (t_0 = T_range.beg; t_0 < T_range.end; t_0++) {
-    tx0 = t_0 - T_range.beg;
     // neglog_cnt = VEC_X( dom_def->st_num, t_0 );
 
     /* for each normal state emissions */
@@ -303,7 +361,6 @@ run_Null2_ByExpectation_Sparse(SEQUENCE* query,               /* query sequence
   for (k_0 = 0; k_0 < NUM_AMINO; k_0++) {
     /* for each position in model */
     for (t_0 = T_range.beg; t_0 < T_range.end - 1; t_0++) {
-      tx0 = t_0 - T_range.beg;
       /*  Look at the log frequencies (weighted probability of position in model contributed to path score )
        *  at the model position and multiply them by the score contribution.
        */
@@ -314,7 +371,6 @@ run_Null2_ByExpectation_Sparse(SEQUENCE* query,               /* query sequence
       VEC_X(dom_def->null2_sc, k_0) = MATH_Sum(VEC_X(dom_def->null2_sc, k_0), imx);
     }
     t_0 = T_range.end - 1;
-    tx0 = t_0 - T_range.beg;
     mmx = MX_2D(dom_def->st_freq, t_0, MAT_ST) + MSC_X(target, t_0, k_0);
 
     VEC_X(dom_def->null2_sc, k_0) = MATH_Sum(VEC_X(dom_def->null2_sc, k_0), mmx);
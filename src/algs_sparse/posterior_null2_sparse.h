@@ -26,4 +26,31 @@ run_Null2_ByExpectation_Sparse(
     DOMAIN_DEF* dom_def,           /* OUTPUT: domain def's null2_sc vector */
     float* compo_bias);            /* OUTPUT: Null2 composition bias */
 
+/*! FUNCTION:  run_Null2_Init_Freq()
+ *  SYNOPSIS:  Sizes and zeroes <dom_def>'s per-position posterior sums (st_freq, sp_freq),
+ *             before they are summed over the posterior matrix.
+ *  RETURN:    Return <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Null2_Init_Freq(
+    DOMAIN_DEF* dom_def, /* OUTPUT: domain def's st_freq, st_num and sp_freq vectors */
+    int T);              /* target length */
+
+/*! FUNCTION:  run_Null2_ByExpectation_FromFreq()
+ *  SYNOPSIS:  Computes the Null2 Bias Composition from <dom_def>'s per-position posterior sums,
+ *             already summed by run_Decode_Posterior_Sparse() or run_Null2_ByExpectation_Sparse().
+ *  RETURN:    Return <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Null2_ByExpectation_FromFreq(
+    SEQUENCE* query,     /* query sequence */
+    HMM_PROFILE* target, /* target hmm model */
+    int Q,               /* query length */
+    int T,               /* target length */
+    RANGE* q_range,      /* OPTIONAL: query range of edgebound cells */
+    RANGE* t_range,      /* OPTIONAL: target range of edgebound cells */
+    RANGE* dom_range,    /* OPTIONAL: domain range in query */
+    DOMAIN_DEF* dom_def, /* OUTPUT: domain def's null2_sc vector */
+    float* compo_bias);  /* OUTPUT: Null2 composition bias */
+
 #endif /* _POSTERIOR_NULL2_SPARSE_H */
@@ -0,0 +1,586 @@
+/*******************************************************************************
+ *  - FILE:  posterior_optacc_sparse.c
+ *  - DESC:  Posterior Optimal Accuracy algorithms (Sparse Space).
+ *  - NOTES:
+ *    - Optimal accuracy alignment is the path that maximizes the sum of posterior
+ *      probabilities of its emitting states (the expected # residues correctly aligned).
+ *    - Alignment is found in linear memory: only two rows of the optimal accuracy matrix
+ *      are kept, indexed by target position. Each pass over the cloud carries, for every cell,
+ *      the cell where its best path crossed a chosen row. The path is found by Hirschberg-style
+ *      divide-and-conquer: split at the crossing cell of the middle row, then solve both halves,
+ *      until subproblems are small enough to solve directly with a traceback.
+ *    - Multihit: one core model alignment is found inside the query rows of each domain, with its
+ *      begin and end scored by the N, J, or C state posteriors around it, and they are joined by J state.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+
+/* header */
+#include "_algs_sparse.h"
+#include "posterior_optacc_sparse.h"
+
+/* traceback predecessor codes: match in bits 0-1, insert in bit 2, delete in bit 3 */
+#define OPTACC_TB_M(code) ((code)&3)
+#define OPTACC_TB_I(code) (((code) >> 2) & 1)
+#define OPTACC_TB_D(code) (((code) >> 3) & 1)
+#define OPTACC_TB_BEGIN 3
+
+/* private functions */
+static void
+optacc_Init(OPTACC_WORK* wk,
+            const HMM_PROFILE* target,
+            int Q,
+            int T,
+            EDGEBOUNDS* edg,
+            MATRIX_3D_SPARSE* st_SMX_post,
+            MATRIX_2D* sp_MX_post);
+static void
+optacc_Cleanup(OPTACC_WORK* wk);
+static float
+optacc_Fill(OPTACC_WORK* wk,
+            int q_beg,
+            int q_end,
+            int t_beg,
+            int t_end,
+            const TRACE* beg,
+            TRACE* end,
+            int q_mark,
+            char* tb,
+            TRACE* orig);
+static void
+optacc_Clear_Row(OPTACC_WORK* wk,
+                 int q_0,
+                 int t_beg,
+                 int t_end);
+static STATUS_FLAG
+optacc_Solve(OPTACC_WORK* wk,
+             TRACE beg,
+             TRACE end);
+static float
+optacc_Get_Post(OPTACC_WORK* wk,
+                TRACE tr);
+
+/*! FUNCTION:  run_OptimalAccuracy_Sparse()
+ *  SYNOPSIS:  Finds optimal accuracy alignment of posterior (normal space) <st_SMX_post> and <sp_MX_post>,
+ *             and stores full model traceback in <aln>. One core model alignment is found in the query rows
+ *             of each domain in <dom_ranges>, and they are joined by J state (N and C states before the first and after the last).
+ *             Memory is linear in <Q> and <T> (no optimal accuracy matrix is stored).
+ *  RETURN:    Return <STATUS_SUCCESS> if alignment found, <STATUS_FAILURE> if cloud has no path in any domain
+ *             (then <aln> is left empty).
+ */
+STATUS_FLAG
+run_OptimalAccuracy_Sparse(const SEQUENCE* query,         /* query sequence */
+                           const HMM_PROFILE* target,     /* target hmm model */
+                           const int Q,                   /* query length */
+                           const int T,                   /* target length */
+                           EDGEBOUNDS* edg,               /* edgebounds (by row) */
+                           VECTOR_RANGE* dom_ranges,      /* OPTIONAL: query rows of each domain */
+                           MATRIX_3D_SPARSE* st_SMX_post, /* posterior normal matrix */
+                           MATRIX_2D* sp_MX_post,         /* posterior special matrix */
+                           ALIGNMENT* aln,                /* OUTPUT: optimal accuracy alignment */
+                           float* sc_final)               /* OUTPUT: optimal accuracy score */
+{
+  OPTACC_WORK wk;
+  TRACE beg, end, tr;
+  RANGE dom;
+  int N_doms, N_found;
+  int q_beg, q_end, q_prv;
+  float sc, cum_sc;
+
+  optacc_Init(&wk, target, Q, T, edg, st_SMX_post, sp_MX_post);
+  ALIGNMENT_Reuse(aln, Q, T);
+
+  /* without domains, core model alignment may begin and end on any row */
+  N_doms = (dom_ranges != NULL ? VECTOR_RANGE_GetSize(dom_ranges) : 0);
+  N_doms = MAX(N_doms, 1);
+
+  /* build full model alignment, with cumulative optimal accuracy of each trace */
+  cum_sc = 0.0f;
+  ALIGNMENT_AppendTrace(aln, S_ST, 0, 0);
+  ALIGNMENT_AppendScore(aln, logf(cum_sc));
+  N_found = 0;
+  q_prv = 0;
+  for (int i = 0; i < N_doms; i++) {
+    dom = (RANGE){1, Q};
+    if (dom_ranges != NULL && VECTOR_RANGE_GetSize(dom_ranges) > 0) {
+      dom = VEC_X(dom_ranges, i);
+    }
+    /* core model alignments can't share rows */
+    q_beg = MAX(dom.beg, q_prv + 1);
+    q_end = MIN(dom.end, Q);
+    if (q_beg > q_end) {
+      continue;
+    }
+
+    /* find end of optimal path, and where it began: entered from N (if first) or J state, left to C (if last) or J state */
+    wk.beg_sum = (N_found == 0 ? wk.n_sum : wk.j_sum);
+    wk.end_sum = (i == N_doms - 1 ? wk.c_sum : wk.j_sum_rev);
+    sc = optacc_Fill(&wk, q_beg, q_end, 1, T, NULL, &end, -1, NULL, &beg);
+    if (sc == -INF) {
+      continue;
+    }
+    /* find core model path between them */
+    VECTOR_TRACE_Reuse(wk.path);
+    VECTOR_TRACE_Pushback(wk.path, beg);
+    if (end.q_0 != beg.q_0 || end.t_0 != beg.t_0) {
+      if (optacc_Solve(&wk, beg, end) != STATUS_SUCCESS) {
+        continue;
+      }
+    }
+
+    /* N or J state up to core model */
+    if (N_found == 0) {
+      for (int q_0 = 0; q_0 < beg.q_0; q_0++) {
+        cum_sc = wk.n_sum[q_0];
+        ALIGNMENT_AddTrace(aln, (TRACE){q_0, 0, N_ST});
+        ALIGNMENT_AppendScore(aln, logf(cum_sc));
+      }
+    }
+    else {
+      ALIGNMENT_AddTrace(aln, (TRACE){q_prv, 0, J_ST});
+      ALIGNMENT_AppendScore(aln, logf(cum_sc));
+      for (int q_0 = q_prv + 1; q_0 < beg.q_0; q_0++) {
+        cum_sc += wk.j_sum[q_0] - wk.j_sum[q_0 - 1];
+        ALIGNMENT_AddTrace(aln, (TRACE){q_0, 0, J_ST});
+        ALIGNMENT_AppendScore(aln, logf(cum_sc));
+      }
+    }
+    /* begin and end states take position of first and last cell of core model, so reports can find alignment range */
+    ALIGNMENT_AddTrace(aln, (TRACE){beg.q_0, beg.t_0, B_ST});
+    ALIGNMENT_AppendScore(aln, logf(cum_sc));
+    for (int j = 0; j < VECTOR_TRACE_GetSize(wk.path); j++) {
+      tr = VECTOR_TRACE_Get(wk.path, j);
+      cum_sc += optacc_Get_Post(&wk, tr);
+      ALIGNMENT_AppendTrace(aln, tr.st, tr.q_0, tr.t_0);
+      ALIGNMENT_AppendScore(aln, logf(cum_sc));
+    }
+    ALIGNMENT_AddTrace(aln, (TRACE){end.q_0, end.t_0, E_ST});
+    ALIGNMENT_AppendScore(aln, logf(cum_sc));
+
+    q_prv = end.q_0;
+    N_found++;
+  }
+
+  if (N_found == 0) {
+    ALIGNMENT_Reuse(aln, Q, T);
+    *sc_final = -INF;
+    optacc_Cleanup(&wk);
+    return STATUS_FAILURE;
+  }
+
+  /* C state to end of query */
+  ALIGNMENT_AddTrace(aln, (TRACE){0, 0, C_ST});
+  ALIGNMENT_AppendScore(aln, logf(cum_sc));
+  for (int q_0 = q_prv + 1; q_0 <= Q; q_0++) {
+    cum_sc += wk.c_sum[q_0] - wk.c_sum[q_0 + 1];
+    ALIGNMENT_AddTrace(aln, (TRACE){q_0, 0, C_ST});
+    ALIGNMENT_AppendScore(aln, logf(cum_sc));
+  }
+  ALIGNMENT_AppendTrace(aln, T_ST, 0, 0);
+  ALIGNMENT_AppendScore(aln, logf(cum_sc));
+  *sc_final = cum_sc;
+
+  ALIGNMENT_FindRegions(aln);
+  ALIGNMENT_ScoreRegions(aln);
+
+  optacc_Cleanup(&wk);
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION:  optacc_Init()
+ *  SYNOPSIS:  Allocate working data <wk>, and sum special state posteriors <sp_MX_post>.
+ */
+static void
+optacc_Init(OPTACC_WORK* wk,
+            const HMM_PROFILE* target,
+            int Q,
+            int T,
+            EDGEBOUNDS* edg,
+            MATRIX_3D_SPARSE* st_SMX_post,
+            MATRIX_2D* sp_MX_post) {
+  int N = EDGEBOUNDS_GetSize(edg);
+  int r_0;
+
+  wk->target = target;
+  wk->edg = edg;
+  wk->st_SMX_post = st_SMX_post;
+  wk->Q = Q;
+  wk->T = T;
+
+  /* index of each row in edgebounds */
+  wk->row_idx = ERROR_malloc(sizeof(int) * (Q + 2));
+  r_0 = 0;
+  for (int q_0 = 0; q_0 <= Q + 1; q_0++) {
+    while (r_0 < N && EDG_X(edg, r_0).id < q_0) {
+      r_0++;
+    }
+    wk->row_idx[q_0] = r_0;
+  }
+
+  /* N, J and C posteriors are summed, so they can be added for any begin/end row */
+  wk->n_sum = ERROR_malloc(sizeof(float) * (Q + 1));
+  wk->j_sum = ERROR_malloc(sizeof(float) * (Q + 1));
+  wk->j_sum_rev = ERROR_malloc(sizeof(float) * (Q + 2));
+  wk->c_sum = ERROR_malloc(sizeof(float) * (Q + 2));
+  wk->n_sum[0] = 0.0f;
+  wk->j_sum[0] = 0.0f;
+  for (int q_0 = 1; q_0 <= Q; q_0++) {
+    wk->n_sum[q_0] = wk->n_sum[q_0 - 1] + XMX_X(sp_MX_post, SP_N, q_0);
+    wk->j_sum[q_0] = wk->j_sum[q_0 - 1] + XMX_X(sp_MX_post, SP_J, q_0);
+  }
+  wk->c_sum[Q + 1] = 0.0f;
+  wk->j_sum_rev[Q + 1] = 0.0f;
+  for (int q_0 = Q; q_0 >= 1; q_0--) {
+    wk->c_sum[q_0] = wk->c_sum[q_0 + 1] + XMX_X(sp_MX_post, SP_C, q_0);
+    wk->j_sum_rev[q_0] = wk->j_sum_rev[q_0 + 1] + XMX_X(sp_MX_post, SP_J, q_0);
+  }
+  wk->c_sum[0] = wk->c_sum[1];
+  wk->j_sum_rev[0] = wk->j_sum_rev[1];
+  wk->beg_sum = wk->n_sum;
+  wk->end_sum = wk->c_sum;
+
+  /* rows are cleared after use, so only need to be initialized once */
+  for (int i = 0; i < 2; i++) {
+    for (int st_0 = 0; st_0 < NUM_NORMAL_STATES; st_0++) {
+      wk->val[i][st_0] = ERROR_malloc(sizeof(float) * (T + 2));
+      wk->orig[i][st_0] = ERROR_malloc(sizeof(TRACE) * (T + 2));
+      for (int t_0 = 0; t_0 < T + 2; t_0++) {
+        wk->val[i][st_0][t_0] = -INF;
+      }
+      memset(wk->orig[i][st_0], 0, sizeof(TRACE) * (T + 2));
+    }
+  }
+
+  wk->tb = NULL;
+  wk->tb_size = 0;
+  wk->path = VECTOR_TRACE_Create();
+}
+
+/*! FUNCTION:  optacc_Cleanup()
+ *  SYNOPSIS:  Free working data <wk>.
+ */
+static void
+optacc_Cleanup(OPTACC_WORK* wk) {
+  wk->row_idx = ERROR_free(wk->row_idx);
+  wk->n_sum = ERROR_free(wk->n_sum);
+  wk->j_sum = ERROR_free(wk->j_sum);
+  wk->j_sum_rev = ERROR_free(wk->j_sum_rev);
+  wk->c_sum = ERROR_free(wk->c_sum);
+  for (int i = 0; i < 2; i++) {
+    for (int st_0 = 0; st_0 < NUM_NORMAL_STATES; st_0++) {
+      wk->val[i][st_0] = ERROR_free(wk->val[i][st_0]);
+      wk->orig[i][st_0] = ERROR_free(wk->orig[i][st_0]);
+    }
+  }
+  wk->tb = ERROR_free(wk->tb);
+  wk->path = VECTOR_TRACE_Destroy(wk->path);
+}
+
+/*! FUNCTION:  optacc_Fill()
+ *  SYNOPSIS:  Fill optimal accuracy of cloud cells in rows [<q_beg>,<q_end>] and columns [<t_beg>,<t_end>].
+ *             If <beg> is given, paths begin at <beg> (which must be on row <q_beg>).
+ *             Otherwise, paths may begin at any match state (from N state), and <end> is set to
+ *             match state with best path through C state to end of query.
+ *             Origin of each cell is the last cell of its path on row <q_mark>, or the first cell of path if none.
+ *             If <tb> is given, predecessor codes of each cell are stored in it, by offset from (<q_beg>,<t_beg>).
+ *  RETURN:    Optimal accuracy of path to <end> (including N and C states if <beg> not given), and its origin <orig>.
+ */
+static float
+optacc_Fill(OPTACC_WORK* wk,
+            int q_beg,
+            int q_end,
+            int t_beg,
+            int t_end,
+            const TRACE* beg,
+            TRACE* end,
+            int q_mark,
+            char* tb,
+            TRACE* orig) {
+  const HMM_PROFILE* target = wk->target;
+  EDGEBOUNDS* edg = wk->edg;
+  MATRIX_3D_SPARSE* st_SMX_post = wk->st_SMX_post;
+  int W = t_end - t_beg + 1;
+  int c, p;
+  int lb_0, rb_0, qx0, tx0;
+  float** val_cur;
+  float** val_prv;
+  TRACE** orig_cur;
+  TRACE** orig_prv;
+  float sc, best_sc, b_sc;
+  float sc_M, sc_I, sc_D;
+  TRACE or_M, or_I, or_D;
+  int tb_M, tb_I, tb_D;
+  BOUND* bnd;
+  bool is_local = (beg == NULL);
+
+  best_sc = -INF;
+  for (int q_0 = q_beg; q_0 <= q_end; q_0++) {
+    c = q_0 & 1;
+    p = c ^ 1;
+    val_cur = wk->val[c];
+    val_prv = wk->val[p];
+    orig_cur = wk->orig[c];
+    orig_prv = wk->orig[p];
+
+    /* current buffer still holds row two back */
+    if (q_0 - 2 >= q_beg) {
+      optacc_Clear_Row(wk, q_0 - 2, t_beg, t_end);
+    }
+    /* begin state (if local) */
+    b_sc = (is_local ? wk->beg_sum[q_0 - 1] : -INF);
+
+    /* FOR every BOUND in current ROW */
+    for (int r_0 = wk->row_idx[q_0]; r_0 < wk->row_idx[q_0 + 1]; r_0++) {
+      bnd = &EDG_X(edg, r_0);
+      lb_0 = MAX(MAX(bnd->lb, t_beg), 1);
+      rb_0 = MIN(MIN(bnd->rb, t_end + 1), wk->T + 1);
+      qx0 = VECTOR_INT_Get(st_SMX_post->imap_cur, r_0);
+
+      /* FOR every position in TARGET profile */
+      for (int t_0 = lb_0; t_0 < rb_0; t_0++) {
+        int t_1 = t_0 - 1;
+        tx0 = t_0 - bnd->lb;
+
+        or_M = or_I = or_D = (TRACE){-1, -1, X_ST};
+
+        /* match state: diagonal, or from begin state */
+        sc_M = -INF;
+        tb_M = M_ST;
+        if (TSC(t_1, M2M) != -INF && val_prv[MAT_ST][t_1] > sc_M) {
+          sc_M = val_prv[MAT_ST][t_1];
+          or_M = orig_prv[MAT_ST][t_1];
+          tb_M = M_ST;
+        }
+        if (TSC(t_1, I2M) != -INF && val_prv[INS_ST][t_1] > sc_M) {
+          sc_M = val_prv[INS_ST][t_1];
+          or_M = orig_prv[INS_ST][t_1];
+          tb_M = I_ST;
+        }
+        if (TSC(t_1, D2M) != -INF && val_prv[DEL_ST][t_1] > sc_M) {
+          sc_M = val_prv[DEL_ST][t_1];
+          or_M = orig_prv[DEL_ST][t_1];
+          tb_M = D_ST;
+        }
+        if (TSC(t_1, B2M) != -INF && b_sc > sc_M) {
+          sc_M = b_sc;
+          or_M = (TRACE){q_0, t_0, M_ST};
+          tb_M = OPTACC_TB_BEGIN;
+        }
+        if (sc_M != -INF) {
+          sc_M += MSMX_X(st_SMX_post, qx0, tx0);
+        }
+
+        /* insert state: vertical */
+        sc_I = -INF;
+        tb_I = 0;
+        if (TSC(t_0, M2I) != -INF && val_prv[MAT_ST][t_0] > sc_I) {
+          sc_I = val_prv[MAT_ST][t_0];
+          or_I = orig_prv[MAT_ST][t_0];
+          tb_I = 0;
+        }
+        if (TSC(t_0, I2I) != -INF && val_prv[INS_ST][t_0] > sc_I) {
+          sc_I = val_prv[INS_ST][t_0];
+          or_I = orig_prv[INS_ST][t_0];
+          tb_I = 1;
+        }
+        if (sc_I != -INF) {
+          sc_I += ISMX_X(st_SMX_post, qx0, tx0);
+        }
+
+        /* delete state: horizontal (emits nothing) */
+        sc_D = -INF;
+        tb_D = 0;
+        if (TSC(t_1, M2D) != -INF && val_cur[MAT_ST][t_1] > sc_D) {
+          sc_D = val_cur[MAT_ST][t_1];
+          or_D = orig_cur[MAT_ST][t_1];
+          tb_D = 0;
+        }
+        if (TSC(t_1, D2D) != -INF && val_cur[DEL_ST][t_1] > sc_D) {
+          sc_D = val_cur[DEL_ST][t_1];
+          or_D = orig_cur[DEL_ST][t_1];
+          tb_D = 1;
+        }
+
+        /* start of path */
+        if (is_local == false && q_0 == q_beg && t_0 == beg->t_0) {
+          sc_M = sc_I = sc_D = -INF;
+          or_M = or_I = or_D = *beg;
+          if (beg->st == M_ST) {
+            sc_M = 0.0f;
+          }
+          elif (beg->st == I_ST) {
+            sc_I = 0.0f;
+          }
+          else {
+            sc_D = 0.0f;
+          }
+        }
+        /* path crosses marked row */
+        if (q_0 == q_mark) {
+          or_M = (TRACE){q_0, t_0, M_ST};
+          or_I = (TRACE){q_0, t_0, I_ST};
+          or_D = (TRACE){q_0, t_0, D_ST};
+        }
+
+        val_cur[MAT_ST][t_0] = sc_M;
+        val_cur[INS_ST][t_0] = sc_I;
+        val_cur[DEL_ST][t_0] = sc_D;
+        orig_cur[MAT_ST][t_0] = or_M;
+        orig_cur[INS_ST][t_0] = or_I;
+        orig_cur[DEL_ST][t_0] = or_D;
+        if (tb != NULL) {
+          tb[(size_t)(q_0 - q_beg) * W + (t_0 - t_beg)] = tb_M | (tb_I << 2) | (tb_D << 3);
+        }
+
+        /* best path leaves core model from match state, then C or J state after it */
+        if (is_local == true && sc_M != -INF) {
+          sc = sc_M + wk->end_sum[q_0 + 1];
+          if (sc > best_sc) {
+            best_sc = sc;
+            *end = (TRACE){q_0, t_0, M_ST};
+            *orig = or_M;
+          }
+        }
+      }
+    }
+  }
+
+  /* get path to end */
+  if (is_local == false) {
+    c = end->q_0 & 1;
+    best_sc = wk->val[c][end->st][end->t_0];
+    *orig = wk->orig[c][end->st][end->t_0];
+  }
+
+  /* leave rows clear for next use */
+  optacc_Clear_Row(wk, q_end, t_beg, t_end);
+  if (q_end - 1 >= q_beg) {
+    optacc_Clear_Row(wk, q_end - 1, t_beg, t_end);
+  }
+
+  return best_sc;
+}
+
+/*! FUNCTION:  optacc_Clear_Row()
+ *  SYNOPSIS:  Reset cloud cells of row <q_0> in columns [<t_beg>,<t_end>] to -INF in row buffer of <wk>.
+ */
+static void
+optacc_Clear_Row(OPTACC_WORK* wk,
+                 int q_0,
+                 int t_beg,
+                 int t_end) {
+  float** val = wk->val[q_0 & 1];
+  BOUND* bnd;
+  int lb_0, rb_0;
+
+  for (int r_0 = wk->row_idx[q_0]; r_0 < wk->row_idx[q_0 + 1]; r_0++) {
+    bnd = &EDG_X(wk->edg, r_0);
+    lb_0 = MAX(MAX(bnd->lb, t_beg), 1);
+    rb_0 = MIN(MIN(bnd->rb, t_end + 1), wk->T + 1);
+    for (int t_0 = lb_0; t_0 < rb_0; t_0++) {
+      val[MAT_ST][t_0] = -INF;
+      val[INS_ST][t_0] = -INF;
+      val[DEL_ST][t_0] = -INF;
+    }
+  }
+}
+
+/*! FUNCTION:  optacc_Solve()
+ *  SYNOPSIS:  Append optimal accuracy path from <beg> (excluded) to <end> (included) to <wk> path.
+ *             Large subproblems are split at the middle row, small ones are solved by traceback.
+ *  RETURN:    Return <STATUS_SUCCESS> if path found, <STATUS_FAILURE> if cloud has no path from <beg> to <end>.
+ */
+static STATUS_FLAG
+optacc_Solve(OPTACC_WORK* wk,
+             TRACE beg,
+             TRACE end) {
+  int n_rows = end.q_0 - beg.q_0 + 1;
+  int W = end.t_0 - beg.t_0 + 1;
+  size_t n_cells = (size_t)n_rows * W;
+  int q_mid, path_beg, path_end, code;
+  TRACE mid, tr;
+  float sc;
+
+  /* split at middle row */
+  if (n_rows > 2 && n_cells > OPTACC_BLOCK_CELLS) {
+    q_mid = (beg.q_0 + end.q_0) / 2;
+    sc = optacc_Fill(wk, beg.q_0, end.q_0, beg.t_0, end.t_0, &beg, &end, q_mid, NULL, &mid);
+    if (sc == -INF) {
+      return STATUS_FAILURE;
+    }
+    if (optacc_Solve(wk, beg, mid) != STATUS_SUCCESS) {
+      return STATUS_FAILURE;
+    }
+    return optacc_Solve(wk, mid, end);
+  }
+
+  /* solve directly */
+  if (wk->tb_size < n_cells) {
+    wk->tb = ERROR_realloc(wk->tb, sizeof(char) * n_cells);
+    wk->tb_size = n_cells;
+  }
+  sc = optacc_Fill(wk, beg.q_0, end.q_0, beg.t_0, end.t_0, &beg, &end, -1, wk->tb, &mid);
+  if (sc == -INF) {
+    return STATUS_FAILURE;
+  }
+
+  /* traceback from end to beg, then put in order */
+  path_beg = VECTOR_TRACE_GetSize(wk->path);
+  tr = end;
+  while (tr.q_0 != beg.q_0 || tr.t_0 != beg.t_0 || tr.st != beg.st) {
+    /* traceback left subproblem */
+    if (tr.q_0 < beg.q_0 || tr.t_0 < beg.t_0) {
+      return STATUS_FAILURE;
+    }
+    VECTOR_TRACE_Pushback(wk->path, tr);
+    code = wk->tb[(size_t)(tr.q_0 - beg.q_0) * W + (tr.t_0 - beg.t_0)];
+    if (tr.st == M_ST) {
+      tr = (TRACE){tr.q_0 - 1, tr.t_0 - 1, OPTACC_TB_M(code)};
+    }
+    elif (tr.st == I_ST) {
+      tr = (TRACE){tr.q_0 - 1, tr.t_0, (OPTACC_TB_I(code) ? I_ST : M_ST)};
+    }
+    else {
+      tr = (TRACE){tr.q_0, tr.t_0 - 1, (OPTACC_TB_D(code) ? D_ST : M_ST)};
+    }
+  }
+  path_end = VECTOR_TRACE_GetSize(wk->path) - 1;
+  while (path_beg < path_end) {
+    VECTOR_TRACE_Swap(wk->path, path_beg++, path_end--);
+  }
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION:  optacc_Get_Post()
+ *  SYNOPSIS:  Get posterior of emitting state at trace <tr>, or zero for delete state.
+ */
+static float
+optacc_Get_Post(OPTACC_WORK* wk,
+                TRACE tr) {
+  MATRIX_3D_SPARSE* st_SMX_post = wk->st_SMX_post;
+  BOUND* bnd;
+  int qx0;
+
+  if (tr.st == D_ST) {
+    return 0.0f;
+  }
+  for (int r_0 = wk->row_idx[tr.q_0]; r_0 < wk->row_idx[tr.q_0 + 1]; r_0++) {
+    bnd = &EDG_X(wk->edg, r_0);
+    if (IS_IN_RANGE(bnd->lb, bnd->rb - 1, tr.t_0)) {
+      qx0 = VECTOR_INT_Get(st_SMX_post->imap_cur, r_0);
+      return SMX_X(st_SMX_post, tr.st, qx0, tr.t_0 - bnd->lb);
+    }
+  }
+  return 0.0f;
+}
@@ -1,6 +1,30 @@
 /*******************************************************************************
  *  - FILE:  posterior_optacc_sparse.h
  *  - DESC:  Posterior Optimal Accuracy algorithms (Sparse Space).
- *  TODOS:
- *  - Relocate functions pertaining to optimal accuracy computation here.
  *******************************************************************************/
+
+#ifndef _POSTERIOR_OPTACC_SPARSE_H
+#define _POSTERIOR_OPTACC_SPARSE_H
+
+/*! FUNCTION:  run_OptimalAccuracy_Sparse()
+ *  SYNOPSIS:  Finds optimal accuracy alignment of posterior (normal space) <st_SMX_post> and <sp_MX_post>,
+ *             and stores full model traceback in <aln>. One core model alignment is found in the query rows
+ *             of each domain in <dom_ranges>, and they are joined by J state (N and C states before the first and after the last).
+ *             Memory is linear in <Q> and <T> (no optimal accuracy matrix is stored).
+ *  RETURN:    Return <STATUS_SUCCESS> if alignment found, <STATUS_FAILURE> if cloud has no path in any domain
+ *             (then <aln> is left empty).
+ */
+STATUS_FLAG
+run_OptimalAccuracy_Sparse(
+    const SEQUENCE* query,         /* query sequence */
+    const HMM_PROFILE* target,     /* target hmm model */
+    const int Q,                   /* query length */
+    const int T,                   /* target length */
+    EDGEBOUNDS* edg,               /* edgebounds (by row) */
+    VECTOR_RANGE* dom_ranges,      /* OPTIONAL: query rows of each domain. If NULL or empty, full query. */
+    MATRIX_3D_SPARSE* st_SMX_post, /* posterior normal matrix */
+    MATRIX_2D* sp_MX_post,         /* posterior special matrix */
+    ALIGNMENT* aln,                /* OUTPUT: optimal accuracy alignment */
+    float* sc_final);              /* OUTPUT: optimal accuracy score */
+
+#endif /* _POSTERIOR_OPTACC_SPARSE_H */
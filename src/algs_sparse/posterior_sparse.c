@@ -2,12 +2,9 @@
  *  - FILE:  posterior_sparse.h
  *  - DESC:  The Maximum Posterior Probability and Optimal Alignment.
  *  - NOTES:
- *    - There are a few suboptimal arrangements I have to clarify the posterior process.
- *    - Currently, posterior_decoding converts from log to normal space in a separate middle step.
- *      This could be integrated into the first pass through the matrix and reduce passes.
- *      The third step also takes two passes: once to get the total per row, and again
- *      to divide by the total denom.  This summing process could also be done during the
- *      first pass if it were in normal space
+ *    - Posterior is decoded directly into normal space, one row at a time: each row is decoded
+ *      and summed, then scaled by the row total while still in cache.  Optionally, the scaled
+ *      row is also summed per model position for null2 (see posterior_null2_sparse.c).
  *******************************************************************************/
 
 /* imports */
@@ -29,6 +26,19 @@
 #include "_algs_sparse.h"
 #include "posterior_sparse.h"
 
+/* private functions */
+static float
+posterior_Decode_Cells(const float* fwd,
+                       const float* bck,
+                       float* post,
+                       int N_cells,
+                       float overall_sc);
+static void
+posterior_Scale_Cells(float* post,
+                      float* freq,
+                      int N_cells,
+                      float scale);
+
 STATUS_FLAG
 run_Decode_Posterior_Sparse(SEQUENCE* q_seq,               /* query sequence */
                             HMM_PROFILE* t_prof,           /* target hmm model */
@@ -41,37 +51,33 @@ run_Decode_Posterior_Sparse(SEQUENCE* q_seq,               /* query sequence */
                             MATRIX_3D_SPARSE* st_SMX_bck,  /* normal state matrix for backward */
                             MATRIX_2D* sp_MX_bck,          /* special state matrix for backward */
                             MATRIX_3D_SPARSE* st_SMX_post, /* OUTPUT: normal state matrix for posterior */
-                            MATRIX_2D* sp_MX_post)         /* OUTPUT: normal state matrix for posterior */
+                            MATRIX_2D* sp_MX_post,         /* OUTPUT: normal state matrix for posterior */
+                            DOMAIN_DEF* dom_def)           /* OPTIONAL OUTPUT: sums posterior for null2 */
 {
   FILE* fp = NULL;
 
   /* query index */
   int q_0, q_1;
-  int qx0, qx1;
+  int qx0;
   /* target index */
-  int t_0, t_1;
-  int tx0, tx1;
+  int t_0;
+  int tx0;
   /* state index */
   int st_0;
   /* edgebound index */
-  int i_0;
   int r_0, r_0b, r_0e;
   BOUND* bnd;
   RANGE Q_range;
   RANGE T_range;
-  int id, lb_0, rb_0;
-  int lb_T, rb_T;
-  int len;
+  int lb_0, rb_0;
   /* overall score */
   float overall_sc;
   /* common scale factor denominator */
   float denom;
-  /* temp mx scores */
-  float mmx, imx, dmx, smx;
-  float mmx_, imx_, dmx_, smx_;
+  /* special state posteriors */
+  float np, jp, cp;
   /* check if query position is in the domain */
   bool is_q_0_in_dom_range;
-  bool is_q_1_in_dom_range;
 
   /* --------------------------------------------------------------------------- */
 
@@ -81,9 +87,6 @@ run_Decode_Posterior_Sparse(SEQUENCE* q_seq,               /* query sequence */
   overall_sc = XMX_X(sp_MX_fwd, SP_C, Q) +
                XSC_X(t_prof, SP_C, SP_MOVE);
 
-  // printf("overall_sc: %f %f ==> %f\n",
-  //        XMX_X(sp_MX_fwd, SP_C, Q), XSC_X(t_prof, SP_C, SP_MOVE), overall_sc);
-
   /* domain range (query sequence) */
   if (dom_range == NULL) {
     Q_range.beg = 0;
@@ -95,142 +98,147 @@ run_Decode_Posterior_Sparse(SEQUENCE* q_seq,               /* query sequence */
   T_range.beg = 0;
   T_range.end = T + 1;
 
-  /* COMPUTE POSTERIOR */
-  if (true) {
-    /* init index */
-    q_0 = 0;
-    r_0b = r_0e = 0;
+  /* posterior is summed per model position for null2 as it is decoded */
+  if (dom_def != NULL) {
+    run_Null2_Init_Freq(dom_def, T);
+  }
+
+  /* init index */
+  q_0 = 0;
+  r_0b = r_0e = 0;
+  /* check if query position is in domain */
+  is_q_0_in_dom_range = IS_IN_RANGE(Q_range.beg, Q_range.end, q_0);
+  /* get edgebound range */
+  EDGEBOUNDS_NxtRow(edg, &r_0b, &r_0e, q_0);
+
+  /* zero row has no posterior */
+  for (st_0 = 0; st_0 < NUM_SPECIAL_STATES; st_0++) {
+    XMX_X(sp_MX_post, st_0, q_0) = 0.0f;
+  }
+  if (is_q_0_in_dom_range == true) {
+    /* FOR every BOUND in zero ROW */
+    for (r_0 = r_0b; r_0 < r_0e; r_0++) {
+      bnd = &EDG_X(edg, r_0);
+      lb_0 = MAX(bnd->lb, T_range.beg); /* can't overflow left edge */
+      rb_0 = MIN(bnd->rb, T_range.end); /* can't overflow right edge */
+      qx0 = VECTOR_INT_Get(st_SMX_fwd->imap_cur, r_0);
+      tx0 = lb_0 - bnd->lb;
+      if (rb_0 > lb_0) {
+        memset(&MSMX_X(st_SMX_post, qx0, tx0), 0, sizeof(float) * NUM_NORMAL_STATES * (rb_0 - lb_0));
+      }
+    }
+  }
+
+  /* Each row is decoded, then normalized while still in cache (and summed for null2),
+   * so the posterior costs one sweep over the cloud.
+   */
+  /* FOR every position in QUERY sequence (row in matrix) */
+  for (q_0 = 1; q_0 <= Q; q_0++) {
+    q_1 = q_0 - 1;
+
     /* check if query position is in domain */
     is_q_0_in_dom_range = IS_IN_RANGE(Q_range.beg, Q_range.end, q_0);
     /* get edgebound range */
     EDGEBOUNDS_NxtRow(edg, &r_0b, &r_0e, q_0);
 
-    /* initialize special states for zero row */
-    XMX_X(sp_MX_post, SP_E, q_0) = -INF;
-    XMX_X(sp_MX_post, SP_N, q_0) = -INF;
-    XMX_X(sp_MX_post, SP_J, q_0) = -INF;
-    XMX_X(sp_MX_post, SP_B, q_0) = -INF;
-    XMX_X(sp_MX_post, SP_C, q_0) = -INF;
-
-    /* if sequence position is in domain range */
+    /* special states */
+    np = XMX_X(sp_MX_fwd, SP_N, q_1) +
+         XMX_X(sp_MX_bck, SP_N, q_0) +
+         XSC_X(t_prof, SP_N, SP_LOOP) -
+         overall_sc;
+    jp = XMX_X(sp_MX_fwd, SP_J, q_1) +
+         XMX_X(sp_MX_bck, SP_J, q_0) +
+         XSC_X(t_prof, SP_J, SP_LOOP) -
+         overall_sc;
+    cp = XMX_X(sp_MX_fwd, SP_C, q_1) +
+         XMX_X(sp_MX_bck, SP_C, q_0) +
+         XSC_X(t_prof, SP_C, SP_LOOP) -
+         overall_sc;
+    np = expf(np);
+    jp = expf(jp);
+    cp = expf(cp);
+    denom = np + jp + cp;
+
+    /* decode normal states into normal space, summing row for normalization */
     if (is_q_0_in_dom_range == true) {
-      /* FOR every BOUND in zero ROW */
+      /* FOR every BOUND in current ROW */
       for (r_0 = r_0b; r_0 < r_0e; r_0++) {
         /* get bound data */
         bnd = &EDG_X(edg, r_0);
-        id = bnd->id;
-        lb_T = bnd->lb <= 0;
         lb_0 = MAX(bnd->lb, T_range.beg); /* can't overflow left edge */
-        rb_T = bnd->rb >= T;
         rb_0 = MIN(bnd->rb, T_range.end); /* can't overflow right edge */
+        if (rb_0 <= lb_0) {
+          continue;
+        }
 
         /* fetch data mapping bound start location to data block in sparse matrix */
         qx0 = VECTOR_INT_Get(st_SMX_fwd->imap_cur, r_0); /* (q_0, t_0) location offset */
 
+        /* special case for left edge of range: no posterior */
+        t_0 = lb_0;
+        tx0 = t_0 - bnd->lb;
+        MSMX_X(st_SMX_post, qx0, tx0) = 0.0f;
+        ISMX_X(st_SMX_post, qx0, tx0) = 0.0f;
+        DSMX_X(st_SMX_post, qx0, tx0) = 0.0f;
+
+        /* MAIN RECURSION */
         /* FOR every position in TARGET profile */
-        for (t_0 = lb_0; t_0 < rb_0; t_0++) {
+        t_0 = lb_0 + 1;
+        tx0 = t_0 - bnd->lb;
+        if (rb_0 - 1 > t_0) {
+          denom += posterior_Decode_Cells(&MSMX_X(st_SMX_fwd, qx0, tx0),
+                                          &MSMX_X(st_SMX_bck, qx0, tx0),
+                                          &MSMX_X(st_SMX_post, qx0, tx0),
+                                          (rb_0 - 1) - t_0,
+                                          overall_sc);
+        }
+
+        /* special case for right edge of range: match state only */
+        if (rb_0 > 1) {
+          t_0 = rb_0 - 1;
           tx0 = t_0 - bnd->lb;
-          /* zero column is -inf in logspace.  We can skip this step and convert to normal space now. */
-          MSMX_X(st_SMX_post, qx0, tx0) = -INF;
-          ISMX_X(st_SMX_post, qx0, tx0) = -INF;
-          DSMX_X(st_SMX_post, qx0, tx0) = -INF;
+          MSMX_X(st_SMX_post, qx0, tx0) = expf(MSMX_X(st_SMX_fwd, qx0, tx0) +
+                                               MSMX_X(st_SMX_bck, qx0, tx0) -
+                                               overall_sc);
+          ISMX_X(st_SMX_post, qx0, tx0) = 0.0f;
+          DSMX_X(st_SMX_post, qx0, tx0) = 0.0f;
+          denom += MSMX_X(st_SMX_post, qx0, tx0);
         }
       }
     }
 
-    /* FOR every position in QUERY sequence (row in matrix) */
-    for (q_0 = 1; q_0 <= Q; q_0++) {
-      q_1 = q_0 - 1;
+    /* normalize by scaling row by common factor denominator */
+    denom = 1.0f / denom;
 
-      /* check if query position is in domain */
-      is_q_0_in_dom_range = IS_IN_RANGE(Q_range.beg, Q_range.end, q_0);
-      /* get edgebound range */
-      EDGEBOUNDS_NxtRow(edg, &r_0b, &r_0e, q_0);
-
-      /* if sequence position is in domain range */
-      if (is_q_0_in_dom_range == true) {
-        /* FOR every BOUND in current ROW */
-        for (r_0 = r_0b; r_0 < r_0e; r_0++) {
-          /* get bound data */
-          bnd = &EDG_X(edg, r_0);
-          id = bnd->id;
-          lb_T = bnd->lb <= 0;
-          lb_0 = MAX(bnd->lb, T_range.beg); /* can't overflow left edge */
-          rb_T = bnd->rb >= T;
-          rb_0 = MIN(bnd->rb, T_range.end); /* can't overflow right edge */
-
-          /* fetch data mapping bound start location to data block in sparse matrix */
-          qx0 = VECTOR_INT_Get(st_SMX_fwd->imap_cur, r_0); /* (q_0, t_0) location offset */
-          qx1 = VECTOR_INT_Get(st_SMX_fwd->imap_prv, r_0); /* (q_1, t_0) location offset */
-
-          /* unrolled first loop: special case for left edge of range */
-          if (true) {
-            t_0 = lb_0;
-            tx0 = t_0 - bnd->lb;
-
-            /* zero column is -inf in logspace.  We can skip this step and convert to normal space now. */
-            MSMX_X(st_SMX_post, qx0, tx0) = -INF;
-            ISMX_X(st_SMX_post, qx0, tx0) = -INF;
-            DSMX_X(st_SMX_post, qx0, tx0) = -INF;
-          }
-
-          /* MAIN RECURSION */
-          /* FOR every position in TARGET profile */
-          for (t_0 = lb_0 + 1; t_0 < rb_0 - 1; t_0++) {
-            tx0 = t_0 - bnd->lb;
-
-            /* normal states */
-            mmx = MSMX_X(st_SMX_fwd, qx0, tx0) +
-                  MSMX_X(st_SMX_bck, qx0, tx0) -
-                  overall_sc;
-            MSMX_X(st_SMX_post, qx0, tx0) = mmx;
-
-            imx = ISMX_X(st_SMX_fwd, qx0, tx0) +
-                  ISMX_X(st_SMX_bck, qx0, tx0) -
-                  overall_sc;
-            ISMX_X(st_SMX_post, qx0, tx0) = imx;
-
-            DSMX_X(st_SMX_post, qx0, tx0) = -INF;
-          }
-
-          /* unrolled final loop: special case for right edge of range */
-          if (true && rb_0 > 1) {
-            t_0 = rb_0 - 1;
-            tx0 = t_0 - bnd->lb;
-
-            /* normal states */
-            mmx = MSMX_X(st_SMX_fwd, qx0, tx0) +
-                  MSMX_X(st_SMX_bck, qx0, tx0) -
-                  overall_sc;
-            MSMX_X(st_SMX_post, qx0, tx0) = mmx;
-
-            ISMX_X(st_SMX_post, qx0, tx0) = -INF;
-            DSMX_X(st_SMX_post, qx0, tx0) = -INF;
-          }
+    /* apply denominator scaling factor to entire row */
+    if (is_q_0_in_dom_range == true) {
+      /* FOR every BOUND in current ROW */
+      for (r_0 = r_0b; r_0 < r_0e; r_0++) {
+        bnd = &EDG_X(edg, r_0);
+        lb_0 = MAX(bnd->lb, T_range.beg); /* can't overflow left edge */
+        rb_0 = MIN(bnd->rb, T_range.end); /* can't overflow right edge */
+        if (rb_0 <= lb_0) {
+          continue;
         }
+        qx0 = VECTOR_INT_Get(st_SMX_fwd->imap_cur, r_0);
+        tx0 = lb_0 - bnd->lb;
+        posterior_Scale_Cells(&MSMX_X(st_SMX_post, qx0, tx0),
+                              (dom_def != NULL ? &MX_2D(dom_def->st_freq, lb_0, 0) : NULL),
+                              rb_0 - lb_0,
+                              denom);
       }
+    }
+
+    XMX_X(sp_MX_post, SP_E, q_0) = 0.0f;
+    XMX_X(sp_MX_post, SP_B, q_0) = 0.0f;
+    XMX_X(sp_MX_post, SP_N, q_0) = np * denom;
+    XMX_X(sp_MX_post, SP_J, q_0) = jp * denom;
+    XMX_X(sp_MX_post, SP_C, q_0) = cp * denom;
 
-      /* special states */
-      XMX_X(sp_MX_post, SP_E, q_0) = -INF;
-      XMX_X(sp_MX_post, SP_B, q_0) = -INF;
-
-      smx = XMX_X(sp_MX_fwd, SP_N, q_1) +
-            XMX_X(sp_MX_bck, SP_N, q_0) +
-            XSC_X(t_prof, SP_N, SP_LOOP) -
-            overall_sc;
-      XMX_X(sp_MX_post, SP_N, q_0) = smx;
-
-      smx = XMX_X(sp_MX_fwd, SP_J, q_1) +
-            XMX_X(sp_MX_bck, SP_J, q_0) +
-            XSC_X(t_prof, SP_J, SP_LOOP) -
-            overall_sc;
-      XMX_X(sp_MX_post, SP_J, q_0) = smx;
-
-      smx = XMX_X(sp_MX_fwd, SP_C, q_1) +
-            XMX_X(sp_MX_bck, SP_C, q_0) +
-            XSC_X(t_prof, SP_C, SP_LOOP) -
-            overall_sc;
-      XMX_X(sp_MX_post, SP_C, q_0) = smx;
+    if (dom_def != NULL) {
+      for (st_0 = 0; st_0 < NUM_SPECIAL_STATES; st_0++) {
+        VEC_X(dom_def->sp_freq, st_0) += XMX_X(sp_MX_post, st_0, q_0);
+      }
     }
   }
 
@@ -243,142 +251,159 @@ run_Decode_Posterior_Sparse(SEQUENCE* q_seq,               /* query sequence */
   }
 #endif
 
-  /* CONVERT TO NORMAL SPACE */
-  if (true) {
-    MATRIX_3D_SPARSE_Exp(st_SMX_post);
-    MATRIX_2D_Exp(sp_MX_post);
-  }
+  return STATUS_SUCCESS;
+}
 
-  /* NORMALIZE MATRIX */
-  if (true) {
-    /* init indexes */
-    q_0 = 0;
-    r_0b = r_0e = 0;
-    /* check if query position is in domain */
-    is_q_0_in_dom_range = IS_IN_RANGE(Q_range.beg, Q_range.end, q_0);
-    /* get edgebound range */
-    EDGEBOUNDS_NxtRow(edg, &r_0b, &r_0e, q_0);
+/* === FAST EXP =================================================================
+ * exp() by range reduction to 2^n * exp(r), |r| <= ln(2)/2, and a degree-5 polynomial
+ * for exp(r) (Cephes expf coefficients). Relative error is about 2e-7. Inputs below
+ * <POST_EXP_LO> (e.g. -INF) give exactly zero.  It is set just above ln(FLT_MIN), so no
+ * lane ever computes a denormal, which is very slow on most cpus.
+ * ==============================================================================
+ */
+#define POST_EXP_HI 88.3762626647949f
+#define POST_EXP_LO -87.0f
+#define POST_EXP_LOG2E 1.44269504088896341f
+#define POST_EXP_C1 0.693359375f
+#define POST_EXP_C2 -2.12194440e-4f
+#define POST_EXP_P0 1.9875691500E-4f
+#define POST_EXP_P1 1.3981999507E-3f
+#define POST_EXP_P2 8.3334519073E-3f
+#define POST_EXP_P3 4.1665795894E-2f
+#define POST_EXP_P4 1.6666665459E-1f
+#define POST_EXP_P5 5.0000001201E-1f
+
+#if (SIMD_METHOD == SIMD_SSE)
+/*! FUNCTION:  posterior_Exp_SSE()
+ *  SYNOPSIS:  Fast exp() of four floats <x>.
+ */
+static inline __m128
+posterior_Exp_SSE(__m128 x) {
+  __m128 is_zero, fx, fl, y, z;
+  __m128i n;
+
+  is_zero = _mm_cmplt_ps(x, _mm_set1_ps(POST_EXP_LO));
+  x = _mm_min_ps(x, _mm_set1_ps(POST_EXP_HI));
+  x = _mm_max_ps(x, _mm_set1_ps(POST_EXP_LO));
+
+  /* n = round(x / ln(2)) */
+  fx = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(POST_EXP_LOG2E)), _mm_set1_ps(0.5f));
+  fl = _mm_cvtepi32_ps(_mm_cvttps_epi32(fx));
+  fl = _mm_sub_ps(fl, _mm_and_ps(_mm_cmpgt_ps(fl, fx), _mm_set1_ps(1.0f)));
+  /* r = x - n * ln(2) */
+  x = _mm_sub_ps(x, _mm_mul_ps(fl, _mm_set1_ps(POST_EXP_C1)));
+  x = _mm_sub_ps(x, _mm_mul_ps(fl, _mm_set1_ps(POST_EXP_C2)));
+
+  /* exp(r) */
+  z = _mm_mul_ps(x, x);
+  y = _mm_set1_ps(POST_EXP_P0);
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(POST_EXP_P1));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(POST_EXP_P2));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(POST_EXP_P3));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(POST_EXP_P4));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(POST_EXP_P5));
+  y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, z), x), _mm_set1_ps(1.0f));
+
+  /* scale by 2^n */
+  n = _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(fl), _mm_set1_epi32(127)), 23);
+  y = _mm_mul_ps(y, _mm_castsi128_ps(n));
+
+  return _mm_andnot_ps(is_zero, y);
+}
+#endif
 
-    /* FOR every position in QUERY sequence (row in matrix) */
-    for (q_0 = 1; q_0 <= Q; q_0++) {
-      q_1 = q_0 - 1;
-      t_0 = 0;
-      /* check if query position is in domain */
-      is_q_0_in_dom_range = (q_0 >= Q_range.beg && q_0 < Q_range.end);
-      /* get edgebound range */
-      EDGEBOUNDS_NxtRow(edg, &r_0b, &r_0e, q_0);
-
-      denom = 0.0;
-
-      /* only compute if in domain range */
-      if (is_q_0_in_dom_range == true) {
-        /* FOR every BOUND in current ROW */
-        for (r_0 = r_0b; r_0 < r_0e; r_0++) {
-          /* get bound data */
-          bnd = &EDG_X(edg, r_0);
-          id = bnd->id;
-          lb_T = bnd->lb <= 0;
-          lb_0 = MAX(bnd->lb, T_range.beg); /* can't overflow left edge */
-          rb_T = bnd->rb >= T;
-          rb_0 = MIN(bnd->rb, T_range.end); /* can't overflow right edge */
-
-          /* fetch data mapping bound start location to data block in sparse matrix */
-          qx0 = VECTOR_INT_Get(st_SMX_fwd->imap_cur, r_0); /* (q_0, t_0) location offset */
-          qx1 = VECTOR_INT_Get(st_SMX_fwd->imap_prv, r_0); /* (q_1, t_0) location offset */
-
-          /* MAIN RECURSION */
-          /* FOR every position in TARGET profile */
-          for (t_0 = lb_0 + 1; t_0 < rb_0 - 1; t_0++) {
-            t_1 = t_0 - 1;
-            tx0 = t_0 - bnd->lb;
-            tx1 = tx0 - 1;
-
-            /* normal states */
-            denom += MSMX_X(st_SMX_post, qx0, tx0);
-            denom += ISMX_X(st_SMX_post, qx0, tx0);
-          }
-
-          /* unrolled final loop: special case for right edge of range */
-          if (true && (rb_0 > 1)) {
-            t_1 = t_0 - 1;
-            tx0 = t_0 - bnd->lb;
-            tx1 = tx0 - 1;
-
-            denom += MSMX_X(st_SMX_post, qx0, tx0);
-          }
-        }
+/*! FUNCTION:  posterior_Decode_Cells()
+ *  SYNOPSIS:  Decode <N_cells> contiguous cells of a row from forward <fwd> and backward <bck>
+ *             into normal space posterior <post>: exp(fwd + bck - <overall_sc>) for match and
+ *             insert states, and zero for delete states.
+ *  RETURN:    Sum of posterior over cells.
+ */
+static float
+posterior_Decode_Cells(const float* fwd,
+                       const float* bck,
+                       float* post,
+                       int N_cells,
+                       float overall_sc) {
+  const int N = N_cells * NUM_NORMAL_STATES;
+  float sum = 0.0f;
+  int i = 0;
+
+#if (SIMD_METHOD == SIMD_SSE)
+  {
+    /* cells are interleaved {M,I,D}, so 4 cells span 3 vectors; mask out delete states */
+    const __m128 mask[3] = {
+        _mm_castsi128_ps(_mm_setr_epi32(-1, -1, 0, -1)), /* M I D M */
+        _mm_castsi128_ps(_mm_setr_epi32(-1, 0, -1, -1)), /* I D M I */
+        _mm_castsi128_ps(_mm_setr_epi32(0, -1, -1, 0)),  /* D M I D */
+    };
+    const __m128 v_overall = _mm_set1_ps(overall_sc);
+    __m128 v_sum = _mm_setzero_ps();
+    __m128 v_x;
+    float sums[4];
+
+    for (; i + 12 <= N; i += 12) {
+      for (int j = 0; j < 3; j++) {
+        v_x = _mm_sub_ps(_mm_add_ps(_mm_loadu_ps(fwd + i + 4 * j), _mm_loadu_ps(bck + i + 4 * j)), v_overall);
+        v_x = _mm_and_ps(posterior_Exp_SSE(v_x), mask[j]);
+        _mm_storeu_ps(post + i + 4 * j, v_x);
+        v_sum = _mm_add_ps(v_sum, v_x);
       }
+    }
+    _mm_storeu_ps(sums, v_sum);
+    sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+  }
+#endif
 
-      /* special states */
-      denom += XMX_X(sp_MX_post, SP_N, q_0) +
-               XMX_X(sp_MX_post, SP_J, q_0) +
-               XMX_X(sp_MX_post, SP_C, q_0);
-
-      /* normalize by scaling row by common factor denominator */
-      // if (q_0 < 5) printf("denom(q_0 = %d): %9.4f %9.4f\n", q_0, denom, 1.0 / denom);
-      denom = 1.0 / denom;
-
-      /* apply denominator scaling factor to entire row */
-      if (is_q_0_in_dom_range == true) {
-        /* FOR every BOUND in current ROW */
-        for (r_0 = r_0b; r_0 < r_0e; r_0++) {
-          /* get bound data */
-          bnd = &EDG_X(edg, r_0);
-          id = bnd->id;
-          lb_T = bnd->lb <= 0;
-          lb_0 = MAX(bnd->lb, T_range.beg); /* can't overflow left edge */
-          rb_T = bnd->rb >= T;
-          rb_0 = MIN(bnd->rb, T_range.end); /* can't overflow right edge */
-
-          /* fetch data mapping bound start location to data block in sparse matrix */
-          qx0 = VECTOR_INT_Get(st_SMX_fwd->imap_cur, r_0); /* (q_0, t_0) location offset */
-          qx1 = VECTOR_INT_Get(st_SMX_fwd->imap_prv, r_0); /* (q_1, t_0) location offset */
-
-          /* if left bound touches the left edge */
-          if (true) {
-            t_0 = lb_0;
-            tx0 = t_0 - bnd->lb;
-            /* normalize by scaling row by common factor denominator */
-            MSMX_X(st_SMX_post, qx0, tx0) *= denom;
-            ISMX_X(st_SMX_post, qx0, tx0) = 0.0;
-            DSMX_X(st_SMX_post, qx0, tx0) = 0.0;
-          }
-
-          /* normalize all values to fraction of total column weight */
-          /* FOR every position in TARGET profile */
-          for (t_0 = lb_0 + 1; t_0 < rb_0 - 1; t_0++) {
-            t_1 = t_0 - 1;
-            tx0 = t_0 - bnd->lb;
-            tx1 = tx0 - 1;
-
-            /* normalize by scaling row by common factor denominator */
-            MSMX_X(st_SMX_post, qx0, tx0) *= denom;
-            ISMX_X(st_SMX_post, qx0, tx0) *= denom;
-            DSMX_X(st_SMX_post, qx0, tx0) = 0.0;
-          }
-
-          /* if right bound touches the right edge */
-          if (true && rb_0 > 1) {
-            t_0 = rb_0 - 1;
-            t_1 = t_0 - 1;
-            tx0 = t_0 - bnd->lb;
-            tx1 = tx0 - 1;
-            /* normalize by scaling row by common factor denominator */
-            MSMX_X(st_SMX_post, qx0, tx0) *= denom;
-            ISMX_X(st_SMX_post, qx0, tx0) = 0.0;
-            DSMX_X(st_SMX_post, qx0, tx0) = 0.0;
-          }
-        }
-      }
+  /* remaining cells */
+  for (; i < N; i += NUM_NORMAL_STATES) {
+    post[i + MAT_ST] = expf(fwd[i + MAT_ST] + bck[i + MAT_ST] - overall_sc);
+    post[i + INS_ST] = expf(fwd[i + INS_ST] + bck[i + INS_ST] - overall_sc);
+    post[i + DEL_ST] = 0.0f;
+    sum += post[i + MAT_ST] + post[i + INS_ST];
+  }
+
+  return sum;
+}
 
-      /* normalize by scaling row by common factor denominator */
-      XMX_X(sp_MX_post, SP_N, q_0) *= denom;
-      XMX_X(sp_MX_post, SP_J, q_0) *= denom;
-      XMX_X(sp_MX_post, SP_C, q_0) *= denom;
+/*! FUNCTION:  posterior_Scale_Cells()
+ *  SYNOPSIS:  Scale <N_cells> contiguous cells of posterior <post> by <scale>.
+ *             If <freq> is not NULL, also add scaled cells to <freq> (with same layout).
+ */
+static void
+posterior_Scale_Cells(float* post,
+                      float* freq,
+                      int N_cells,
+                      float scale) {
+  const int N = N_cells * NUM_NORMAL_STATES;
+  int i = 0;
+
+#if (SIMD_METHOD == SIMD_SSE)
+  {
+    const __m128 v_scale = _mm_set1_ps(scale);
+    __m128 v_x;
+
+    if (freq != NULL) {
+      for (; i + 4 <= N; i += 4) {
+        v_x = _mm_mul_ps(_mm_loadu_ps(post + i), v_scale);
+        _mm_storeu_ps(post + i, v_x);
+        _mm_storeu_ps(freq + i, _mm_add_ps(_mm_loadu_ps(freq + i), v_x));
+      }
+    }
+    else {
+      for (; i + 4 <= N; i += 4) {
+        _mm_storeu_ps(post + i, _mm_mul_ps(_mm_loadu_ps(post + i), v_scale));
+      }
     }
   }
+#endif
 
-  return STATUS_SUCCESS;
+  /* remaining cells */
+  for (; i < N; i++) {
+    post[i] *= scale;
+    if (freq != NULL) {
+      freq[i] += post[i];
+    }
+  }
 }
 
 STATUS_FLAG
@@ -390,84 +415,117 @@ run_Decode_Domains(SEQUENCE* q_seq,      /* query sequence */
                    MATRIX_2D* sp_MX_fwd, /* special state matrix for forward */
                    MATRIX_2D* sp_MX_bck, /* special state matrix for backward */
                    DOMAIN_DEF* dom_def)  /* OUTPUT: domain data */
+{
+  int q_0;
+
+  /* compute posterior for B, E, and core model states (via HMMER method) */
+  run_Decode_Domains_Init(Q, dom_def);
+  for (q_0 = Q; q_0 >= 0; q_0--) {
+    run_Decode_Domains_Row(t_prof, Q, q_0, sp_MX_fwd, sp_MX_bck, dom_def);
+  }
+  /* find all domain ranges */
+  run_Decode_Domains_Regions(Q, dom_def);
+
+  return STATUS_SUCCESS;
+}
+
+void run_Decode_Domains_Init(int Q,               /* query length */
+                             DOMAIN_DEF* dom_def) /* OUTPUT: domain data */
+{
+  VECTOR_FLT_SetSize(dom_def->b_tot, Q + 1);
+  VECTOR_FLT_SetSize(dom_def->e_tot, Q + 1);
+  VECTOR_FLT_SetSize(dom_def->m_occ, Q + 1);
+
+  VEC_X(dom_def->b_tot, 0) = 0.0f;
+  VEC_X(dom_def->e_tot, 0) = 0.0f;
+  VEC_X(dom_def->m_occ, 0) = 0.0f;
+}
+
+void run_Decode_Domains_Row(const HMM_PROFILE* t_prof, /* target hmm model */
+                            int Q,                     /* query length */
+                            int q_0,                   /* row of backward which was just completed */
+                            MATRIX_2D* sp_MX_fwd,      /* special state matrix for forward */
+                            MATRIX_2D* sp_MX_bck,      /* special state matrix for backward */
+                            DOMAIN_DEF* dom_def)       /* OUTPUT: domain data */
+{
+  int q_1;
+  double btot_add, etot_add;
+  double njcp, np, jp, cp;
+  float overall_logp;
+
+  /* scalar for preventing underflow error */
+  overall_logp = XMX_X(sp_MX_fwd, SP_C, Q) +
+                 XSC_X(t_prof, SP_C, SP_MOVE);
+
+  /* probability of having reached the end state */
+  if (q_0 >= 1) {
+    etot_add = XMX_X(sp_MX_fwd, SP_E, q_0) +
+               XMX_X(sp_MX_bck, SP_E, q_0) -
+               overall_logp;
+    VEC_X(dom_def->e_tot, q_0) = exp(etot_add);
+  }
+
+  /* begin state and core model occupancy of next row only need backward of this row */
+  if (q_0 < Q) {
+    q_1 = q_0 + 1;
+
+    /* probability of having reached the begin state */
+    btot_add = XMX_X(sp_MX_fwd, SP_B, q_0) +
+               XMX_X(sp_MX_bck, SP_B, q_0) -
+               overall_logp;
+    VEC_X(dom_def->b_tot, q_1) = exp(btot_add);
+
+    /* probability of being in the main model (match,insert,delete) */
+    np = XMX_X(sp_MX_fwd, SP_N, q_0) +
+         XMX_X(sp_MX_bck, SP_N, q_1) +
+         XSC_X(t_prof, SP_N, SP_LOOP) -
+         overall_logp;
+    np = expf(np);
+    jp = XMX_X(sp_MX_fwd, SP_J, q_0) +
+         XMX_X(sp_MX_bck, SP_J, q_1) +
+         XSC_X(t_prof, SP_J, SP_LOOP) -
+         overall_logp;
+    jp = expf(jp);
+    cp = XMX_X(sp_MX_fwd, SP_C, q_0) +
+         XMX_X(sp_MX_bck, SP_C, q_1) +
+         XSC_X(t_prof, SP_C, SP_LOOP) -
+         overall_logp;
+    cp = expf(cp);
+    njcp = np + jp + cp;
+
+    VEC_X(dom_def->m_occ, q_1) = 1.0 - njcp;
+  }
+}
+
+STATUS_FLAG
+run_Decode_Domains_Regions(int Q,               /* query length */
+                           DOMAIN_DEF* dom_def) /* OUTPUT: domain data */
 {
   FILE* fp;
   VECTOR_FLT* idx;
 
   int q_0, q_1;
   int q_beg, q_end;
-  int t_0, t_1;
   int t_beg, t_end;
-  double b_0, e_0;
-  double btot_add, etot_add;
-  double njcp, np, jp, cp;
   float mocc_0, btot_0, btot_1, etot_0, etot_1;
   float rt1_test, rt2_btest, rt2_etest;
   float rt1_max, rt2_bmax, rt2_emax;
-  float rt1_crit, rt2_crit;
-  float rt1, rt2, rt3;
-  float overall_logp;
+  float rt2_crit;
+  float rt1, rt2;
   bool is_in_domain;
   bool rt2_bhit, rt2_ehit;
   bool is_multiple_domains;
 
-  /* scalar for preventing underflow error */
-  overall_logp = XMX_X(sp_MX_fwd, SP_C, Q) +
-                 XSC_X(t_prof, SP_C, SP_MOVE);
-  // printf("# overall_logp: %7.4f, Q = %d\n", overall_logp, Q );
-
   /* domain threshold test 1: */
   rt1 = dom_def->rt1;
   /* domain threshold test 2: */
   rt2 = dom_def->rt2;
 
-  VECTOR_FLT_SetSize(dom_def->b_tot, Q + 1);
-  VECTOR_FLT_SetSize(dom_def->e_tot, Q + 1);
-  VECTOR_FLT_SetSize(dom_def->m_occ, Q + 1);
-
-  VEC_X(dom_def->b_tot, 0) = 0.0f;
-  VEC_X(dom_def->e_tot, 0) = 0.0f;
-  VEC_X(dom_def->m_occ, 0) = 0.0f;
-
-  /* compute posterior for B, E, and core model states (via HMMER method) */
-  if (true) {
-    for (q_0 = 1; q_0 <= Q; q_0++) {
-      q_1 = q_0 - 1;
-
-      /* probability of having reached the begin state */
-      btot_add = XMX_X(sp_MX_fwd, SP_B, q_1) +
-                 XMX_X(sp_MX_bck, SP_B, q_1) -
-                 overall_logp;
-      VEC_X(dom_def->b_tot, q_0) = VEC_X(dom_def->b_tot, q_1) +
-                                   exp(btot_add);
-
-      /* probability of having reached the end state */
-      etot_add = XMX_X(sp_MX_fwd, SP_E, q_0) +
-                 XMX_X(sp_MX_bck, SP_E, q_0) -
-                 overall_logp;
-      VEC_X(dom_def->e_tot, q_0) = VEC_X(dom_def->e_tot, q_1) +
-                                   exp(etot_add);
-
-      /* probability of being in the main model (match,insert,delete) */
-      np = XMX_X(sp_MX_fwd, SP_N, q_1) +
-           XMX_X(sp_MX_bck, SP_N, q_0) +
-           XSC_X(t_prof, SP_N, SP_LOOP) -
-           overall_logp;
-      np = expf(np);
-      jp = XMX_X(sp_MX_fwd, SP_J, q_1) +
-           XMX_X(sp_MX_bck, SP_J, q_0) +
-           XSC_X(t_prof, SP_J, SP_LOOP) -
-           overall_logp;
-      jp = expf(jp);
-      cp = XMX_X(sp_MX_fwd, SP_C, q_1) +
-           XMX_X(sp_MX_bck, SP_C, q_0) +
-           XSC_X(t_prof, SP_C, SP_LOOP) -
-           overall_logp;
-      cp = expf(cp);
-      njcp = np + jp + cp;
-
-      VEC_X(dom_def->m_occ, q_0) = 1.0 - njcp;
-    }
+  /* rows hold begin and end state probabilities, make them cumulative */
+  for (q_0 = 1; q_0 <= Q; q_0++) {
+    q_1 = q_0 - 1;
+    VEC_X(dom_def->b_tot, q_0) += VEC_X(dom_def->b_tot, q_1);
+    VEC_X(dom_def->e_tot, q_0) += VEC_X(dom_def->e_tot, q_1);
   }
 
 #if DEBUG
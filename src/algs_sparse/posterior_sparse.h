@@ -41,7 +41,9 @@ run_Posterior_Sparse(
 
 /*! FUNCTION:  run_Decode_Normal_Posterior_Sparse()
  *  SYNOPSIS:  Using <...fwd> and <...bck> dp matrices to create special state
- * posterior into <...post>. Can store matrix in <...fwd> or <...bck>. NOTE:
+ * posterior into <...post>. Can store matrix in <...fwd> or <...bck>. If
+ * <dom_def> is given, posterior is also summed for null2 in the same pass
+ * (finish with run_Null2_ByExpectation_FromFreq()). NOTE:
  * Modeled after <p7_Decoding()>. RETURN:    Return <STATUS_SUCCESS> if no
  * errors.
  */
@@ -59,7 +61,8 @@ run_Decode_Posterior_Sparse(
     MATRIX_2D* sp_MX_bck,        /* special state matrix for backward */
     MATRIX_3D_SPARSE*
         st_MX_post,         /* OUTPUT: normal state matrix for posterior */
-    MATRIX_2D* sp_MX_post); /* OUTPUT: normal state matrix for posterior */
+    MATRIX_2D* sp_MX_post, /* OUTPUT: normal state matrix for posterior */
+    DOMAIN_DEF* dom_def);  /* OPTIONAL OUTPUT: sums posterior for null2 */
 
 /*! FUNCTION:  run_Decode_Domains()
  *  SYNOPSIS:  Filled dp matrices for forward <st_MX_fwd> and backward
@@ -78,4 +81,33 @@ run_Decode_Domains(SEQUENCE* q_seq,      /* query sequence */
                    MATRIX_2D* sp_MX_bck, /* special state matrix for backward */
                    DOMAIN_DEF* dom_def); /* OUTPUT: domain data */
 
+/*! FUNCTION:  run_Decode_Domains_Init()
+ *  SYNOPSIS:  Size the per-row domain data of <dom_def> for query of length <Q>,
+ *             before it is filled by run_Decode_Domains_Row().
+ */
+void run_Decode_Domains_Init(int Q,                /* query length */
+                             DOMAIN_DEF* dom_def); /* OUTPUT: domain data */
+
+/*! FUNCTION:  run_Decode_Domains_Row()
+ *  SYNOPSIS:  Compute the begin, end and core model posterior mass that becomes available once
+ *             row <q_0> of backward <sp_MX_bck> is complete (forward <sp_MX_fwd> must be complete).
+ *             Rows must be given in backward order, from <Q> down to 0. This lets backward decode
+ *             domain data as it goes, so that only run_Decode_Domains_Regions() remains afterwards.
+ */
+void run_Decode_Domains_Row(const HMM_PROFILE* t_prof, /* target hmm model */
+                            int Q,                     /* query length */
+                            int q_0,                   /* row of backward which was just completed */
+                            MATRIX_2D* sp_MX_fwd,      /* special state matrix for forward */
+                            MATRIX_2D* sp_MX_bck,      /* special state matrix for backward */
+                            DOMAIN_DEF* dom_def);      /* OUTPUT: domain data */
+
+/*! FUNCTION:  run_Decode_Domains_Regions()
+ *  SYNOPSIS:  Find domain ranges from the per-row domain data of <dom_def>, filled for all rows by
+ *             run_Decode_Domains_Row(). Does not need the dp matrices.
+ *  RETURN:    Return <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Decode_Domains_Regions(int Q,                /* query length */
+                           DOMAIN_DEF* dom_def); /* OUTPUT: domain data */
+
 #endif /* _POSTERIOR_SPARSE_H */
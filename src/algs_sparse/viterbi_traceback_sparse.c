@@ -615,6 +615,222 @@ run_Viterbi_Traceback_Sparse(const SEQUENCE* query,                 /* query seq
   return STATUS_SUCCESS;
 }
 
+/*! FUNCTION:  run_Viterbi_Traceback_Sparse_Ptrs()
+ *  SYNOPSIS:  Run Viterbi Traceback to recover Optimal Alignment, from backpointers
+ *             <vit_ptrs> and special states <sp_MX_vit> of run_Bound_Viterbi_Sparse_Ptrs().
+ *             Traceback follows stored backpointers, so needs no score comparisons.
+ *             Score of each core trace is then recomputed along the path.
+ *
+ *    RETURN:  Return <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Viterbi_Traceback_Sparse_Ptrs(const SEQUENCE* query,         /* query sequence */
+                                  const HMM_PROFILE* target,     /* HMM model */
+                                  const int Q,                   /* query/seq length */
+                                  const int T,                   /* target/model length */
+                                  const EDGEBOUNDS* edg,         /* edgebounds of sparse matrix */
+                                  VITERBI_PTRS* vit_ptrs,        /* backpointers from viterbi */
+                                  MATRIX_2D* restrict sp_MX_vit, /* Special State (J,N,B,C,E) Matrix */
+                                  ALIGNMENT* aln)                /* OUTPUT: Traceback Alignment */
+{
+  /* generic dp matrix pointers for macros */
+  MATRIX_2D* sp_MX = sp_MX_vit;
+
+  /* vars for traceback */
+  int q_0, t_0;     /* current query and target position */
+  int st_cur;       /* current state */
+  int cell = -1;    /* index of current cell in backpointers */
+  int ptr;          /* backpointers of current cell */
+  int sp_ptr;       /* backpointers of special states of current row */
+  CHAR* cells;      /* packed backpointers for each cell */
+  TRACE* tr;        /* traces of alignment */
+  int N;            /* number of traces */
+  int A;            /* int value of character at current query position */
+  float sc_cur;     /* score at current trace */
+  float tsc;        /* transition score into current trace */
+
+  cells = vit_ptrs->cells->data;
+
+  /* clear memory for trace */
+  ALIGNMENT_Reuse(aln, Q, T);
+
+  /* Backtracing, so begins at the T (exit) state, then C state of last row */
+  q_0 = Q;
+  t_0 = 0;
+  st_cur = C_ST;
+  ALIGNMENT_AddTrace(aln, (TRACE){q_0, t_0, T_ST});
+  ALIGNMENT_AddTrace(aln, (TRACE){q_0, t_0, C_ST});
+
+  /* Run traceback until S (entry) state */
+  while (st_cur != S_ST) {
+    sp_ptr = VEC_X(vit_ptrs->sp_ptr, q_0);
+
+    switch (st_cur) {
+      /* C STATE: from E or C (previous row) */
+      case C_ST: {
+        if (sp_ptr & VPTR_C_FROM_E) {
+          st_cur = E_ST;
+        } else {
+          q_0--;
+        }
+      } break;
+
+      /* E STATE: from best M or D of row */
+      case E_ST: {
+        t_0 = VEC_X(vit_ptrs->e_ptr, q_0);
+        st_cur = (sp_ptr & VPTR_E_FROM_D) ? D_ST : M_ST;
+      } break;
+
+      /* M STATE: from M, I, D (previous row and column) or B (previous row) */
+      case M_ST: {
+        ptr = VPTR_GET(cells, cell) & VPTR_M_MASK;
+        q_0--;
+        t_0--;
+        if (ptr == VPTR_M_FROM_B) {
+          st_cur = B_ST;
+          t_0 = 0;
+        }
+        elif (ptr == VPTR_M_FROM_I) {
+          st_cur = I_ST;
+        }
+        elif (ptr == VPTR_M_FROM_D) {
+          st_cur = D_ST;
+        }
+      } break;
+
+      /* I STATE: from M or I (previous row) */
+      case I_ST: {
+        ptr = VPTR_GET(cells, cell);
+        q_0--;
+        if (!(ptr & VPTR_I_FROM_I)) {
+          st_cur = M_ST;
+        }
+      } break;
+
+      /* D STATE: from M or D (previous column) */
+      case D_ST: {
+        ptr = VPTR_GET(cells, cell);
+        t_0--;
+        if (!(ptr & VPTR_D_FROM_D)) {
+          st_cur = M_ST;
+        }
+      } break;
+
+      /* B STATE: from N or J */
+      case B_ST: {
+        st_cur = (sp_ptr & VPTR_B_FROM_J) ? J_ST : N_ST;
+      } break;
+
+      /* J STATE: from E or J (previous row) */
+      case J_ST: {
+        if (sp_ptr & VPTR_J_FROM_E) {
+          st_cur = E_ST;
+        } else {
+          q_0--;
+        }
+      } break;
+
+      /* N STATE: from N (previous row), or from S at start of query */
+      case N_ST: {
+        if (q_0 == 0) {
+          st_cur = S_ST;
+        } else {
+          q_0--;
+        }
+      } break;
+
+      default: {
+        fprintf(stderr, "ERROR: Hit Bogus State!!! => %d\n", st_cur);
+        ERRORCHECK_exit(EXIT_FAILURE);
+      }
+    }
+
+    /* core states must be inside the cloud */
+    if (st_cur == M_ST || st_cur == I_ST || st_cur == D_ST) {
+      cell = VITERBI_PTRS_GetIndex(vit_ptrs, edg, q_0, t_0);
+      if (cell < 0) {
+        fprintf(stderr, "ERROR: Viterbi traceback left sparse matrix at %s(%d,%d).\n",
+                STATE_NAMES[st_cur], q_0, t_0);
+        ERRORCHECK_exit(EXIT_FAILURE);
+      }
+    }
+
+    /* push new trace onto the alignment */
+    ALIGNMENT_AddTrace(aln, (TRACE){q_0, t_0, st_cur});
+  }
+
+  /* reverse order of traceback */
+  ALIGNMENT_Reverse(aln);
+
+  /* recompute score of each trace, from start of alignment */
+  N = ALIGNMENT_GetSize(aln);
+  tr = aln->traces->data;
+  sc_cur = MY_One();
+  for (int i = 0; i < N; i++) {
+    q_0 = tr[i].q_0;
+    t_0 = tr[i].t_0;
+
+    switch (tr[i].st) {
+      case S_ST: {
+        sc_cur = MY_One();
+      } break;
+      case N_ST: {
+        sc_cur = XMX(SP_N, q_0);
+      } break;
+      case B_ST: {
+        sc_cur = XMX(SP_B, q_0);
+      } break;
+      case E_ST: {
+        sc_cur = XMX(SP_E, q_0);
+      } break;
+      case J_ST: {
+        sc_cur = XMX(SP_J, q_0);
+      } break;
+      case C_ST: {
+        sc_cur = XMX(SP_C, q_0);
+      } break;
+      case T_ST: {
+        sc_cur = MY_Prod(XMX(SP_C, Q), XSC(SP_C, SP_MOVE));
+      } break;
+      case M_ST: {
+        A = AA_REV[query->seq[q_0 - 1]];
+        tsc = (tr[i - 1].st == B_ST) ? TSC(t_0 - 1, B2M) : (tr[i - 1].st == I_ST) ? TSC(t_0 - 1, I2M)
+                                                      : (tr[i - 1].st == D_ST) ? TSC(t_0 - 1, D2M)
+                                                                               : TSC(t_0 - 1, M2M);
+        sc_cur = MY_Prod(MY_Prod(sc_cur, tsc), MSC(t_0, A));
+      } break;
+      case I_ST: {
+        A = AA_REV[query->seq[q_0 - 1]];
+        tsc = (tr[i - 1].st == I_ST) ? TSC(t_0, I2I) : TSC(t_0, M2I);
+        sc_cur = MY_Prod(MY_Prod(sc_cur, tsc), ISC(t_0, A));
+      } break;
+      case D_ST: {
+        tsc = (tr[i - 1].st == D_ST) ? TSC(t_0 - 1, D2D) : TSC(t_0 - 1, M2D);
+        sc_cur = MY_Prod(sc_cur, tsc);
+      } break;
+    }
+    ALIGNMENT_AppendScore(aln, sc_cur);
+  }
+
+  /* B and E take position of first and last cell of their core alignment */
+  for (int i = 1; i < N - 1; i++) {
+    if (tr[i].st == B_ST) {
+      tr[i].q_0 = tr[i + 1].q_0;
+      tr[i].t_0 = tr[i + 1].t_0;
+    }
+    if (tr[N - 1 - i].st == E_ST) {
+      tr[N - 1 - i].q_0 = tr[N - 2 - i].q_0;
+      tr[N - 1 - i].t_0 = tr[N - 2 - i].t_0;
+    }
+  }
+
+  /* Set main model regions of alignment */
+  ALIGNMENT_FindRegions(aln);
+  ALIGNMENT_ScoreRegions(aln);
+
+  return STATUS_SUCCESS;
+}
+
 /* MATH RULES: These determine how probilities are summed, multiplied, and certain identities */
 
 static inline float
@@ -24,4 +24,20 @@ run_Viterbi_Traceback_Sparse(
     MATRIX_2D* restrict sp_MX_vit,         /* Special State (J,N,B,C,E) Matrix */
     ALIGNMENT* aln);                       /* OUTPUT: Traceback Alignment */
 
+/*! FUNCTION:  run_Viterbi_Traceback_Sparse_Ptrs()
+ *  SYNOPSIS:  Run Viterbi Traceback to recover Optimal Alignment, from backpointers
+ *             <vit_ptrs> and special states <sp_MX_vit> of run_Bound_Viterbi_Sparse_Ptrs().
+ *    RETURN:  Return <STATUS_SUCCESS> if no errors.
+ */
+STATUS_FLAG
+run_Viterbi_Traceback_Sparse_Ptrs(
+    const SEQUENCE* query,         /* query sequence */
+    const HMM_PROFILE* target,     /* HMM model */
+    const int Q,                   /* query/seq length */
+    const int T,                   /* target/model length */
+    const EDGEBOUNDS* edg,         /* edgebounds of sparse matrix */
+    VITERBI_PTRS* vit_ptrs,        /* backpointers from viterbi */
+    MATRIX_2D* restrict sp_MX_vit, /* Special State (J,N,B,C,E) Matrix */
+    ALIGNMENT* aln);               /* OUTPUT: Traceback Alignment */
+
 #endif /* _VITERBI_TRACEBACK_SPARSE_H */
@@ -0,0 +1,1121 @@
+/*******************************************************************************
+ *  - FILE:  mmoreseqs_bench.c
+ *  - DESC:  Entry Point to Benchmark: times core MMORE kernels and parsers on
+ *           loaded or synthetic query/profile pairs and reports throughput.
+ *  NOTES:
+ *    - Each kernel is run <warmup> untimed times, then <reps> timed times.
+ *      Reports min/median/mean runtime and median throughput (units/sec).
+ *    - Kernels are run in pipeline order, so each has valid inputs from the one before:
+ *      cloud fwd/bck (int16, then float) => union => reorient => bound fwd/bck => posterior
+ *      => optimal accuracy => viterbi (backpointers) and traceback.
+ *    - Shape of the sparse search space can be the cloud found by cloud search (cloud),
+ *      a fixed-width band around the anchor diagonal (band), or the full dp matrix (full).
+ *    - Synthetic queries are emitted from the profile's match states (flanked by
+ *      background residues), so the cloud search follows a real homologous diagonal.
+ *    - With --gen, instead writes a synthetic database of profiles (.hmm), homologous and
+ *      random sequences (.fasta) and a matching hit list (.m8), for end-to-end benchmarks
+ *      of the mmore stage (see scripts/dev/bench_e2e.py).
+ *******************************************************************************/
+
+/* import stdlib */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+#include <errno.h>
+#include <sys/stat.h>
+
+/* import local libraries */
+#include "easel.h"
+
+/* include local files */
+#include "objects/structs.h"
+#include "utilities/_utilities.h"
+#include "objects/_objects.h"
+#include "parsers/_parsers.h"
+#include "algs_linear/_algs_linear.h"
+#include "algs_sparse/_algs_sparse.h"
+#include "work/_work.h"
+
+/* shape of search space for sparse kernels */
+typedef enum {
+  BENCH_SHAPE_CLOUD = 0,
+  BENCH_SHAPE_BAND = 1,
+  BENCH_SHAPE_FULL = 2,
+} BENCH_SHAPE;
+#define NUM_BENCH_SHAPES 3
+
+static const char* BENCH_SHAPE_NAMES[] = {
+    "cloud",
+    "band",
+    "full",
+};
+
+/* benchmarked kernels and parsers */
+typedef enum {
+  BENCH_VITERBI = 0,
+  BENCH_CLOUD_FWD_I16 = 1,
+  BENCH_CLOUD_BCK_I16 = 2,
+  BENCH_CLOUD_FWD = 3,
+  BENCH_CLOUD_BCK = 4,
+  BENCH_UNION = 5,
+  BENCH_UNION_OLD = 6,
+  BENCH_REORIENT = 7,
+  BENCH_BOUND_FWD = 8,
+  BENCH_BOUND_BCK = 9,
+  BENCH_POSTERIOR = 10,
+  BENCH_OPTACC = 11,
+  BENCH_VITERBI_PTRS = 12,
+  BENCH_PARSE_HMM = 13,
+  BENCH_PARSE_FASTA = 14,
+  BENCH_PARSE_M8 = 15,
+} BENCH_KERNEL;
+#define NUM_BENCH_KERNELS 16
+
+static const char* BENCH_KERNEL_NAMES[] = {
+    "viterbi-lin",
+    "cloud-fwd-i16",
+    "cloud-bck-i16",
+    "cloud-fwd-lin",
+    "cloud-bck-lin",
+    "edg-union",
+    "edg-union-old",
+    "edg-reorient",
+    "bound-fwd-sp",
+    "bound-bck-sp",
+    "posterior-sp",
+    "optacc-sp",
+    "viterbi-ptrs-sp",
+    "parse-hmm",
+    "parse-fasta",
+    "parse-m8",
+};
+
+/* units of work counted for each kernel */
+static const char* BENCH_KERNEL_UNITS[] = {
+    "cells",
+    "cells",
+    "cells",
+    "cells",
+    "cells",
+    "cells",
+    "cells",
+    "cells",
+    "cells",
+    "cells",
+    "cells",
+    "cells",
+    "cells",
+    "nodes",
+    "residues",
+    "records",
+};
+
+/* benchmark settings and scratch space */
+typedef struct {
+  /* inputs */
+  STR hmm_filein;     /* target .hmm file (if NULL, profiles are synthesized) */
+  STR fasta_filein;   /* query .fasta file (if NULL, queries are synthesized) */
+  STR m8_filein;      /* .m8 file (only used for parser benchmark) */
+  VECTOR_INT* q_lens; /* synthetic query lengths */
+  VECTOR_INT* t_lens; /* synthetic profile lengths */
+  float conserve;     /* synthetic profile: probability mass of consensus residue per node */
+  /* synthetic database */
+  STR gen_dir;        /* output directory (if not NULL, generate database instead of timing kernels) */
+  int gen_profiles;   /* number of profiles */
+  int gen_seqs;       /* number of sequences */
+  long gen_hits;      /* number of m8 hits */
+  float gen_homologs; /* fraction of sequences (and hits) which are homologous */
+  /* search space */
+  BENCH_SHAPE shape;
+  int band_width;
+  /* repetition */
+  int warmup;
+  int reps;
+  unsigned int seed;
+  /* scratch space for parser benchmarks */
+  HMM_PROFILE* prof_tmp;
+  SEQUENCE* seq_tmp;
+  VECTOR_DBL* times;
+} BENCH;
+
+/* private functions */
+static void
+BENCH_SetDefaults(BENCH* bench);
+static void
+BENCH_Parse(BENCH* bench, ARGS* args, int argc, char* argv[]);
+static void
+BENCH_Parse_Lengths(VECTOR_INT* lens, char* list);
+static void
+BENCH_Help(FILE* fp);
+static void
+BENCH_Synth_Profile(WORKER* worker, BENCH* bench, int T);
+static void
+BENCH_Synth_Query(WORKER* worker, int Q, RANGE* q_core, RANGE* t_core);
+static int
+BENCH_Sample(double* weights);
+static void
+BENCH_Setup(WORKER* worker, RANGE q_core, RANGE t_core);
+static void
+BENCH_Set_Shape(WORKER* worker, BENCH* bench);
+static size_t
+BENCH_Run(WORKER* worker, BENCH* bench, BENCH_KERNEL kernel);
+static void
+BENCH_Time(WORKER* worker, BENCH* bench, BENCH_KERNEL kernel);
+static void
+BENCH_Run_Pair(WORKER* worker, BENCH* bench);
+static void
+BENCH_Generate(WORKER* worker, BENCH* bench);
+static void
+BENCH_Write_Profile(HMM_PROFILE* prof, FILE* fp);
+static void
+BENCH_Write_Probs(float* probs, int N, FILE* fp);
+static void
+BENCH_Write_Sequence(char* name, char* seq, FILE* fp);
+static void
+BENCH_Write_Hit(BENCH* bench, char* t_name, char* q_name, bool is_homolog, RANGE t_core, RANGE q_core, FILE* fp);
+static FILE*
+BENCH_Open(BENCH* bench, const char* filename);
+
+/* === MAIN ENTRY-POINT TO BENCHMARK === */
+STATUS_FLAG
+main(int argc, char* argv[]) {
+  BENCH bench;
+  RANGE q_core, t_core;
+  int n_q, n_t;
+
+  /* initialize worker and args object */
+  WORKER* worker = WORKER_Create();
+  WORKER_Init(worker);
+  ARGS_SetDefaults(worker->args);
+  worker->args->verbose_level = VERBOSE_NONE;
+
+  /* parse benchmark options */
+  BENCH_SetDefaults(&bench);
+  BENCH_Parse(&bench, worker->args, argc, argv);
+  RNG_Init_Seed(bench.seed);
+
+  /* only linear and sparse data structs are needed */
+  worker->tasks->linear = true;
+  worker->tasks->sparse = true;
+  worker->tasks->lin_cloud_fwd = true;
+  worker->tasks->lin_cloud_bck = true;
+  worker->args->is_run_full = (bench.shape == BENCH_SHAPE_FULL);
+  WORK_init(worker);
+  bench.prof_tmp = HMM_PROFILE_Create();
+  bench.seq_tmp = SEQUENCE_Create();
+  bench.times = VECTOR_DBL_Create();
+
+  /* generate synthetic database instead of timing kernels */
+  if (bench.gen_dir != NULL) {
+    BENCH_Generate(worker, &bench);
+  }
+  else {
+    printf("# === MMORESEQS BENCHMARK ===\n");
+    printf("# target: %s\n", (bench.hmm_filein != NULL ? bench.hmm_filein : "synthetic"));
+    printf("# query:  %s\n", (bench.fasta_filein != NULL ? bench.fasta_filein : "synthetic"));
+    printf("# shape: %s, band: %d, alpha: %.2f, beta: %.2f, gamma: %d\n",
+           BENCH_SHAPE_NAMES[bench.shape], bench.band_width,
+           worker->cloud_params.alpha, worker->cloud_params.beta, worker->cloud_params.gamma);
+    printf("# warmup: %d, reps: %d, seed: %u\n", bench.warmup, bench.reps, bench.seed);
+    printf("#%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n",
+           "kernel", "shape", "Q", "T", "unit", "count", "reps",
+           "time-min", "time-median", "time-mean", "rate-median");
+
+    /* parsers */
+    if (bench.hmm_filein != NULL) {
+      BENCH_Time(worker, &bench, BENCH_PARSE_HMM);
+    }
+    if (bench.fasta_filein != NULL) {
+      BENCH_Time(worker, &bench, BENCH_PARSE_FASTA);
+    }
+    if (bench.m8_filein != NULL) {
+      BENCH_Time(worker, &bench, BENCH_PARSE_M8);
+    }
+
+    /* kernels: loaded inputs override the synthetic lengths on their side */
+    n_t = (bench.hmm_filein != NULL ? 1 : VECTOR_INT_GetSize(bench.t_lens));
+    n_q = (bench.fasta_filein != NULL ? 1 : VECTOR_INT_GetSize(bench.q_lens));
+    for (int i = 0; i < n_t; i++) {
+      if (bench.hmm_filein != NULL) {
+        HMM_PROFILE_Parse(worker->t_prof, bench.hmm_filein, 0);
+        HMM_PROFILE_Convert_NegLog_To_Real(worker->t_prof);
+        HMM_PROFILE_Config(worker->t_prof, worker->args->search_mode);
+      } else {
+        BENCH_Synth_Profile(worker, &bench, VECTOR_INT_Get(bench.t_lens, i));
+        HMM_PROFILE_Config(worker->t_prof, worker->args->search_mode);
+      }
+
+      for (int j = 0; j < n_q; j++) {
+        if (bench.fasta_filein != NULL) {
+          SEQUENCE_Fasta_Parse(worker->q_seq, bench.fasta_filein, 0);
+          /* without a known alignment, anchor on the main diagonal */
+          q_core = (RANGE){1, worker->q_seq->N};
+          t_core = (RANGE){1, worker->t_prof->N};
+        } else {
+          BENCH_Synth_Query(worker, VECTOR_INT_Get(bench.q_lens, j), &q_core, &t_core);
+        }
+        BENCH_Setup(worker, q_core, t_core);
+        BENCH_Run_Pair(worker, &bench);
+      }
+    }
+  }
+
+  /* clean up allocated data */
+  bench.prof_tmp = HMM_PROFILE_Destroy(bench.prof_tmp);
+  bench.seq_tmp = SEQUENCE_Destroy(bench.seq_tmp);
+  bench.times = VECTOR_DBL_Destroy(bench.times);
+  bench.q_lens = VECTOR_INT_Destroy(bench.q_lens);
+  bench.t_lens = VECTOR_INT_Destroy(bench.t_lens);
+  WORK_cleanup(worker);
+  WORKER_Destroy(worker);
+
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION:  BENCH_SetDefaults()
+ *  SYNOPSIS:  Set default benchmark settings in <bench>.
+ */
+static void
+BENCH_SetDefaults(BENCH* bench) {
+  bench->hmm_filein = NULL;
+  bench->fasta_filein = NULL;
+  bench->m8_filein = NULL;
+  bench->q_lens = VECTOR_INT_Create();
+  bench->t_lens = VECTOR_INT_Create();
+  bench->conserve = 0.5f;
+  bench->gen_dir = NULL;
+  bench->gen_profiles = 100;
+  bench->gen_seqs = 1000;
+  bench->gen_hits = 1000;
+  bench->gen_homologs = 0.8f;
+  bench->shape = BENCH_SHAPE_CLOUD;
+  bench->band_width = 20;
+  bench->warmup = 1;
+  bench->reps = 5;
+  bench->seed = 1;
+  bench->prof_tmp = NULL;
+  bench->seq_tmp = NULL;
+  bench->times = NULL;
+}
+
+/*! FUNCTION:  BENCH_Parse()
+ *  SYNOPSIS:  Parse commandline options into <bench>.
+ *             Cloud search parameters are stored in <args>, so WORK_init() picks them up.
+ */
+static void
+BENCH_Parse(BENCH* bench,
+            ARGS* args,
+            int argc,
+            char* argv[]) {
+  char* opt = NULL;
+  char* val = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    opt = argv[i];
+    /* options with no argument */
+    if (strcmp(opt, "-h") == 0 || strcmp(opt, "--help") == 0) {
+      BENCH_Help(stdout);
+      exit(EXIT_SUCCESS);
+    }
+    /* all remaining options take one argument */
+    if (i + 1 >= argc) {
+      fprintf(stderr, "ERROR: Option '%s' requires an argument.\n", opt);
+      BENCH_Help(stderr);
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+    val = argv[++i];
+
+    if (strcmp(opt, "--hmm") == 0) {
+      bench->hmm_filein = val;
+    }
+    elif (strcmp(opt, "--fasta") == 0) {
+      bench->fasta_filein = val;
+    }
+    elif (strcmp(opt, "--m8") == 0) {
+      bench->m8_filein = val;
+    }
+    elif (strcmp(opt, "--qlen") == 0) {
+      BENCH_Parse_Lengths(bench->q_lens, val);
+    }
+    elif (strcmp(opt, "--tlen") == 0) {
+      BENCH_Parse_Lengths(bench->t_lens, val);
+    }
+    elif (strcmp(opt, "--conserve") == 0) {
+      bench->conserve = atof(val);
+      if (bench->conserve < 0.0f || bench->conserve > 1.0f) {
+        fprintf(stderr, "ERROR: --conserve must be in range [0,1].\n");
+        ERRORCHECK_exit(EXIT_FAILURE);
+      }
+    }
+    elif (strcmp(opt, "--gen") == 0) {
+      bench->gen_dir = val;
+    }
+    elif (strcmp(opt, "--gen-profiles") == 0) {
+      bench->gen_profiles = atoi(val);
+    }
+    elif (strcmp(opt, "--gen-seqs") == 0) {
+      bench->gen_seqs = atoi(val);
+    }
+    elif (strcmp(opt, "--gen-hits") == 0) {
+      bench->gen_hits = atol(val);
+    }
+    elif (strcmp(opt, "--gen-homologs") == 0) {
+      bench->gen_homologs = atof(val);
+      if (bench->gen_homologs < 0.0f || bench->gen_homologs > 1.0f) {
+        fprintf(stderr, "ERROR: --gen-homologs must be in range [0,1].\n");
+        ERRORCHECK_exit(EXIT_FAILURE);
+      }
+    }
+    elif (strcmp(opt, "--shape") == 0) {
+      bench->shape = -1;
+      for (int j = 0; j < NUM_BENCH_SHAPES; j++) {
+        if (strcmp(val, BENCH_SHAPE_NAMES[j]) == 0) {
+          bench->shape = j;
+        }
+      }
+      if (bench->shape == -1) {
+        fprintf(stderr, "ERROR: Invalid shape '%s'. Must be 'cloud', 'band' or 'full'.\n", val);
+        ERRORCHECK_exit(EXIT_FAILURE);
+      }
+    }
+    elif (strcmp(opt, "--band") == 0) {
+      bench->band_width = atoi(val);
+    }
+    elif (strcmp(opt, "--alpha") == 0) {
+      args->alpha = atof(val);
+    }
+    elif (strcmp(opt, "--beta") == 0) {
+      args->beta = atof(val);
+    }
+    elif (strcmp(opt, "--gamma") == 0) {
+      args->gamma = atoi(val);
+    }
+    elif (strcmp(opt, "--warmup") == 0) {
+      bench->warmup = atoi(val);
+    }
+    elif (strcmp(opt, "--reps") == 0) {
+      bench->reps = atoi(val);
+    }
+    elif (strcmp(opt, "--seed") == 0) {
+      bench->seed = atoi(val);
+    }
+    else {
+      fprintf(stderr, "ERROR: Unknown option '%s'.\n", opt);
+      BENCH_Help(stderr);
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+  }
+
+  if (bench->reps < 1 || bench->warmup < 0 || bench->band_width < 0) {
+    fprintf(stderr, "ERROR: --reps must be positive, --warmup and --band must be non-negative.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  if (bench->gen_profiles < 1 || bench->gen_seqs < 1 || bench->gen_hits < 0) {
+    fprintf(stderr, "ERROR: --gen-profiles and --gen-seqs must be positive, --gen-hits must be non-negative.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  /* default lengths */
+  if (VECTOR_INT_GetSize(bench->q_lens) == 0) {
+    BENCH_Parse_Lengths(bench->q_lens, "100,400,1600");
+  }
+  if (VECTOR_INT_GetSize(bench->t_lens) == 0) {
+    BENCH_Parse_Lengths(bench->t_lens, "100,400");
+  }
+}
+
+/*! FUNCTION:  BENCH_Parse_Lengths()
+ *  SYNOPSIS:  Parse comma-separated <list> of positive lengths and append them to <lens>.
+ */
+static void
+BENCH_Parse_Lengths(VECTOR_INT* lens,
+                    char* list) {
+  char* buf = STR_Create(list);
+  char* save = NULL;
+  int len;
+
+  for (char* tok = strtok_r(buf, ",", &save); tok != NULL; tok = strtok_r(NULL, ",", &save)) {
+    len = atoi(tok);
+    if (len <= 0) {
+      fprintf(stderr, "ERROR: Invalid length '%s'. Lengths must be positive integers.\n", tok);
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+    VECTOR_INT_Pushback(lens, len);
+  }
+  buf = STR_Destroy(buf);
+}
+
+/*! FUNCTION:  BENCH_Help()
+ *  SYNOPSIS:  Print usage to <fp>.
+ */
+static void
+BENCH_Help(FILE* fp) {
+  fprintf(fp, "Usage: mmoreseqs_bench [options]\n");
+  fprintf(fp, "  --hmm <file>          target .hmm file; first profile is used [default: synthesize profiles]\n");
+  fprintf(fp, "  --fasta <file>        query .fasta file; first sequence is used [default: synthesize queries]\n");
+  fprintf(fp, "  --m8 <file>           .m8 file to benchmark m8 parser\n");
+  fprintf(fp, "  --qlen <n,n,...>      synthetic query lengths [100,400,1600]\n");
+  fprintf(fp, "  --tlen <n,n,...>      synthetic profile lengths [100,400]\n");
+  fprintf(fp, "  --conserve <f>        synthetic profile: consensus residue probability per node [0.5]\n");
+  fprintf(fp, "  --shape <s>           sparse search space: cloud, band or full [cloud]\n");
+  fprintf(fp, "  --band <n>            band half-width around anchor diagonal, for '--shape band' [20]\n");
+  fprintf(fp, "  --alpha/--beta <f>    cloud search pruning parameters [12.0/16.0]\n");
+  fprintf(fp, "  --gamma <n>           cloud search antidiagonals before pruning [5]\n");
+  fprintf(fp, "  --warmup <n>          untimed runs per kernel [1]\n");
+  fprintf(fp, "  --reps <n>            timed runs per kernel [5]\n");
+  fprintf(fp, "  --seed <n>            random seed for synthetic inputs [1]\n");
+  fprintf(fp, "  --gen <dir>           write synthetic database to <dir> (target.hmm, query.fasta, hits.m8, labels.tsv),\n");
+  fprintf(fp, "                        using --tlen/--qlen as profile/sequence lengths, instead of timing kernels\n");
+  fprintf(fp, "  --gen-profiles <n>    number of synthetic profiles [100]\n");
+  fprintf(fp, "  --gen-seqs <n>        number of synthetic sequences [1000]\n");
+  fprintf(fp, "  --gen-hits <n>        number of m8 hits [1000]\n");
+  fprintf(fp, "  --gen-homologs <f>    fraction of sequences and hits which are homologous [0.8]\n");
+}
+
+/*! FUNCTION:  BENCH_Synth_Profile()
+ *  SYNOPSIS:  Synthesize a profile of length <T> into <t_prof> of <worker>.
+ *             Each node puts <conserve> of its match emission mass on a random consensus residue,
+ *             and the rest on the background. Transitions follow HMM_PROFILE_From_Seq().
+ *             Profile is left in real space: caller must run HMM_PROFILE_Config() before searching.
+ */
+static void
+BENCH_Synth_Profile(WORKER* worker,
+                    BENCH* bench,
+                    int T) {
+  HMM_PROFILE* prof = worker->t_prof;
+  HMM_NODE* node = NULL;
+  const float popen = 0.02f;   /* gap open probability */
+  const float pextend = 0.4f;  /* gap extend probability */
+  int cons;
+
+  HMM_PROFILE_SetModel_Length(prof, T);
+  HMM_PROFILE_SetTextField(&prof->name, "synthetic");
+
+  for (int k = 0; k <= T; k++) {
+    node = &prof->hmm_model[k];
+    cons = RNG_Range(0, NUM_AMINO);
+    for (int x = 0; x < NUM_AMINO; x++) {
+      node->match[x] = (1.0f - bench->conserve) * BG_MODEL[x] + (x == cons ? bench->conserve : 0.0f);
+      node->insert[x] = BG_MODEL[x];
+    }
+    for (int x = NUM_AMINO; x < NUM_AMINO_PLUS_SPEC; x++) {
+      node->match[x] = -INF;
+      node->insert[x] = 0.0f;
+    }
+    node->trans[M2M] = 1.0f - 2 * popen;
+    node->trans[M2I] = popen;
+    node->trans[M2D] = popen;
+    node->trans[I2M] = 1.0f - pextend;
+    node->trans[I2I] = pextend;
+    node->trans[D2M] = 1.0f - pextend;
+    node->trans[D2D] = pextend;
+  }
+  /* initial node */
+  node = &prof->hmm_model[0];
+  node->match[0] = 1.0f;
+  for (int x = 1; x < NUM_AMINO; x++) {
+    node->match[x] = 0.0f;
+  }
+  /* final node */
+  node = &prof->hmm_model[T];
+  node->trans[M2M] = 1.0f - popen;
+  node->trans[M2D] = 0.0f;
+  node->trans[D2M] = 1.0f;
+  node->trans[D2D] = 0.0f;
+  /* background */
+  for (int x = 0; x < NUM_AMINO; x++) {
+    prof->bg_model->compo[x] = BG_MODEL[x];
+    prof->bg_model->insert[x] = BG_MODEL[x];
+  }
+  for (int x = 0; x < NUM_TRANS_STATES; x++) {
+    prof->bg_model->trans[x] = prof->hmm_model[1].trans[x];
+  }
+
+  prof->numberFormat = PROF_FORMAT_REAL;
+}
+
+/*! FUNCTION:  BENCH_Synth_Query()
+ *  SYNOPSIS:  Synthesize a query of length <Q> into <q_seq> of <worker>, homologous to <t_prof>.
+ *             The core is emitted from consecutive match states (no indels) and centered in the query,
+ *             flanked by background residues. Core ranges are returned in <q_core> and <t_core>.
+ */
+static void
+BENCH_Synth_Query(WORKER* worker,
+                  int Q,
+                  RANGE* q_core,
+                  RANGE* t_core) {
+  HMM_PROFILE* prof = worker->t_prof;
+  int T = prof->N;
+  int core_len = MIN(Q, T);
+  int q_off = (Q - core_len) / 2;
+  int t_off = (T - core_len) / 2;
+  double weights[NUM_AMINO];
+  char* text = NULL;
+  HMM_NODE* node = NULL;
+
+  text = ERROR_malloc(sizeof(char) * (Q + 1));
+  for (int i = 0; i < Q; i++) {
+    if (i >= q_off && i < q_off + core_len) {
+      /* match scores are log-odds ratios after config */
+      node = &prof->hmm_model[t_off + (i - q_off) + 1];
+      for (int x = 0; x < NUM_AMINO; x++) {
+        weights[x] = exp(node->match[x]) * prof->bg_model->freq[x];
+      }
+    } else {
+      for (int x = 0; x < NUM_AMINO; x++) {
+        weights[x] = BG_MODEL[x];
+      }
+    }
+    text[i] = AA[BENCH_Sample(weights)];
+  }
+  text[Q] = '\0';
+
+  SEQUENCE_Reuse(worker->q_seq);
+  SEQUENCE_SetSeq(worker->q_seq, text);
+  SEQUENCE_SetTextfield(&worker->q_seq->name, "synthetic");
+  text = ERROR_free(text);
+
+  *q_core = (RANGE){q_off + 1, q_off + core_len};
+  *t_core = (RANGE){t_off + 1, t_off + core_len};
+}
+
+/*! FUNCTION:  BENCH_Sample()
+ *  SYNOPSIS:  Sample an amino acid index from unnormalized <weights>.
+ *  RETURN:    Sampled index.
+ */
+static int
+BENCH_Sample(double* weights) {
+  double total = 0.0;
+  double r;
+
+  for (int x = 0; x < NUM_AMINO; x++) {
+    total += weights[x];
+  }
+  r = RNG_FLT_Range(0.0f, 1.0f) * total;
+  for (int x = 0; x < NUM_AMINO; x++) {
+    r -= weights[x];
+    if (r < 0.0) {
+      return x;
+    }
+  }
+  return NUM_AMINO - 1;
+}
+
+/*! FUNCTION:  BENCH_Setup()
+ *  SYNOPSIS:  Size <worker> data structs for loaded query/profile pair and set the anchor
+ *             alignment from (<q_core.beg>,<t_core.beg>) to (<q_core.end>,<t_core.end>),
+ *             the same way WORK_load_mmseqs_alignment() does for an m8 entry.
+ */
+static void
+BENCH_Setup(WORKER* worker,
+            RANGE q_core,
+            RANGE t_core) {
+  int Q = worker->q_seq->N;
+  int T = worker->t_prof->N;
+  TRACE aln_beg, aln_end;
+
+  HMM_PROFILE_ReconfigLength(worker->t_prof, Q);
+  WORK_reuse(worker);
+
+  ALIGNMENT_Reuse(worker->trace_vit, Q, T);
+  aln_beg = (TRACE){.q_0 = q_core.beg, .t_0 = t_core.beg, .st = M_ST};
+  aln_end = (TRACE){.q_0 = q_core.end, .t_0 = t_core.end, .st = M_ST};
+  ALIGNMENT_AddTrace(worker->trace_vit, aln_beg);
+  ALIGNMENT_AddTrace(worker->trace_vit, aln_end);
+  ALIGNMENT_AddRegion(worker->trace_vit, 0, 1, 0.0f);
+  ALIGNMENT_SetRegion(worker->trace_vit, 0);
+}
+
+/*! FUNCTION:  BENCH_Set_Shape()
+ *  SYNOPSIS:  Set row-wise search space <edg_row> for sparse kernels, by <shape> of <bench>,
+ *             and shape sparse matrices to fit it. Caller must have run cloud search, union and reorient.
+ */
+static void
+BENCH_Set_Shape(WORKER* worker,
+                BENCH* bench) {
+  EDGEBOUNDS* edg = worker->edg_row;
+  int Q = worker->q_seq->N;
+  int T = worker->t_prof->N;
+  int w = bench->band_width;
+  int t_mid;
+
+  if (bench->shape == BENCH_SHAPE_BAND) {
+    EDGEBOUNDS_Reuse(edg, Q, T);
+    edg->edg_mode = EDG_ROW;
+    for (int q_0 = 0; q_0 <= Q; q_0++) {
+      t_mid = (int)((double)q_0 * T / Q);
+      EDGEBOUNDS_Pushback(edg, (BOUND){q_0, MAX(t_mid - w, 0), MIN(t_mid + w + 1, T + 1)});
+    }
+    EDGEBOUNDS_Index(edg);
+  }
+  /* full shape is handled by <is_run_full> */
+  worker->result->cloud_cells = EDGEBOUNDS_Count(edg);
+  WORK_build_sparse_matrix(worker);
+}
+
+/*! FUNCTION:  BENCH_Run()
+ *  SYNOPSIS:  Run <kernel> once on current inputs in <worker>.
+ *  RETURN:    Units of work done (cells, nodes, residues or records).
+ */
+static size_t
+BENCH_Run(WORKER* worker,
+          BENCH* bench,
+          BENCH_KERNEL kernel) {
+  SEQUENCE* q_seq = worker->q_seq;
+  HMM_PROFILE* t_prof = worker->t_prof;
+  int Q = q_seq->N;
+  int T = t_prof->N;
+  M8_RESULTS* m8 = NULL;
+  size_t count = 0;
+  float sc, inner_sc;
+  bool is_saturated;
+
+  switch (kernel) {
+    case BENCH_VITERBI: {
+      run_Viterbi_Linear(q_seq, t_prof, Q, T, worker->st_MX3, worker->sp_MX, &sc);
+      count = (size_t)(Q + 1) * (T + 1);
+    } break;
+    case BENCH_CLOUD_FWD_I16: {
+      /* int16 prefilter (if saturated, caller falls back to float cloud search) */
+      run_Cloud_Forward_Linear_I16(q_seq, t_prof, Q, T, worker->i16_MX, worker->trace_vit,
+                                   worker->edg_rows_tmp, worker->edg_fwd, &worker->cloud_params, &inner_sc, &sc, &is_saturated);
+      count = EDGEBOUNDS_Count(worker->edg_fwd);
+    } break;
+    case BENCH_CLOUD_BCK_I16: {
+      run_Cloud_Backward_Linear_I16(q_seq, t_prof, Q, T, worker->i16_MX, worker->trace_vit,
+                                    worker->edg_rows_tmp, worker->edg_bck, &worker->cloud_params, &inner_sc, &sc, &is_saturated);
+      count = EDGEBOUNDS_Count(worker->edg_bck);
+    } break;
+    case BENCH_CLOUD_FWD: {
+      run_Cloud_Forward_Linear(q_seq, t_prof, Q, T, worker->st_MX3, worker->sp_MX, worker->trace_vit,
+                               worker->edg_rows_tmp, worker->edg_fwd, &worker->cloud_params, &inner_sc, &sc);
+      count = EDGEBOUNDS_Count(worker->edg_fwd);
+    } break;
+    case BENCH_CLOUD_BCK: {
+      run_Cloud_Backward_Linear(q_seq, t_prof, Q, T, worker->st_MX3, worker->sp_MX, worker->trace_vit,
+                                worker->edg_rows_tmp, worker->edg_bck, &worker->cloud_params, &inner_sc, &sc);
+      count = EDGEBOUNDS_Count(worker->edg_bck);
+    } break;
+    case BENCH_UNION: {
+      EDGEBOUNDS_Union(Q, T, worker->edg_fwd, worker->edg_bck, worker->edg_diag);
+      count = EDGEBOUNDS_Count(worker->edg_diag);
+    } break;
+    case BENCH_UNION_OLD: {
+      /* previous union, which merges each antidiagonal pairwise in working space */
+      EDGEBOUNDS_Union_byRow_Old(Q, T, worker->edg_fwd, worker->edg_bck, worker->edg_diag);
+      count = EDGEBOUNDS_Count(worker->edg_diag);
+    } break;
+    case BENCH_REORIENT: {
+      EDGEBOUNDS_ReorientToRow(Q, T, worker->edg_diag, worker->edg_rows_tmp, worker->edg_row);
+      EDGEBOUNDS_Index(worker->edg_row);
+      count = EDGEBOUNDS_Count(worker->edg_row);
+    } break;
+    case BENCH_BOUND_FWD: {
+      run_Bound_Forward_Sparse(q_seq, t_prof, Q, T, worker->st_SMX_fwd, worker->sp_MX_fwd,
+                               worker->edg_row, NULL, &sc);
+      count = worker->result->cloud_cells;
+    } break;
+    case BENCH_BOUND_BCK: {
+      run_Bound_Backward_Sparse(q_seq, t_prof, Q, T, worker->st_SMX_bck, worker->sp_MX_bck,
+                                worker->edg_row, NULL, &sc, NULL, NULL);
+      count = worker->result->cloud_cells;
+    } break;
+    case BENCH_POSTERIOR: {
+      run_Decode_Posterior_Sparse(q_seq, t_prof, Q, T, worker->edg_row, NULL,
+                                  worker->st_SMX_fwd, worker->sp_MX_fwd, worker->st_SMX_bck, worker->sp_MX_bck,
+                                  worker->st_SMX_post, worker->sp_MX_post, NULL);
+      count = worker->result->cloud_cells;
+    } break;
+    case BENCH_OPTACC: {
+      run_OptimalAccuracy_Sparse(q_seq, t_prof, Q, T, worker->edg_row, NULL,
+                                 worker->st_SMX_post, worker->sp_MX_post, worker->trace_post, &sc);
+      count = worker->result->cloud_cells;
+    } break;
+    case BENCH_VITERBI_PTRS: {
+      /* backpointer viterbi and its traceback */
+      run_Bound_Viterbi_Sparse_Ptrs(q_seq, t_prof, Q, T, worker->edg_row,
+                                    worker->vit_ptrs, worker->sp_MX_optacc, &sc);
+      run_Viterbi_Traceback_Sparse_Ptrs(q_seq, t_prof, Q, T, worker->edg_row,
+                                        worker->vit_ptrs, worker->sp_MX_optacc, worker->trace_post);
+      count = worker->result->cloud_cells;
+    } break;
+    case BENCH_PARSE_HMM: {
+      HMM_PROFILE_Parse(bench->prof_tmp, bench->hmm_filein, 0);
+      HMM_PROFILE_Convert_NegLog_To_Real(bench->prof_tmp);
+      HMM_PROFILE_Config(bench->prof_tmp, worker->args->search_mode);
+      count = bench->prof_tmp->N;
+    } break;
+    case BENCH_PARSE_FASTA: {
+      SEQUENCE_Fasta_Parse(bench->seq_tmp, bench->fasta_filein, 0);
+      count = bench->seq_tmp->N;
+    } break;
+    case BENCH_PARSE_M8: {
+      m8 = M8_RESULTS_Create();
+      RESULTS_M8_Parse(m8, bench->m8_filein, 0, INT_MAX);
+      count = m8->N;
+      m8 = M8_RESULTS_Destroy(m8);
+    } break;
+    default: {
+      fprintf(stderr, "ERROR: Invalid benchmark kernel: %d\n", kernel);
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+  }
+
+  return count;
+}
+
+/*! FUNCTION:  BENCH_Time()
+ *  SYNOPSIS:  Run <kernel> <warmup> times untimed, then <reps> times timed,
+ *             and print a row of runtime and throughput stats.
+ */
+static void
+BENCH_Time(WORKER* worker,
+           BENCH* bench,
+           BENCH_KERNEL kernel) {
+  CLOCK* timer = worker->timer;
+  VECTOR_DBL* times = bench->times;
+  size_t count = 0;
+  double t_min, t_med, t_mean, rate;
+  bool is_parser = (kernel >= BENCH_PARSE_HMM);
+  int Q = (is_parser ? 0 : worker->q_seq->N);
+  int T = (is_parser ? 0 : worker->t_prof->N);
+  const char* shape;
+
+  /* only sparse kernels run on the chosen shape */
+  if (is_parser) {
+    shape = "-";
+  }
+  elif (kernel == BENCH_VITERBI) {
+    shape = BENCH_SHAPE_NAMES[BENCH_SHAPE_FULL];
+  }
+  elif (kernel < BENCH_BOUND_FWD) {
+    shape = BENCH_SHAPE_NAMES[BENCH_SHAPE_CLOUD];
+  }
+  else {
+    shape = BENCH_SHAPE_NAMES[bench->shape];
+  }
+
+  for (int i = 0; i < bench->warmup; i++) {
+    BENCH_Run(worker, bench, kernel);
+  }
+
+  VECTOR_DBL_Reuse(times);
+  t_mean = 0.0;
+  for (int i = 0; i < bench->reps; i++) {
+    CLOCK_Start(timer);
+    count = BENCH_Run(worker, bench, kernel);
+    CLOCK_Stop(timer);
+    VECTOR_DBL_Pushback(times, CLOCK_Duration(timer));
+    t_mean += CLOCK_Duration(timer);
+  }
+  t_mean /= bench->reps;
+  VECTOR_DBL_Sort(times);
+  t_min = VECTOR_DBL_Get(times, 0);
+  t_med = VECTOR_DBL_Get(times, bench->reps / 2);
+  if (bench->reps % 2 == 0) {
+    t_med = (t_med + VECTOR_DBL_Get(times, bench->reps / 2 - 1)) / 2.0;
+  }
+  rate = (t_med > 0 ? (double)count / t_med : 0.0);
+
+  printf("%s\t%s\t%d\t%d\t%s\t%ld\t%d\t%.6f\t%.6f\t%.6f\t%.4e\n",
+         BENCH_KERNEL_NAMES[kernel],
+         shape,
+         Q, T,
+         BENCH_KERNEL_UNITS[kernel],
+         count,
+         bench->reps,
+         t_min, t_med, t_mean, rate);
+  fflush(stdout);
+}
+
+/*! FUNCTION:  BENCH_Run_Pair()
+ *  SYNOPSIS:  Time all kernels on current query/profile pair in <worker>, in pipeline order.
+ */
+static void
+BENCH_Run_Pair(WORKER* worker,
+               BENCH* bench) {
+  BENCH_Time(worker, bench, BENCH_VITERBI);
+  /* int16 cloud search first, so float cloud search leaves the cloud used downstream */
+  BENCH_Time(worker, bench, BENCH_CLOUD_FWD_I16);
+  BENCH_Time(worker, bench, BENCH_CLOUD_BCK_I16);
+  BENCH_Time(worker, bench, BENCH_CLOUD_FWD);
+  BENCH_Time(worker, bench, BENCH_CLOUD_BCK);
+  BENCH_Time(worker, bench, BENCH_UNION_OLD);
+  BENCH_Time(worker, bench, BENCH_UNION);
+  BENCH_Time(worker, bench, BENCH_REORIENT);
+  BENCH_Set_Shape(worker, bench);
+  BENCH_Time(worker, bench, BENCH_BOUND_FWD);
+  BENCH_Time(worker, bench, BENCH_BOUND_BCK);
+  BENCH_Time(worker, bench, BENCH_POSTERIOR);
+  BENCH_Time(worker, bench, BENCH_OPTACC);
+  /* last, as its special states may share memory with forward */
+  BENCH_Time(worker, bench, BENCH_VITERBI_PTRS);
+}
+
+/*! FUNCTION:  BENCH_Generate()
+ *  SYNOPSIS:  Write synthetic database to <gen_dir> of <bench>:
+ *               - target.hmm:  <gen_profiles> profiles, with lengths drawn from <t_lens>.
+ *               - query.fasta: <gen_seqs> sequences, with lengths drawn from <q_lens>. The first
+ *                              <gen_homologs> fraction are emitted from the profiles (evenly
+ *                              distributed), the rest are background residues.
+ *               - hits.m8:     <gen_hits> hits, grouped by profile (as mmseqs reports them).
+ *                              <gen_homologs> fraction of each profile's hits are to its homologs,
+ *                              anchored on the emitted core, the rest are to random sequences,
+ *                              anchored on the main diagonal.
+ *               - labels.tsv:  profile and sequence of each homologous hit (for `mmoreseqs cloud-calibrate`).
+ */
+static void
+BENCH_Generate(WORKER* worker,
+               BENCH* bench) {
+  HMM_PROFILE* prof = worker->t_prof;
+  SEQUENCE* seq = worker->q_seq;
+  FILE* hmm_fp = BENCH_Open(bench, "target.hmm");
+  FILE* fasta_fp = BENCH_Open(bench, "query.fasta");
+  FILE* m8_fp = BENCH_Open(bench, "hits.m8");
+  FILE* labels_fp = BENCH_Open(bench, "labels.tsv");
+  int P = bench->gen_profiles;
+  int S = bench->gen_seqs;
+  int n_hom = (int)(bench->gen_homologs * S + 0.5f);
+  int n_t_lens = VECTOR_INT_GetSize(bench->t_lens);
+  int n_q_lens = VECTOR_INT_GetSize(bench->q_lens);
+  VECTOR_INT* t_lens = VECTOR_INT_Create();     /* length of each profile */
+  VECTOR_INT* q_lens = VECTOR_INT_Create();     /* length of each sequence */
+  VECTOR_INT* hom_beg = VECTOR_INT_Create();    /* id of first homolog of each profile */
+  VECTOR_RANGE* q_cores = VECTOR_RANGE_Create(); /* emitted core of each homolog */
+  VECTOR_RANGE* t_cores = VECTOR_RANGE_Create();
+  RANGE q_core, t_core;
+  char t_name[64];
+  char q_name[64];
+  char* text = NULL;
+  double bg[NUM_AMINO];
+  int Q, T, core_len, id, n_hom_p;
+  long n_hits_p;
+  bool is_homolog;
+
+  /* profiles and their homologs */
+  for (int p = 0; p < P; p++) {
+    T = VECTOR_INT_Get(bench->t_lens, RNG_Range(0, n_t_lens));
+    BENCH_Synth_Profile(worker, bench, T);
+    snprintf(t_name, sizeof(t_name), "SYNTH%05d", p);
+    HMM_PROFILE_SetTextField(&prof->name, t_name);
+    BENCH_Write_Profile(prof, hmm_fp);
+    HMM_PROFILE_Config(prof, worker->args->search_mode);
+    VECTOR_INT_Pushback(t_lens, T);
+    VECTOR_INT_Pushback(hom_beg, VECTOR_INT_GetSize(q_lens));
+
+    n_hom_p = n_hom / P + (p < n_hom % P);
+    for (int i = 0; i < n_hom_p; i++) {
+      Q = VECTOR_INT_Get(bench->q_lens, RNG_Range(0, n_q_lens));
+      BENCH_Synth_Query(worker, Q, &q_core, &t_core);
+      snprintf(q_name, sizeof(q_name), "hom%07d", VECTOR_INT_GetSize(q_lens));
+      BENCH_Write_Sequence(q_name, seq->seq, fasta_fp);
+      VECTOR_INT_Pushback(q_lens, Q);
+      VECTOR_RANGE_Pushback(q_cores, q_core);
+      VECTOR_RANGE_Pushback(t_cores, t_core);
+    }
+  }
+  VECTOR_INT_Pushback(hom_beg, n_hom);
+
+  /* random sequences */
+  for (int x = 0; x < NUM_AMINO; x++) {
+    bg[x] = BG_MODEL[x];
+  }
+  for (int i = n_hom; i < S; i++) {
+    Q = VECTOR_INT_Get(bench->q_lens, RNG_Range(0, n_q_lens));
+    text = ERROR_realloc(text, sizeof(char) * (Q + 1));
+    for (int j = 0; j < Q; j++) {
+      text[j] = AA[BENCH_Sample(bg)];
+    }
+    text[Q] = '\0';
+    snprintf(q_name, sizeof(q_name), "rand%07d", i);
+    BENCH_Write_Sequence(q_name, text, fasta_fp);
+    VECTOR_INT_Pushback(q_lens, Q);
+  }
+  text = ERROR_free(text);
+
+  /* hits */
+  for (int p = 0; p < P; p++) {
+    snprintf(t_name, sizeof(t_name), "SYNTH%05d", p);
+    T = VECTOR_INT_Get(t_lens, p);
+    n_hom_p = VECTOR_INT_Get(hom_beg, p + 1) - VECTOR_INT_Get(hom_beg, p);
+    n_hits_p = bench->gen_hits / P + (p < bench->gen_hits % P);
+
+    for (long i = 0; i < n_hits_p; i++) {
+      is_homolog = (n_hom_p > 0 && RNG_FLT_Range(0.0f, 1.0f) < bench->gen_homologs);
+      if (is_homolog) {
+        id = VECTOR_INT_Get(hom_beg, p) + RNG_Range(0, n_hom_p);
+        q_core = VECTOR_RANGE_Get(q_cores, id);
+        t_core = VECTOR_RANGE_Get(t_cores, id);
+      } else {
+        /* if there are no random sequences, any sequence will do */
+        id = (n_hom < S ? RNG_Range(n_hom, S) : RNG_Range(0, S));
+        Q = VECTOR_INT_Get(q_lens, id);
+        core_len = MIN(Q, T);
+        q_core = (RANGE){(Q - core_len) / 2 + 1, (Q - core_len) / 2 + core_len};
+        t_core = (RANGE){(T - core_len) / 2 + 1, (T - core_len) / 2 + core_len};
+      }
+      snprintf(q_name, sizeof(q_name), "%s%07d", (id < n_hom ? "hom" : "rand"), id);
+      BENCH_Write_Hit(bench, t_name, q_name, is_homolog, t_core, q_core, m8_fp);
+      if (is_homolog) {
+        fprintf(labels_fp, "%s\t%s\n", t_name, q_name);
+      }
+    }
+  }
+
+  printf("# === MMORESEQS SYNTHETIC DATABASE ===\n");
+  printf("# profiles:  %d => %s/target.hmm\n", P, bench->gen_dir);
+  printf("# sequences: %d (%d homologous, %d random) => %s/query.fasta\n", S, n_hom, S - n_hom, bench->gen_dir);
+  printf("# hits:      %ld => %s/hits.m8\n", bench->gen_hits, bench->gen_dir);
+  printf("# labels:    homologous hits => %s/labels.tsv\n", bench->gen_dir);
+  printf("# seed: %u\n", bench->seed);
+
+  fclose(hmm_fp);
+  fclose(fasta_fp);
+  fclose(m8_fp);
+  fclose(labels_fp);
+  t_lens = VECTOR_INT_Destroy(t_lens);
+  q_lens = VECTOR_INT_Destroy(q_lens);
+  hom_beg = VECTOR_INT_Destroy(hom_beg);
+  q_cores = VECTOR_RANGE_Destroy(q_cores);
+  t_cores = VECTOR_RANGE_Destroy(t_cores);
+}
+
+/*! FUNCTION:  BENCH_Write_Profile()
+ *  SYNOPSIS:  Write real-space profile <prof> to <fp> in HMMER3 .hmm format,
+ *             as read by HMM_PROFILE_Parse(). Probabilities are written as negative logs.
+ */
+static void
+BENCH_Write_Profile(HMM_PROFILE* prof,
+                    FILE* fp) {
+  HMM_NODE* node = NULL;
+
+  fprintf(fp, "HMMER3/f [mmoreseqs_bench synthetic]\n");
+  fprintf(fp, "NAME  %s\n", prof->name);
+  fprintf(fp, "LENG  %d\n", prof->N);
+  fprintf(fp, "ALPH  amino\n");
+  fprintf(fp, "RF    no\n");
+  fprintf(fp, "MM    no\n");
+  /* typical values for a pfam profile */
+  fprintf(fp, "STATS LOCAL MSV      -11.0000  0.70000\n");
+  fprintf(fp, "STATS LOCAL VITERBI  -11.5000  0.70000\n");
+  fprintf(fp, "STATS LOCAL FORWARD   -5.5000  0.70000\n");
+  fprintf(fp, "HMM    ");
+  for (int x = 0; x < NUM_AMINO; x++) {
+    fprintf(fp, "      %c  ", AA[x]);
+  }
+  fprintf(fp, "\n");
+  fprintf(fp, "            m->m     m->i     m->d     i->m     i->i     d->m     d->d\n");
+
+  /* background composition, then node 0 insert emissions and transitions */
+  fprintf(fp, "  COMPO ");
+  BENCH_Write_Probs(prof->bg_model->compo, NUM_AMINO, fp);
+  fprintf(fp, "        ");
+  BENCH_Write_Probs(prof->hmm_model[0].insert, NUM_AMINO, fp);
+  fprintf(fp, "        ");
+  BENCH_Write_Probs(prof->hmm_model[0].trans, NUM_TRANS_STATES - 1, fp);
+
+  for (int k = 1; k <= prof->N; k++) {
+    node = &prof->hmm_model[k];
+    fprintf(fp, " %6d ", k);
+    BENCH_Write_Probs(node->match, NUM_AMINO, fp);
+    fprintf(fp, "        ");
+    BENCH_Write_Probs(node->insert, NUM_AMINO, fp);
+    fprintf(fp, "        ");
+    BENCH_Write_Probs(node->trans, NUM_TRANS_STATES - 1, fp);
+  }
+  fprintf(fp, "//\n");
+}
+
+/*! FUNCTION:  BENCH_Write_Probs()
+ *  SYNOPSIS:  Write line of <N> real-space <probs> to <fp> as negative logs (zero as '*').
+ */
+static void
+BENCH_Write_Probs(float* probs,
+                  int N,
+                  FILE* fp) {
+  for (int i = 0; i < N; i++) {
+    if (probs[i] > 0.0f) {
+      fprintf(fp, " %8.5f", log(1.0 / probs[i]));
+    } else {
+      fprintf(fp, " %8s", "*");
+    }
+  }
+  fprintf(fp, "\n");
+}
+
+/*! FUNCTION:  BENCH_Write_Sequence()
+ *  SYNOPSIS:  Write sequence <seq> named <name> to <fp> in .fasta format.
+ */
+static void
+BENCH_Write_Sequence(char* name,
+                     char* seq,
+                     FILE* fp) {
+  const int line_width = 60;
+  int N = strlen(seq);
+
+  fprintf(fp, ">%s\n", name);
+  for (int i = 0; i < N; i += line_width) {
+    fprintf(fp, "%.*s\n", MIN(line_width, N - i), seq + i);
+  }
+}
+
+/*! FUNCTION:  BENCH_Write_Hit()
+ *  SYNOPSIS:  Write m8 hit of profile <t_name> and sequence <q_name> to <fp>, with alignment
+ *             from (<t_core.beg>,<q_core.beg>) to (<t_core.end>,<q_core.end>).
+ *             Homologous hits get significant e-values, random hits get insignificant ones.
+ */
+static void
+BENCH_Write_Hit(BENCH* bench,
+                char* t_name,
+                char* q_name,
+                bool is_homolog,
+                RANGE t_core,
+                RANGE q_core,
+                FILE* fp) {
+  int alnlen = q_core.end - q_core.beg + 1;
+  float pident, log10_eval, bitscore;
+
+  if (is_homolog) {
+    pident = bench->conserve + (1.0f - bench->conserve) * 0.05f;
+    log10_eval = RNG_FLT_Range(-40.0f, -5.0f);
+  } else {
+    pident = RNG_FLT_Range(0.05f, 0.15f);
+    log10_eval = RNG_FLT_Range(-3.0f, 1.0f);
+  }
+  /* e-value = database size * 2^(-bitscore) */
+  bitscore = MAX(0.0f, (log10(bench->gen_profiles) - log10_eval) / log10(2.0));
+
+  /* columns: target, query, pident, alnlen, mismatch, gapopen, t_beg, t_end, q_beg, q_end, evalue, bitscore */
+  fprintf(fp, "%s\t%s\t%.3f\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%.3E\t%.0f\n",
+          t_name, q_name,
+          pident, alnlen, (int)(alnlen * (1.0f - pident)), 0,
+          t_core.beg - 1, t_core.end, q_core.beg - 1, q_core.end,
+          pow(10.0, log10_eval), bitscore);
+}
+
+/*! FUNCTION:  BENCH_Open()
+ *  SYNOPSIS:  Create <gen_dir> of <bench> if necessary, and open <filename> in it for writing.
+ *  RETURN:    Open file pointer.
+ */
+static FILE*
+BENCH_Open(BENCH* bench,
+           const char* filename) {
+  char path[4096];
+  FILE* fp = NULL;
+
+  if (mkdir(bench->gen_dir, 0777) == -1 && errno != EEXIST) {
+    fprintf(stderr, "ERROR: Unable to create directory '%s'.\n", bench->gen_dir);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  snprintf(path, sizeof(path), "%s/%s", bench->gen_dir, filename);
+  fp = fopen(path, "w");
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to open file '%s' for writing.\n", path);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  return fp;
+}
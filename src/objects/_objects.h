@@ -32,16 +32,21 @@
 #include "clock.h"
 #include "debugger.h"
 #include "domain_def.h"
+#include "dup_map.h"
 #include "f_index.h"
 #include "hmm_profile.h"
 #include "hmm_bg.h"
+#include "msa.h"
 #include "mystring.h"
+#include "perf_counters.h"
 #include "results.h"
 #include "m8_results.h"
 #include "score_matrix.h"
 #include "sequence.h"
+#include "seq_builder.h"
 #include "scriptrunner.h"
 #include "commandline.h"
+#include "thread_pool.h"
 
 /* worker (dependent on most object types) */
 #include "worker_thread.h"
@@ -88,6 +88,48 @@ ALIGNMENT_Destroy(ALIGNMENT* aln) {
   return aln;
 }
 
+/*! FUNCTION:  ALIGNMENT_Copy()
+ *  SYNOPSIS:  Create deep copy of <src> into <dest>, reusing memory owned by <dest>.
+ *             Creates new ALIGNMENT for <dest> if <dest> is NULL.
+ */
+ALIGNMENT*
+ALIGNMENT_Copy(ALIGNMENT* dest,
+               ALIGNMENT* src) {
+  if (dest == NULL) {
+    dest = ALIGNMENT_Create();
+  }
+
+  /* copy base data */
+  dest->Q = src->Q;
+  dest->T = src->T;
+  dest->full_len = src->full_len;
+  dest->num_alns = src->num_alns;
+  dest->best_idx = src->best_idx;
+  dest->aln_len = src->aln_len;
+  dest->beg = src->beg;
+  dest->end = src->end;
+  dest->num_gaps = src->num_gaps;
+  dest->num_misses = src->num_misses;
+  dest->num_matches = src->num_matches;
+  dest->perc_id = src->perc_id;
+  dest->is_cigar_aln = src->is_cigar_aln;
+  dest->is_hmmer_aln = src->is_hmmer_aln;
+
+  /* copy variable-sized data */
+  VECTOR_TRACE_Copy(dest->traces, src->traces);
+  VECTOR_FLT_Copy(dest->scores, src->scores);
+  VECTOR_INT_Copy(dest->tr_beg, src->tr_beg);
+  VECTOR_INT_Copy(dest->tr_end, src->tr_end);
+  VECTOR_FLT_Copy(dest->tr_score, src->tr_score);
+  VECTOR_CHAR_Copy(dest->cigar_aln, src->cigar_aln);
+  VECTOR_CHAR_Copy(dest->target_aln, src->target_aln);
+  VECTOR_CHAR_Copy(dest->center_aln, src->center_aln);
+  VECTOR_CHAR_Copy(dest->query_aln, src->query_aln);
+  VECTOR_CHAR_Copy(dest->state_aln, src->state_aln);
+
+  return dest;
+}
+
 /*! FUNCTION:  ALIGNMENT_Reuse()
  *  SYNOPSIS:  Wipes <aln>'s old data for reuse, sets dimensions <Q x T>.
  */
@@ -307,6 +349,7 @@ float ALIGNMENT_ScoreRegions(ALIGNMENT* aln) {
 
   N = VECTOR_INT_GetSize(aln->tr_beg);
   max_sc = -INF;
+  max_idx = 0;
   /* scan traceback for all begin, end states */
   for (int i = 0; i < N; i++) {
     b_idx = VECTOR_INT_Get(aln->tr_beg, i);
@@ -331,10 +374,13 @@ float ALIGNMENT_ScoreRegions(ALIGNMENT* aln) {
     ERRORCHECK_exit(EXIT_FAILURE);
   }
 
-  /* set best alignment to maximum scoring */
-  aln->beg = VECTOR_INT_Get(aln->tr_beg, max_idx);
-  aln->end = VECTOR_INT_Get(aln->tr_end, max_idx);
-  aln->aln_len = aln->end - aln->beg + 1;
+  /* set best alignment to maximum scoring (first, if no score is comparable) */
+  if (N > 0) {
+    aln->beg = VECTOR_INT_Get(aln->tr_beg, max_idx);
+    aln->end = VECTOR_INT_Get(aln->tr_end, max_idx);
+    aln->aln_len = aln->end - aln->beg + 1;
+  }
+  return max_sc;
 }
 
 /*! FUNCTION:  ALIGNMENT_AddRegion()
@@ -423,12 +469,8 @@ void ALIGNMENT_Build_HMMER_Style(ALIGNMENT* aln,
   /* special characters for query/target alignment */
   const char gap_ch = '.'; /* insert/delete */
 
-  /* counters */
-  aln->num_matches = 0;
-  aln->num_misses = 0;
-  aln->num_gaps = 0;
-  /* streak counter */
-  int match_streak = 0;
+  /* counts of matches, misses and gaps */
+  ALIGNMENT_Build_Stats(aln, q_seq, t_prof);
 
   /* allocate for entire string */
   VECTOR_CHAR_SetSize(aln->state_aln, aln_len + 1);
@@ -443,7 +485,7 @@ void ALIGNMENT_Build_HMMER_Style(ALIGNMENT* aln,
 
   /* capture alignment (until END state) */
   pos = 0;
-  for (i = i_beg; i <= i_end; i++, pos++) {
+  for (i = i_beg; i <= i_end; i++) {
     /* get emitted residue at position in the alignment */
     tr = VECTOR_TRACE_GetX(traceback, i);
     t_ch = STR_GetChar(tseq, tr->t_0);
@@ -453,7 +495,6 @@ void ALIGNMENT_Build_HMMER_Style(ALIGNMENT* aln,
 
     /* center symbol depends upon state */
     if (tr->st == M_ST) {
-      match_streak++;
       VECTOR_CHAR_Set(aln->state_aln, pos, 'M');
       VECTOR_CHAR_Set(aln->target_aln, pos, t_ch);
       VECTOR_CHAR_Set(aln->query_aln, pos, q_ch);
@@ -461,7 +502,6 @@ void ALIGNMENT_Build_HMMER_Style(ALIGNMENT* aln,
       /* center alignment depends on match score between target and query: */
       /* if target and query match (same case) */
       if (t_ch == q_ch) {
-        aln->num_matches++;
         VECTOR_CHAR_Set(aln->center_aln, pos, t_ch);
       }
       /* else, if target and query match (any case) */
@@ -469,7 +509,6 @@ void ALIGNMENT_Build_HMMER_Style(ALIGNMENT* aln,
         t_ch = toupper(t_ch);
         q_ch = toupper(q_ch);
         if (t_ch == q_ch) {
-          aln->num_matches++;
           VECTOR_CHAR_Set(aln->center_aln, pos, tolower(t_ch));
         }
         /* else, if score is positive or negative */
@@ -488,12 +527,6 @@ void ALIGNMENT_Build_HMMER_Style(ALIGNMENT* aln,
       }
     }
     elif (tr->st == I_ST) {
-      /* if we are leaving a matching region, add a gap */
-      if (match_streak > 0) {
-        aln->num_gaps++;
-      }
-      match_streak = 0;
-      aln->num_misses++;
       /* insert corresponds to gap in target profile */
       VECTOR_CHAR_Set(aln->state_aln, pos, 'I');
       VECTOR_CHAR_Set(aln->center_aln, pos, ins_ch);
@@ -501,21 +534,17 @@ void ALIGNMENT_Build_HMMER_Style(ALIGNMENT* aln,
       VECTOR_CHAR_Set(aln->query_aln, pos, q_ch);
     }
     elif (tr->st == D_ST) {
-      /* if we are leaving a matching region, add a gap */
-      if (match_streak > 0) {
-        aln->num_gaps++;
-      }
-      match_streak = 0;
-      aln->num_misses++;
       /* delete corresponds to gap in query sequence */
       VECTOR_CHAR_Set(aln->state_aln, pos, 'D');
       VECTOR_CHAR_Set(aln->center_aln, pos, del_ch);
       VECTOR_CHAR_Set(aln->target_aln, pos, t_ch);
       VECTOR_CHAR_Set(aln->query_aln, pos, gap_ch);
     }
-    /* if not a core model emit state */
+    /* if not a core model emit state, it takes no position in strings */
     else {
+      continue;
     }
+    pos++;
   }
   /* terminate strings with null termination character */
   VECTOR_CHAR_Set(aln->state_aln, pos, NULL_CHAR);
@@ -523,15 +552,62 @@ void ALIGNMENT_Build_HMMER_Style(ALIGNMENT* aln,
   VECTOR_CHAR_Set(aln->target_aln, pos, NULL_CHAR);
   VECTOR_CHAR_Set(aln->query_aln, pos, NULL_CHAR);
 
+  aln->is_hmmer_aln = true;
+}
+
+/*! FUNCTION:  ALIGNMENT_Build_Stats()
+ *  SYNOPSIS:  Count matches, misses and gap openings of <aln>, and its percent identity.
+ *             Same counts as ALIGNMENT_Build_HMMER_Style(), without building strings.
+ *             Expects <aln> has already been constructed.
+ */
+void ALIGNMENT_Build_Stats(ALIGNMENT* aln,
+                           SEQUENCE* q_seq,
+                           HMM_PROFILE* t_prof) {
+  VECTOR_TRACE* traceback = aln->traces;
+  TRACE* tr = NULL;
+  /* query and target consensus sequences as strings */
+  STR qseq = SEQUENCE_GetSeq(q_seq);
+  STR tseq = HMM_PROFILE_GetConsensus(t_prof);
+  char t_ch, q_ch;
+  /* streak counter */
+  int match_streak = 0;
+
+  /* counters */
+  aln->num_matches = 0;
+  aln->num_misses = 0;
+  aln->num_gaps = 0;
+
+  for (int i = aln->beg; i <= aln->end; i++) {
+    tr = VECTOR_TRACE_GetX(traceback, i);
+
+    if (tr->st == M_ST) {
+      match_streak++;
+      /* target and query match (any case) */
+      t_ch = toupper(STR_GetChar(tseq, tr->t_0));
+      q_ch = toupper(STR_GetChar(qseq, tr->q_0));
+      if (t_ch == q_ch) {
+        aln->num_matches++;
+      }
+    }
+    elif (tr->st == I_ST || tr->st == D_ST) {
+      /* if we are leaving a matching region, add a gap */
+      if (match_streak > 0) {
+        aln->num_gaps++;
+      }
+      match_streak = 0;
+      aln->num_misses++;
+    }
+  }
+
   /* percent identity is percentage of alignment that is a direct match */
   aln->perc_id = (float)aln->num_matches / (float)aln->traces->N;
-  aln->is_hmmer_aln = true;
 }
 
 /*! FUNCTION:  ALIGNMENT_Build_MMSEQS_Style()
  *  SYNOPSIS:  Generate <aln> strings, MMSEQS-style.
  *             Stores in <cigar_aln>.
  *             Expects <aln> has already been constructed.
+ *             Only uses traces of <aln>, so <query> and <target> may be NULL.
  */
 void ALIGNMENT_Build_MMSEQS_Style(ALIGNMENT* aln,
                                   SEQUENCE* query,
@@ -540,6 +616,12 @@ void ALIGNMENT_Build_MMSEQS_Style(ALIGNMENT* aln,
 
   /* cigar alignment can't be longer than twice the size of the alignment */
   VECTOR_CHAR_Reuse(aln->cigar_aln);
+  /* empty alignment has empty cigar */
+  if (traceback->N == 0) {
+    VECTOR_CHAR_Pushback(aln->cigar_aln, NULL_CHAR);
+    aln->is_cigar_aln = true;
+    return;
+  }
 
   /* place to cast run length and state to string */
   char cigar_buffer[64]; /* buffer for building string */
@@ -582,6 +664,60 @@ void ALIGNMENT_Build_MMSEQS_Style(ALIGNMENT* aln,
   aln->is_cigar_aln = true;
 }
 
+/*! FUNCTION:  ALIGNMENT_Build_From_MMSEQS_Cigar()
+ *  SYNOPSIS:  Append traces to <aln> of path given by MMSEQS-style <cigar> (e.g. 12M2I5M), starting from
+ *             (<q_beg>,<t_beg>). MMSEQS query/target are swapped relative to MMORE, so 'I' steps through
+ *             target (delete state) and 'D' steps through query (insert state).
+ *             Returns false if <cigar> is not a valid alignment (empty, unknown op, or not starting with a match).
+ */
+bool ALIGNMENT_Build_From_MMSEQS_Cigar(ALIGNMENT* aln,
+                                       const char* cigar,
+                                       int q_beg,
+                                       int t_beg) {
+  int N_beg = aln->traces->N;
+  int q_0 = q_beg - 1;
+  int t_0 = t_beg - 1;
+  int run_len;
+  int st;
+
+  if (cigar == NULL || !isdigit(*cigar)) {
+    return false;
+  }
+
+  while (*cigar != '\0') {
+    /* format is {RUN_LENGTH}{OP} */
+    run_len = 0;
+    while (isdigit(*cigar)) {
+      run_len = (run_len * 10) + (*cigar - '0');
+      cigar++;
+    }
+    if (*cigar == 'M') {
+      st = M_ST;
+    }
+    elif (*cigar == 'I') {
+      st = D_ST;
+    }
+    elif (*cigar == 'D') {
+      st = I_ST;
+    }
+    else {
+      return false;
+    }
+    cigar++;
+    /* path must begin with a match */
+    if (aln->traces->N == N_beg && st != M_ST) {
+      return false;
+    }
+
+    for (int i = 0; i < run_len; i++) {
+      q_0 += (st != D_ST);
+      t_0 += (st != I_ST);
+      ALIGNMENT_AddTrace(aln, (TRACE){.q_0 = q_0, .t_0 = t_0, .st = st});
+    }
+  }
+  return (aln->traces->N > N_beg);
+}
+
 /*! FUNCTION:  ALIGNMENT_Dump()
  *  SYNOPSIS:  Outputs <aln> to open file pointer <fp>.
  */
@@ -17,6 +17,12 @@ ALIGNMENT* ALIGNMENT_Create();
  */
 ALIGNMENT* ALIGNMENT_Destroy(ALIGNMENT* aln);
 
+/*! FUNCTION:  ALIGNMENT_Copy()
+ *  SYNOPSIS:  Create deep copy of <src> into <dest>, reusing memory owned by <dest>.
+ *             Creates new ALIGNMENT for <dest> if <dest> is NULL.
+ */
+ALIGNMENT* ALIGNMENT_Copy(ALIGNMENT* dest, ALIGNMENT* src);
+
 /*! FUNCTION:  ALIGNMENT_Reuse()
  *  SYNOPSIS:  Wipes <aln>'s old data for reuse, sets dimensions <Q x T>.
  */
@@ -118,15 +124,36 @@ void ALIGNMENT_Build_HMMER_Style(ALIGNMENT* aln,
                                  SEQUENCE* query,
                                  HMM_PROFILE* target);
 
+/*! FUNCTION:  ALIGNMENT_Build_Stats()
+ *  SYNOPSIS:  Count matches, misses and gap openings of <aln>, and its percent identity.
+ *             Same counts as ALIGNMENT_Build_HMMER_Style(), without building strings.
+ *             Expects <aln> has already been constructed.
+ */
+void ALIGNMENT_Build_Stats(ALIGNMENT* aln,
+                           SEQUENCE* query,
+                           HMM_PROFILE* target);
+
 /*! FUNCTION:  ALIGNMENT_Build_MMSEQS_Style()
  *  SYNOPSIS:  Generate <aln> strings, MMSEQS-style.
  *             Stores in <cigar_aln>.
  *             Expects <aln> has already been constructed.
+ *             Only uses traces of <aln>, so <query> and <target> may be NULL.
  */
 void ALIGNMENT_Build_MMSEQS_Style(ALIGNMENT* aln,
                                   SEQUENCE* query,
                                   HMM_PROFILE* target);
 
+/*! FUNCTION:  ALIGNMENT_Build_From_MMSEQS_Cigar()
+ *  SYNOPSIS:  Append traces to <aln> of path given by MMSEQS-style <cigar> (e.g. 12M2I5M), starting from
+ *             (<q_beg>,<t_beg>). MMSEQS query/target are swapped relative to MMORE, so 'I' steps through
+ *             target (delete state) and 'D' steps through query (insert state).
+ *             Returns false if <cigar> is not a valid alignment (empty, unknown op, or not starting with a match).
+ */
+bool ALIGNMENT_Build_From_MMSEQS_Cigar(ALIGNMENT* aln,
+                                       const char* cigar,
+                                       int q_beg,
+                                       int t_beg);
+
 /*! FUNCTION:  ALIGNMENT_Dump()
  *  SYNOPSIS:  Outputs <aln> to open file pointer <fp>.
  */
@@ -29,6 +29,11 @@ ARGS* ARGS_Create() {
   /* commandline */
   args->cmdline = NULL;
   args->opts = NULL;
+  /* program */
+  args->mmoreseqs_program = NULL;
+  args->mmseqs_program = NULL;
+  args->hmmer_program = NULL;
+  args->mmoreseqs_scripts = NULL;
   /* pipeline */
   args->pipeline_mode = -1;
   args->pipeline_name = NULL;
@@ -58,6 +63,11 @@ ARGS* ARGS_Create() {
   /* results input */
   args->mmseqs_m8_filein = NULL;
   args->hitlist_filein = NULL;
+  args->idlist_filein = NULL;
+  args->cloudin_filein = NULL;
+  args->binout_filein = NULL;
+  args->dupmap_filein = NULL;
+  args->shard_fileins = NULL;
   /* prep-able files */
   args->target_prep = NULL;
   args->query_prep = NULL;
@@ -75,7 +85,24 @@ ARGS* ARGS_Create() {
   args->mydom_fileout = NULL;
   args->mytime_fileout = NULL;
   args->mythresh_fileout = NULL;
+  args->perf_fileout = NULL;
+  args->trace_fileout = NULL;
+  args->binout_fileout = NULL;
+  args->cloudout_fileout = NULL;
   args->customout_fileout = NULL;
+  /* shard planning */
+  args->plan_calib_filein = NULL;
+  args->plan_fileout = NULL;
+  args->plan_idlist_fileout = NULL;
+  /* cloud calibration */
+  args->calib_labels_filein = NULL;
+  args->calib_fileout = NULL;
+  /* query deduplication */
+  args->dedup_fileout = NULL;
+  args->dupmap_fileout = NULL;
+  /* profile building */
+  args->hmm_fileout = NULL;
+  args->cons_fileout = NULL;
 
   return args;
 }
@@ -123,6 +150,16 @@ ARGS* ARGS_Destroy(ARGS* args) {
   /* results input */
   STR_Destroy(args->mmseqs_m8_filein);
   STR_Destroy(args->hitlist_filein);
+  STR_Destroy(args->idlist_filein);
+  STR_Destroy(args->cloudin_filein);
+  STR_Destroy(args->binout_filein);
+  STR_Destroy(args->dupmap_filein);
+  if (args->shard_fileins != NULL) {
+    for (int i = 0; i < args->shard_fileins->N; i++) {
+      STR_Destroy(VEC_X(args->shard_fileins, i));
+    }
+    args->shard_fileins = VECTOR_STR_Destroy(args->shard_fileins);
+  }
   /* prep-able files */
   STR_Destroy(args->target_prep);
   STR_Destroy(args->query_prep);
@@ -140,7 +177,24 @@ ARGS* ARGS_Destroy(ARGS* args) {
   STR_Destroy(args->mydom_fileout);
   STR_Destroy(args->mytime_fileout);
   STR_Destroy(args->mythresh_fileout);
+  STR_Destroy(args->perf_fileout);
+  STR_Destroy(args->trace_fileout);
+  STR_Destroy(args->binout_fileout);
+  STR_Destroy(args->cloudout_fileout);
   STR_Destroy(args->customout_fileout);
+  /* shard planning */
+  STR_Destroy(args->plan_calib_filein);
+  STR_Destroy(args->plan_fileout);
+  STR_Destroy(args->plan_idlist_fileout);
+  /* cloud calibration */
+  STR_Destroy(args->calib_labels_filein);
+  STR_Destroy(args->calib_fileout);
+  /* query deduplication */
+  STR_Destroy(args->dedup_fileout);
+  STR_Destroy(args->dupmap_fileout);
+  /* profile building */
+  STR_Destroy(args->hmm_fileout);
+  STR_Destroy(args->cons_fileout);
 
   args = ERROR_free(args);
   return args;
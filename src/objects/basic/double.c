@@ -79,7 +79,8 @@ DBL_FromString(char* str) {
 inline int
 DBL_Compare(const DBL a,
             const DBL b) {
-  return (a - b);
+  /* difference would be truncated to zero on cast to int */
+  return (a > b) - (a < b);
 }
 
 /*! FUNCTION:  DBL_CompareTo()
@@ -91,7 +91,8 @@ FLT_FromString(char* str) {
 inline int
 FLT_Compare(const FLT a,
             const FLT b) {
-  return (a - b);
+  /* difference would be truncated to zero on cast to int */
+  return (a > b) - (a < b);
 }
 
 /*! FUNCTION:  FLT_CompareTo()
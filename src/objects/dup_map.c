@@ -0,0 +1,174 @@
+/*******************************************************************************
+ *  - FILE:      dup_map.c
+ *  - DESC:    DUP_MAP Object.
+ *             Maps canonical queries to the duplicate queries removed from query file
+ *             by `mmoreseqs dedup`, so that results of canonical can be reported for each duplicate.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/* local imports */
+#include "structs.h"
+#include "../utilities/_utilities.h"
+
+/* header */
+#include "_objects.h"
+#include "dup_map.h"
+
+/* === PRIVATE FUNCTIONS === */
+static int
+DUP_MAP_Compare_by_Canon(const void* a, const void* b);
+
+/*!  FUNCTION:    DUP_MAP_Create()
+ *   SYNOPSIS:    Creates an instance of DUP_MAP.
+ */
+DUP_MAP*
+DUP_MAP_Create() {
+  DUP_MAP* map = NULL;
+  const int min_size = 32;
+
+  map = (DUP_MAP*)ERROR_malloc(sizeof(DUP_MAP));
+
+  map->N = 0;
+  map->Nalloc = min_size;
+  map->nodes = ERROR_malloc(sizeof(DUP_MAP_NODE) * min_size);
+  map->source_path = NULL;
+  map->sort_type = SORT_NONE;
+
+  return map;
+}
+
+/*!  FUNCTION:    DUP_MAP_Destroy()
+ *   SYNOPSIS:    Destroys instance of DUP_MAP and frees memory.
+ */
+DUP_MAP*
+DUP_MAP_Destroy(DUP_MAP* map) {
+  if (map == NULL)
+    return map;
+
+  DUP_MAP_Reuse(map);
+  map->nodes = ERROR_free(map->nodes);
+
+  map = ERROR_free(map);
+  return map;
+}
+
+/*!  FUNCTION:    DUP_MAP_Reuse()
+ *   SYNOPSIS:    Reuse an instance of DUP_MAP.
+ */
+void DUP_MAP_Reuse(DUP_MAP* map) {
+  for (int i = 0; i < map->N; i++) {
+    STR_Destroy(map->nodes[i].canon_name);
+    STR_Destroy(map->nodes[i].dup_name);
+  }
+  map->N = 0;
+
+  map->source_path = STR_Destroy(map->source_path);
+  map->sort_type = SORT_NONE;
+}
+
+/*!  FUNCTION:    DUP_MAP_Pushback()
+ *   SYNOPSIS:    Add duplicate <dup_name> of canonical query <canon_name> to <map>.
+ *                Resizes node array if necessary.
+ */
+void DUP_MAP_Pushback(DUP_MAP* map,
+                      const char* canon_name,
+                      const char* dup_name) {
+  DUP_MAP_NODE* node = &map->nodes[map->N];
+
+  node->id = map->N;
+  node->canon_name = STR_Create(canon_name);
+  node->dup_name = STR_Create(dup_name);
+
+  map->N++;
+  if (map->N >= map->Nalloc) {
+    map->Nalloc = map->N * 2;
+    map->nodes = ERROR_realloc(map->nodes, sizeof(DUP_MAP_NODE) * map->Nalloc);
+  }
+  map->sort_type = SORT_NONE;
+}
+
+/*!  FUNCTION:    DUP_MAP_Sort()
+ *   SYNOPSIS:    Sort <map> by canonical name.  Duplicates of the same canonical query keep their order.
+ */
+void DUP_MAP_Sort(DUP_MAP* map) {
+  qsort(map->nodes, map->N, sizeof(DUP_MAP_NODE), DUP_MAP_Compare_by_Canon);
+  map->sort_type = SORT_NAME;
+}
+
+/*!  FUNCTION:    DUP_MAP_Search()
+ *   SYNOPSIS:    Binary search (by canonical name) for first duplicate of <canon_name>.
+ *                Assumes <map> is sorted by DUP_MAP_Sort().  Following duplicates of <canon_name> are adjacent.
+ *     RETURN:    index of first duplicate; -1 if <canon_name> has no duplicates.
+ */
+int DUP_MAP_Search(const DUP_MAP* map,
+                   const char* canon_name) {
+  int lo = 0;
+  int hi = map->N;
+  int mid;
+
+#if DEBUG
+  {
+    if (map->sort_type != SORT_NAME) {
+      printf("ERROR: Binary Search of DUP_MAP by Name while not sorted by Name.\n");
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+  }
+#endif
+
+  /* lower bound */
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if (strcmp(map->nodes[mid].canon_name, canon_name) < 0) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+
+  if (lo < map->N && strcmp(map->nodes[lo].canon_name, canon_name) == 0) {
+    return lo;
+  }
+  return -1;
+}
+
+/*!  FUNCTION:    DUP_MAP_Dump()
+ *   SYNOPSIS:    Output <map> to file pointer <fp>, in map file format: one duplicate per line,
+ *                as tab-delimited {canonical name} and {duplicate name}.
+ */
+void DUP_MAP_Dump(const DUP_MAP* map,
+                  FILE* fp) {
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to open file.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  fprintf(fp, "#%s\t%s\n", "canonical_query", "duplicate_query");
+  for (int i = 0; i < map->N; i++) {
+    fprintf(fp, "%s\t%s\n", map->nodes[i].canon_name, map->nodes[i].dup_name);
+  }
+}
+
+/*!  FUNCTION:    DUP_MAP_Compare_by_Canon()
+ *   SYNOPSIS:    Compare nodes by canonical name, then by order in map.
+ */
+static int
+DUP_MAP_Compare_by_Canon(const void* a,
+                         const void* b) {
+  const DUP_MAP_NODE* node_a = (const DUP_MAP_NODE*)a;
+  const DUP_MAP_NODE* node_b = (const DUP_MAP_NODE*)b;
+  int cmp = strcmp(node_a->canon_name, node_b->canon_name);
+
+  if (cmp != 0) {
+    return cmp;
+  }
+  return node_a->id - node_b->id;
+}
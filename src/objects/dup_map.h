@@ -0,0 +1,49 @@
+/*******************************************************************************
+ *  - FILE:      dup_map.h
+ *  - DESC:    DUP_MAP Object.
+ *             Maps canonical queries to the duplicate queries removed from query file.
+ *******************************************************************************/
+
+#ifndef _DUP_MAP_H
+#define _DUP_MAP_H
+
+/*!  FUNCTION:    DUP_MAP_Create()
+ *   SYNOPSIS:    Creates an instance of DUP_MAP.
+ */
+DUP_MAP* DUP_MAP_Create();
+
+/*!  FUNCTION:    DUP_MAP_Destroy()
+ *   SYNOPSIS:    Destroys instance of DUP_MAP and frees memory.
+ */
+DUP_MAP* DUP_MAP_Destroy(DUP_MAP* map);
+
+/*!  FUNCTION:    DUP_MAP_Reuse()
+ *   SYNOPSIS:    Reuse an instance of DUP_MAP.
+ */
+void DUP_MAP_Reuse(DUP_MAP* map);
+
+/*!  FUNCTION:    DUP_MAP_Pushback()
+ *   SYNOPSIS:    Add duplicate <dup_name> of canonical query <canon_name> to <map>.
+ *                Resizes node array if necessary.
+ */
+void DUP_MAP_Pushback(DUP_MAP* map, const char* canon_name, const char* dup_name);
+
+/*!  FUNCTION:    DUP_MAP_Sort()
+ *   SYNOPSIS:    Sort <map> by canonical name.  Duplicates of the same canonical query keep their order.
+ */
+void DUP_MAP_Sort(DUP_MAP* map);
+
+/*!  FUNCTION:    DUP_MAP_Search()
+ *   SYNOPSIS:    Binary search (by canonical name) for first duplicate of <canon_name>.
+ *                Assumes <map> is sorted by DUP_MAP_Sort().  Following duplicates of <canon_name> are adjacent.
+ *     RETURN:    index of first duplicate; -1 if <canon_name> has no duplicates.
+ */
+int DUP_MAP_Search(const DUP_MAP* map, const char* canon_name);
+
+/*!  FUNCTION:    DUP_MAP_Dump()
+ *   SYNOPSIS:    Output <map> to file pointer <fp>, in map file format: one duplicate per line,
+ *                as tab-delimited {canonical name} and {duplicate name}.
+ */
+void DUP_MAP_Dump(const DUP_MAP* map, FILE* fp);
+
+#endif /* _DUP_MAP_H */
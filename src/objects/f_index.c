@@ -262,7 +262,7 @@ int F_INDEX_Search_Name(F_INDEX* index,
                         char* search_term) {
   int lo = 0;
   int mid = 0;
-  int hi = index->N;
+  int hi = index->N - 1;
   int cmp = 0;
   F_INDEX_NODE node;
 
@@ -317,7 +317,7 @@ int F_INDEX_Search_Id(F_INDEX* index,
                       int search_term) {
   int lo = 0;
   int mid = 0;
-  int hi = index->N;
+  int hi = index->N - 1;
   int cmp = 0;
 
 #if DEBUG
@@ -377,7 +377,7 @@ void F_INDEX_Dump(F_INDEX* index,
     fprintf(fp, "#_%s\t%s\n", "LOOKUP_PATH:", index->lookup_path);
     fprintf(fp, "#_%s\t%d\n", "NUMBER_SEQS:", index->N);
     fprintf(fp, "#_%s\t%s\n", "MMSEQS_NAMES:", index->mmseqs_names ? "true" : "false");
-    fprintf(fp, "#>{ID}\t{OFF}\t{NAME}\n");
+    fprintf(fp, "#>{ID}\t{OFF}\t{NAME}\t{LEN}\n");
   }
 
   /* print index */
@@ -391,7 +391,7 @@ void F_INDEX_Dump(F_INDEX* index,
     if (name != NULL) {
       name = strtok(node->name, delim);
     }
-    fprintf(fp, "%d\t%ld\t%s\t", i, node->offset, name);
+    fprintf(fp, "%d\t%ld\t%s\t%d\t", i, node->offset, name, node->length);
     fprintf(fp, "\n");
   }
 }
@@ -21,6 +21,10 @@
 /* header */
 #include "hmm_profile.h"
 
+/* private functions */
+static void
+HMM_FILE_Dump_Prob(FILE* fp, float p);
+
 /**  FUNCTION:  HMM_PROFILE_Create()
  *   SYNOPSIS:  Constructor for HMM_PROFILE.
  *   RETURN:    Pointer to HMM_PROFILE object.
@@ -37,6 +41,8 @@ HMM_PROFILE_Create() {
   prof->acc = NULL;
   prof->desc = NULL;
   prof->alph = NULL;
+  prof->nseq = 0;
+  prof->effn = 0.0f;
 
   prof->consensus = VECTOR_CHAR_Create();
   prof->is_consensus = false;
@@ -211,6 +217,29 @@ STR HMM_PROFILE_GetConsensus(HMM_PROFILE* prof) {
   return consensus;
 }
 
+/**  FUNCTION:  HMM_PROFILE_Copy()
+ *   SYNOPSIS:  Copy name, model, background and settings of <src> into <dest>, resizing <dest> if necessary.
+ */
+void HMM_PROFILE_Copy(HMM_PROFILE* dest,
+                      HMM_PROFILE* src) {
+  HMM_BG* hmm_bg = dest->bg_model->hmm_bg;
+
+  HMM_PROFILE_SetTextField(&dest->name, src->name);
+  HMM_PROFILE_SetModel_Length(dest, src->N);
+  memcpy(dest->hmm_model, src->hmm_model, sizeof(HMM_NODE) * (src->N + 1));
+  *dest->bg_model = *src->bg_model;
+  dest->bg_model->hmm_bg = hmm_bg;
+
+  dest->numberFormat = src->numberFormat;
+  dest->mode = src->mode;
+  dest->isLocal = src->isLocal;
+  dest->isMultihit = src->isMultihit;
+  dest->num_J = src->num_J;
+  dest->msv_dist = src->msv_dist;
+  dest->viterbi_dist = src->viterbi_dist;
+  dest->forward_dist = src->forward_dist;
+}
+
 /* Set Distribution Parameters for HMM_PROFILE */
 /**  FUNCTION:  HMM_PROFILE_Reuse()
  *   SYNOPSIS:
@@ -381,88 +410,124 @@ void HMM_PROFILE_Dump(HMM_PROFILE* prof,
   fprintf(fp, "//\n");
 }
 
+/**  FUNCTION:  HMM_FILE_Dump()
+ *   SYNOPSIS:  Output HMM_PROFILE <prof> to FILE POINTER <fp> in HMMER3/f .hmm file format, readable by HMM_PROFILE_Parse().
+ *              Profile must be in real space (probabilities are written as negative logs).
+ *              Consensus residue is uppercase if its match probability is at least 0.5, lowercase otherwise.
+ */
 void HMM_FILE_Dump(HMM_PROFILE* prof,
                    FILE* fp) {
-  /* hardcoded vars */
-  char* format_name = "HMMER3/f [3.2.1 | June 2018]";
-  char* alph = "amino";
-  int nseq = 1;
-
-  int head_pad = 5;
-  int stat_pad = 21;
-  int hmm_pad = 7;
-  int cons_pad = 6;
-
-  /* Header */
-  fprintf(fp, "%s\n", format_name);
-  fprintf(fp, "%*s %s\n", head_pad, "NAME", prof->name);
-  fprintf(fp, "%*s %d\n", head_pad, "LENG", prof->N);
-  fprintf(fp, "%*s %s\n", head_pad, "ALPH", alph);
-  /* RF - y/n */
-  /* MM - y/n */
-  /* CONS - y/n */
-  /* CS - y/n */
-  /* MAP - y/n */
-  fprintf(fp, "%*s %d\n", head_pad, "NSEQ", nseq);
-  /* CKSUM - checksum */
-  fprintf(fp, "%*s %8.4f %8.5f\n",
-          stat_pad, "STAT LOCAL MSV", prof->msv_dist.param1, prof->msv_dist.param2);
-  fprintf(fp, "%*s %8.4f %8.5f\n",
-          stat_pad, "STAT LOCAL VITERBI", prof->viterbi_dist.param1, prof->viterbi_dist.param2);
-  fprintf(fp, "%*s %8.4f %8.5f\n",
-          stat_pad, "STAT LOCAL FORWARD", prof->forward_dist.param1, prof->forward_dist.param2);
-
-  /* hmm */
-  fprintf(fp, "HMM          A        C        D        E        F        G        H        I        K        L        M        N        P        Q        R        S        T        V        W        Y\n");
-  fprintf(fp, "            m->m     m->i     m->d     i->m     i->i     d->m     d->d\n");
-  /* background composition */
-  /* emission probabilities */
-  fprintf(fp, "%*s   ", -hmm_pad, "COMPO");
+  const char* trans_names[] = {"m->m", "m->i", "m->d", "i->m", "i->i", "d->m", "d->d"};
+  HMM_NODE* node = NULL;
+  int best;
+
+  /* test for bad file pointer */
+  if (fp == NULL) {
+    const char* obj_name = "HMM_PROFILE";
+    fprintf(stderr, "ERROR: Bad FILE POINTER for printing %s.\n", obj_name);
+    ERRORCHECK_exit(EXIT_FAILURE);
+    return;
+  }
+  if (prof->numberFormat != PROF_FORMAT_REAL) {
+    fprintf(stderr, "ERROR: HMM_PROFILE '%s' must be in real space to be written to .hmm file.\n", prof->name);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  /* header */
+  fprintf(fp, "HMMER3/f [MMOREseqs %s]\n", BUILD_VERSION);
+  fprintf(fp, "NAME  %s\n", prof->name);
+  if (prof->acc != NULL) {
+    fprintf(fp, "ACC   %s\n", prof->acc);
+  }
+  if (prof->desc != NULL) {
+    fprintf(fp, "DESC  %s\n", prof->desc);
+  }
+  fprintf(fp, "LENG  %d\n", prof->N);
+  fprintf(fp, "ALPH  %s\n", "amino");
+  fprintf(fp, "RF    %s\n", "no");
+  fprintf(fp, "MM    %s\n", "no");
+  fprintf(fp, "CONS  %s\n", "yes");
+  fprintf(fp, "CS    %s\n", "no");
+  fprintf(fp, "MAP   %s\n", "no");
+  fprintf(fp, "NSEQ  %d\n", prof->nseq);
+  fprintf(fp, "EFFN  %f\n", prof->effn);
+  fprintf(fp, "STATS LOCAL MSV      %8.4f %8.5f\n", prof->msv_dist.param1, prof->msv_dist.param2);
+  fprintf(fp, "STATS LOCAL VITERBI  %8.4f %8.5f\n", prof->viterbi_dist.param1, prof->viterbi_dist.param2);
+  fprintf(fp, "STATS LOCAL FORWARD  %8.4f %8.5f\n", prof->forward_dist.param1, prof->forward_dist.param2);
+
+  /* column headers */
+  fprintf(fp, "HMM     ");
+  for (int j = 0; j < NUM_AMINO; j++) {
+    fprintf(fp, "     %c   ", AA[j]);
+  }
+  fprintf(fp, "\n");
+  fprintf(fp, "        ");
+  for (int j = 0; j < NUM_TRANS_STATES - 1; j++) {
+    fprintf(fp, " %8s", trans_names[j]);
+  }
+  fprintf(fp, "\n");
+
+  /* background composition, then node 0 insert emissions and transitions */
+  fprintf(fp, "  COMPO ");
   for (int j = 0; j < NUM_AMINO; j++) {
-    fprintf(fp, "%8.5f ", prof->bg_model->compo[j]);
+    HMM_FILE_Dump_Prob(fp, prof->bg_model->compo[j]);
   }
   fprintf(fp, "\n");
-  /* background insert probabilities */
-  fprintf(fp, "%*s   ", -hmm_pad, "");
+  node = &prof->hmm_model[0];
+  fprintf(fp, "        ");
   for (int j = 0; j < NUM_AMINO; j++) {
-    fprintf(fp, "%8.5f ", prof->bg_model->insert[j]);
+    HMM_FILE_Dump_Prob(fp, node->insert[j]);
   }
   fprintf(fp, "\n");
-  /* back transition proabilities */
-  fprintf(fp, "%*s   ", -hmm_pad, "");
-  for (int j = 0; j < NUM_TRANS_STATES; j++) {
-    if (prof->bg_model->trans[j] == -INF || prof->bg_model->trans[j] == INF) {
-      fprintf(fp, "%8s ", "*");
-    } else {
-      fprintf(fp, "%8.5f ", prof->bg_model->trans[j]);
-    }
+  fprintf(fp, "        ");
+  for (int j = 0; j < NUM_TRANS_STATES - 1; j++) {
+    HMM_FILE_Dump_Prob(fp, node->trans[j]);
   }
   fprintf(fp, "\n");
+
   /* position-specific probabilities */
-  for (int i = 1; i < prof->N + 1; i++) {
-    /* emission probabilities */
-    fprintf(fp, "%*d   ", -hmm_pad, i);
+  for (int i = 1; i <= prof->N; i++) {
+    node = &prof->hmm_model[i];
+    /* match emissions, map (unused), consensus, reference (unused), mask (unused), consensus structure (unused) */
+    best = 0;
+    fprintf(fp, " %6d ", i);
     for (int j = 0; j < NUM_AMINO; j++) {
-      fprintf(fp, "%8.5f ", prof->bg_model->compo[j]);
+      HMM_FILE_Dump_Prob(fp, node->match[j]);
+      if (node->match[j] > node->match[best]) {
+        best = j;
+      }
     }
-    /* consensus */
-    // fprintf(stderr, "%*d %c %c %c %c\n", -cons_pad, *prof->consensus[i], "-", "-", "-" );
-    fprintf(fp, "\n");
-    /* background insert probabilities */
-    fprintf(fp, "%*s   ", -hmm_pad, "");
+    fprintf(fp, " %6s %c %c %c %c\n", "-",
+            (node->match[best] >= 0.5f ? AA[best] : tolower(AA[best])), '-', '-', '-');
+    /* insert emissions */
+    fprintf(fp, "        ");
     for (int j = 0; j < NUM_AMINO; j++) {
-      fprintf(fp, "%8.5f ", prof->bg_model->insert[j]);
+      HMM_FILE_Dump_Prob(fp, node->insert[j]);
     }
     fprintf(fp, "\n");
-    /* back transition proabilities */
-    fprintf(fp, "%*s   ", -hmm_pad, "");
-    for (int j = 0; j < NUM_TRANS_STATES; j++) {
-      if (prof->bg_model->trans[j] == -INF || prof->bg_model->trans[j] == INF) {
-        fprintf(fp, "%8s ", "*");
-      } else {
-        fprintf(fp, "%8.5f ", prof->bg_model->trans[j]);
-      }
+    /* transitions */
+    fprintf(fp, "        ");
+    for (int j = 0; j < NUM_TRANS_STATES - 1; j++) {
+      HMM_FILE_Dump_Prob(fp, node->trans[j]);
     }
     fprintf(fp, "\n");
   }
+  fprintf(fp, "//\n");
+}
+
+/**  FUNCTION:  HMM_FILE_Dump_Prob()
+ *   SYNOPSIS:  Output probability <p> to FILE POINTER <fp> as .hmm file field: negative log, or "*" for zero.
+ */
+static void
+HMM_FILE_Dump_Prob(FILE* fp,
+                   float p) {
+  if (p <= 0.0f) {
+    fprintf(fp, " %8s", "*");
+  }
+  elif (p >= 1.0f) {
+    fprintf(fp, " %8.5f", 0.0);
+  }
+  else {
+    fprintf(fp, " %8.5f", -logf(p));
+  }
 }
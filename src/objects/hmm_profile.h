@@ -37,6 +37,11 @@ void HMM_PROFILE_SetConsensus(HMM_PROFILE* prof);
  */
 STR HMM_PROFILE_GetConsensus(HMM_PROFILE* prof);
 
+/**  FUNCTION:  HMM_PROFILE_Copy()
+ *   SYNOPSIS:  Copy name, model, background and settings of <src> into <dest>, resizing <dest> if necessary.
+ */
+void HMM_PROFILE_Copy(HMM_PROFILE* dest, HMM_PROFILE* src);
+
 /* Set Distribution Parameters for HMM_PROFILE */
 void HMM_PROFILE_SetDistribution_Params(HMM_PROFILE* prof,
                                         float param1,
@@ -55,4 +60,11 @@ void HMM_PROFILE_UnsetSubmodel(HMM_PROFILE* prof);
 /* Output HMM_PROFILE to FILE POINTER */
 void HMM_PROFILE_Dump(HMM_PROFILE* prof, FILE* fp);
 
+/**  FUNCTION:  HMM_FILE_Dump()
+ *   SYNOPSIS:  Output HMM_PROFILE <prof> to FILE POINTER <fp> in HMMER3/f .hmm file format, readable by HMM_PROFILE_Parse().
+ *              Profile must be in real space (probabilities are written as negative logs).
+ *              Consensus residue is uppercase if its match probability is at least 0.5, lowercase otherwise.
+ */
+void HMM_FILE_Dump(HMM_PROFILE* prof, FILE* fp);
+
 #endif /* _HMM_PROFILE_H */
@@ -16,5 +16,6 @@
 /* reader and writer (depend on buffer) */
 #include "reader.h"
 #include "writer.h"
+#include "async_writer.h"
 
 #endif /* _IO_H */
@@ -0,0 +1,213 @@
+/*******************************************************************************
+ *  - FILE:  async_writer.c
+ *  - DESC:  ASYNC_WRITER Class. Buffered writer which drains to file on a background thread.
+ *  NOTES:
+ *    - Caller fills one buffer while the background thread writes out the other,
+ *      so file i/o is kept off the main search loop.
+ *    - Only one caller thread should write to a given ASYNC_WRITER.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+#include <pthread.h>
+
+/* local imports */
+#include "../structs.h"
+#include "../../utilities/_utilities.h"
+#include "../_objects.h"
+
+/* header */
+#include "_io.h"
+#include "async_writer.h"
+
+/* private functions */
+static void*
+ASYNC_WRITER_Thread(void* arg);
+static void
+ASYNC_WRITER_Handoff(ASYNC_WRITER* writer);
+static void
+ASYNC_WRITER_Wait(ASYNC_WRITER* writer);
+
+/*!  FUNCTION:  ASYNC_WRITER_Create()
+ *   SYNOPSIS:  Create <writer> for open file <fp>, with two buffers of initial size <buf_size>,
+ *              and start background writer thread.
+ */
+ASYNC_WRITER*
+ASYNC_WRITER_Create(FILE* fp,
+                    size_t buf_size) {
+  ASYNC_WRITER* writer;
+  writer = ERROR_malloc(sizeof(ASYNC_WRITER));
+
+  writer->fp = fp;
+  for (int i = 0; i < 2; i++) {
+    writer->bufs[i] = ERROR_malloc(sizeof(char) * buf_size);
+    writer->lens[i] = 0;
+    writer->Nallocs[i] = buf_size;
+  }
+  writer->fill_idx = 0;
+  writer->drain_idx = 1;
+  writer->is_pending = false;
+  writer->is_stop = false;
+  writer->bytes_written = 0;
+
+  pthread_mutex_init(&writer->lock, NULL);
+  pthread_cond_init(&writer->cond, NULL);
+  if (pthread_create(&writer->thread, NULL, ASYNC_WRITER_Thread, writer) != 0) {
+    fprintf(stderr, "ERROR: Unable to start async writer thread.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  return writer;
+}
+
+/*!  FUNCTION:  ASYNC_WRITER_Destroy()
+ *   SYNOPSIS:  Flush all pending data, stop background thread, free memory and return NULL pointer.
+ *              Does not close <fp>.
+ */
+ASYNC_WRITER*
+ASYNC_WRITER_Destroy(ASYNC_WRITER* writer) {
+  if (writer == NULL) {
+    return writer;
+  }
+
+  ASYNC_WRITER_Flush(writer);
+
+  pthread_mutex_lock(&writer->lock);
+  writer->is_stop = true;
+  pthread_cond_broadcast(&writer->cond);
+  pthread_mutex_unlock(&writer->lock);
+  pthread_join(writer->thread, NULL);
+
+  pthread_mutex_destroy(&writer->lock);
+  pthread_cond_destroy(&writer->cond);
+  for (int i = 0; i < 2; i++) {
+    writer->bufs[i] = ERROR_free(writer->bufs[i]);
+  }
+  writer = ERROR_free(writer);
+
+  return writer;
+}
+
+/*!  FUNCTION:  ASYNC_WRITER_Printf()
+ *   SYNOPSIS:  Append formatted string to <writer>'s fill buffer.
+ *              When fill buffer is full, it is handed off to the background thread.
+ *              Only blocks if the background thread has not finished draining the previous buffer.
+ */
+STATUS_FLAG
+ASYNC_WRITER_Printf(ASYNC_WRITER* writer,
+                    const char* format,
+                    ...) {
+  va_list args;
+  int idx, len;
+  size_t space;
+
+  for (int attempt = 0; attempt < 3; attempt++) {
+    idx = writer->fill_idx;
+    space = writer->Nallocs[idx] - writer->lens[idx];
+
+    va_start(args, format);
+    len = vsnprintf(writer->bufs[idx] + writer->lens[idx], space, format, args);
+    va_end(args);
+    if (len < 0) {
+      return STATUS_FAILURE;
+    }
+    /* fits in current buffer */
+    if ((size_t)len < space) {
+      writer->lens[idx] += len;
+      return STATUS_SUCCESS;
+    }
+    /* buffer has data: hand it off and retry on the empty buffer */
+    if (writer->lens[idx] > 0) {
+      ASYNC_WRITER_Handoff(writer);
+    }
+    /* entry is larger than an empty buffer: grow it (only caller touches fill buffer) */
+    else {
+      writer->Nallocs[idx] = 2 * (len + 1);
+      writer->bufs[idx] = ERROR_realloc(writer->bufs[idx], sizeof(char) * writer->Nallocs[idx]);
+    }
+  }
+
+  return STATUS_FAILURE;
+}
+
+/*!  FUNCTION:  ASYNC_WRITER_Flush()
+ *   SYNOPSIS:  Hand off fill buffer and wait until all data has been written to file.
+ */
+STATUS_FLAG
+ASYNC_WRITER_Flush(ASYNC_WRITER* writer) {
+  if (writer->lens[writer->fill_idx] > 0) {
+    ASYNC_WRITER_Handoff(writer);
+  }
+  ASYNC_WRITER_Wait(writer);
+  fflush(writer->fp);
+
+  return STATUS_SUCCESS;
+}
+
+/*!  FUNCTION:  ASYNC_WRITER_Handoff()
+ *   SYNOPSIS:  Pass fill buffer to background thread and begin filling the other buffer.
+ *              Waits for previous hand-off to finish draining first.
+ */
+static void
+ASYNC_WRITER_Handoff(ASYNC_WRITER* writer) {
+  pthread_mutex_lock(&writer->lock);
+  while (writer->is_pending == true) {
+    pthread_cond_wait(&writer->cond, &writer->lock);
+  }
+  writer->drain_idx = writer->fill_idx;
+  writer->fill_idx = 1 - writer->fill_idx;
+  writer->lens[writer->fill_idx] = 0;
+  writer->is_pending = true;
+  pthread_cond_broadcast(&writer->cond);
+  pthread_mutex_unlock(&writer->lock);
+}
+
+/*!  FUNCTION:  ASYNC_WRITER_Wait()
+ *   SYNOPSIS:  Wait until background thread has drained any pending buffer.
+ */
+static void
+ASYNC_WRITER_Wait(ASYNC_WRITER* writer) {
+  pthread_mutex_lock(&writer->lock);
+  while (writer->is_pending == true) {
+    pthread_cond_wait(&writer->cond, &writer->lock);
+  }
+  pthread_mutex_unlock(&writer->lock);
+}
+
+/*!  FUNCTION:  ASYNC_WRITER_Thread()
+ *   SYNOPSIS:  Background thread: waits for buffers to be handed off and writes them to file.
+ */
+static void*
+ASYNC_WRITER_Thread(void* arg) {
+  ASYNC_WRITER* writer = (ASYNC_WRITER*)arg;
+  int idx;
+
+  while (true) {
+    pthread_mutex_lock(&writer->lock);
+    while (writer->is_pending == false && writer->is_stop == false) {
+      pthread_cond_wait(&writer->cond, &writer->lock);
+    }
+    if (writer->is_pending == false) {
+      pthread_mutex_unlock(&writer->lock);
+      break;
+    }
+    idx = writer->drain_idx;
+    pthread_mutex_unlock(&writer->lock);
+
+    /* buffer is not touched by caller until <is_pending> is cleared */
+    fwrite(writer->bufs[idx], sizeof(char), writer->lens[idx], writer->fp);
+    writer->bytes_written += writer->lens[idx];
+
+    pthread_mutex_lock(&writer->lock);
+    writer->is_pending = false;
+    pthread_cond_broadcast(&writer->cond);
+    pthread_mutex_unlock(&writer->lock);
+  }
+
+  return NULL;
+}
@@ -0,0 +1,40 @@
+/*******************************************************************************
+ *  - FILE:  async_writer.h
+ *  - DESC:  ASYNC_WRITER Class. Buffered writer which drains to file on a background thread.
+ *******************************************************************************/
+
+#ifndef _ASYNC_WRITER_H
+#define _ASYNC_WRITER_H
+
+/*!  FUNCTION:  ASYNC_WRITER_Create()
+ *   SYNOPSIS:  Create <writer> for open file <fp>, with two buffers of initial size <buf_size>,
+ *              and start background writer thread.
+ */
+ASYNC_WRITER*
+ASYNC_WRITER_Create(FILE* fp,
+                    size_t buf_size);
+
+/*!  FUNCTION:  ASYNC_WRITER_Destroy()
+ *   SYNOPSIS:  Flush all pending data, stop background thread, free memory and return NULL pointer.
+ *              Does not close <fp>.
+ */
+ASYNC_WRITER*
+ASYNC_WRITER_Destroy(ASYNC_WRITER* writer);
+
+/*!  FUNCTION:  ASYNC_WRITER_Printf()
+ *   SYNOPSIS:  Append formatted string to <writer>'s fill buffer.
+ *              When fill buffer is full, it is handed off to the background thread.
+ *              Only blocks if the background thread has not finished draining the previous buffer.
+ */
+STATUS_FLAG
+ASYNC_WRITER_Printf(ASYNC_WRITER* writer,
+                    const char* format,
+                    ...);
+
+/*!  FUNCTION:  ASYNC_WRITER_Flush()
+ *   SYNOPSIS:  Hand off fill buffer and wait until all data has been written to file.
+ */
+STATUS_FLAG
+ASYNC_WRITER_Flush(ASYNC_WRITER* writer);
+
+#endif /* _ASYNC_WRITER_H */
@@ -55,6 +55,7 @@ FILER_Create(STR filename,
   filer->mode = STR_Create(mode);
   filer->is_eof = false;
   filer->is_open = false;
+  filer->buf = NULL;
 
   return filer;
 }
@@ -73,6 +74,7 @@ FILER_Create_Stdout() {
   filer->mode = STR_Create("w+");
   filer->is_eof = false;
   filer->is_open = true;
+  filer->buf = NULL;
 
   return filer;
 }
@@ -143,6 +145,26 @@ FILER_Close(FILER* filer) {
     ERROR_fclose(filer->fp);
     filer->fp = NULL;
     filer->is_open = false;
+    filer->buf = ERROR_free(filer->buf);
+  }
+
+  return STATUS_SUCCESS;
+}
+
+/*!  FUNCTION:  FILER_SetBuffer()
+ *   SYNOPSIS:  Give open <filer> a fully-buffered stdio buffer of <size> bytes.
+ *              Must be called before any i/o on <filer>. Standard output is left unchanged.
+ */
+STATUS_FLAG
+FILER_SetBuffer(FILER* filer,
+                size_t size) {
+  if (filer->is_open == false || FILER_Is_StandardOutput(filer) == true || filer->buf != NULL) {
+    return STATUS_FAILURE;
+  }
+  filer->buf = ERROR_malloc(sizeof(char) * size);
+  if (setvbuf(filer->fp, filer->buf, _IOFBF, size) != 0) {
+    filer->buf = ERROR_free(filer->buf);
+    return STATUS_FAILURE;
   }
 
   return STATUS_SUCCESS;
@@ -28,6 +28,13 @@ FILER_SetFile(FILER* filer, STR filename, STR mode);
 STATUS_FLAG
 FILER_Open(FILER* filer);
 
+/*!  FUNCTION:  FILER_SetBuffer()
+ *   SYNOPSIS:  Give open <filer> a fully-buffered stdio buffer of <size> bytes.
+ *              Must be called before any i/o on <filer>. Standard output is left unchanged.
+ */
+STATUS_FLAG
+FILER_SetBuffer(FILER* filer, size_t size);
+
 /*!  FUNCTION:  FILER_Close()
  *   SYNOPSIS:  Close <filer> file pointer.
  */
@@ -34,6 +34,8 @@ M8_RESULTS_Create() {
   results->N = 0;
   results->Nalloc = 0;
   results->data = NULL;
+  results->num_searches = 0;
+  results->num_hits = 0;
 
   M8_RESULTS_Resize(results, min_size);
 
@@ -51,6 +53,7 @@ M8_RESULTS_Destroy(M8_RESULTS* results) {
   for (int i = 0; i < results->N; i++) {
     ERROR_free(results->data[i].target_name);
     ERROR_free(results->data[i].query_name);
+    ERROR_free(results->data[i].cigar_aln);
   }
 
   results->data = ERROR_free(results->data);
@@ -89,6 +92,34 @@ M8_RESULTS_GetX(M8_RESULTS* results,
   return &(results->data[i]);
 }
 
+/*! FUNCTION:  M8_RESULTS_Select_Ids()
+ *  SYNOPSIS:  Remove all entries from <results> whose result id is not in <ids> (in ascending order).
+ *             Order of remaining entries is preserved.
+ */
+void M8_RESULTS_Select_Ids(M8_RESULTS* results,
+                           VECTOR_INT* ids) {
+  int N_ids = VECTOR_INT_GetSize(ids);
+  int N_keep = 0;
+  int j = 0;
+
+  /* both lists are ascending by result id, so walk them together */
+  for (int i = 0; i < results->N; i++) {
+    M8_RESULT* res = &results->data[i];
+    while (j < N_ids && VEC_X(ids, j) < res->result_id) {
+      j++;
+    }
+    if (j < N_ids && VEC_X(ids, j) == res->result_id) {
+      results->data[N_keep++] = *res;
+    }
+    else {
+      ERROR_free(res->target_name);
+      ERROR_free(res->query_name);
+      ERROR_free(res->cigar_aln);
+    }
+  }
+  results->N = N_keep;
+}
+
 /*! FUNCTION:  M8_RESULTS_Swap_Target_and_Query()
  *  SYNOPSIS:  The target and query are cross-labeled between MMSEQS and MMORE.
  *             Ideally, this should be remedied and MMORE should be swapped (todo list).
@@ -96,18 +127,33 @@ M8_RESULTS_GetX(M8_RESULTS* results,
  */
 M8_RESULT*
 M8_RESULTS_Swap_Target_and_Query(M8_RESULTS* results) {
-  M8_RESULT* result;
-  int tmp_int;
-  STR tmp_str;
-
   for (int i = 0; i < results->N; i++) {
-    result = M8_RESULTS_GetX(results, i);
-    /* swap all fields */
-    INT_Swap(&result->query_id, &result->target_id);
-    STR_Swap(&result->query_name, &result->target_name);
-    INT_Swap(&result->q_beg, &result->t_beg);
-    INT_Swap(&result->q_end, &result->t_end);
+    M8_RESULT_Swap_Target_and_Query(M8_RESULTS_GetX(results, i));
+  }
+}
+
+/*! FUNCTION:  M8_RESULT_Swap_Target_and_Query()
+ *  SYNOPSIS:  Swap target and query fields of single entry <result>, as M8_RESULTS_Swap_Target_and_Query().
+ */
+void M8_RESULT_Swap_Target_and_Query(M8_RESULT* result) {
+  INT_Swap(&result->query_id, &result->target_id);
+  STR_Swap(&result->query_name, &result->target_name);
+  INT_Swap(&result->q_beg, &result->t_beg);
+  INT_Swap(&result->q_end, &result->t_end);
+}
+
+/*! FUNCTION:  M8_RESULT_Is_Same_Pair()
+ *  SYNOPSIS:  Check whether <res_a> and <res_b> are results for the same target/query pair.
+ *             Compares by name, or by id for entries without names (hitlist).
+ */
+bool M8_RESULT_Is_Same_Pair(M8_RESULT* res_a,
+                            M8_RESULT* res_b) {
+  if (res_a->target_name == NULL || res_a->query_name == NULL ||
+      res_b->target_name == NULL || res_b->query_name == NULL) {
+    return (res_a->target_id == res_b->target_id && res_a->query_id == res_b->query_id);
   }
+  return (strcmp(res_a->target_name, res_b->target_name) == 0 &&
+          strcmp(res_a->query_name, res_b->query_name) == 0);
 }
 
 /*! FUNCTION:  M8_RESULTS_Dump()
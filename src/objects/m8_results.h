@@ -32,6 +32,12 @@ void M8_RESULTS_Resize(M8_RESULTS* res, size_t size);
  */
 M8_RESULT* M8_RESULTS_GetX(M8_RESULTS* results, int i);
 
+/*! FUNCTION:  M8_RESULTS_Select_Ids()
+ *  SYNOPSIS:  Remove all entries from <results> whose result id is not in <ids> (in ascending order).
+ *             Order of remaining entries is preserved.
+ */
+void M8_RESULTS_Select_Ids(M8_RESULTS* results, VECTOR_INT* ids);
+
 /*! FUNCTION:  M8_RESULTS_Swap_Target_and_Query()
  *  SYNOPSIS:  The target and query are cross-labeled between MMSEQS and MMORE.
  *             Ideally, this should be remedied and MMORE should be swapped
@@ -40,6 +46,17 @@ M8_RESULT* M8_RESULTS_GetX(M8_RESULTS* results, int i);
  */
 M8_RESULT* M8_RESULTS_Swap_Target_and_Query(M8_RESULTS* results);
 
+/*! FUNCTION:  M8_RESULT_Swap_Target_and_Query()
+ *  SYNOPSIS:  Swap target and query fields of single entry <result>, as M8_RESULTS_Swap_Target_and_Query().
+ */
+void M8_RESULT_Swap_Target_and_Query(M8_RESULT* result);
+
+/*! FUNCTION:  M8_RESULT_Is_Same_Pair()
+ *  SYNOPSIS:  Check whether <res_a> and <res_b> are results for the same target/query pair.
+ *             Compares by name, or by id for entries without names (hitlist).
+ */
+bool M8_RESULT_Is_Same_Pair(M8_RESULT* res_a, M8_RESULT* res_b);
+
 /*! FUNCTION:  M8_RESULTS_Dump()
  *  SYNOPSIS:  Output all entries in <results> in .m8 format to file <fp>.
  */
@@ -11,5 +11,6 @@
 
 #include "matrix_2d.h"
 #include "matrix_3d.h"
+#include "matrix_i16.h"
 
 #endif /* _MATRIX_H */
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ *  - FILE:   matrix_i16.c
+ *  - DESC:    MATRIX_I16 object.
+ *             Int16 work buffers for reduced-precision cloud search, owned by worker
+ *             so they are only grown, not reallocated, between searches.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/* local imports */
+#include "../structs.h"
+#include "../../utilities/_utilities.h"
+#include "../_objects.h"
+
+/* header */
+#include "matrix_i16.h"
+
+/*! FUNCTION:  MATRIX_I16_Create()
+ *  SYNOPSIS:  Create new MATRIX_I16 object and returns pointer.
+ *             Caller must call MATRIX_I16_Reuse() before use.
+ */
+MATRIX_I16*
+MATRIX_I16_Create() {
+  MATRIX_I16* mx = NULL;
+
+  mx = ERROR_malloc(sizeof(MATRIX_I16));
+
+  mx->Q = 0;
+  mx->T = 0;
+  mx->W = 0;
+  mx->Wt = 0;
+  mx->Nalloc = 0;
+  mx->data = NULL;
+  mx->mx = NULL;
+  mx->tsc_rev = NULL;
+  mx->msc = NULL;
+  mx->isc = NULL;
+  mx->qA = VECTOR_INT_Create();
+  for (int i = 0; i < 3; i++) {
+    mx->lb_vec[i] = VECTOR_INT_Create();
+    mx->rb_vec[i] = VECTOR_INT_Create();
+  }
+
+  return mx;
+}
+
+/*! FUNCTION:  MATRIX_I16_Destroy()
+ *  SYNOPSIS:  Frees all memory from MATRIX_I16 object.
+ */
+MATRIX_I16*
+MATRIX_I16_Destroy(MATRIX_I16* mx) {
+  if (mx == NULL)
+    return mx;
+
+  mx->data = ERROR_free(mx->data);
+  mx->qA = VECTOR_INT_Destroy(mx->qA);
+  for (int i = 0; i < 3; i++) {
+    mx->lb_vec[i] = VECTOR_INT_Destroy(mx->lb_vec[i]);
+    mx->rb_vec[i] = VECTOR_INT_Destroy(mx->rb_vec[i]);
+  }
+
+  mx = ERROR_free(mx);
+  return mx;
+}
+
+/*! FUNCTION:  MATRIX_I16_Reuse()
+ *  SYNOPSIS:  Reuses MATRIX_I16 for new <Q> x <T> search (only resizes if more memory is needed).
+ *             Sets all cells of dp matrix to int16 floor and empties bound lists.
+ *             Score profile and digitized query are left for caller to fill.
+ */
+void MATRIX_I16_Reuse(MATRIX_I16* mx,
+                      int Q,
+                      int T) {
+  size_t N_mx, N_tsc, N_sc;
+
+  mx->Q = Q;
+  mx->T = T;
+  mx->W = (Q + 1) + (T + 1) + CLOUD_I16_PAD;
+  mx->Wt = (T + 1) + CLOUD_I16_PAD;
+
+  N_mx = (size_t)NUM_NORMAL_STATES * 3 * mx->W;
+  N_tsc = (size_t)NUM_TRANS_STATES * mx->Wt;
+  N_sc = (size_t)(T + 2) * NUM_AMINO_PLUS_SPEC;
+  if (N_mx + N_tsc + 2 * N_sc > mx->Nalloc) {
+    mx->Nalloc = N_mx + N_tsc + 2 * N_sc;
+    mx->data = ERROR_realloc(mx->data, sizeof(int16_t) * mx->Nalloc);
+  }
+  mx->mx = mx->data;
+  mx->tsc_rev = mx->mx + N_mx;
+  mx->msc = mx->tsc_rev + N_tsc;
+  mx->isc = mx->msc + N_sc;
+
+  for (size_t i = 0; i < N_mx; i++) {
+    mx->mx[i] = INT16_MIN;
+  }
+  VECTOR_INT_SetSize(mx->qA, Q + 1);
+  for (int i = 0; i < 3; i++) {
+    VECTOR_INT_Reuse(mx->lb_vec[i]);
+    VECTOR_INT_Reuse(mx->rb_vec[i]);
+  }
+}
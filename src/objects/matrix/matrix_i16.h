@@ -0,0 +1,28 @@
+/*******************************************************************************
+ *  - FILE:   matrix_i16.h
+ *  - DESC:    MATRIX_I16 object.
+ *             Int16 work buffers for reduced-precision cloud search.
+ *******************************************************************************/
+
+#ifndef _MATRIX_I16_H
+#define _MATRIX_I16_H
+
+/*! FUNCTION:  MATRIX_I16_Create()
+ *  SYNOPSIS:  Create new MATRIX_I16 object and returns pointer.
+ *             Caller must call MATRIX_I16_Reuse() before use.
+ */
+MATRIX_I16* MATRIX_I16_Create();
+
+/*! FUNCTION:  MATRIX_I16_Destroy()
+ *  SYNOPSIS:  Frees all memory from MATRIX_I16 object.
+ */
+MATRIX_I16* MATRIX_I16_Destroy(MATRIX_I16* mx);
+
+/*! FUNCTION:  MATRIX_I16_Reuse()
+ *  SYNOPSIS:  Reuses MATRIX_I16 for new <Q> x <T> search (only resizes if more memory is needed).
+ *             Sets all cells of dp matrix to int16 floor and empties bound lists.
+ *             Score profile and digitized query are left for caller to fill.
+ */
+void MATRIX_I16_Reuse(MATRIX_I16* mx, int Q, int T);
+
+#endif /* _MATRIX_I16_H */
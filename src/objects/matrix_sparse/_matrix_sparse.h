@@ -18,5 +18,9 @@
 #include "matrix_3d_sparse.h"
 /* sparse matrix builder */
 #include "matrix_3d_sparse_build.h"
+/* backpointers for viterbi traceback (dependent on edgebounds) */
+#include "viterbi_ptrs.h"
+/* cloud cache records for rescoring runs (dependent on edgebounds) */
+#include "cloud_cache.h"
 
 #endif /* _MATRIX_SPARSE_H */
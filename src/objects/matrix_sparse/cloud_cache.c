@@ -0,0 +1,215 @@
+/*******************************************************************************
+ *  - FILE:   cloud_cache.c
+ *  - DESC:    CLOUD_CACHE Object.
+ *             Row-wise cloud of a single search, stored in a cloud cache file so that
+ *             later runs over the same results can skip cloud search, merge and reorient.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/* local imports */
+#include "../structs.h"
+#include "../../utilities/_utilities.h"
+#include "../_objects.h"
+
+/* header */
+#include "_matrix_sparse.h"
+#include "cloud_cache.h"
+
+/* === CLOUD CACHE FORMAT =============================
+   Native byte order.
+   HEADER:
+        magic   char[8]   "MMORECLD"
+      version   int32     CLOUD_CACHE_VERSION
+       endian   int32     0x01020304
+   RECORDS (until end of file, in order of result id):
+    result_id   int32     id of .m8 result
+            Q   int32     query length
+            T   int32     target length
+       window   int32[4]  q_beg, t_beg, q_end, t_end of seed alignment
+       scores   float[5]  lin_cloud_fwd, lin_cloud_bck, threshold_cloud_max,
+                          threshold_cloud_compo, cloud_natsc
+       is_i16   int32     whether float cloud search was pruned to cloud of int16 search
+     N_bounds   int32     number of row-wise edgebounds
+      N_bytes   int32     size of encoded edgebounds
+         data   uint8[]   edgebounds, packed by EDGEBOUNDS_Pack()
+   ====================================================
+ */
+
+/*! FUNCTION:  CLOUD_CACHE_Create()
+ *  SYNOPSIS:  Create new CLOUD_CACHE object and returns pointer.
+ */
+CLOUD_CACHE*
+CLOUD_CACHE_Create() {
+  CLOUD_CACHE* cache = NULL;
+
+  cache = ERROR_malloc(sizeof(CLOUD_CACHE));
+
+  cache->result_id = -1;
+  cache->Q = 0;
+  cache->T = 0;
+  cache->q_beg = cache->t_beg = -1;
+  cache->q_end = cache->t_end = -1;
+  cache->lin_cloud_fwd = -INF;
+  cache->lin_cloud_bck = -INF;
+  cache->threshold_cloud_max = -INF;
+  cache->threshold_cloud_compo = -INF;
+  cache->cloud_natsc = -INF;
+  cache->is_i16 = false;
+  cache->N_bounds = 0;
+  cache->data = VECTOR_CHAR_Create();
+
+  return cache;
+}
+
+/*! FUNCTION:  CLOUD_CACHE_Destroy()
+ *  SYNOPSIS:  Frees all memory from CLOUD_CACHE object.
+ */
+CLOUD_CACHE*
+CLOUD_CACHE_Destroy(CLOUD_CACHE* cache) {
+  if (cache == NULL)
+    return cache;
+
+  cache->data = VECTOR_CHAR_Destroy(cache->data);
+
+  cache = ERROR_free(cache);
+  return cache;
+}
+
+/*! FUNCTION:  CLOUD_CACHE_Encode()
+ *  SYNOPSIS:  Encode row-wise edgebounds <edg> into <cache>.
+ */
+void CLOUD_CACHE_Encode(CLOUD_CACHE* cache,
+                        const EDGEBOUNDS* edg) {
+  cache->Q = edg->Q;
+  cache->T = edg->T;
+  cache->N_bounds = EDGEBOUNDS_GetSize(edg);
+  EDGEBOUNDS_Pack(edg, cache->data);
+}
+
+/*! FUNCTION:  CLOUD_CACHE_Decode()
+ *  SYNOPSIS:  Decode edgebounds of <cache> into row-wise <edg> and index them.
+ *             Returns false if encoded data is malformed.
+ */
+bool CLOUD_CACHE_Decode(const CLOUD_CACHE* cache,
+                        EDGEBOUNDS* edg) {
+  EDGEBOUNDS_Reuse(edg, cache->Q, cache->T);
+  if (EDGEBOUNDS_Unpack(edg, cache->data) == false ||
+      EDGEBOUNDS_GetSize(edg) != cache->N_bounds) {
+    return false;
+  }
+  EDGEBOUNDS_Index(edg);
+
+  return true;
+}
+
+/*! FUNCTION:  CLOUD_CACHE_Write_Header()
+ *  SYNOPSIS:  Write cloud cache header to <fp>.
+ */
+void CLOUD_CACHE_Write_Header(FILE* fp) {
+  int32_t header[2] = {CLOUD_CACHE_VERSION, CLOUD_CACHE_ENDIAN};
+
+  fwrite(CLOUD_CACHE_MAGIC, 1, CLOUD_CACHE_MAGIC_LEN, fp);
+  fwrite(header, sizeof(int32_t), 2, fp);
+}
+
+/*! FUNCTION:  CLOUD_CACHE_Write()
+ *  SYNOPSIS:  Write encoded record of <cache> to <fp>.
+ */
+void CLOUD_CACHE_Write(const CLOUD_CACHE* cache,
+                       FILE* fp) {
+  int32_t ids[3] = {cache->result_id, cache->Q, cache->T};
+  int32_t window[4] = {cache->q_beg, cache->t_beg, cache->q_end, cache->t_end};
+  float scores[5] = {cache->lin_cloud_fwd, cache->lin_cloud_bck,
+                     cache->threshold_cloud_max, cache->threshold_cloud_compo, cache->cloud_natsc};
+  int32_t is_i16 = cache->is_i16;
+  int32_t sizes[2] = {cache->N_bounds, cache->data->N};
+
+  fwrite(ids, sizeof(int32_t), 3, fp);
+  fwrite(window, sizeof(int32_t), 4, fp);
+  fwrite(scores, sizeof(float), 5, fp);
+  fwrite(&is_i16, sizeof(int32_t), 1, fp);
+  fwrite(sizes, sizeof(int32_t), 2, fp);
+  fwrite(cache->data->data, 1, cache->data->N, fp);
+}
+
+/*! FUNCTION:  CLOUD_CACHE_Read_Header()
+ *  SYNOPSIS:  Read cloud cache header from <fp>, checking format is compatible with this build.
+ *             <filename> is used for error messages.
+ */
+void CLOUD_CACHE_Read_Header(FILE* fp,
+                             const char* filename) {
+  char magic[CLOUD_CACHE_MAGIC_LEN];
+  int32_t header[2]; /* version, endian */
+
+  if (fread(magic, 1, CLOUD_CACHE_MAGIC_LEN, fp) != CLOUD_CACHE_MAGIC_LEN ||
+      memcmp(magic, CLOUD_CACHE_MAGIC, CLOUD_CACHE_MAGIC_LEN) != 0 ||
+      fread(header, sizeof(int32_t), 2, fp) != 2) {
+    fprintf(stderr, "ERROR: File '%s' is not a cloud cache file.\n", filename);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  if (header[0] != CLOUD_CACHE_VERSION) {
+    fprintf(stderr, "ERROR: cloud cache file version (%d) is not supported by this build (%d).\n",
+            header[0], CLOUD_CACHE_VERSION);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  if (header[1] != CLOUD_CACHE_ENDIAN) {
+    fprintf(stderr, "ERROR: cloud cache file was written on a machine with different byte order.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+}
+
+/*! FUNCTION:  CLOUD_CACHE_Read()
+ *  SYNOPSIS:  Read next record from <fp> into <cache>.
+ *             Returns false at end of file.
+ */
+bool CLOUD_CACHE_Read(CLOUD_CACHE* cache,
+                      FILE* fp) {
+  int32_t ids[3];
+  int32_t window[4];
+  float scores[5];
+  int32_t is_i16;
+  int32_t sizes[2];
+
+  if (fread(ids, sizeof(int32_t), 3, fp) != 3) {
+    return false;
+  }
+  if (fread(window, sizeof(int32_t), 4, fp) != 4 ||
+      fread(scores, sizeof(float), 5, fp) != 5 ||
+      fread(&is_i16, sizeof(int32_t), 1, fp) != 1 ||
+      fread(sizes, sizeof(int32_t), 2, fp) != 2 ||
+      sizes[0] < 0 || sizes[1] < 0) {
+    fprintf(stderr, "ERROR: cloud cache file is truncated or corrupt.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  cache->result_id = ids[0];
+  cache->Q = ids[1];
+  cache->T = ids[2];
+  cache->q_beg = window[0];
+  cache->t_beg = window[1];
+  cache->q_end = window[2];
+  cache->t_end = window[3];
+  cache->lin_cloud_fwd = scores[0];
+  cache->lin_cloud_bck = scores[1];
+  cache->threshold_cloud_max = scores[2];
+  cache->threshold_cloud_compo = scores[3];
+  cache->cloud_natsc = scores[4];
+  cache->is_i16 = (is_i16 != 0);
+  cache->N_bounds = sizes[0];
+
+  VECTOR_CHAR_SetSize(cache->data, sizes[1]);
+  if (fread(cache->data->data, 1, sizes[1], fp) != sizes[1]) {
+    fprintf(stderr, "ERROR: cloud cache file is truncated or corrupt.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  return true;
+}
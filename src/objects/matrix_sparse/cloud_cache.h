@@ -0,0 +1,53 @@
+/*******************************************************************************
+ *  - FILE:   cloud_cache.h
+ *  - DESC:    CLOUD_CACHE Object.
+ *             Row-wise cloud of a single search, stored in a cloud cache file.
+ *******************************************************************************/
+
+#ifndef _CLOUD_CACHE_H
+#define _CLOUD_CACHE_H
+
+/*! FUNCTION:  CLOUD_CACHE_Create()
+ *  SYNOPSIS:  Create new CLOUD_CACHE object and returns pointer.
+ */
+CLOUD_CACHE* CLOUD_CACHE_Create();
+
+/*! FUNCTION:  CLOUD_CACHE_Destroy()
+ *  SYNOPSIS:  Frees all memory from CLOUD_CACHE object.
+ */
+CLOUD_CACHE* CLOUD_CACHE_Destroy(CLOUD_CACHE* cache);
+
+/*! FUNCTION:  CLOUD_CACHE_Encode()
+ *  SYNOPSIS:  Encode row-wise edgebounds <edg> into <cache>.
+ */
+void CLOUD_CACHE_Encode(CLOUD_CACHE* cache, const EDGEBOUNDS* edg);
+
+/*! FUNCTION:  CLOUD_CACHE_Decode()
+ *  SYNOPSIS:  Decode edgebounds of <cache> into row-wise <edg> and index them.
+ *             Returns false if encoded data is malformed.
+ */
+bool CLOUD_CACHE_Decode(const CLOUD_CACHE* cache, EDGEBOUNDS* edg);
+
+/*! FUNCTION:  CLOUD_CACHE_Write_Header()
+ *  SYNOPSIS:  Write cloud cache header to <fp>.
+ */
+void CLOUD_CACHE_Write_Header(FILE* fp);
+
+/*! FUNCTION:  CLOUD_CACHE_Write()
+ *  SYNOPSIS:  Write encoded record of <cache> to <fp>.
+ */
+void CLOUD_CACHE_Write(const CLOUD_CACHE* cache, FILE* fp);
+
+/*! FUNCTION:  CLOUD_CACHE_Read_Header()
+ *  SYNOPSIS:  Read cloud cache header from <fp>, checking format is compatible with this build.
+ *             <filename> is used for error messages.
+ */
+void CLOUD_CACHE_Read_Header(FILE* fp, const char* filename);
+
+/*! FUNCTION:  CLOUD_CACHE_Read()
+ *  SYNOPSIS:  Read next record from <fp> into <cache>.
+ *             Returns false at end of file.
+ */
+bool CLOUD_CACHE_Read(CLOUD_CACHE* cache, FILE* fp);
+
+#endif /* _CLOUD_CACHE_H */
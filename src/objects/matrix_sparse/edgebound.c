@@ -11,6 +11,7 @@
 #include <unistd.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 #include <math.h>
 
@@ -23,6 +24,12 @@
 #include "_matrix_sparse.h"
 #include "edgebound.h"
 
+/* private functions */
+static void
+EDGEBOUNDS_Pack_Varint(VECTOR_CHAR* data, uint32_t val);
+static uint32_t
+EDGEBOUNDS_Unpack_Varint(const uint8_t* data, int N, int* pos);
+
 /* index padding */
 const int index_pad = 1;
 
@@ -707,6 +714,97 @@ void EDGEBOUNDS_Save(EDGEBOUNDS* edg,
   fclose(fp);
 }
 
+/*! FUNCTION: EDGEBOUNDS_Pack()
+ *  SYNOPSIS: Pack row-wise <edg> into compact byte representation <data>.
+ *            Assumes <edg> is sorted. Rows are stored in order with their ids implicit,
+ *            and each bound is stored as offset from the bound before it:
+ *              per row:    varint(id - prev id - 1), varint(number of bounds in row)
+ *              1st bound:  zigzag(lb - 1st lb of prev row), varint(rb - lb)
+ *              next bound: zigzag(lb - prev rb), varint(rb - lb)
+ *            Varints are little-endian base-128 (7 bits per byte, high bit set on all but last byte).
+ *            This is a storage format (used by the cloud cache), not a working format:
+ *            the sparse passes still iterate over the indexed BOUND list.
+ */
+void EDGEBOUNDS_Pack(const EDGEBOUNDS* edg,
+                     VECTOR_CHAR* data) {
+  int N = EDGEBOUNDS_GetSize(edg);
+  int prv_id = -1;
+  int prv_lb = 0;
+  int d_lb;
+
+  VECTOR_CHAR_Reuse(data);
+
+  for (int r_0b = 0, r_0e; r_0b < N; r_0b = r_0e) {
+    BOUND* bnd = EDGEBOUNDS_GetX(edg, r_0b);
+    int id_0 = bnd->id;
+    int prv_rb;
+    /* find end of row */
+    for (r_0e = r_0b + 1; r_0e < N && EDGEBOUNDS_GetX(edg, r_0e)->id == id_0; r_0e++)
+      ;
+
+    EDGEBOUNDS_Pack_Varint(data, id_0 - prv_id - 1);
+    EDGEBOUNDS_Pack_Varint(data, r_0e - r_0b);
+    /* first bound relative to first bound of previous row */
+    d_lb = bnd->lb - prv_lb;
+    EDGEBOUNDS_Pack_Varint(data, ((uint32_t)d_lb << 1) ^ (uint32_t)(d_lb >> 31));
+    EDGEBOUNDS_Pack_Varint(data, bnd->rb - bnd->lb);
+    prv_lb = bnd->lb;
+    prv_rb = bnd->rb;
+    /* remaining bounds relative to end of previous bound */
+    for (int r_0 = r_0b + 1; r_0 < r_0e; r_0++) {
+      bnd = EDGEBOUNDS_GetX(edg, r_0);
+      d_lb = bnd->lb - prv_rb;
+      EDGEBOUNDS_Pack_Varint(data, ((uint32_t)d_lb << 1) ^ (uint32_t)(d_lb >> 31));
+      EDGEBOUNDS_Pack_Varint(data, bnd->rb - bnd->lb);
+      prv_rb = bnd->rb;
+    }
+    prv_id = id_0;
+  }
+}
+
+/*! FUNCTION: EDGEBOUNDS_Unpack()
+ *  SYNOPSIS: Unpack compact byte representation <data> from EDGEBOUNDS_Pack() and append to row-wise <edg>.
+ *            <edg> should be reused to proper dimensions first, which bounds are checked against.
+ *            Returns false if <data> is malformed.
+ */
+bool EDGEBOUNDS_Unpack(EDGEBOUNDS* edg,
+                       const VECTOR_CHAR* data) {
+  const uint8_t* bytes = (const uint8_t*)data->data;
+  int N_bytes = data->N;
+  int pos = 0;
+  int id_0 = -1;
+  int prv_lb = 0;
+  BOUND bnd;
+  uint32_t z_lb;
+
+  edg->edg_mode = EDG_ROW;
+
+  while (pos < N_bytes) {
+    id_0 += 1 + EDGEBOUNDS_Unpack_Varint(bytes, N_bytes, &pos);
+    int N_row = EDGEBOUNDS_Unpack_Varint(bytes, N_bytes, &pos);
+    if (pos > N_bytes || id_0 > edg->Q || N_row <= 0) {
+      return false;
+    }
+
+    for (int i = 0; i < N_row; i++) {
+      z_lb = EDGEBOUNDS_Unpack_Varint(bytes, N_bytes, &pos);
+      /* first bound from previous row, otherwise from previous bound */
+      bnd.lb = (i == 0 ? prv_lb : bnd.rb) + ((int)(z_lb >> 1) ^ -(int)(z_lb & 1));
+      bnd.rb = bnd.lb + EDGEBOUNDS_Unpack_Varint(bytes, N_bytes, &pos);
+      bnd.id = id_0;
+      if (pos > N_bytes || bnd.lb < 0 || bnd.rb > edg->T + 1) {
+        return false;
+      }
+      if (i == 0) {
+        prv_lb = bnd.lb;
+      }
+      EDGEBOUNDS_Pushback(edg, bnd);
+    }
+  }
+
+  return true;
+}
+
 /*! FUNCTION: EDGEBOUNDS_Compare()
  *  SYNOPSIS: Compare two EDGEBOUNDS objects.  Return 0 if equal.
  */
@@ -752,6 +850,21 @@ int EDGEBOUNDS_Count(EDGEBOUNDS* edg) {
   return sum;
 }
 
+/*! FUNCTION: EDGEBOUNDS_Count_in_Range()
+ *  SYNOPSIS: Count the number of cells in edgebound whose row/diag id is in <range> (inclusive).
+ */
+int EDGEBOUNDS_Count_in_Range(EDGEBOUNDS* edg, RANGE range) {
+  int sum = 0;
+  int N = EDGEBOUNDS_GetSize(edg);
+  for (int i = 0; i < N; i++) {
+    BOUND bnd = EDGEBOUNDS_Get(edg, i);
+    if (bnd.id >= range.beg && bnd.id <= range.end) {
+      sum += bnd.rb - bnd.lb;
+    }
+  }
+  return sum;
+}
+
 /*! FUNCTION: EDGEBOUNDS_Validate()
  *  SYNOPSIS: Verifies that edgebound ranges don't go out-of-bounds of containing matrix dimensions.
  *            For testing.
@@ -952,3 +1065,39 @@ int EDGEBOUNDS_SetDomain(EDGEBOUNDS* edg_in,
 
   return STATUS_SUCCESS;
 }
+
+/*! FUNCTION: EDGEBOUNDS_Pack_Varint()
+ *  SYNOPSIS: Append <val> to <data> as varint.
+ */
+static void
+EDGEBOUNDS_Pack_Varint(VECTOR_CHAR* data,
+                       uint32_t val) {
+  while (val >= 0x80) {
+    VECTOR_CHAR_Pushback(data, (CHAR)((val & 0x7F) | 0x80));
+    val >>= 7;
+  }
+  VECTOR_CHAR_Pushback(data, (CHAR)val);
+}
+
+/*! FUNCTION: EDGEBOUNDS_Unpack_Varint()
+ *  SYNOPSIS: Read varint from <data> of length <N> at <pos>, and advance <pos>.
+ *            On overrun, <pos> is set past <N>.
+ */
+static uint32_t
+EDGEBOUNDS_Unpack_Varint(const uint8_t* data,
+                         int N,
+                         int* pos) {
+  uint32_t val = 0;
+  int shift = 0;
+
+  while (*pos < N && shift < 32) {
+    uint8_t byte = data[(*pos)++];
+    val |= (uint32_t)(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return val;
+    }
+    shift += 7;
+  }
+  *pos = N + 1;
+  return 0;
+}
@@ -232,6 +232,22 @@ void EDGEBOUNDS_Sub_Dump(EDGEBOUNDS* edg, FILE* fp, int beg, int end);
  */
 void EDGEBOUNDS_Save(EDGEBOUNDS* edg, const char* filename);
 
+/*! FUNCTION: EDGEBOUNDS_Pack()
+ *  SYNOPSIS: Pack row-wise <edg> into compact byte representation <data>.
+ *            Assumes <edg> is sorted. Rows are stored in order with their ids implicit,
+ *            and each bound is stored as varint offset from the bound before it.
+ *            This is a storage format (used by the cloud cache), not a working format:
+ *            the sparse passes still iterate over the indexed BOUND list.
+ */
+void EDGEBOUNDS_Pack(const EDGEBOUNDS* edg, VECTOR_CHAR* data);
+
+/*! FUNCTION: EDGEBOUNDS_Unpack()
+ *  SYNOPSIS: Unpack compact byte representation <data> from EDGEBOUNDS_Pack() and append to row-wise <edg>.
+ *            <edg> should be reused to proper dimensions first, which bounds are checked against.
+ *            Returns false if <data> is malformed.
+ */
+bool EDGEBOUNDS_Unpack(EDGEBOUNDS* edg, const VECTOR_CHAR* data);
+
 /*! FUNCTION: EDGEBOUNDS_Compare()
  *  SYNOPSIS: Compare two EDGEBOUNDS objects.  Return 0 if equal.
  */
@@ -242,6 +258,11 @@ int EDGEBOUNDS_Compare(EDGEBOUNDS* edg_a, EDGEBOUNDS* edg_b);
  */
 int EDGEBOUNDS_Count(EDGEBOUNDS* edg);
 
+/*! FUNCTION: EDGEBOUNDS_Count_in_Range()
+ *  SYNOPSIS: Count the number of cells in edgebound whose row/diag id is in <range> (inclusive).
+ */
+int EDGEBOUNDS_Count_in_Range(EDGEBOUNDS* edg, RANGE range);
+
 /*! FUNCTION: EDGEBOUNDS_Validate()
  *  SYNOPSIS: Verifies that edgebound ranges don't go out-of-bounds of
  * containing matrix dimensions.
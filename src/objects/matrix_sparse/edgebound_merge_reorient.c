@@ -24,6 +24,10 @@
 #include "_matrix_sparse.h"
 #include "edgebound_merge_reorient.h"
 
+/* private functions */
+static STATUS_FLAG
+EDGEBOUNDS_Union_Sweep(const int Q, const int T, EDGEBOUNDS** edg_in, const int num_input, const int id_end, EDGEBOUNDS* edg_out);
+
 /*! FUNCTION:  EDGEBOUNDS_Reflect()
  *  SYNOPSIS:  Reflect antidiagonal bounds.
  *             Antidiag <d_0> is indexed from query to target (or vice versa).
@@ -57,7 +61,7 @@ EDGEBOUNDS_Union(const int Q,          /* query length */
                  EDGEBOUNDS* edg_out)  /* OUTPUT: merged edgebounds (sorted ascending) */
 {
   STATUS_FLAG status;
-  status = EDGEBOUNDS_Union_byRow_Old(Q, T, edg_in_1, edg_in_2, edg_out);
+  status = EDGEBOUNDS_Union_byRow_Linear(Q, T, edg_in_1, edg_in_2, edg_out);
   return status;
 }
 
@@ -327,6 +331,59 @@ EDGEBOUNDS_Union_byRow(const int Q,          /* query length */
   return STATUS_SUCCESS;
 }
 
+/*! FUNCTION:  EDGEBOUNDS_Union_byRow_Linear()
+ *  SYNOPSIS:  Combine two edgebound lists into one to cover the union.
+ *             Assumes input lists are sorted ascending by row/diag <id>.
+ *             Like the other union methods, the last row/diag of the inputs is not included.
+ *  METHOD:    Single sweep over both lists with a pointer into each. For each row/diag <id_0>,
+ *             bounds of both lists are taken in ascending <lb> order, and overlapping (or touching)
+ *             bounds are merged as they are taken. No sorting, working space or deletion.
+ */
+STATUS_FLAG
+EDGEBOUNDS_Union_byRow_Linear(const int Q,          /* query length */
+                              const int T,          /* target length */
+                              EDGEBOUNDS* edg_in_1, /* edgebounds (fwd, sorted ascending) */
+                              EDGEBOUNDS* edg_in_2, /* edgebounds (bck, sorted ascending) */
+                              EDGEBOUNDS* edg_out)  /* OUTPUT: merged edgebounds (sorted ascending) */
+{
+  EDGEBOUNDS* edg_in[2] = {edg_in_1, edg_in_2};
+  int id_end = INT_MIN;
+
+  /* stop short of last row/diag */
+  for (int i = 0; i < 2; i++) {
+    if (EDGEBOUNDS_GetSize(edg_in[i]) > 0) {
+      id_end = MAX(id_end, EDG_X(edg_in[i], EDGEBOUNDS_GetSize(edg_in[i]) - 1).id);
+    }
+  }
+
+  return EDGEBOUNDS_Union_Sweep(Q, T, edg_in, 2, id_end, edg_out);
+}
+
+/*! FUNCTION:  EDGEBOUNDS_Union_Multi()
+ *  SYNOPSIS:  Combine <num_input> edgebound lists <edg_in> into one to cover the union of all of them,
+ *             such as the clouds of several anchors on the same query/target pair.
+ *             Assumes input lists are sorted ascending by row/diag <id>.
+ *             Unlike EDGEBOUNDS_Union(), all rows/diags of the inputs are included.
+ *  METHOD:    Same sweep as EDGEBOUNDS_Union_byRow_Linear(), taking next lowest <lb> from all lists.
+ */
+STATUS_FLAG
+EDGEBOUNDS_Union_Multi(const int Q,          /* query length */
+                       const int T,          /* target length */
+                       EDGEBOUNDS** edg_in,  /* list of edgebounds (each sorted ascending) */
+                       const int num_input,  /* number of edgebounds in list */
+                       EDGEBOUNDS* edg_out)  /* OUTPUT: merged edgebounds (sorted ascending) */
+{
+  int id_end = INT_MIN;
+
+  for (int i = 0; i < num_input; i++) {
+    if (EDGEBOUNDS_GetSize(edg_in[i]) > 0) {
+      id_end = MAX(id_end, EDG_X(edg_in[i], EDGEBOUNDS_GetSize(edg_in[i]) - 1).id + 1);
+    }
+  }
+
+  return EDGEBOUNDS_Union_Sweep(Q, T, edg_in, num_input, id_end, edg_out);
+}
+
 /*! FUNCTION:  EDGEBOUNDS_Union_via_Bridge()
  *  SYNOPSIS:  Combine two edgebound lists into one. Bridges all bounds on each antidiagonal into single bound.
  *             Assumes input lists are sorted and both oriented by-antidiagonal.
@@ -736,3 +793,117 @@ EDGEBOUNDS_Reorient_Pushback(EDGEBOUNDS* edg, /* edgebounds (row-wise, sorted as
 {
   return STATUS_SUCCESS;
 }
+
+/*! FUNCTION:  EDGEBOUNDS_Union_Sweep()
+ *  SYNOPSIS:  Combine <num_input> edgebound lists <edg_in> into <edg_out> to cover their union,
+ *             over all rows/diags less than <id_end>.
+ *             Bounds of each row/diag must be ordered by <lb>, either ascending, or descending
+ *             (as backward cloud search leaves them after reversing its list).
+ */
+static STATUS_FLAG
+EDGEBOUNDS_Union_Sweep(const int Q,         /* query length */
+                       const int T,         /* target length */
+                       EDGEBOUNDS** edg_in, /* list of edgebounds (each sorted ascending) */
+                       const int num_input, /* number of edgebounds in list */
+                       const int id_end,    /* end of row/diag range to merge */
+                       EDGEBOUNDS* edg_out) /* OUTPUT: merged edgebounds (sorted ascending) */
+{
+  int* r_head; /* next unread bound of each list */
+  int* r_size; /* size of each list */
+  int* r_cur;  /* next bound to sweep on current row/diag of each list */
+  int* r_last; /* end of current row/diag of each list, in sweep direction */
+  int* r_step; /* sweep direction of each list: +1 if row/diag is ascending by <lb>, -1 if descending */
+  int r_0b, r_0e;
+  int id_0, i_min;
+  BOUND bnd, bnd_open;
+  bool is_open;
+
+  /* verify that all input edgebounds are the same mode */
+  for (int i = 1; i < num_input; i++) {
+    if (edg_in[i]->edg_mode != edg_in[0]->edg_mode) {
+      fprintf(stderr, "ERROR: Not all edgebounds being merged have same orientation!");
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+  }
+
+  /* reset output edgebounds */
+  EDGEBOUNDS_Reuse(edg_out, Q, T);
+  edg_out->edg_mode = edg_in[0]->edg_mode;
+
+  r_head = ERROR_malloc(sizeof(int) * 5 * num_input);
+  r_size = r_head + num_input;
+  r_cur = r_size + num_input;
+  r_last = r_cur + num_input;
+  r_step = r_last + num_input;
+  for (int i = 0; i < num_input; i++) {
+    r_head[i] = 0;
+    r_size[i] = EDGEBOUNDS_GetSize(edg_in[i]);
+  }
+
+  while (true) {
+    /* next row/diag is the lowest at the head of any list */
+    id_0 = INT_MAX;
+    for (int i = 0; i < num_input; i++) {
+      if (r_head[i] < r_size[i]) {
+        id_0 = MIN(id_0, EDG_X(edg_in[i], r_head[i]).id);
+      }
+    }
+    if (id_0 >= id_end) {
+      break;
+    }
+
+    /* find the bounds of each list on row/diag, and which way to sweep them */
+    for (int i = 0; i < num_input; i++) {
+      r_0b = r_0e = r_head[i];
+      while (r_0e < r_size[i] && EDG_X(edg_in[i], r_0e).id == id_0) {
+        r_0e++;
+      }
+      if (r_0e - r_0b > 1 && EDG_X(edg_in[i], r_0b).lb > EDG_X(edg_in[i], r_0e - 1).lb) {
+        r_cur[i] = r_0e - 1;
+        r_last[i] = r_0b - 1;
+        r_step[i] = -1;
+      }
+      else {
+        r_cur[i] = r_0b;
+        r_last[i] = r_0e;
+        r_step[i] = +1;
+      }
+      r_head[i] = r_0e;
+    }
+
+    /* take bounds from all lists in ascending <lb>, extending open bound while they overlap */
+    is_open = false;
+    while (true) {
+      i_min = -1;
+      for (int i = 0; i < num_input; i++) {
+        if (r_cur[i] != r_last[i] &&
+            (i_min == -1 || EDG_X(edg_in[i], r_cur[i]).lb < EDG_X(edg_in[i_min], r_cur[i_min]).lb)) {
+          i_min = i;
+        }
+      }
+      if (i_min == -1) {
+        break;
+      }
+      bnd = EDG_X(edg_in[i_min], r_cur[i_min]);
+      r_cur[i_min] += r_step[i_min];
+
+      if (is_open == true && bnd.lb <= bnd_open.rb) {
+        bnd_open.rb = MAX(bnd_open.rb, bnd.rb);
+      }
+      else {
+        if (is_open == true) {
+          EDGEBOUNDS_Pushback(edg_out, bnd_open);
+        }
+        bnd_open = bnd;
+        is_open = true;
+      }
+    }
+    if (is_open == true) {
+      EDGEBOUNDS_Pushback(edg_out, bnd_open);
+    }
+  }
+
+  r_head = ERROR_free(r_head);
+
+  return STATUS_SUCCESS;
+}
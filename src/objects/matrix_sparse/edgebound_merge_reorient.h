@@ -62,6 +62,37 @@ EDGEBOUNDS_Union_byRow(
     EDGEBOUNDS* edg_in_2, /* edgebounds (bck, sorted ascending) */
     EDGEBOUNDS* edg_out); /* OUTPUT: merged edgebounds (sorted ascending) */
 
+/*! FUNCTION:  EDGEBOUNDS_Union_byRow_Linear()
+ *  SYNOPSIS:  Combine two edgebound lists into one to cover the union.
+ *             Assumes input lists are sorted ascending by row/diag <id>.
+ *             Like the other union methods, the last row/diag of the inputs is not included.
+ *  METHOD:    Single sweep over both lists with a pointer into each. For each row/diag <id_0>,
+ *             bounds of both lists are taken in ascending <lb> order, and overlapping (or touching)
+ *             bounds are merged as they are taken. No sorting, working space or deletion.
+ */
+STATUS_FLAG
+EDGEBOUNDS_Union_byRow_Linear(
+    const int Q,          /* query length */
+    const int T,          /* target length */
+    EDGEBOUNDS* edg_in_1, /* edgebounds (fwd, sorted ascending) */
+    EDGEBOUNDS* edg_in_2, /* edgebounds (bck, sorted ascending) */
+    EDGEBOUNDS* edg_out); /* OUTPUT: merged edgebounds (sorted ascending) */
+
+/*! FUNCTION:  EDGEBOUNDS_Union_Multi()
+ *  SYNOPSIS:  Combine <num_input> edgebound lists <edg_in> into one to cover the union of all of them,
+ *             such as the clouds of several anchors on the same query/target pair.
+ *             Assumes input lists are sorted ascending by row/diag <id>.
+ *             Unlike EDGEBOUNDS_Union(), all rows/diags of the inputs are included.
+ *  METHOD:    Same sweep as EDGEBOUNDS_Union_byRow_Linear(), taking next lowest <lb> from all lists.
+ */
+STATUS_FLAG
+EDGEBOUNDS_Union_Multi(
+    const int Q,          /* query length */
+    const int T,          /* target length */
+    EDGEBOUNDS** edg_in,  /* list of edgebounds (each sorted ascending) */
+    const int num_input,  /* number of edgebounds in list */
+    EDGEBOUNDS* edg_out); /* OUTPUT: merged edgebounds (sorted ascending) */
+
 /*! FUNCTION:  EDGEBOUNDS_Union_via_Bridge()
  *  SYNOPSIS:  Combine two edgebound lists into one.
  *             Bridges all bounds on each row/diag into single bound, spanning
@@ -50,7 +50,7 @@ EDGEBOUND_ROWS_Create_by_Size(int Q,
   edg->Nalloc = 0;
   edg->rows_N = NULL;
   edg->rows = NULL;
-  edg->row_max = MAX_BOUNDS_PER_ROW;
+  edg->row_max = INIT_BOUNDS_PER_ROW;
 
   EDGEBOUND_ROWS_Resize(edg, Q + 1);
   return edg;
@@ -121,6 +121,27 @@ void EDGEBOUND_ROWS_Resize(EDGEBOUND_ROWS* edg,
   edg->N = size;
 }
 
+/*! FUNCTION: EDGEBOUND_ROWS_GrowRowMax()
+ *  SYNOPSIS: Resizes EDGEBOUND_ROWS so each row can hold <row_max> bounds, if more than current.
+ *            Keeps bounds of all current rows.
+ */
+void EDGEBOUND_ROWS_GrowRowMax(EDGEBOUND_ROWS* edg,
+                               int row_max) {
+  BOUND* rows;
+
+  if (row_max <= edg->row_max) {
+    return;
+  }
+  /* rows are stored at fixed stride, so move each to its new offset */
+  rows = ERROR_malloc(sizeof(BOUND) * (edg->Nalloc * row_max));
+  for (int qx0 = 0; qx0 < edg->N; qx0++) {
+    memcpy(&rows[qx0 * row_max], &edg->rows[qx0 * edg->row_max], sizeof(BOUND) * edg->rows_N[qx0]);
+  }
+  ERROR_free(edg->rows);
+  edg->rows = rows;
+  edg->row_max = row_max;
+}
+
 /*! FUNCTION: EDGEBOUND_ROWS_GetRowSize()
  *  SYNOPSIS: Get the size of row <q_0>.
  */
@@ -268,38 +289,18 @@ void EDGEBOUND_ROWS_Pushback(EDGEBOUND_ROWS* edg,
   /* last index points to the next free bound in list */
   last_idx = EDGEBOUND_ROWS_GetRowSize(edg, q_0);
 
-  /* if bound exceeds limit for bounds per row, throw flag */
+  /* if row is full, make room for more bounds in every row */
   if (last_idx >= edg->row_max) {
-    fprintf(stderr, "ERROR: Number of edgebounds for given row (%d) has been exceeded to (%d). Resorting to unbroken spans.\n", q_0, edg->row_max);
-    fprintf(stderr, "HELP: To increase the allowed number of edgebounds in row, increase value of compiler flag '%s'.\n", "MAX_BOUNDS_PER_ROW_SUPPORTED");
-
-#if DEBUG
-    {
-      char s[100];
-      fprintf(stderr, "BOUND ATTEMPTING TO INSERT:\n");
-      fprintf(stderr, "%s\n", BOUND_ToString(bnd, s));
-      fprintf(stderr, "BOUND LIST AT ROW_ID:\n");
-      for (int i = 0; i < edg->rows_N[qx0]; i++) {
-        fprintf(stderr, "{%d}:\t", i);
-        fprintf(stderr, "%s,\n", BOUND_ToString(edg->rows[i], s));
-      }
-    }
-#endif
-
-    /* Otherwise, we could just bridge the last two spans together, by updating right bound */
-    last_idx -= edg->row_max - 1;
-    edg_bnd = EDGEBOUND_ROWS_GetX_byRow(edg, q_0, last_idx);
-    edg_bnd->lb = MIN(edg_bnd->lb, bnd.lb);
-    edg_bnd->rb = MAX(edg_bnd->rb, bnd.rb);
-  } else {
-    /* get reference to bound on row at last index and update it with new info */
-    edg_bnd = EDGEBOUND_ROWS_GetX_byRow(edg, q_0, last_idx);
-    edg_bnd->id = bnd.id;
-    edg_bnd->rb = bnd.rb;
-    edg_bnd->lb = bnd.lb;
-    /* increment the number of bounds in row */
-    ARR_X(edg->rows_N, qx0) += 1;
+    EDGEBOUND_ROWS_GrowRowMax(edg, 2 * edg->row_max);
   }
+
+  /* get reference to bound on row at last index and update it with new info */
+  edg_bnd = EDGEBOUND_ROWS_GetX_byRow(edg, q_0, last_idx);
+  edg_bnd->id = bnd.id;
+  edg_bnd->rb = bnd.rb;
+  edg_bnd->lb = bnd.lb;
+  /* increment the number of bounds in row */
+  ARR_X(edg->rows_N, qx0) += 1;
 }
 
 /*! FUNCTION: EDGEBOUND_ROWS_IntegrateDiag_Fwd()
@@ -307,8 +308,7 @@ void EDGEBOUND_ROWS_Pushback(EDGEBOUND_ROWS* edg,
  *            Looks at each cell individually in the antidiagonal.
  *            If it is right-side adjacent to the current open bound (within a tolerance value), it extends it.
  *            Otherwise, it creates a new edgebound and adds it to the list.
- *            Edgebound lists sizes are determined at compile time and do not resize.
- *            If size is exceeded, program terminates with error.
+ *            Rows grow as needed to hold any number of bounds.
  */
 void EDGEBOUND_ROWS_IntegrateDiag_Fwd(EDGEBOUND_ROWS* edg,
                                       BOUND* bnd) {
@@ -348,8 +348,7 @@ void EDGEBOUND_ROWS_IntegrateDiag_Fwd(EDGEBOUND_ROWS* edg,
  *            Looks at each cell individually in the antidiagonal.
  *            If it is left-side adjacent to the current open bound (within a tolerance value), it extends it.
  *            Otherwise, it creates a new edgebound and adds it to the list.
- *            Edgebound lists sizes are determined at compile time and do not resize.
- *            If size is exceeded, program terminates with error.
+ *            Rows grow as needed to hold any number of bounds.
  */
 void EDGEBOUND_ROWS_IntegrateDiag_Bck(EDGEBOUND_ROWS* edg,
                                       BOUND* bnd) {
@@ -495,20 +494,16 @@ int EDGEBOUND_ROWS_Stats(EDGEBOUND_ROWS* edg) {
   /* total cells */
   int cell_total = 0;
   /* occupancy of each row */
-  int occ[MAX_BOUNDS_PER_ROW + 2];
+  int* occ = ERROR_malloc(sizeof(int) * (edg->row_max + 1));
 
-  for (int i = 0; i < MAX_BOUNDS_PER_ROW; i++) {
+  for (int i = 0; i <= edg->row_max; i++) {
     occ[i] = 0;
   }
 
   /* for every row in <edg_in> */
   for (int q_0 = edg->Q_range.beg; q_0 < edg->Q_range.end; q_0++) {
     int row_size = EDGEBOUND_ROWS_GetRowSize(edg, q_0);
-    if (row_size > MAX_BOUNDS_PER_ROW) {
-      occ[row_size + 1] += 1;
-    } else {
-      occ[row_size] += 1;
-    }
+    occ[row_size] += 1;
 
     bnd_total += row_size;
 
@@ -520,11 +515,11 @@ int EDGEBOUND_ROWS_Stats(EDGEBOUND_ROWS* edg) {
 
   /* output stats */
   printf("EDGEBOUND_ROWS => bnd_total: %d, cell_total: %d\n", bnd_total, cell_total);
-  for (int i = 0; i < MAX_BOUNDS_PER_ROW; i++) {
+  for (int i = 0; i <= edg->row_max; i++) {
     test_total += (occ[i] * i);
     printf("OCC[%d]: %d\n", i, occ[i]);
   }
-  printf("OCC[OVER]: %d\n", occ[MAX_BOUNDS_PER_ROW + 1]);
+  occ = ERROR_free(occ);
   if (test_total != bnd_total)
     printf("ERROR: sum_total != total\n");
 }
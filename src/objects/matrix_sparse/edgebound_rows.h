@@ -45,6 +45,12 @@ void EDGEBOUND_ROWS_GrowTo(EDGEBOUND_ROWS* edg, int size);
  */
 void EDGEBOUND_ROWS_Resize(EDGEBOUND_ROWS* edg, int size);
 
+/*! FUNCTION: EDGEBOUND_ROWS_GrowRowMax()
+ *  SYNOPSIS: Resizes EDGEBOUND_ROWS so each row can hold <row_max> bounds, if more than current.
+ *            Keeps bounds of all current rows.
+ */
+void EDGEBOUND_ROWS_GrowRowMax(EDGEBOUND_ROWS* edg, int row_max);
+
 /*! FUNCTION: EDGEBOUND_ROWS_GetRowSize()
  *  SYNOPSIS: Get the size of row <q_0>.
  */
@@ -99,8 +105,7 @@ void EDGEBOUND_ROWS_Clear(EDGEBOUND_ROWS* edg);
  * Search. Looks at each cell individually in the antidiagonal. If it is
  * right-side adjacent to the current open bound (within a tolerance value), it
  * extends it. Otherwise, it creates a new edgebound and adds it to the list.
- *            Edgebound lists sizes are determined at compile time and do not
- * resize. If size is exceeded, program terminates with error.
+ *            Rows grow as needed to hold any number of bounds.
  */
 void EDGEBOUND_ROWS_IntegrateDiag_Fwd(EDGEBOUND_ROWS* edg, BOUND* bnd);
 
@@ -109,8 +114,7 @@ void EDGEBOUND_ROWS_IntegrateDiag_Fwd(EDGEBOUND_ROWS* edg, BOUND* bnd);
  * Cloud Search. Looks at each cell individually in the antidiagonal. If it is
  * left-side adjacent to the current open bound (within a tolerance value), it
  * extends it. Otherwise, it creates a new edgebound and adds it to the list.
- *            Edgebound lists sizes are determined at compile time and do not
- * resize. If size is exceeded, program terminates with error.
+ *            Rows grow as needed to hold any number of bounds.
  */
 void EDGEBOUND_ROWS_IntegrateDiag_Bck(EDGEBOUND_ROWS* edg, BOUND* bnd);
 
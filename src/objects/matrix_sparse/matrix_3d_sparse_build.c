@@ -81,16 +81,18 @@ EDGEBOUNDS*
 EDGEBOUNDS_Create_Padded_Edgebounds(EDGEBOUNDS* edg_inner, /* EDGEBOUNDS of the active cells */
                                     EDGEBOUNDS* edg_outer) /* EDGEBOUNDS of the total cells */
 {
-  edg_outer = EDGEBOUNDS_Create_Padded_Edgebounds_Naive(edg_inner, edg_outer);
+  edg_outer = EDGEBOUNDS_Create_Padded_Edgebounds_Optimal(edg_inner, edg_outer);
   return edg_outer;
 }
 
-/* TODO: WIP */
-/** FUNCTION:   EDGEBOUNDS_Create_Padded_Edgebounds()
+/** FUNCTION:   EDGEBOUNDS_Create_Padded_Edgebounds_Optimal()
  *  SYNOPSIS:   Create new EDGEBOUNDS <edg_outer> from given EDGEBOUNDS <edg_inner>.
  *              <edg_outer> contains all cells contained in <edg_inner> and pads with every cell adjacent to <edg_outer>,
  *              If <edg_outer> already created, reuses data struct.
- *              Requires <edg_inner> to be sorted.
+ *              Requires <edg_inner> to be sorted by row.
+ *              Sweeps rows once: each outer row is the union of the padded bounds of the inner rows above, on and below it.
+ *              Produces the same bounds as the naive method, without building, sorting and merging 3x as many bounds,
+ *              and without any limit on the number of bounds per row.
  *
  *    RETURN:   Returns <edg_outer>.
  */
@@ -98,129 +100,68 @@ EDGEBOUNDS*
 EDGEBOUNDS_Create_Padded_Edgebounds_Optimal(EDGEBOUNDS* edg_inner, /* EDGEBOUNDS of the active cells */
                                             EDGEBOUNDS* edg_outer) /* EDGEBOUNDS of the total cells */
 {
-  BOUND bnd;                               /* temporary bound for adding to edgebound */
-  BOUND* bnd_1;                            /* bounds from edgebound list, for unioning */
-  int Q, T, N;                             /* query, target, and edgebounds length */
-  int q_min, q_max;                        /* min and max rows in edgebounds */
-  int r_0, r_0b, r_0e;                     /* (start,end] range in upper edgebound row */
-  int r_1, r_1b, r_1e;                     /* (start,end] range in center edgebound row */
-  int r_2, r_2b, r_2e;                     /* (start,end] range in lower edgebound row */
-  int q_0, q_1, q_2;                       /* row index: prev, current, next */
-  int qx0, qx1, qx2;                       /* row index (mod 3) */
-  int n_[3];                               /* counts of range arrays */
-  RANGE ranges[3][MAX_BOUNDS_PER_ROW * 3]; /* bound ranges on prev, cur, and next row */
-  RANGE rng;
-  bool merging, is_Q;
-
-  /* embedded matrix dimension */
-  Q = edg_inner->Q;
-  T = edg_inner->T;
-  /* embedded matrix length */
-  N = EDGEBOUNDS_GetSize(edg_inner);
-  /* edgebounds initialize */
-  r_1b = r_1e = r_1 = 0;
-
-  /* first and last rows in edgebounds */
-  q_min = EDG_X(edg_inner, 0).id;
-  q_max = EDG_X(edg_inner, N - 1).id;
-
-  /* set ranges to empty */
-  for (int i = 0; i < 3; i++) {
-    n_[i] = 0;
-  }
+  BOUND* bnd;          /* bound from inner edgebound list */
+  RANGE rng;           /* range of merged bounds being built */
+  int N;               /* number of inner edgebounds */
+  int q_min, q_max;    /* min and max rows in inner edgebounds */
+  int r_lo, r_hi;      /* [start,end) of inner bounds on rows adjacent to current row */
+  VECTOR_RANGE* rngs;  /* padded bounds on current row */
+  int N_rngs;
 
-  /* create same size so likely no reallocation necessary */
-  if (edg_outer != NULL) {
-    edg_outer = EDGEBOUNDS_Create_by_Size(N);
+  if (edg_outer == NULL) {
+    edg_outer = EDGEBOUNDS_Create();
   }
   EDGEBOUNDS_Reuse(edg_outer, edg_inner->Q, edg_inner->T);
-
-  edg_outer->Q = edg_inner->Q;
-  edg_outer->T = edg_inner->T;
   edg_outer->edg_mode = edg_inner->edg_mode;
 
-  /* add internal bounds row-by-row  */
-  for (q_1 = q_min; q_1 <= q_max; q_1++) {
-    q_2 = q_1 - 1;
-    q_0 = q_1 + 1;
-    qx2 = (((q_2 % 3) + 3) % 3); /* ensures that all mods are in the positive range */
-    qx1 = (qx1 + 1) % 3;
-    qx0 = (q_0 + 2) % 3;
-
-    /* add ranges to rows */
-    r_1b = r_1;
-
-    /* get all bounds in current row */
-    while (r_1 < EDGEBOUNDS_GetSize(edg_inner)) {
-      bnd_1 = EDGEBOUNDS_GetX(edg_inner, r_1);
-      if (bnd_1->id != q_1)
-        break;
-
-      ranges[qx2][n_[qx2]] = (RANGE){(bnd_1->lb) - 1, (bnd_1->rb) + 1}; /* add to its previous neighbors row (for insert and match state) */
-      ranges[qx1][n_[qx1]] = (RANGE){(bnd_1->lb) - 1, (bnd_1->rb) + 1}; /* add to its own row (+/-1 for delete state in fwd/bck) */
-      ranges[qx0][n_[qx0]] = (RANGE){(bnd_1->lb) - 1, (bnd_1->rb) + 1}; /* add to its next neighbors row (for insert and match state) */
-
-      r_1++;
-      n_[qx0]++;
-      n_[qx1]++;
-      n_[qx2]++;
+  N = EDGEBOUNDS_GetSize(edg_inner);
+  if (N == 0) {
+    return edg_outer;
+  }
+  q_min = EDG_X(edg_inner, 0).id;
+  q_max = EDG_X(edg_inner, N - 1).id;
+  rngs = VECTOR_RANGE_Create();
+
+  r_lo = r_hi = 0;
+  for (int q_0 = q_min - 1; q_0 <= q_max + 1; q_0++) {
+    /* move window to inner rows (q_0 - 1, q_0, q_0 + 1) */
+    while (r_lo < N && EDG_X(edg_inner, r_lo).id < q_0 - 1) {
+      r_lo++;
+    }
+    while (r_hi < N && EDG_X(edg_inner, r_hi).id <= q_0 + 1) {
+      r_hi++;
+    }
+    if (r_lo == r_hi) {
+      continue;
     }
-    r_1e = r_1;
-
-    /* sort and merge if more than one element */
-    if (n_[qx2] > 1) {
-      /* sort previous range */
-      for (int i = 0; i < n_[qx2]; i++) {
-        RANGE* cur_r = NULL;
-        RANGE* min_r = &ranges[qx2][i];
-        int min_i = i;
-        int cmp = 0;
-        for (int j = i; j < n_[qx2]; j++) {
-          cur_r = &ranges[qx2][j];
-          cmp = RANGE_Compare(*min_r, *cur_r);
-          if (cmp > 0) {
-            min_r = cur_r;
-          }
-          min_i = j;
-        }
-        RANGE swap = ranges[qx2][i];
-        ranges[qx2][i] = ranges[qx2][min_i];
-        ranges[qx2][min_i] = swap;
-      }
 
-      /* merge previous range */
-      for (int i = 1; i < n_[qx2]; i++) {
-        /* if ranges overlap, merge them */
-        if (ranges[qx2][i - 1].end >= ranges[qx2][i].beg) {
-          ranges[qx2][i].beg = ranges[qx2][i - 1].beg;
-        }
-        /* otherwise, add previous to edgebounds */
-        else {
-          BOUND bnd = (BOUND){q_2, ranges[qx2][i - 1].beg, ranges[qx2][i - 1].end};
-          EDGEBOUNDS_Pushback(edg_outer, bnd);
-        }
+    /* collect padded bounds in order of left bound (rows are already sorted, so insertion is cheap) */
+    VECTOR_RANGE_Reuse(rngs);
+    for (int r_0 = r_lo; r_0 < r_hi; r_0++) {
+      bnd = EDGEBOUNDS_GetX(edg_inner, r_0);
+      rng = (RANGE){bnd->lb - 1, bnd->rb + 1};
+      VECTOR_RANGE_Pushback(rngs, rng);
+      for (int i = VECTOR_RANGE_GetSize(rngs) - 1; i > 0 && RANGE_Compare(VEC_X(rngs, i - 1), VEC_X(rngs, i)) > 0; i--) {
+        VECTOR_RANGE_Swap(rngs, i - 1, i);
       }
     }
 
-    if (n_[qx2] > 0) {
-      BOUND bnd = (BOUND){q_2, ranges[qx2][n_[qx2] - 1].beg, ranges[qx2][n_[qx2] - 1].end};
-      EDGEBOUNDS_Pushback(edg_outer, bnd);
+    /* merge overlapping bounds and add them to row */
+    N_rngs = VECTOR_RANGE_GetSize(rngs);
+    rng = VEC_X(rngs, 0);
+    for (int i = 1; i < N_rngs; i++) {
+      if (rng.end >= VEC_X(rngs, i).beg) {
+        rng.end = MAX(rng.end, VEC_X(rngs, i).end);
+      }
+      else {
+        EDGEBOUNDS_Pushback(edg_outer, (BOUND){q_0, rng.beg, rng.end});
+        rng = VEC_X(rngs, i);
+      }
     }
-
-    n_[qx2] = 0;
+    EDGEBOUNDS_Pushback(edg_outer, (BOUND){q_0, rng.beg, rng.end});
   }
 
-  q_1 = q_max;
-  qx1 = q_1 % 3;
-  q_0 = q_max + 1;
-  qx0 = q_0 % 3;
-
-  /* push last remaining rows */
-  bnd = (BOUND){q_1, ranges[qx1][n_[qx1] - 1].beg, ranges[qx1][n_[qx1] - 1].end};
-  EDGEBOUNDS_Pushback(edg_outer, bnd);
-  bnd = (BOUND){q_0, ranges[qx0][n_[qx0] - 1].beg, ranges[qx0][n_[qx0] - 1].end};
-  EDGEBOUNDS_Pushback(edg_outer, bnd);
-
+  rngs = VECTOR_RANGE_Destroy(rngs);
   return edg_outer;
 }
 
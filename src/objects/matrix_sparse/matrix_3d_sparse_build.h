@@ -30,6 +30,18 @@ EDGEBOUNDS* EDGEBOUNDS_Create_Padded_Edgebounds(
     EDGEBOUNDS* edg_inner,  /* EDGEBOUNDS of the active cells */
     EDGEBOUNDS* edg_outer); /* EDGEBOUNDS of the total cells */
 
+/*! FUNCTION:     EDGEBOUNDS_Create_Padded_Edgebounds_Optimal()
+ *  SYNOPSIS:     Create new EDGEBOUNDS <edg_outer> from given EDGEBOUNDS
+ * <edg_inner>, in a single sweep over rows. Produces the same bounds as the
+ * naive method, with no limit on the number of bounds per row.
+ * Requires <edg_inner> is sorted by row.
+ *
+ *  RETURN:       Returns <edg_outer>.
+ */
+EDGEBOUNDS* EDGEBOUNDS_Create_Padded_Edgebounds_Optimal(
+    EDGEBOUNDS* edg_inner,  /* EDGEBOUNDS of the active cells */
+    EDGEBOUNDS* edg_outer); /* EDGEBOUNDS of the total cells */
+
 /*! FUNCTION:     EDGEBOUNDS_Create_Padded_Edgebounds_Naive()
  *  SYNOPSIS:     Create new EDGEBOUNDS <edg_outer> from given EDGEBOUNDS
  * <edg_inner>. <edg_outer> contains all cells contained in <edg_inner> and pads
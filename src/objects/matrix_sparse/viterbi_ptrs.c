@@ -0,0 +1,122 @@
+/*******************************************************************************
+ *  - FILE:   viterbi_ptrs.c
+ *  - DESC:    VITERBI_PTRS Object.
+ *             Compact backpointers for Viterbi over sparse matrix.
+ *             Each cell of the sparse matrix keeps the predecessor of its match, insert
+ *             and delete states in four bits, so traceback does not need the score matrix.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+/* local imports */
+#include "../structs.h"
+#include "../../utilities/_utilities.h"
+#include "../_objects.h"
+
+/* header */
+#include "_matrix_sparse.h"
+#include "viterbi_ptrs.h"
+
+/*! FUNCTION:  VITERBI_PTRS_Create()
+ *  SYNOPSIS:  Create new VITERBI_PTRS object and returns pointer.
+ *             Caller must call VITERBI_PTRS_Reuse() before use.
+ */
+VITERBI_PTRS*
+VITERBI_PTRS_Create() {
+  VITERBI_PTRS* ptrs = NULL;
+
+  ptrs = ERROR_malloc(sizeof(VITERBI_PTRS));
+
+  ptrs->Q = 0;
+  ptrs->T = 0;
+  ptrs->bnd_offset = VECTOR_INT_Create();
+  ptrs->cells = VECTOR_CHAR_Create();
+  ptrs->sp_ptr = VECTOR_CHAR_Create();
+  ptrs->e_ptr = VECTOR_INT_Create();
+  ptrs->rows = VECTOR_FLT_Create();
+  ptrs->row_stamp = VECTOR_INT_Create();
+
+  return ptrs;
+}
+
+/*! FUNCTION:  VITERBI_PTRS_Destroy()
+ *  SYNOPSIS:  Frees all memory from VITERBI_PTRS object.
+ */
+VITERBI_PTRS*
+VITERBI_PTRS_Destroy(VITERBI_PTRS* ptrs) {
+  if (ptrs == NULL)
+    return ptrs;
+
+  ptrs->bnd_offset = VECTOR_INT_Destroy(ptrs->bnd_offset);
+  ptrs->cells = VECTOR_CHAR_Destroy(ptrs->cells);
+  ptrs->sp_ptr = VECTOR_CHAR_Destroy(ptrs->sp_ptr);
+  ptrs->e_ptr = VECTOR_INT_Destroy(ptrs->e_ptr);
+  ptrs->rows = VECTOR_FLT_Destroy(ptrs->rows);
+  ptrs->row_stamp = VECTOR_INT_Destroy(ptrs->row_stamp);
+
+  ptrs = ERROR_free(ptrs);
+  return ptrs;
+}
+
+/*! FUNCTION:  VITERBI_PTRS_Reuse()
+ *  SYNOPSIS:  Reuses VITERBI_PTRS for new <Q> x <T> problem over cells of <edg>.
+ *             Maps each bound of <edg> to its cells and clears all backpointers (does not downsize).
+ */
+void VITERBI_PTRS_Reuse(VITERBI_PTRS* ptrs,
+                        int Q,
+                        int T,
+                        const EDGEBOUNDS* edg) {
+  int N = EDGEBOUNDS_GetSize(edg);
+  int N_cells = 0;
+
+  ptrs->Q = Q;
+  ptrs->T = T;
+
+  /* offset of each bound into cells */
+  VECTOR_INT_SetSize(ptrs->bnd_offset, N + 1);
+  for (int r_0 = 0; r_0 < N; r_0++) {
+    BOUND* bnd = EDGEBOUNDS_GetX(edg, r_0);
+    VEC_X(ptrs->bnd_offset, r_0) = N_cells;
+    N_cells += bnd->rb - bnd->lb;
+  }
+  VEC_X(ptrs->bnd_offset, N) = N_cells;
+
+  /* backpointers are set by bitwise-or, so must start cleared */
+  VECTOR_CHAR_SetSize(ptrs->cells, (N_cells + 1) / 2);
+  VECTOR_CHAR_Fill(ptrs->cells, 0);
+  VECTOR_CHAR_SetSize(ptrs->sp_ptr, Q + 1);
+  VECTOR_CHAR_Fill(ptrs->sp_ptr, 0);
+  VECTOR_INT_SetSize(ptrs->e_ptr, Q + 1);
+  VECTOR_INT_Fill(ptrs->e_ptr, -1);
+
+  /* two rows for each normal state, which are only valid where stamped with row index */
+  VECTOR_FLT_SetSize(ptrs->rows, 2 * NUM_NORMAL_STATES * (T + 2));
+  VECTOR_INT_SetSize(ptrs->row_stamp, 2 * (T + 2));
+  VECTOR_INT_Fill(ptrs->row_stamp, -1);
+}
+
+/*! FUNCTION:  VITERBI_PTRS_GetIndex()
+ *  SYNOPSIS:  Get index of cell (<q_0>,<t_0>) into <cells>.
+ *             Returns -1 if cell is not inside <edg>.
+ */
+int VITERBI_PTRS_GetIndex(VITERBI_PTRS* ptrs,
+                          const EDGEBOUNDS* edg,
+                          int q_0,
+                          int t_0) {
+  int r_0b = EDGEBOUNDS_GetIndex_byRow_Fwd(edg, q_0);
+  int r_0e = EDGEBOUNDS_GetIndex_byRow_Fwd(edg, q_0 + 1);
+
+  for (int r_0 = r_0b; r_0 < r_0e; r_0++) {
+    BOUND* bnd = EDGEBOUNDS_GetX(edg, r_0);
+    if (bnd->id == q_0 && t_0 >= bnd->lb && t_0 < bnd->rb) {
+      return VEC_X(ptrs->bnd_offset, r_0) + (t_0 - bnd->lb);
+    }
+  }
+  return -1;
+}
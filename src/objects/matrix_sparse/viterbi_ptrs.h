@@ -0,0 +1,33 @@
+/*******************************************************************************
+ *  - FILE:   viterbi_ptrs.h
+ *  - DESC:    VITERBI_PTRS Object.
+ *             Compact backpointers for Viterbi over sparse matrix.
+ *******************************************************************************/
+
+#ifndef _VITERBI_PTRS_H
+#define _VITERBI_PTRS_H
+
+/*! FUNCTION:  VITERBI_PTRS_Create()
+ *  SYNOPSIS:  Create new VITERBI_PTRS object and returns pointer.
+ *             Caller must call VITERBI_PTRS_Reuse() before use.
+ */
+VITERBI_PTRS* VITERBI_PTRS_Create();
+
+/*! FUNCTION:  VITERBI_PTRS_Destroy()
+ *  SYNOPSIS:  Frees all memory from VITERBI_PTRS object.
+ */
+VITERBI_PTRS* VITERBI_PTRS_Destroy(VITERBI_PTRS* ptrs);
+
+/*! FUNCTION:  VITERBI_PTRS_Reuse()
+ *  SYNOPSIS:  Reuses VITERBI_PTRS for new <Q> x <T> problem over cells of <edg>.
+ *             Maps each bound of <edg> to its cells and clears all backpointers (does not downsize).
+ */
+void VITERBI_PTRS_Reuse(VITERBI_PTRS* ptrs, int Q, int T, const EDGEBOUNDS* edg);
+
+/*! FUNCTION:  VITERBI_PTRS_GetIndex()
+ *  SYNOPSIS:  Get index of cell (<q_0>,<t_0>) into <cells>.
+ *             Returns -1 if cell is not inside <edg>.
+ */
+int VITERBI_PTRS_GetIndex(VITERBI_PTRS* ptrs, const EDGEBOUNDS* edg, int q_0, int t_0);
+
+#endif /* _VITERBI_PTRS_H */
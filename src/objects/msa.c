@@ -0,0 +1,146 @@
+/*******************************************************************************
+ *  - FILE:      msa.c
+ *  - DESC:    MSA object.
+ *             Multiple sequence alignment of one family, as read from a Stockholm file.
+ *             Memory of sequences is kept between families when reused.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+/* local imports */
+#include "structs.h"
+#include "../utilities/_utilities.h"
+
+/* header */
+#include "_objects.h"
+#include "msa.h"
+
+/*! FUNCTION:  MSA_Create()
+ *  SYNOPSIS:  Create <msa>, allocate memory and return pointer.
+ */
+MSA* MSA_Create() {
+  MSA* msa = NULL;
+  const int min_size = 16;
+
+  msa = (MSA*)ERROR_malloc(sizeof(MSA));
+
+  msa->name = NULL;
+  msa->acc = NULL;
+  msa->desc = NULL;
+  msa->N = 0;
+  msa->Nalloc = min_size;
+  msa->alen = 0;
+  msa->sqnames = ERROR_malloc(sizeof(char*) * min_size);
+  msa->aseqs = ERROR_malloc(sizeof(char*) * min_size);
+  msa->aseq_lens = ERROR_malloc(sizeof(int) * min_size);
+  msa->aseq_alloc = ERROR_malloc(sizeof(int) * min_size);
+  for (int i = 0; i < min_size; i++) {
+    msa->sqnames[i] = NULL;
+    msa->aseqs[i] = NULL;
+    msa->aseq_lens[i] = 0;
+    msa->aseq_alloc[i] = 0;
+  }
+
+  return msa;
+}
+
+/*! FUNCTION:  MSA_Destroy()
+ *  SYNOPSIS:  Destroy <msa>, free memory and return NULL pointer.
+ */
+MSA* MSA_Destroy(MSA* msa) {
+  if (msa == NULL)
+    return msa;
+
+  MSA_Reuse(msa);
+  for (int i = 0; i < msa->Nalloc; i++) {
+    ERROR_free(msa->aseqs[i]);
+  }
+  ERROR_free(msa->sqnames);
+  ERROR_free(msa->aseqs);
+  ERROR_free(msa->aseq_lens);
+  ERROR_free(msa->aseq_alloc);
+
+  msa = ERROR_free(msa);
+  return msa;
+}
+
+/*! FUNCTION:  MSA_Reuse()
+ *  SYNOPSIS:  Reuse <msa> by clearing all sequences and annotation, keeping allocated memory.
+ */
+void MSA_Reuse(MSA* msa) {
+  msa->name = STR_Destroy(msa->name);
+  msa->acc = STR_Destroy(msa->acc);
+  msa->desc = STR_Destroy(msa->desc);
+  for (int i = 0; i < msa->N; i++) {
+    msa->sqnames[i] = STR_Destroy(msa->sqnames[i]);
+    msa->aseq_lens[i] = 0;
+  }
+  msa->N = 0;
+  msa->alen = 0;
+}
+
+/*! FUNCTION:  MSA_Pushback()
+ *  SYNOPSIS:  Add empty sequence named <sqname> to <msa>.
+ *     RETURN: Index of new sequence.
+ */
+int MSA_Pushback(MSA* msa,
+                 const char* sqname) {
+  if (msa->N >= msa->Nalloc) {
+    int Nalloc = msa->Nalloc * 2;
+    msa->sqnames = ERROR_realloc(msa->sqnames, sizeof(char*) * Nalloc);
+    msa->aseqs = ERROR_realloc(msa->aseqs, sizeof(char*) * Nalloc);
+    msa->aseq_lens = ERROR_realloc(msa->aseq_lens, sizeof(int) * Nalloc);
+    msa->aseq_alloc = ERROR_realloc(msa->aseq_alloc, sizeof(int) * Nalloc);
+    for (int i = msa->Nalloc; i < Nalloc; i++) {
+      msa->sqnames[i] = NULL;
+      msa->aseqs[i] = NULL;
+      msa->aseq_lens[i] = 0;
+      msa->aseq_alloc[i] = 0;
+    }
+    msa->Nalloc = Nalloc;
+  }
+
+  msa->sqnames[msa->N] = STR_Create(sqname);
+  msa->aseq_lens[msa->N] = 0;
+  msa->N++;
+
+  return msa->N - 1;
+}
+
+/*! FUNCTION:  MSA_AppendSeq()
+ *  SYNOPSIS:  Append <L> characters of aligned <text> to sequence <idx> of <msa>.
+ */
+void MSA_AppendSeq(MSA* msa,
+                   int idx,
+                   const char* text,
+                   int L) {
+  int new_len = msa->aseq_lens[idx] + L;
+
+  /* leave room for null terminator */
+  if (new_len + 1 > msa->aseq_alloc[idx]) {
+    msa->aseq_alloc[idx] = MAX(2 * msa->aseq_alloc[idx], new_len + 1);
+    msa->aseqs[idx] = ERROR_realloc(msa->aseqs[idx], sizeof(char) * msa->aseq_alloc[idx]);
+  }
+  memcpy(&msa->aseqs[idx][msa->aseq_lens[idx]], text, sizeof(char) * L);
+  msa->aseq_lens[idx] = new_len;
+  msa->aseqs[idx][new_len] = '\0';
+}
+
+/*! FUNCTION:  MSA_Search_Name()
+ *  SYNOPSIS:  Linear search of <msa> for sequence named <sqname>.
+ *     RETURN: Index of sequence; -1 if not found.
+ */
+int MSA_Search_Name(MSA* msa,
+                    const char* sqname) {
+  for (int i = 0; i < msa->N; i++) {
+    if (strcmp(msa->sqnames[i], sqname) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
@@ -0,0 +1,42 @@
+/*******************************************************************************
+ *  - FILE:      msa.h
+ *  - DESC:    MSA object.
+ *             Multiple sequence alignment of one family.
+ *******************************************************************************/
+
+#ifndef _MSA_H
+#define _MSA_H
+
+/*! FUNCTION:  MSA_Create()
+ *  SYNOPSIS:  Create <msa>, allocate memory and return pointer.
+ */
+MSA* MSA_Create();
+
+/*! FUNCTION:  MSA_Destroy()
+ *  SYNOPSIS:  Destroy <msa>, free memory and return NULL pointer.
+ */
+MSA* MSA_Destroy(MSA* msa);
+
+/*! FUNCTION:  MSA_Reuse()
+ *  SYNOPSIS:  Reuse <msa> by clearing all sequences and annotation, keeping allocated memory.
+ */
+void MSA_Reuse(MSA* msa);
+
+/*! FUNCTION:  MSA_Pushback()
+ *  SYNOPSIS:  Add empty sequence named <sqname> to <msa>.
+ *     RETURN: Index of new sequence.
+ */
+int MSA_Pushback(MSA* msa, const char* sqname);
+
+/*! FUNCTION:  MSA_AppendSeq()
+ *  SYNOPSIS:  Append <L> characters of aligned <text> to sequence <idx> of <msa>.
+ */
+void MSA_AppendSeq(MSA* msa, int idx, const char* text, int L);
+
+/*! FUNCTION:  MSA_Search_Name()
+ *  SYNOPSIS:  Linear search of <msa> for sequence named <sqname>.
+ *     RETURN: Index of sequence; -1 if not found.
+ */
+int MSA_Search_Name(MSA* msa, const char* sqname);
+
+#endif /* _MSA_H */
@@ -0,0 +1,213 @@
+/*******************************************************************************
+ *  - FILE:  perf_counters.c
+ *  - DESC:  PERF_COUNTERS Object (per-stage runtime, cell, and memory counters).
+ *  NOTES:
+ *    - The WORKER owns the PERF_COUNTERS, and stages update them from the thread running
+ *      the search, so updates require no locking.
+ *    - Histograms are log2-scaled, with <PERF_BINS_PER_OCTAVE> bins per power of 2.
+ *      Run times are binned in microsecs and throughput in cells/microsec.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+/* local imports */
+#include "structs.h"
+#include "../utilities/_utilities.h"
+
+/* header */
+#include "_objects.h"
+#include "perf_counters.h"
+
+/* names of each stage */
+static const char* PERF_STAGE_NAMES[] = {
+    "viterbi-lin",
+    "viterbi-sp",
+    "cloud",
+    "bound-fwd-lin",
+    "bound-fwd-sp",
+    "bound-bck-lin",
+    "bound-bck-sp",
+    "posterior",
+    "domain",
+};
+
+/* private functions */
+static int
+PERF_COUNTERS_GetBin(double value);
+static double
+PERF_COUNTERS_Hist_Percentile(size_t* hist,
+                              size_t count,
+                              double pct);
+
+/*! FUNCTION:  PERF_COUNTERS_Create()
+ *  SYNOPSIS:  Create new PERF_COUNTERS object, with all counters zeroed.
+ *  RETURN:    Pointer to PERF_COUNTERS object.
+ */
+PERF_COUNTERS*
+PERF_COUNTERS_Create() {
+  PERF_COUNTERS* perf = NULL;
+
+  perf = (PERF_COUNTERS*)ERROR_malloc(sizeof(PERF_COUNTERS));
+  PERF_COUNTERS_Reset(perf);
+
+  return perf;
+}
+
+/*! FUNCTION:  PERF_COUNTERS_Destroy()
+ *  SYNOPSIS:  Destroy PERF_COUNTERS object.
+ *  RETURN:    NULL pointer.
+ */
+PERF_COUNTERS*
+PERF_COUNTERS_Destroy(PERF_COUNTERS* perf) {
+  perf = ERROR_free(perf);
+  return perf;
+}
+
+/*! FUNCTION:  PERF_COUNTERS_Reset()
+ *  SYNOPSIS:  Zero all counters and histograms in <perf>.
+ */
+void PERF_COUNTERS_Reset(PERF_COUNTERS* perf) {
+  memset(perf->stages, 0, sizeof(PERF_STAGE_COUNTER) * NUM_PERF_STAGES);
+}
+
+/*! FUNCTION:  PERF_COUNTERS_Begin()
+ *  SYNOPSIS:  Mark start of a run of <stage>. Captures thread's allocation counter,
+ *             so bytes allocated during stage can be attributed on PERF_COUNTERS_End().
+ *             No-op if <perf> is NULL.
+ */
+void PERF_COUNTERS_Begin(PERF_COUNTERS* perf,
+                         PERF_STAGE stage) {
+  if (perf == NULL) {
+    return;
+  }
+  perf->stages[stage].bytes_start = ERRORCHECK_alloc_bytes();
+}
+
+/*! FUNCTION:  PERF_COUNTERS_End()
+ *  SYNOPSIS:  Mark end of a run of <stage>, which took <time> seconds and computed <cells> dp cells.
+ *             Updates totals and time/throughput histograms. No-op if <perf> is NULL.
+ */
+void PERF_COUNTERS_End(PERF_COUNTERS* perf,
+                       PERF_STAGE stage,
+                       double time,
+                       size_t cells) {
+  PERF_STAGE_COUNTER* counter;
+  double usecs;
+
+  if (perf == NULL) {
+    return;
+  }
+  counter = &perf->stages[stage];
+
+  counter->count += 1;
+  counter->time += time;
+  counter->time_max = MAX(counter->time_max, time);
+  counter->cells += cells;
+  counter->bytes += ERRORCHECK_alloc_bytes() - counter->bytes_start;
+
+  usecs = time * 1e6;
+  counter->time_hist[PERF_COUNTERS_GetBin(usecs)] += 1;
+  if (usecs > 0) {
+    counter->rate_hist[PERF_COUNTERS_GetBin((double)cells / usecs)] += 1;
+  }
+}
+
+/*! FUNCTION:  PERF_COUNTERS_GetName()
+ *  SYNOPSIS:  Get name of <stage>.
+ *  RETURN:    Stage name string.
+ */
+const char*
+PERF_COUNTERS_GetName(PERF_STAGE stage) {
+  return PERF_STAGE_NAMES[stage];
+}
+
+/*! FUNCTION:  PERF_COUNTERS_GetBinValue()
+ *  SYNOPSIS:  Get upper edge of histogram bin <bin_id>.
+ *  RETURN:    Bin upper edge value.
+ */
+double
+PERF_COUNTERS_GetBinValue(int bin_id) {
+  return pow(2.0, (double)(bin_id + 1 - PERF_BINS_OFFSET) / PERF_BINS_PER_OCTAVE);
+}
+
+/*! FUNCTION:  PERF_COUNTERS_GetTime_Percentile()
+ *  SYNOPSIS:  Get approximate <pct> percentile (in [0,100]) of <stage> run times, from histogram.
+ *  RETURN:    Percentile runtime (in secs).
+ */
+double
+PERF_COUNTERS_GetTime_Percentile(PERF_COUNTERS* perf,
+                                 PERF_STAGE stage,
+                                 double pct) {
+  PERF_STAGE_COUNTER* counter = &perf->stages[stage];
+  double usecs;
+
+  usecs = PERF_COUNTERS_Hist_Percentile(counter->time_hist, counter->count, pct);
+  /* bin edge can overshoot the true value */
+  return MIN(usecs / 1e6, counter->time_max);
+}
+
+/*! FUNCTION:  PERF_COUNTERS_GetRate_Percentile()
+ *  SYNOPSIS:  Get approximate <pct> percentile (in [0,100]) of <stage> throughput, from histogram.
+ *  RETURN:    Percentile throughput (in GCUPS).
+ */
+double
+PERF_COUNTERS_GetRate_Percentile(PERF_COUNTERS* perf,
+                                 PERF_STAGE stage,
+                                 double pct) {
+  PERF_STAGE_COUNTER* counter = &perf->stages[stage];
+  size_t count = 0;
+
+  for (int i = 0; i < NUM_PERF_BINS; i++) {
+    count += counter->rate_hist[i];
+  }
+  /* cells/microsec => gigacells/sec */
+  return PERF_COUNTERS_Hist_Percentile(counter->rate_hist, count, pct) / 1e3;
+}
+
+/*! FUNCTION:  PERF_COUNTERS_GetBin()
+ *  SYNOPSIS:  Get log2-scaled histogram bin for <value>. Out-of-range values are clamped to end bins.
+ *  RETURN:    Bin index.
+ */
+static int
+PERF_COUNTERS_GetBin(double value) {
+  int bin_id;
+
+  if (value <= 0) {
+    return 0;
+  }
+  bin_id = (int)floor(log2(value) * PERF_BINS_PER_OCTAVE) + PERF_BINS_OFFSET;
+  bin_id = MAX(bin_id, 0);
+  bin_id = MIN(bin_id, NUM_PERF_BINS - 1);
+  return bin_id;
+}
+
+/*! FUNCTION:  PERF_COUNTERS_Hist_Percentile()
+ *  SYNOPSIS:  Find the bin of <hist> containing the <pct> percentile of its <count> entries.
+ *  RETURN:    Upper edge of that bin, or zero if histogram is empty.
+ */
+static double
+PERF_COUNTERS_Hist_Percentile(size_t* hist,
+                              size_t count,
+                              double pct) {
+  size_t rank;
+  size_t cum = 0;
+
+  if (count == 0) {
+    return 0.0;
+  }
+  rank = (size_t)ceil((pct / 100.0) * count);
+  rank = MAX(rank, 1);
+  for (int i = 0; i < NUM_PERF_BINS; i++) {
+    cum += hist[i];
+    if (cum >= rank) {
+      return PERF_COUNTERS_GetBinValue(i);
+    }
+  }
+  return PERF_COUNTERS_GetBinValue(NUM_PERF_BINS - 1);
+}
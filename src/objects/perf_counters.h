@@ -0,0 +1,77 @@
+/*******************************************************************************
+ *  - FILE:  perf_counters.h
+ *  - DESC:  PERF_COUNTERS Object (per-stage runtime, cell, and memory counters).
+ *******************************************************************************/
+
+#ifndef _PERF_COUNTERS_H
+#define _PERF_COUNTERS_H
+
+/*! FUNCTION:  PERF_COUNTERS_Create()
+ *  SYNOPSIS:  Create new PERF_COUNTERS object, with all counters zeroed.
+ *  RETURN:    Pointer to PERF_COUNTERS object.
+ */
+PERF_COUNTERS*
+PERF_COUNTERS_Create();
+
+/*! FUNCTION:  PERF_COUNTERS_Destroy()
+ *  SYNOPSIS:  Destroy PERF_COUNTERS object.
+ *  RETURN:    NULL pointer.
+ */
+PERF_COUNTERS*
+PERF_COUNTERS_Destroy(PERF_COUNTERS* perf);
+
+/*! FUNCTION:  PERF_COUNTERS_Reset()
+ *  SYNOPSIS:  Zero all counters and histograms in <perf>.
+ */
+void PERF_COUNTERS_Reset(PERF_COUNTERS* perf);
+
+/*! FUNCTION:  PERF_COUNTERS_Begin()
+ *  SYNOPSIS:  Mark start of a run of <stage>. Captures thread's allocation counter,
+ *             so bytes allocated during stage can be attributed on PERF_COUNTERS_End().
+ *             No-op if <perf> is NULL.
+ */
+void PERF_COUNTERS_Begin(PERF_COUNTERS* perf,
+                         PERF_STAGE stage);
+
+/*! FUNCTION:  PERF_COUNTERS_End()
+ *  SYNOPSIS:  Mark end of a run of <stage>, which took <time> seconds and computed <cells> dp cells.
+ *             Updates totals and time/throughput histograms. No-op if <perf> is NULL.
+ */
+void PERF_COUNTERS_End(PERF_COUNTERS* perf,
+                       PERF_STAGE stage,
+                       double time,
+                       size_t cells);
+
+/*! FUNCTION:  PERF_COUNTERS_GetName()
+ *  SYNOPSIS:  Get name of <stage>.
+ *  RETURN:    Stage name string.
+ */
+const char*
+PERF_COUNTERS_GetName(PERF_STAGE stage);
+
+/*! FUNCTION:  PERF_COUNTERS_GetBinValue()
+ *  SYNOPSIS:  Get upper edge of histogram bin <bin_id>.
+ *  RETURN:    Bin upper edge value.
+ */
+double
+PERF_COUNTERS_GetBinValue(int bin_id);
+
+/*! FUNCTION:  PERF_COUNTERS_GetTime_Percentile()
+ *  SYNOPSIS:  Get approximate <pct> percentile (in [0,100]) of <stage> run times, from histogram.
+ *  RETURN:    Percentile runtime (in secs).
+ */
+double
+PERF_COUNTERS_GetTime_Percentile(PERF_COUNTERS* perf,
+                                 PERF_STAGE stage,
+                                 double pct);
+
+/*! FUNCTION:  PERF_COUNTERS_GetRate_Percentile()
+ *  SYNOPSIS:  Get approximate <pct> percentile (in [0,100]) of <stage> throughput, from histogram.
+ *  RETURN:    Percentile throughput (in GCUPS).
+ */
+double
+PERF_COUNTERS_GetRate_Percentile(PERF_COUNTERS* perf,
+                                 PERF_STAGE stage,
+                                 double pct);
+
+#endif /* _PERF_COUNTERS_H */
@@ -1,6 +1,11 @@
 /*******************************************************************************
  *  - FILE:      results.c
  *  - DESC:    RESULTS object
+ *  NOTES:
+ *    - RESULTS doubles as a bounded ring-buffer queue of self-contained RESULT records,
+ *      filled by the search thread and drained by a report writer thread.
+ *    - Queue supports one producer and one consumer.  Records are filled and read in place,
+ *      and their alignment buffers are reused as queue slots cycle.
  *******************************************************************************/
 
 /* imports */
@@ -10,6 +15,7 @@
 #include <stdbool.h>
 #include <string.h>
 #include <math.h>
+#include <pthread.h>
 
 /* local imports */
 #include "structs.h"
@@ -19,6 +25,97 @@
 /* header */
 #include "results.h"
 
+/*! FUNCTION:  RESULT_Create()
+ *  SYNOPSIS:  Create empty <result>, allocates memory and returns pointer.
+ */
+RESULT*
+RESULT_Create() {
+  RESULT* result = NULL;
+  result = ERROR_malloc(sizeof(RESULT));
+  RESULT_Init(result);
+
+  return result;
+}
+
+/*! FUNCTION:  RESULT_Destroy()
+ *  SYNOPSIS:  Destroy <result>, frees memory and returns NULL pointer.
+ */
+RESULT*
+RESULT_Destroy(RESULT* result) {
+  if (result == NULL)
+    return result;
+
+  RESULT_Cleanup(result);
+  result = ERROR_free(result);
+  return result;
+}
+
+/*! FUNCTION:  RESULT_Init()
+ *  SYNOPSIS:  Initialize <result> in place, with all fields zeroed and no owned data.
+ */
+void RESULT_Init(RESULT* result) {
+  memset(result, 0, sizeof(RESULT));
+  result->result_id = -1;
+  result->target_id = -1;
+  result->query_id = -1;
+  result->dom_best = -1;
+}
+
+/*! FUNCTION:  RESULT_Cleanup()
+ *  SYNOPSIS:  Free all data owned by <result>, leaving it initialized.
+ */
+void RESULT_Cleanup(RESULT* result) {
+  ERROR_free(result->target_name);
+  ERROR_free(result->query_name);
+  ERROR_free(result->target_acc);
+  ERROR_free(result->target_desc);
+  ERROR_free(result->query_acc);
+  ALIGNMENT_Destroy(result->vit_trace);
+  ALIGNMENT_Destroy(result->post_trace);
+  RESULT_Init(result);
+}
+
+/*! FUNCTION:  RESULT_Copy()
+ *  SYNOPSIS:  Deep copy of <src> into <dest>. Reuses memory already owned by <dest>.
+ *             Creates new RESULT for <dest> if <dest> is NULL.
+ *  RETURN:    Pointer to <dest>.
+ */
+RESULT*
+RESULT_Copy(RESULT* dest,
+            RESULT* src) {
+  if (dest == NULL) {
+    dest = RESULT_Create();
+  }
+  /* hold onto owned data while base data is copied */
+  STR target_name = dest->target_name;
+  STR query_name = dest->query_name;
+  STR target_acc = dest->target_acc;
+  STR target_desc = dest->target_desc;
+  STR query_acc = dest->query_acc;
+  ALIGNMENT* vit_trace = dest->vit_trace;
+  ALIGNMENT* post_trace = dest->post_trace;
+
+  /* copy base data */
+  *dest = *src;
+
+  /* copy owned data */
+  dest->target_name = STR_Set(target_name, src->target_name);
+  dest->query_name = STR_Set(query_name, src->query_name);
+  dest->target_acc = STR_Set(target_acc, src->target_acc);
+  dest->target_desc = STR_Set(target_desc, src->target_desc);
+  dest->query_acc = STR_Set(query_acc, src->query_acc);
+  dest->vit_trace = vit_trace;
+  dest->post_trace = post_trace;
+  if (src->vit_trace != NULL) {
+    dest->vit_trace = ALIGNMENT_Copy(dest->vit_trace, src->vit_trace);
+  }
+  if (src->post_trace != NULL) {
+    dest->post_trace = ALIGNMENT_Copy(dest->post_trace, src->post_trace);
+  }
+
+  return dest;
+}
+
 /*! FUNCTION:  RESULTS_Create()
  *  SYNOPSIS:
  */
@@ -38,6 +135,11 @@ RESULTS_Create() {
   results->num_hits = 0;
   results->num_searches = 0;
 
+  results->head = 0;
+  results->is_closed = false;
+  pthread_mutex_init(&results->lock, NULL);
+  pthread_cond_init(&results->cond, NULL);
+
   RESULTS_Resize(results, min_size);
 
   return results;
@@ -51,11 +153,14 @@ RESULTS_Destroy(RESULTS* results) {
   if (results == NULL)
     return results;
 
-  for (int i = 0; i < results->N; i++) {
-    ERROR_free(results->data[i].target_name);
-    ERROR_free(results->data[i].query_name);
+  /* all slots are initialized, so owned data can be freed whether or not slot is in use */
+  for (int i = 0; i < results->Nalloc; i++) {
+    RESULT_Cleanup(&results->data[i]);
   }
 
+  pthread_mutex_destroy(&results->lock);
+  pthread_cond_destroy(&results->cond);
+
   results->data = ERROR_free(results->data);
   results = ERROR_free(results);
   return results;
@@ -64,7 +169,7 @@ RESULTS_Destroy(RESULTS* results) {
 /* add result to results */
 void RESULTS_Pushback(RESULTS* results,
                       RESULT* res) {
-  results->data[results->N] = *res;
+  RESULT_Copy(&results->data[results->N], res);
 
   results->N++;
   if (results->N >= results->Nalloc) {
@@ -75,8 +180,103 @@ void RESULTS_Pushback(RESULTS* results,
 /* resize results */
 void RESULTS_Resize(RESULTS* results,
                     size_t size) {
+  size_t old_size = results->Nalloc;
   results->Nalloc = size;
   results->data = (RESULT*)ERROR_realloc(results->data, sizeof(RESULT) * size);
+  /* initialize new slots */
+  for (size_t i = old_size; i < size; i++) {
+    RESULT_Init(&results->data[i]);
+  }
+}
+
+/*! FUNCTION:  RESULTS_SetMaxInQueue()
+ *  SYNOPSIS:  Empty <results> and set it up as a queue holding at most <max_in_queue> results.
+ *             Should not be called while queue is shared between threads.
+ */
+void RESULTS_SetMaxInQueue(RESULTS* results,
+                           int max_in_queue) {
+  max_in_queue = MAX(max_in_queue, 1);
+  if (results->Nalloc < max_in_queue) {
+    RESULTS_Resize(results, max_in_queue);
+  }
+  results->max_in_queue = max_in_queue;
+  results->N = 0;
+  results->head = 0;
+  results->is_closed = false;
+}
+
+/*! FUNCTION:  RESULTS_Queue_Back()
+ *  SYNOPSIS:  Get free slot at back of <results> queue, to be filled by producer and then committed
+ *             by RESULTS_Queue_Push(). Blocks while queue is full.
+ *             Slot may contain stale data from a previous result; owned data is reused.
+ *  RETURN:    Pointer to free slot.
+ */
+RESULT*
+RESULTS_Queue_Back(RESULTS* results) {
+  RESULT* result;
+
+  pthread_mutex_lock(&results->lock);
+  while (results->N >= results->max_in_queue) {
+    pthread_cond_wait(&results->cond, &results->lock);
+  }
+  result = &results->data[(results->head + results->N) % results->max_in_queue];
+  pthread_mutex_unlock(&results->lock);
+
+  return result;
+}
+
+/*! FUNCTION:  RESULTS_Queue_Push()
+ *  SYNOPSIS:  Commit slot returned by last call to RESULTS_Queue_Back() to the back of <results> queue.
+ */
+void RESULTS_Queue_Push(RESULTS* results) {
+  pthread_mutex_lock(&results->lock);
+  results->N++;
+  results->num_hits++;
+  pthread_cond_broadcast(&results->cond);
+  pthread_mutex_unlock(&results->lock);
+}
+
+/*! FUNCTION:  RESULTS_Queue_Front()
+ *  SYNOPSIS:  Get oldest result in <results> queue, without removing it.
+ *             Blocks while queue is empty and open.
+ *  RETURN:    Pointer to result, or NULL if queue is empty and closed.
+ */
+RESULT*
+RESULTS_Queue_Front(RESULTS* results) {
+  RESULT* result = NULL;
+
+  pthread_mutex_lock(&results->lock);
+  while (results->N == 0 && results->is_closed == false) {
+    pthread_cond_wait(&results->cond, &results->lock);
+  }
+  if (results->N > 0) {
+    result = &results->data[results->head];
+  }
+  pthread_mutex_unlock(&results->lock);
+
+  return result;
+}
+
+/*! FUNCTION:  RESULTS_Queue_Pop()
+ *  SYNOPSIS:  Remove oldest result from <results> queue, freeing its slot for reuse.
+ */
+void RESULTS_Queue_Pop(RESULTS* results) {
+  pthread_mutex_lock(&results->lock);
+  results->head = (results->head + 1) % results->max_in_queue;
+  results->N--;
+  pthread_cond_broadcast(&results->cond);
+  pthread_mutex_unlock(&results->lock);
+}
+
+/*! FUNCTION:  RESULTS_Queue_Close()
+ *  SYNOPSIS:  Signal that no more results will be pushed to <results> queue.
+ *             Consumer drains remaining results, then RESULTS_Queue_Front() returns NULL.
+ */
+void RESULTS_Queue_Close(RESULTS* results) {
+  pthread_mutex_lock(&results->lock);
+  results->is_closed = true;
+  pthread_cond_broadcast(&results->cond);
+  pthread_mutex_unlock(&results->lock);
 }
 
 /* output results to file pointer */
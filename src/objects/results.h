@@ -6,6 +6,25 @@
 #ifndef _RESULTS_H
 #define _RESULTS_H
 
+/* === RESULT === */
+
+/* constructor */
+RESULT* RESULT_Create();
+
+/* destructor */
+RESULT* RESULT_Destroy(RESULT* result);
+
+/* initialize result in place, with no owned data */
+void RESULT_Init(RESULT* result);
+
+/* free data owned by result, leaving it initialized */
+void RESULT_Cleanup(RESULT* result);
+
+/* deep copy of <src> into <dest>, reusing memory owned by <dest> */
+RESULT* RESULT_Copy(RESULT* dest, RESULT* src);
+
+/* === RESULTS === */
+
 /* constructor */
 RESULTS* RESULTS_Create();
 
@@ -17,6 +36,26 @@ void RESULTS_Pushback(RESULTS* res, RESULT* r);
 /* resize results */
 void RESULTS_Resize(RESULTS* res, size_t size);
 
+/* === RESULTS QUEUE === */
+
+/* empty results and use as queue of at most <max_in_queue> results */
+void RESULTS_SetMaxInQueue(RESULTS* res, int max_in_queue);
+
+/* get free slot at back of queue to fill (blocks while full) */
+RESULT* RESULTS_Queue_Back(RESULTS* res);
+
+/* commit filled slot to back of queue */
+void RESULTS_Queue_Push(RESULTS* res);
+
+/* get oldest result in queue (blocks while empty); NULL if empty and closed */
+RESULT* RESULTS_Queue_Front(RESULTS* res);
+
+/* remove oldest result from queue */
+void RESULTS_Queue_Pop(RESULTS* res);
+
+/* no more results will be pushed to queue */
+void RESULTS_Queue_Close(RESULTS* res);
+
 /* output results in personal format to file pointer */
 void RESULTS_Dump(RESULTS* res, FILE* fp);
 
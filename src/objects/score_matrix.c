@@ -133,12 +133,52 @@ SCORE_MATRIX* SCORE_MATRIX_Load(char* filename) {
   return submat;
 }
 
+/* Construct SCORE_MATRIX object from built-in BLOSUM62 table */
+SCORE_MATRIX* SCORE_MATRIX_Create_Blosum62() {
+  SCORE_MATRIX* submat;
+  /* BLOSUM62, in half-bits (NCBI order) */
+  static char blosum62_alph[] = "ARNDCQEGHILKMFPSTWYV";
+  static const int blosum62[20][20] = {
+      {4, -1, -2, -2, 0, -1, -1, 0, -2, -1, -1, -1, -1, -2, -1, 1, 0, -3, -2, 0},
+      {-1, 5, 0, -2, -3, 1, 0, -2, 0, -3, -2, 2, -1, -3, -2, -1, -1, -3, -2, -3},
+      {-2, 0, 6, 1, -3, 0, 0, 0, 1, -3, -3, 0, -2, -3, -2, 1, 0, -4, -2, -3},
+      {-2, -2, 1, 6, -3, 0, 2, -1, -1, -3, -4, -1, -3, -3, -1, 0, -1, -4, -3, -3},
+      {0, -3, -3, -3, 9, -3, -4, -3, -3, -1, -1, -3, -1, -2, -3, -1, -1, -2, -2, -1},
+      {-1, 1, 0, 0, -3, 5, 2, -2, 0, -3, -2, 1, 0, -3, -1, 0, -1, -2, -1, -2},
+      {-1, 0, 0, 2, -4, 2, 5, -2, 0, -3, -3, 1, -2, -3, -1, 0, -1, -3, -2, -2},
+      {0, -2, 0, -1, -3, -2, -2, 6, -2, -4, -4, -2, -3, -3, -2, 0, -2, -2, -3, -3},
+      {-2, 0, 1, -1, -3, 0, 0, -2, 8, -3, -3, -1, -2, -1, -2, -1, -2, -2, 2, -3},
+      {-1, -3, -3, -3, -1, -3, -3, -4, -3, 4, 2, -3, 1, 0, -3, -2, -1, -3, -1, 3},
+      {-1, -2, -3, -4, -1, -2, -3, -4, -3, 2, 4, -2, 2, 0, -3, -2, -1, -2, -1, 1},
+      {-1, 2, 0, -1, -3, 1, 1, -2, -1, -3, -2, 5, -1, -3, -1, 0, -1, -3, -2, -2},
+      {-1, -1, -2, -3, -1, 0, -2, -3, -2, 1, 2, -1, 5, 0, -2, -1, -1, -1, -1, 1},
+      {-2, -3, -3, -3, -2, -3, -3, -3, -1, 0, 0, -3, 0, 6, -4, -2, -2, 1, 3, -1},
+      {-1, -2, -2, -1, -3, -1, -1, -2, -2, -3, -3, -1, -2, -4, 7, -1, -1, -4, -3, -2},
+      {1, -1, 1, 0, -1, 0, 0, 0, -1, -2, -2, 0, -1, -2, -1, 4, 1, -3, -2, -2},
+      {0, -1, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, -2, -1, 1, 5, -2, -2, 0},
+      {-3, -3, -4, -4, -2, -2, -3, -2, -2, -3, -2, -3, -1, 1, -4, -3, -2, 11, 2, -3},
+      {-2, -2, -2, -3, -2, -1, -2, -3, 2, -1, -1, -2, -1, 3, -3, -2, -2, 2, 7, -1},
+      {0, -3, -3, -3, -1, -2, -2, -3, -3, 3, 1, -2, 1, -1, -2, -2, 0, -3, -1, 4},
+  };
+
+  submat = SCORE_MATRIX_Create();
+  submat->filename = STR_Create("BLOSUM62");
+  SCORE_MATRIX_SetAlphabet(submat, blosum62_alph);
+
+  for (int i = 0; i < 20; i++) {
+    for (int j = 0; j < 20; j++) {
+      *(SCORE_MATRIX_Score(submat, blosum62_alph[i], blosum62_alph[j])) = blosum62[i][j];
+    }
+  }
+
+  return submat;
+}
+
 /* Set alphabet and the initialize score matrix based on size */
 void SCORE_MATRIX_SetAlphabet(SCORE_MATRIX* submat,
                               char* alph) {
   int alph_len = strlen(alph);
-  submat->alph = NULL;
-  submat->alph = STR_Create(alph);
+  submat->alph = STR_Set(submat->alph, alph);
   submat->alph_len = alph_len;
 
   /* initialize map */
@@ -152,7 +192,7 @@ void SCORE_MATRIX_SetAlphabet(SCORE_MATRIX* submat,
   }
 
   submat->scores = (float*)realloc(submat->scores, sizeof(float) * alph_len * alph_len);
-  if (submat == NULL) {
+  if (submat->scores == NULL) {
     perror("Error while malloc'ing SCORES in SCORE_MATRIX.\n");
     ERRORCHECK_exit(EXIT_FAILURE);
   }
@@ -184,6 +224,50 @@ inline float SCORE_MATRIX_GetScore(SCORE_MATRIX* submat,
   return submat->scores[key];
 }
 
+/* Solve for scale <lambda> of SCORE_MATRIX, given background frequencies <bg> of amino alphabet */
+/* modeled after esl_scorematrix_ProbifyGivenBG(): lambda is the root of sum_ab bg_a * bg_b * exp(lambda * s_ab) = 1 */
+double SCORE_MATRIX_Lambda(SCORE_MATRIX* submat,
+                           const double* bg) {
+  double lo = 0.0;
+  double hi = 1.0;
+  double mid = 0.0;
+  double sum = 0.0;
+
+  /* bracket the root: sum is below 1 at lambda = 0+ (negative expected score), above 1 as lambda grows */
+  for (int i = 0; i < 100; i++) {
+    sum = 0.0;
+    for (int a = 0; a < NUM_AMINO; a++) {
+      for (int b = 0; b < NUM_AMINO; b++) {
+        sum += bg[a] * bg[b] * exp(hi * SCORE_MATRIX_GetScore(submat, AA[a], AA[b]));
+      }
+    }
+    if (sum > 1.0) {
+      break;
+    }
+    lo = hi;
+    hi *= 2.0;
+  }
+
+  /* bisect */
+  for (int i = 0; i < 100; i++) {
+    mid = (lo + hi) / 2.0;
+    sum = 0.0;
+    for (int a = 0; a < NUM_AMINO; a++) {
+      for (int b = 0; b < NUM_AMINO; b++) {
+        sum += bg[a] * bg[b] * exp(mid * SCORE_MATRIX_GetScore(submat, AA[a], AA[b]));
+      }
+    }
+    if (sum > 1.0) {
+      hi = mid;
+    }
+    else {
+      lo = mid;
+    }
+  }
+
+  return (lo + hi) / 2.0;
+}
+
 /* Output SCORE_MATRIX to FILE pointer */
 void SCORE_MATRIX_Dump(SCORE_MATRIX* submat,
                        FILE* fp) {
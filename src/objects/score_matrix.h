@@ -16,6 +16,9 @@ void SCORE_MATRIX_Destroy(SCORE_MATRIX* submat);
 /* Construct SCORE_MATRIX object by parsing .submat file */
 SCORE_MATRIX* SCORE_MATRIX_Load(char* filename);
 
+/* Construct SCORE_MATRIX object from built-in BLOSUM62 table */
+SCORE_MATRIX* SCORE_MATRIX_Create_Blosum62();
+
 /* Set alphabet and the initialize score matrix based on size */
 void SCORE_MATRIX_SetAlphabet(SCORE_MATRIX* submat, char* alph);
 
@@ -28,6 +31,9 @@ float* SCORE_MATRIX_Score(SCORE_MATRIX* submat, char q_ch, char t_ch);
 /* Get score from SCORE_MATRIX, given query/target chars  */
 float SCORE_MATRIX_GetScore(SCORE_MATRIX* submat, char q_ch, char t_ch);
 
+/* Solve for scale <lambda> of SCORE_MATRIX, given background frequencies <bg> of amino alphabet */
+double SCORE_MATRIX_Lambda(SCORE_MATRIX* submat, const double* bg);
+
 /* Output SCORE_MATRIX to FILE pointer */
 void SCORE_MATRIX_Dump(SCORE_MATRIX* submat, FILE* fp);
 
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ *  - FILE:      seq_builder.c
+ *  - DESC:    SEQ_BUILDER Object.
+ *             Builds HMM_PROFILE from a single SEQUENCE, as in HMMER's p7_SingleBuilder(),
+ *             or from an MSA, as in HMMER's p7_Builder(): match emissions use BLOSUM62 conditional
+ *             probabilities, and workspace for calibrating e-value distribution parameters is kept between profiles.
+ *             Not shared between threads: each thread needs its own SEQ_BUILDER.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+/* local imports */
+#include "structs.h"
+#include "../utilities/_utilities.h"
+
+/* header */
+#include "_objects.h"
+#include "seq_builder.h"
+
+/*!  FUNCTION:    SEQ_BUILDER_Create()
+ *   SYNOPSIS:    Creates an instance of SEQ_BUILDER.
+ *                Match emissions are conditional probabilities of BLOSUM62, given background frequencies.
+ */
+SEQ_BUILDER*
+SEQ_BUILDER_Create() {
+  SEQ_BUILDER* bld = NULL;
+  double sum;
+
+  bld = (SEQ_BUILDER*)ERROR_malloc(sizeof(SEQ_BUILDER));
+
+  /* joint probabilities of BLOSUM62 are bg_a * bg_b * exp(lambda * s_ab); normalize each row for P(b|a) */
+  bld->submat = SCORE_MATRIX_Create_Blosum62();
+  bld->lambda = SCORE_MATRIX_Lambda(bld->submat, BG_MODEL);
+  for (int a = 0; a < NUM_AMINO; a++) {
+    sum = 0.0;
+    for (int b = 0; b < NUM_AMINO; b++) {
+      bld->cond[a][b] = BG_MODEL[b] * exp(bld->lambda * SCORE_MATRIX_GetScore(bld->submat, AA[a], AA[b]));
+      sum += bld->cond[a][b];
+    }
+    for (int b = 0; b < NUM_AMINO; b++) {
+      bld->cond[a][b] /= sum;
+    }
+  }
+
+  /* gap open/extend (defaults from HMMER) */
+  bld->popen = 0.02f;
+  bld->pextend = 0.4f;
+
+  /* building from msa (defaults from HMMER, transition prior from p7_prior_CreateAmino()) */
+  bld->symfrac = 0.5f;
+  bld->fragthresh = 0.5f;
+  bld->ere = 0.59f;
+  bld->esigma = 45.0f;
+  bld->pseudo = 10.0f;
+  bld->tprior[M2M] = 0.7939f;
+  bld->tprior[M2I] = 0.0278f;
+  bld->tprior[M2D] = 0.0135f;
+  bld->tprior[I2M] = 0.1551f;
+  bld->tprior[I2I] = 0.1331f;
+  bld->tprior[D2M] = 0.9002f;
+  bld->tprior[D2D] = 0.5630f;
+  bld->tprior[B2M] = 0.0f;
+
+  /* calibration (defaults from HMMER) */
+  bld->EmL = 200;
+  bld->EmN = 200;
+  bld->EvL = 200;
+  bld->EvN = 200;
+  bld->EfL = 100;
+  bld->EfN = 200;
+  bld->Eft = 0.04;
+  bld->seed = 42;
+
+  bld->cal_prof = HMM_PROFILE_Create();
+  bld->cal_seq = SEQUENCE_Create();
+  bld->cal_text = NULL;
+  bld->cal_Nalloc = 0;
+  bld->cal_scores = NULL;
+  bld->msv_row = NULL;
+  bld->msv_Nalloc = 0;
+  bld->st_MX3 = MATRIX_3D_Create(NUM_NORMAL_STATES, 1, 1);
+  bld->sp_MX = MATRIX_2D_Create(NUM_SPECIAL_STATES, 1);
+
+  /* logsum table is shared by all threads, so fill it before any are started */
+  MATH_Logsum_Init();
+
+  return bld;
+}
+
+/*!  FUNCTION:    SEQ_BUILDER_Destroy()
+ *   SYNOPSIS:    Destroys instance of SEQ_BUILDER and frees memory.
+ */
+SEQ_BUILDER*
+SEQ_BUILDER_Destroy(SEQ_BUILDER* bld) {
+  if (bld == NULL)
+    return bld;
+
+  SCORE_MATRIX_Destroy(bld->submat);
+  bld->cal_prof = HMM_PROFILE_Destroy(bld->cal_prof);
+  bld->cal_seq = SEQUENCE_Destroy(bld->cal_seq);
+  bld->cal_text = ERROR_free(bld->cal_text);
+  bld->cal_scores = ERROR_free(bld->cal_scores);
+  bld->msv_row = ERROR_free(bld->msv_row);
+  bld->st_MX3 = MATRIX_3D_Destroy(bld->st_MX3);
+  bld->sp_MX = MATRIX_2D_Destroy(bld->sp_MX);
+
+  bld = ERROR_free(bld);
+  return bld;
+}
+
+/*!  FUNCTION:    SEQ_BUILDER_Reserve()
+ *   SYNOPSIS:    Grow calibration workspace of <bld> to fit profiles of length <T>.
+ */
+void SEQ_BUILDER_Reserve(SEQ_BUILDER* bld,
+                         int T) {
+  int L = MAX(bld->EmL, MAX(bld->EvL, bld->EfL));
+  int N = MAX(bld->EmN, MAX(bld->EvN, bld->EfN));
+
+  if (bld->cal_Nalloc < L + 1) {
+    bld->cal_Nalloc = L + 1;
+    bld->cal_text = ERROR_realloc(bld->cal_text, sizeof(char) * bld->cal_Nalloc);
+    bld->cal_scores = ERROR_realloc(bld->cal_scores, sizeof(double) * N);
+  }
+  if (bld->msv_Nalloc < T + 1) {
+    bld->msv_Nalloc = T + 1;
+    bld->msv_row = ERROR_realloc(bld->msv_row, sizeof(float) * bld->msv_Nalloc);
+  }
+}
@@ -0,0 +1,26 @@
+/*******************************************************************************
+ *  - FILE:      seq_builder.h
+ *  - DESC:    SEQ_BUILDER Object.
+ *             Builds HMM_PROFILE from a single SEQUENCE or an MSA.
+ *******************************************************************************/
+
+#ifndef _SEQ_BUILDER_H
+#define _SEQ_BUILDER_H
+
+/*!  FUNCTION:    SEQ_BUILDER_Create()
+ *   SYNOPSIS:    Creates an instance of SEQ_BUILDER.
+ *                Match emissions are conditional probabilities of BLOSUM62, given background frequencies.
+ */
+SEQ_BUILDER* SEQ_BUILDER_Create();
+
+/*!  FUNCTION:    SEQ_BUILDER_Destroy()
+ *   SYNOPSIS:    Destroys instance of SEQ_BUILDER and frees memory.
+ */
+SEQ_BUILDER* SEQ_BUILDER_Destroy(SEQ_BUILDER* bld);
+
+/*!  FUNCTION:    SEQ_BUILDER_Reserve()
+ *   SYNOPSIS:    Grow calibration workspace of <bld> to fit profiles of length <T>.
+ */
+void SEQ_BUILDER_Reserve(SEQ_BUILDER* bld, int T);
+
+#endif /* _SEQ_BUILDER_H */
@@ -63,6 +63,7 @@ SEQUENCE_Create() {
   seq->header = NULL;
   seq->filename = NULL;
   seq->name = NULL;
+  seq->acc = NULL;
   seq->alph = NULL;
 
   seq->seq = NULL;
@@ -86,6 +87,7 @@ SEQUENCE_Destroy(SEQUENCE* seq) {
   seq->header = STR_Destroy(seq->header);
   seq->filename = STR_Destroy(seq->filename);
   seq->name = STR_Destroy(seq->name);
+  seq->acc = STR_Destroy(seq->acc);
   seq->alph = STR_Destroy(seq->alph);
 
   ERROR_free(seq->seq);
@@ -93,7 +93,7 @@ double BG_MODEL_log[] = {
 };
 
 /* descriptors of all pipelines */
-const int NUM_PIPELINES = 7;
+const int NUM_PIPELINES = 14;
 PIPELINE PIPELINES[] = {
     {"search", mmoreseqs_search_pipeline, 5, NULL},
     {"mmore-search", mmoreseqs_mmore_pipeline, 3, NULL},
@@ -101,7 +101,14 @@ PIPELINE PIPELINES[] = {
     {"prep", mmoreseqs_prep_pipeline, 3, NULL},
     {"prep-search", mmoreseqs_prepsearch_pipeline, 1, NULL},
     {"easy-search", mmoreseqs_easysearch_pipeline, 3, NULL},
-    {"index", index_pipeline, 4, NULL}
+    {"index", index_pipeline, 4, NULL},
+    {"convert", convert_pipeline, 1, NULL},
+    {"merge", merge_pipeline, 1, NULL},
+    {"plan", plan_pipeline, 4, NULL},
+    {"cloud-calibrate", cloud_calibrate_pipeline, 3, NULL},
+    {"dedup", dedup_pipeline, 3, NULL},
+    {"fasta-to-hmm", fasta_to_hmm_pipeline, 2, NULL},
+    {"msa-to-hmm", msa_to_hmm_pipeline, 3, NULL}
 };
 
 /* help output strings for pipeline */
@@ -112,7 +119,14 @@ char* PIPELINES_ARG_HELP[] = {
     "mmoreseqs prep <i:QUERY_MSA> <i:TARGET_FASTA> <i:PREP_DIR>",
     "mmoreseqs prep-search <i:PREP_DIR>",
     "mmoreseqs easy-search <i:QUERY_MSA> <i:TARGET_FASTA> <i:PREP_DIR>",
-    "mmoreseqs index <i:QUERY_HMM> <i:TARGET_FASTA> <o:QUERY_INDEX> <o:TARGET_INDEX>"
+    "mmoreseqs index <i:QUERY_HMM> <i:TARGET_FASTA> <o:QUERY_INDEX> <o:TARGET_INDEX>",
+    "mmoreseqs convert <i:RESULTS_BIN>",
+    "mmoreseqs merge <i:SHARD_RESULTS_BIN> [<i:SHARD_RESULTS_BIN> ...]",
+    "mmoreseqs plan <i:QUERY_HMM> <i:TARGET_FASTA> <i:MMSEQS_M8_RESULTS> <i:NUM_SHARDS>",
+    "mmoreseqs cloud-calibrate <i:QUERY_HMM> <i:TARGET_FASTA> <i:MMSEQS_M8_RESULTS>",
+    "mmoreseqs dedup <i:QUERY_FASTA> <o:UNIQUE_QUERY_FASTA> <o:QUERY_DUPMAP>",
+    "mmoreseqs fasta-to-hmm <i:TARGET_FASTA> <o:TARGET_HMM>",
+    "mmoreseqs msa-to-hmm <i:TARGET_MSA> <o:TARGET_HMM> <o:TARGET_FASTA>"
 };
 
 /* full names of the all states */
@@ -251,11 +265,6 @@ STR FILETYPE_NAME_Get(FILETYPE filetype_id) {
 /* debugging data structures */
 DEBUG_KIT* debugger;
 
-/* initializes single_builder scoring matrix used in HMM_PROFILE_From_Seq() */
-/* SingleBuilder probability matrix (created by HMMER using p7_SingleBuilder, dependent on only bg frequencies) */
-/* TODO: Needs to be freed */
-SCORE_MATRIX* bld = NULL;
-
 /* --- EXTERNAL EXECUTABLE/SCRIPT LOCATIONS --- */
 char* ROOT_DIR = MACRO_XSTR(PROJECT_LOC);
 /* --- TOOL BINARIES --- */
@@ -8,8 +8,10 @@
 
 /* === STDLIB DATA TYPES === */
 #include <stdbool.h>
+#include <stdint.h>
 #include <time.h>
 #include <sys/types.h>
+#include <pthread.h>
 
 /* === MACROS === */
 #include "../macros/_macros.h"
@@ -233,6 +235,7 @@ typedef struct {
   bool is_eof;      /* is file pointer at the end of file? */
   long int prv_pos; /* position of start of current line in file */
   long int cur_pos; /* position of beginning of next line in file */
+  char* buf;        /* stdio buffer for <fp>, if set by FILER_SetBuffer() */
 } FILER;
 
 /* string buffer for reading/writing to file */
@@ -286,6 +289,22 @@ typedef struct {
   long int pos_nxt; /* position of start of next line */
 } WRITER;
 
+/* double-buffered writer, with a background thread draining full buffers to file */
+typedef struct {
+  FILE* fp;               /* output file (not owned by writer) */
+  char* bufs[2];          /* double buffer: one filled by caller, other drained by thread */
+  size_t lens[2];         /* number of chars in each buffer */
+  size_t Nallocs[2];      /* allocated size of each buffer */
+  int fill_idx;           /* buffer currently being filled by caller */
+  int drain_idx;          /* buffer currently handed off to thread */
+  bool is_pending;        /* is a buffer waiting to be (or being) drained? */
+  bool is_stop;           /* signals thread to exit */
+  size_t bytes_written;   /* total bytes written to file */
+  pthread_t thread;       /* background writer thread */
+  pthread_mutex_t lock;   /* guards <is_pending>, <drain_idx>, <is_stop> */
+  pthread_cond_t cond;    /* signals hand-off and completion of drain */
+} ASYNC_WRITER;
+
 /* set of bounds for cloud search space */
 typedef struct {
   /* dimensions of embedding matrix */
@@ -499,6 +518,20 @@ typedef struct {
   char* alph;     /* alphabet (currently only supports AMINO) */
 } SEQUENCE;
 
+/* multiple sequence alignment of one family (as read from Stockholm file) */
+typedef struct {
+  char* name;      /* name of family (#=GF ID) */
+  char* acc;       /* accession of family (#=GF AC) */
+  char* desc;      /* description of family (#=GF DE) */
+  int N;           /* number of aligned sequences */
+  int Nalloc;      /* allocated number of aligned sequences */
+  int alen;        /* alignment length (number of columns) */
+  char** sqnames;  /* name of each sequence */
+  char** aseqs;    /* aligned text of each sequence */
+  int* aseq_lens;  /* length of aligned text of each sequence */
+  int* aseq_alloc; /* allocated length of aligned text of each sequence */
+} MSA;
+
 /* 2-dimensional float matrix */
 typedef struct {
   /* dimensions */
@@ -522,6 +555,27 @@ typedef struct {
   bool clean;  /* whether data has been cleared / all cells set to -INF */
 } MATRIX_3D;
 
+/* int16 work buffers for reduced-precision cloud search */
+typedef struct {
+  /* dimensions */
+  int Q;  /* length of query */
+  int T;  /* length of target */
+  int W;  /* width of each antidiagonal of <mx> */
+  int Wt; /* width of each transition row of <tsc_rev> */
+  /* allocated size */
+  size_t Nalloc; /* number of int16 cells alloc'd */
+  int16_t* data; /* memory shared by <mx>, <tsc_rev>, <msc> and <isc> */
+  /* views into <data> */
+  int16_t* mx;      /* dp matrix: 3 normal states x 3 antidiagonals */
+  int16_t* tsc_rev; /* transition scores, indexed by reversed target position */
+  int16_t* msc;     /* match emission scores */
+  int16_t* isc;     /* insert emission scores */
+  /* other work buffers */
+  VECTOR_INT* qA;        /* digitized query */
+  VECTOR_INT* lb_vec[3]; /* left bounds of previous 3 antidiagonals */
+  VECTOR_INT* rb_vec[3]; /* right bounds of previous 3 antidiagonals */
+} MATRIX_I16;
+
 /** 3-dimensional sparse float matrix */
 typedef struct {
   /* dimensions */
@@ -562,6 +616,44 @@ typedef struct {
   RANGE r_0; /* current edgebound iterator for retrieving next row range */
 } MATRIX_3D_SPARSE;
 
+/* backpointers for viterbi over a sparse matrix, for traceback without storing scores */
+typedef struct {
+  /* dimensions of embedding matrix */
+  int Q; /* length of query sequence */
+  int T; /* length of target hmm profile */
+  /* backpointers */
+  VECTOR_INT* bnd_offset; /* index of first cell of each edgebound in <cells> */
+  VECTOR_CHAR* cells;     /* normal state backpointers (VITERBI_PTR), packed two cells per byte */
+  VECTOR_CHAR* sp_ptr;    /* special state backpointers (VITERBI_PTR), per row */
+  VECTOR_INT* e_ptr;      /* target position of best predecessor of E state, per row */
+  /* working rows */
+  VECTOR_FLT* rows;      /* normal state scores of current and previous row */
+  VECTOR_INT* row_stamp; /* row which last set each position of <rows> */
+} VITERBI_PTRS;
+
+/* row-wise cloud of a single search, stored in cloud cache file for rescoring runs */
+typedef struct {
+  /* search */
+  int result_id; /* id of .m8 result which cloud belongs to */
+  int Q;         /* length of query sequence */
+  int T;         /* length of target hmm profile */
+  /* endpoints of seed alignment, as clipped to matrix by cloud search */
+  int q_beg; /* query start */
+  int t_beg; /* target start */
+  int q_end; /* query end */
+  int t_end; /* target end */
+  /* cloud search scores */
+  float lin_cloud_fwd;         /* max score of forward cloud search */
+  float lin_cloud_bck;         /* max score of backward cloud search */
+  float threshold_cloud_max;   /* max of forward and backward scores */
+  float threshold_cloud_compo; /* composite of forward and backward scores */
+  float cloud_natsc;           /* sum of forward and backward scores */
+  bool is_i16;                 /* whether float cloud search was pruned to cloud of int16 search */
+  /* cloud */
+  int N_bounds;      /* number of row-wise edgebounds */
+  VECTOR_CHAR* data; /* delta-encoded edgebounds */
+} CLOUD_CACHE;
+
 /* dynamic programming matrix for computing algs */
 typedef struct {
   /* dimensions */
@@ -626,6 +718,25 @@ typedef struct {
   RANGE q_range;    /* start-end range of queries in file (inclusive) */
   RANGE list_range; /* start-end range of hitlist */
 
+  /* --- SHARD PLANNING OPTIONS --- */
+  int plan_num_shards;       /* number of shards to split search into */
+  char* plan_calib_filein;   /* filepath to mytimeout report of previous run, for calibrating cost model */
+  char* plan_fileout;        /* filepath to output shard plan; if NULL, plan is output to stdout */
+  char* plan_idlist_fileout; /* prefix of id list files for each shard; if NULL, shards are ranges */
+
+  /* --- CLOUD CALIBRATION OPTIONS --- */
+  char* calib_labels_filein; /* filepath to labels of true homolog pairs; if NULL, widest cloud is taken as truth */
+  char* calib_fileout;       /* filepath to output calibration report; if NULL, report is output to stdout */
+  float calib_loss;          /* sensitivity loss allowed of fitted policy, relative to fixed x-drops */
+
+  /* --- QUERY DEDUPLICATION OPTIONS --- */
+  char* dedup_fileout;  /* filepath to output query file with only first copy of each distinct sequence */
+  char* dupmap_fileout; /* filepath to output map of removed duplicate queries to their canonical query */
+
+  /* --- PROFILE BUILDING OPTIONS --- */
+  char* hmm_fileout;  /* filepath to output .hmm file of profiles built from sequences or msas */
+  char* cons_fileout; /* filepath to output .fasta file of consensus sequences of profiles built from msas */
+
   /* --- DEBUG OPTIONS --- */
   bool is_use_local_tools; /* whether to system installed tools or local project tools */
   bool is_recycle_mx;      /* whether to recycle <fwd> and <bck> matrices for computing <post> and <optacc> */
@@ -686,8 +797,13 @@ typedef struct {
   float mmoreseqs_time;        /* time spent running mmoreseqs */
 
   /* --- OPTIONAL OUTPUT --- */
-  /* simple hitlist (input) */
-  char* hitlist_filein; /* filepath to simple hitlist */
+  /* simple hitlist, id list and binary results (input) */
+  char* hitlist_filein; /* filepath to binary hitlist (set when mmseqs results file is a hitlist) */
+  char* idlist_filein;  /* filepath to list of .m8 result ids to search (one per line) */
+  char* cloudin_filein; /* filepath to cloud cache of previous run, for rescoring without cloud search */
+  char* binout_filein;  /* filepath to binary results (binout), for converting to text reports */
+  char* dupmap_filein;  /* filepath to map of duplicate queries removed from query file, reported with their canonical query */
+  VECTOR_STR* shard_fileins; /* filepaths to binary results (binout) of shards, for merging */
 
   /* --- PREPARATION OUTPUT --- */
   /* root prep folder */
@@ -756,6 +872,15 @@ typedef struct {
   char* mytime_fileout;    /* mytime: tab-delimited table output of runtimes */
   bool is_mythreshout;     /* report mythreshout table? */
   char* mythresh_fileout;  /* mythresh: tab-delimited table output of threshold scores */
+  bool is_perfout;         /* report perfout table? */
+  char* perf_fileout;      /* perf: per-stage performance counters and histograms */
+  bool is_traceout;        /* report traceout? */
+  char* trace_fileout;     /* trace: per-hit JSONL trace of sizes, runtimes and filter outcomes */
+  bool is_binout;          /* report binout? */
+  char* binout_fileout;    /* bin: compact binary copy of results, rendered to text reports by convert */
+  bool is_cloudout;        /* write cloud cache? */
+  char* cloudout_fileout;  /* cloud: row-wise clouds of searches, reused by later runs with --cloudin */
+  int report_queue;        /* number of results queued for writer thread; 0 reports on search thread */
                            /* customized output */
   bool is_customout;       /* report custom table? */
   char* customout_fileout; /* customout: user-selected fields for tab-delimited table output */
@@ -764,9 +889,12 @@ typedef struct {
   /* --- TASK OPTIONS --- */
   bool is_run_prep;            /* Should run prep before main pipeline? */
   bool is_prep_copy;           /* Should prep folder make copies or soft link input files? */
+  bool is_prep_dedup;          /* Should prep folder remove duplicate query sequences? */
+  bool is_prep_native;         /* Should prep folder build profiles from msas natively (instead of hmmbuild)? */
   bool is_run_pruned;          /* should run pruned forward backward? */
   bool is_run_full;            /* should run full forward backward? */
   bool is_run_domains;         /* should run domain search? */
+  bool is_run_coalesce;        /* should search all mmseqs results for same target/query pair at once? */
   bool is_run_bias;            /* should composition bias filter be applied? */
   bool is_run_mmseqsaln;       /* perform mmseqs alignment? */
   bool is_run_vit;             /* compute viterbi matrix (DEBUG)? */
@@ -808,6 +936,14 @@ typedef struct {
   float beta;         /* cloud search: x-drop maximum drop before termination */
   int gamma;          /* cloud search: number of antidiag passes before pruning  */
   float hard_limit;   /* cloud search: hard floor for x-drop pruning  */
+  bool is_cloud_i16;  /* cloud search: use reduced-precision (int16) prefilter */
+  float cloud_i16_margin; /* cloud search: x-drop slack for reduced-precision prefilter */
+  int cloud_path_band;    /* cloud search: max distance from mmseqs cigar path to keep cells (negative to disable) */
+  bool is_cloud_adaptive;   /* cloud search: scale x-drops of each hit by its features */
+  float cloud_adapt_margin; /* cloud search: bitscore margin over reporting threshold of tightest pruning */
+  float cloud_adapt_min;    /* cloud search: x-drop scale of strong hits */
+  float cloud_adapt_max;    /* cloud search: x-drop scale of borderline hits */
+  float cloud_adapt_cover;  /* cloud search: extra x-drop scale for alignments covering little of query or target */
   float mmore_evalue; /* e-value mmore / fb-pruner */
   float mmore_pvalue; /* p-value mmore / fb-pruner */
 
@@ -1022,6 +1158,7 @@ typedef struct {
   char* name;    /* Name of HMM/FASTA in file */
   long offset;   /* Positional offset of HMM/FASTA into file */
   int mmseqs_id; /* id number, referencing mmseqs lookup file */
+  int length;    /* Length of HMM/FASTA (-1 if not known) */
 } F_INDEX_NODE;
 
 /* index for offset locations into a file, searchable by name or id */
@@ -1041,6 +1178,30 @@ typedef struct {
   int mmseqs_names; /* Whether index is using names from mmseqs lookup */
 } F_INDEX;
 
+/* duplicate query, removed from query file in favor of identical canonical query */
+typedef struct {
+  int id;           /* id number, determined by order in map file */
+  char* canon_name; /* name of canonical query (first copy of sequence, kept in query file) */
+  char* dup_name;   /* name of duplicate query (removed from query file) */
+} DUP_MAP_NODE;
+
+/* map of canonical queries to their removed duplicates, searchable by canonical name */
+typedef struct {
+  int N;               /* number of duplicate nodes used */
+  int Nalloc;          /* number of duplicate nodes allocated */
+  DUP_MAP_NODE* nodes; /* duplicates, in order of map file or sorted by canonical name */
+  char* source_path;   /* filepath of map file (NULL if not loaded) */
+  int sort_type;       /* whether nodes have been sorted by canonical name */
+} DUP_MAP;
+
+/* distinct sequence found while deduplicating query file */
+typedef struct {
+  uint64_t hash;   /* hash of digitized sequence */
+  size_t seq_beg;  /* offset of digitized sequence into sequence buffer */
+  int seq_len;     /* length of sequence */
+  size_t name_beg; /* offset of name into name buffer */
+} DEDUP_SEQ;
+
 /* descriptor for command line arguments */
 typedef struct {
   int N_opts; /* number of options */
@@ -1134,6 +1295,13 @@ typedef struct {
   int num_hits;
 } M8_RESULTS;
 
+/* m8 result with estimated search cost, for shard planning */
+typedef struct {
+  int result_id; /* id of result in mmseqs list */
+  int shard_id;  /* shard result is assigned to */
+  double cost;   /* estimated cost of search */
+} PLAN_HIT;
+
 /* hitlist entry */
 typedef struct {
   /* results id */
@@ -1160,15 +1328,34 @@ typedef struct {
   /* target/query name */
   STR target_name; /* target name */
   STR query_name;  /* query name */
+  /* target/query metadata */
+  STR target_acc;  /* target accession */
+  STR target_desc; /* target description */
+  STR query_acc;   /* query accession */
+  int target_len;  /* target length */
+  int query_len;   /* query length */
   /* target/query alignment ranges */
-  RANGE target_range; /* range of target in alignment */
-  RANGE query_range;  /* range of query in alignment */
+  RANGE target_range;  /* range of target in alignment */
+  RANGE query_range;   /* range of query in alignment */
+  RANGE target_bounds; /* target bounds of cloud search area */
+  RANGE query_bounds;  /* query bounds of cloud search area */
   /* alignment */
   ALIGNMENT* vit_trace;  /* viterbi alignment */
   ALIGNMENT* post_trace; /* posterior optimal accuracy alignment */
   /* scores */
   ALL_SCORES scores;   /* all possible scores produced by algorithms */
   SCORES final_scores; /* final scores for reporting */
+  /* domain summary */
+  int n_domains;        /* number of domains */
+  int dom_best;         /* index of highest scoring domain */
+  RANGE dom_best_range; /* query range of best domain */
+  float dom_best_sc;    /* corrected score of best domain */
+  float dom_best_presc; /* pre-score of best domain */
+  float dom_best_fwdsc; /* forward score of best domain */
+  float dom_best_bias;  /* compo bias of best domain */
+  float dom_sumsc;      /* all domains sumscore */
+  /* runtimes */
+  TIMES times; /* section runtimes */
   /* number of cells computed */
   int cpu_cloud_cells; /* number of times a cell in cloud edgebounds */
   int cloud_cells;     /* number of cells in cloud search matrix */
@@ -1185,6 +1372,7 @@ typedef struct {
   float threshold_cloud;     /* minimum required score to pass cloud threshold */
   float score_cloud;         /* score achieved by cloud */
   bool is_passed_cloud;      /* whether cloud score passed filter */
+  bool is_cloud_i16;         /* whether float cloud search was pruned to cloud of int16 search */
   float threshold_fwdback;   /* minimum required score to pass fwdback threshold */
   float score_fwdback;       /* score achieved by fwdback */
   bool is_passed_fwdback;    /* whether fwdback score passed filter */
@@ -1200,6 +1388,11 @@ typedef struct {
   size_t Nalloc;    /* allocated space in queue */
   RESULT* data;     /* result queue */
   int max_in_queue; /* number of results to keep in memory before dumping to file */
+  /* ring buffer queue, shared between search thread (producer) and writer thread (consumer) */
+  size_t head;          /* index of oldest result in queue */
+  bool is_closed;       /* producer has finished, no more results will be pushed */
+  pthread_mutex_t lock; /* guards <N>, <head> and <is_closed> */
+  pthread_cond_t cond;  /* signalled when queue gains a result, loses a result, or closes */
   /* aggregate data */
   int num_hits;
   int num_searches;
@@ -1214,6 +1407,38 @@ typedef struct {
   float* scores;  /* */
 } SCORE_MATRIX;
 
+/* builds HMM_PROFILE from single SEQUENCE or MSA (modeled after HMMER p7_SingleBuilder and p7_Builder) */
+typedef struct {
+  /* emission and transition probabilities */
+  SCORE_MATRIX* submat;             /* substitution matrix (BLOSUM62) */
+  double lambda;                    /* scale of <submat> given background frequencies */
+  float cond[NUM_AMINO][NUM_AMINO]; /* conditional match emission probabilities P(b|a) */
+  float popen;                      /* gap open probability */
+  float pextend;                    /* gap extend probability */
+  /* building from msa */
+  float symfrac;                    /* min weighted residue fraction for column to be match node */
+  float fragthresh;                 /* seqs spanning less than this fraction of alignment are fragments */
+  float ere;                        /* target mean match relative entropy per node (bits) */
+  float esigma;                     /* min total relative entropy of model (bits) */
+  float pseudo;                     /* weight of substitution matrix pseudocounts on match emissions */
+  float tprior[NUM_TRANS_STATES];   /* dirichlet prior on transitions of each node */
+  /* calibration of e-value distribution parameters (length and number of random sequences) */
+  int EmL, EmN;                     /* msv mu */
+  int EvL, EvN;                     /* viterbi mu */
+  int EfL, EfN;                     /* forward tau */
+  double Eft;                       /* tail mass of forward fit */
+  unsigned int seed;                /* random seed for calibration sequences (reset for each profile) */
+  HMM_PROFILE* cal_prof;            /* configured copy of profile being calibrated */
+  SEQUENCE* cal_seq;                /* random background sequence */
+  char* cal_text;                   /* text of <cal_seq> */
+  int cal_Nalloc;                   /* allocated length of <cal_text> */
+  double* cal_scores;               /* scores of random sequences */
+  float* msv_row;                   /* row of ungapped viterbi matrix */
+  int msv_Nalloc;                   /* allocated length of <msv_row> */
+  MATRIX_3D* st_MX3;                /* normal state matrix (linear space) */
+  MATRIX_2D* sp_MX;                 /* special state matrix */
+} SEQ_BUILDER;
+
 /* data struct for passing debugger data */
 typedef struct {
   /* debug options */
@@ -1280,8 +1505,39 @@ typedef struct {
   float beta;       /* x-drop for global score, determines when to terminate search. Looser than alpha. */
   int gamma;        /* number of traversed antidiags before pruning begins */
   float hard_limit; /* hard floor for any score in matrix */
+  bool is_i16;      /* run reduced-precision (int16) cloud search first, and prune float search to its cloud */
+  float i16_margin; /* extra x-drop slack for int16 search, so its cloud covers the float cloud */
+  int path_band;    /* if input alignment is a full path, prune cells farther than this from path (negative to disable) */
+  const EDGEBOUNDS* edg_lim; /* if not NULL, float search is pruned to cells of these antidiag-wise edgebounds (int16 cloud) */
 } CLOUD_PARAMS;
 
+/* policy for scaling cloud search x-drop parameters to each hit, by features known before cloud search */
+typedef struct {
+  bool is_adaptive; /* scale x-drops of each hit by policy, rather than using same x-drops for all */
+  float margin;     /* margin of mmseqs score over reporting threshold (in bits) at which pruning is tightest */
+  float scale_min;  /* x-drop scale of hits at or above <margin> */
+  float scale_max;  /* x-drop scale of hits at or below reporting threshold */
+  float cover;      /* extra x-drop scale of hits whose alignment covers none of the shorter of query and target */
+} CLOUD_POLICY;
+
+/* m8 result with cost and outcome of cloud search at each x-drop scale, for cloud calibration */
+typedef struct {
+  int result_id;                     /* id of m8 result */
+  bool is_true;                      /* whether result is a true homolog pair */
+  float margin;                      /* margin of mmseqs score over reporting threshold (in bits) */
+  float cover;                       /* coverage of shorter of query and target by mmseqs alignment */
+  double cells[NUM_CALIB_SCALES];    /* cells computed with x-drops at each scale */
+  bool is_found[NUM_CALIB_SCALES];   /* whether result passes reporting threshold with x-drops at each scale */
+} CALIB_HIT;
+
+/* total cost and outcome of cloud search policy over all calibration results */
+typedef struct {
+  CLOUD_POLICY policy; /* policy evaluated */
+  double cells;        /* total cells computed */
+  int N_found_true;    /* number of true results found */
+  int N_found_false;   /* number of false results found */
+} CALIB_POLICY;
+
 /* aggregate stats */
 typedef struct {
   /* database sizes */
@@ -1394,6 +1650,32 @@ typedef struct {
   float rt3; /* default region threshold */
 } DOMAIN_DEF;
 
+/* working data for linear memory optimal accuracy (see posterior_optacc_sparse.c) */
+typedef struct {
+  /* input data */
+  const HMM_PROFILE* target;     /* target hmm model */
+  EDGEBOUNDS* edg;               /* edgebounds (by row) */
+  MATRIX_3D_SPARSE* st_SMX_post; /* posterior normal matrix (normal space) */
+  int Q;                         /* query length */
+  int T;                         /* target length */
+  /* special state posterior sums */
+  int* row_idx;     /* index of first bound of each row in <edg> */
+  float* n_sum;     /* sum of N posterior over rows [1,q] */
+  float* j_sum;     /* sum of J posterior over rows [1,q] */
+  float* j_sum_rev; /* sum of J posterior over rows [q,Q] */
+  float* c_sum;     /* sum of C posterior over rows [q,Q] */
+  float* beg_sum;   /* sums before current core model alignment (<n_sum> or <j_sum>) */
+  float* end_sum;   /* sums after current core model alignment (<c_sum> or <j_sum_rev>) */
+  /* dp rows (previous/current), indexed by target position and -INF outside of cloud */
+  float* val[2][NUM_NORMAL_STATES];  /* optimal accuracy of best path to cell */
+  TRACE* orig[2][NUM_NORMAL_STATES]; /* cell where best path to cell crossed marked row (or began) */
+  /* traceback for subproblems solved directly */
+  char* tb;       /* predecessor codes */
+  size_t tb_size; /* allocated size of <tb> */
+  /* output data */
+  VECTOR_TRACE* path; /* core model path, in order */
+} OPTACC_WORK;
+
 /* tools for running script scripts */
 typedef struct {
   /* main script */
@@ -1409,13 +1691,65 @@ typedef struct {
   VECTOR_STR* command; /* stores final command to be passed to shell */
 } SCRIPTRUNNER;
 
+/* performance counters for a single pipeline stage */
+typedef struct {
+  size_t count;                    /* number of times stage was run */
+  double time;                     /* total wall time (in secs) */
+  double time_max;                 /* longest single run (in secs) */
+  size_t cells;                    /* total dp cells computed */
+  size_t bytes;                    /* total bytes requested from allocator */
+  size_t bytes_start;              /* allocator count at start of current run */
+  size_t time_hist[NUM_PERF_BINS]; /* histogram of run times (in microsecs) */
+  size_t rate_hist[NUM_PERF_BINS]; /* histogram of run throughput (in cells/microsec) */
+} PERF_STAGE_COUNTER;
+
+/* performance counters for all pipeline stages */
+typedef struct {
+  PERF_STAGE_COUNTER stages[NUM_PERF_STAGES]; /* counters by stage */
+} PERF_COUNTERS;
+
+/* function run by THREAD_POOL for each job in batch: <data> is shared by all jobs, <thread_id> selects thread-local data */
+typedef void (*THREAD_JOB)(void* data, int job_id, int thread_id);
+
+/* pool of threads which run batches of independent jobs */
+typedef struct {
+  int N_threads;            /* number of threads */
+  int N_started;            /* number of threads which have taken a thread id */
+  pthread_t* threads;       /* pool threads */
+  pthread_mutex_t lock;     /* guards all fields below */
+  pthread_cond_t cond_job;  /* signalled when batch is posted, or pool closes */
+  pthread_cond_t cond_done; /* signalled when last job of batch is finished */
+  THREAD_JOB job;           /* function run on each job of current batch */
+  void* data;               /* data shared by jobs of current batch */
+  int N_jobs;               /* number of jobs in current batch */
+  int next_job;             /* next job to be claimed by a thread */
+  int N_done;               /* number of finished jobs in current batch */
+  bool is_closed;           /* pool is closing, threads should exit */
+} THREAD_POOL;
+
 /* TODO: for multi-threading (stored in WORKER object) */
 typedef struct {
   /* --- thread identifier --- */
   int thread_id;
-
+  /* --- thread-local working data --- */
+  HMM_PROFILE* t_prof;    /* target hmm profile model data */
+  SEQ_BUILDER* t_builder; /* builds target profiles from sequences */
 } WORKER_THREAD;
 
+/* batch of sequences or msas built into profiles by threads, one job per sequence or msa */
+typedef struct {
+  int N;                  /* number of sequences or msas in batch */
+  int Nalloc;             /* allocated size of batch */
+  SEQUENCE** seqs;        /* input sequences (NULL if building from msas) */
+  MSA** msas;             /* input msas (NULL if building from sequences) */
+  char** texts;           /* output .hmm text of each profile */
+  size_t* text_lens;      /* length of each output text */
+  char** cons_texts;      /* output .fasta text of consensus of each profile (NULL if not output) */
+  size_t* cons_lens;      /* length of each consensus text */
+  int* prof_lens;         /* length of each profile */
+  WORKER_THREAD* threads; /* threads with thread-local builders */
+} BUILD_BATCH;
+
 /* worker contains the necessary data structures to conduct search */
 typedef struct {
   /* --- pipeline --- */
@@ -1442,6 +1776,7 @@ typedef struct {
   FILER* t_index_file; /* target index file */
   FILER* mmseqs_file;  /* mmseqs *.m8 format file */
   FILER* hitlist_file; /* hitlist csv file */
+  FILER* cloudin_file; /* cloud cache input file */
 
   /* --- output files --- */
   FILER* output_file;      /* standard output */
@@ -1452,6 +1787,12 @@ typedef struct {
   FILER* mytimeout_file;   /* Runtime summary output */
   FILER* mythreshout_file; /* Threshold passage output */
   FILER* hmmerout_file;    /* HMMER-style output */
+  FILER* perfout_file;     /* Per-stage performance counters output */
+  FILER* traceout_file;    /* Per-hit JSONL trace output */
+  FILER* binout_file;      /* Binary results output */
+  FILER* cloudout_file;    /* Cloud cache output */
+  /* buffered background writer for <traceout_file> */
+  ASYNC_WRITER* traceout_writer;
 
   /* --- input data --- */
   /* m8 results from mmseqs */
@@ -1460,6 +1801,8 @@ typedef struct {
   /* indexes of query and target data files */
   F_INDEX* q_index; /* file index of <q_file> */
   F_INDEX* t_index; /* file index of <t_file> */
+  /* duplicates removed from query file, reported with their canonical query */
+  DUP_MAP* q_dupmap;
 
   /* --- output data --- */
   /* aggregate statistics */
@@ -1467,33 +1810,45 @@ typedef struct {
   /* results to output (if we are going to output results in batches) */
   RESULTS* results; /* results array */
   RESULT* result;   /* current result */
+  /* writer thread which drains <results> queue to output files */
+  bool is_results_writer;   /* is writer thread running? */
+  pthread_t results_writer; /* writer thread */
   /* times for tasks */
   TIMES* times;        /* current result section runtimes */
   TIMES* times_totals; /* cumulative section runtimes */
+  /* performance counters by pipeline stage */
+  PERF_COUNTERS* perf;
   /* scores (moved to results) */
   // ALL_SCORES*          scores;        /* scores in NATS */
   // ALL_SCORES*          evals;         /* scores in evals */
 
   /* --- working data --- */
   /* current query and target data */
-  SEQUENCE* q_seq;     /* query sequence model data */
-  SEQUENCE* t_seq;     /* target sequence model data */
-  HMM_PROFILE* t_prof; /* target hmm profile model data */
-  HMM_BG* hmm_bg;      /* hmm background model */
+  SEQUENCE* q_seq;        /* query sequence model data */
+  SEQUENCE* t_seq;        /* target sequence model data */
+  HMM_PROFILE* t_prof;    /* target hmm profile model data */
+  HMM_BG* hmm_bg;         /* hmm background model */
+  SEQ_BUILDER* t_builder; /* builds target profile from target sequence */
   /* edgebounds for cloud search */
   EDGEBOUNDS* edg_fwd;          /* edgebounds for forward cloud search */
   EDGEBOUNDS* edg_bck;          /* edgebounds for backward cloud search */
   EDGEBOUNDS* edg_diag;         /* merged cloud search by antidiagonal */
   EDGEBOUNDS* edg_row;          /* merged cloud search by row */
   EDGEBOUND_ROWS* edg_rows_tmp; /* temporary edgebound row object; helper for reorientating */
+  VECTOR_PTR* edg_anchors;      /* merged cloud of each anchor (EDGEBOUNDS*), for union over all anchors */
   /* int vector for cloud search */
   VECTOR_INT* lb_vec[3]; /* left bounds for building cloud edgebounds */
   VECTOR_INT* rb_vec[3]; /* right bounds for building cloud edgebounds */
   /* cloud pruning parameters */
   CLOUD_PARAMS cloud_params; /* parameters for cloud search */
+  CLOUD_POLICY cloud_policy; /* policy for adapting cloud search parameters to each hit */
   /* alignment traceback for viterbi */
-  ALIGNMENT* trace_vit;  /* traceback for viterbi */
-  ALIGNMENT* trace_post; /* traceback for posterior */
+  ALIGNMENT* trace_vit;   /* traceback for viterbi */
+  ALIGNMENT* trace_post;  /* traceback for posterior */
+  VITERBI_PTRS* vit_ptrs; /* backpointers for sparse viterbi traceback */
+  MATRIX_I16* i16_MX;     /* work buffers for reduced-precision cloud search */
+  CLOUD_CACHE* cloudin_cache;  /* cloud cache record read ahead from <cloudin_file> */
+  CLOUD_CACHE* cloudout_cache; /* cloud cache record for writing to <cloudout_file> */
   /* dynamic programming matrices */
   /* quadratic space matrices */
   MATRIX_3D* st_MX;        /* normal state matrix (quadratic space) */
@@ -1530,6 +1885,7 @@ typedef struct {
   int mmseqs_id;         /* current mmseqs id (position in mmseqs loaded data) */
   M8_RESULT* mmseqs_cur; /* current mmseqs entry */
   M8_RESULT* mmseqs_prv; /* previous mmseqs entry */
+  bool is_mmseqs_stream; /* whether mmseqs .m8 is read from a pipe, as entries arrive */
   /* hitlist variables */
   int hitlist_id;              /* currently loaded hitlist entry from input hitlist results */
   HITLIST_RESULT* hitlist_cur; /* current hitlist entry */
@@ -1606,8 +1962,6 @@ extern double BG_MODEL[];
 extern double BG_MODEL_log[];
 /* commandline arg objects */
 extern char* DATATYPE_NAMES[];
-/* scoring matrix for converting sequences to hmm */
-extern SCORE_MATRIX* bld;
 
 /* root directory */
 extern char* ROOT_DIR;
@@ -118,9 +118,12 @@ typedef enum {
   PIPELINE_PREP,
   PIPELINE_PREP_SEARCH,
   PIPELINE_EASY_SEARCH,
-  PIPELINE_INDEX
+  PIPELINE_INDEX,
+  PIPELINE_CONVERT,
+  PIPELINE_MERGE,
+  PIPELINE_PLAN
 } PIPELINE_MODE;
-#define NUM_PIPELINE_MODES 11
+#define NUM_PIPELINE_MODES 10
 
 /* Verbosity Modes (how much output does user want) */
 typedef enum {
@@ -253,6 +256,23 @@ typedef enum {
 } SPECIAL_TRANS;
 #define NUM_SPECIAL_TRANS 2
 
+/* Viterbi Backpointers (see VITERBI_PTRS) */
+typedef enum {
+  /* normal state cell: match predecessor in low two bits, then insert and delete flags */
+  VPTR_M_FROM_M = 0, /* Match from Match */
+  VPTR_M_FROM_I = 1, /* Match from Insert */
+  VPTR_M_FROM_D = 2, /* Match from Delete */
+  VPTR_M_FROM_B = 3, /* Match from Begin */
+  VPTR_M_MASK = 3,
+  VPTR_I_FROM_I = 4, /* Insert from Insert (else from Match) */
+  VPTR_D_FROM_D = 8, /* Delete from Delete (else from Match) */
+  /* special states of row */
+  VPTR_C_FROM_E = 1, /* C from E (else from C) */
+  VPTR_J_FROM_E = 2, /* J from E (else from J) */
+  VPTR_B_FROM_J = 4, /* B from J (else from N) */
+  VPTR_E_FROM_D = 8, /* E from Delete (else from Match) */
+} VITERBI_PTR;
+
 /* Amino Acids */
 typedef enum {
   AMINO_A = 0,
@@ -324,4 +344,57 @@ typedef enum { VAL_USED_NONE,
                VAL_USED_EVAL } VAL_USED;
 #define NUM_VAL_USED 3
 
+/* pipeline stages tracked by performance counters */
+typedef enum {
+  PERF_VITERBI_LIN = 0,   /* viterbi (linear) */
+  PERF_VITERBI_SP = 1,    /* viterbi (sparse) */
+  PERF_CLOUD = 2,         /* cloud search fwd/bck */
+  PERF_BOUND_FWD_LIN = 3, /* bound forward (linear) */
+  PERF_BOUND_FWD_SP = 4,  /* bound forward (sparse) */
+  PERF_BOUND_BCK_LIN = 5, /* bound backward (linear) */
+  PERF_BOUND_BCK_SP = 6,  /* bound backward (sparse) */
+  PERF_POSTERIOR = 7,     /* posterior, decoding, and bias correction */
+  PERF_DOMAIN = 8,        /* per-domain loop */
+} PERF_STAGE;
+#define NUM_PERF_STAGES 9
+/* performance histograms use log2-scaled bins with <PERF_BINS_PER_OCTAVE> bins per power of 2.
+ * bin 0 starts at 2^(-PERF_BINS_OFFSET/PERF_BINS_PER_OCTAVE) */
+#define NUM_PERF_BINS 160
+#define PERF_BINS_PER_OCTAVE 4
+#define PERF_BINS_OFFSET 32
+
+/* shard planning cost model terms: cost = sum of coeff * term */
+typedef enum {
+  PLAN_FIXED = 0,  /* per-search overhead */
+  PLAN_LINEAR = 1, /* query + target length (loading, bias, per-row setup) */
+  PLAN_WINDOW = 2, /* query span * target span of mmseqs alignment (cloud search area) */
+  PLAN_FULL = 3,   /* query * target length (full matrix) */
+} PLAN_TERM;
+#define NUM_PLAN_TERMS 4
+
+/* cloud calibration: number of x-drop scales each search is run with */
+#define NUM_CALIB_SCALES 7
+
+/* binary results (binout) format */
+#define BINOUT_MAGIC "MMOREBIN"    /* file signature */
+#define BINOUT_MAGIC_LEN 8         /* length of file signature */
+#define BINOUT_VERSION 1           /* format version, bumped on any layout change */
+#define BINOUT_ENDIAN 0x01020304   /* written natively, to detect byte order on read */
+#define BINOUT_TAG_RESULT 'R'      /* tag preceding each result record */
+#define BINOUT_TAG_FOOTER 'F'      /* tag preceding footer */
+
+/* binary hitlist format (packed target/query id records, searched in place of .m8 results) */
+#define HITLIST_MAGIC "MMOREHIT"   /* file signature */
+#define HITLIST_MAGIC_LEN 8        /* length of file signature */
+#define HITLIST_VERSION 1          /* format version, bumped on any layout change */
+#define HITLIST_ENDIAN 0x01020304  /* written natively, to detect byte order on read */
+#define HITLIST_HAS_SCORE 0x1      /* flag: records have (eval, bitsc) floats */
+#define HITLIST_HAS_WINDOW 0x2     /* flag: records have (t_beg, t_end, q_beg, q_end) alignment window */
+
+/* cloud cache format (row-wise clouds of searches, reused by rescoring runs) */
+#define CLOUD_CACHE_MAGIC "MMORECLD"  /* file signature */
+#define CLOUD_CACHE_MAGIC_LEN 8       /* length of file signature */
+#define CLOUD_CACHE_VERSION 3         /* format version, bumped on any layout change */
+#define CLOUD_CACHE_ENDIAN 0x01020304 /* written natively, to detect byte order on read */
+
 #endif /* _STRUCTS_CONSTS_H */
@@ -94,9 +94,9 @@
 #define PRUNER_XDROP_EDGETRIM 1
 #define PRUNER_XDROP_BIFURCATE 2
 #define PRUNER_DBL_XDROP_EDGETRIM_OR_DIE 3
-/* if bifurcation is allowed, set max limit on forking paths */
-#ifndef MAX_BOUNDS_PER_ROW
-#define MAX_BOUNDS_PER_ROW 20
+/* initial number of bounds per row when building row-wise edgebounds (grows as needed for forking paths) */
+#ifndef INIT_BOUNDS_PER_ROW
+#define INIT_BOUNDS_PER_ROW 20
 #endif
 /* set default  of pruner method */
 /* PRUNER METHODS: PRUNER_DBL_XDROP_EDGETRIM_OR_DIE, PRUNER_XDROP_EDGETRIM  */
@@ -113,6 +113,53 @@
 #define CLOUD_METHOD CLOUD_DIAGS
 #endif
 
+/* reduced-precision cloud search: number of int16 units per nat */
+#ifndef CLOUD_I16_SCALE
+#define CLOUD_I16_SCALE 16.0f
+#endif
+/* reduced-precision cloud search: padding at end of each int16 row, so vector loads never leave buffer */
+#ifndef CLOUD_I16_PAD
+#define CLOUD_I16_PAD 10
+#endif
+
+/* initial size of each ASYNC_WRITER buffer */
+#ifndef ASYNC_WRITER_BUFSIZE
+#define ASYNC_WRITER_BUFSIZE (1 << 16)
+#endif
+
+/* default number of results queued for report writer thread */
+#ifndef REPORT_QUEUE_SIZE
+#define REPORT_QUEUE_SIZE 64
+#endif
+
+/* stdio buffer size for report output files */
+#ifndef REPORT_FILE_BUFSIZE
+#define REPORT_FILE_BUFSIZE (1 << 20)
+#endif
+
+/* default shard planning cost model coefficients (used when not calibrated), in units of dp cells */
+#ifndef PLAN_COST_FIXED
+#define PLAN_COST_FIXED 1000.0
+#endif
+#ifndef PLAN_COST_LINEAR
+#define PLAN_COST_LINEAR 10.0
+#endif
+#ifndef PLAN_COST_WINDOW
+#define PLAN_COST_WINDOW 1.0
+#endif
+#ifndef PLAN_COST_FULL
+#define PLAN_COST_FULL 0.0
+#endif
+
+/* optimal accuracy: max cells in a subproblem solved directly (with traceback) rather than split again */
+#ifndef OPTACC_BLOCK_CELLS
+#define OPTACC_BLOCK_CELLS (1 << 16)
+#endif
+
+/* viterbi backpointers: packed four bits per cell, two cells per byte */
+#define VPTR_GET(ptrs, i) ((((unsigned char*)(ptrs))[(i) >> 1] >> (((i)&1) << 2)) & 0xF)
+#define VPTR_SET(ptrs, i, code) (((unsigned char*)(ptrs))[(i) >> 1] |= (unsigned char)((code) << (((i)&1) << 2)))
+
 /* types of simd vectorization method */
 #define SIMD_NONE 0
 #define SIMD_SSE 1
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ *  - FILE:  thread_pool.c
+ *  - DESC:  THREAD_POOL Class. Fixed set of threads which run batches of independent jobs.
+ *  NOTES:
+ *    - Caller posts a batch and waits for it to finish, so work can be staged on the caller's
+ *      thread (e.g. parsing input) between batches while threads stay alive.
+ *    - Only one caller thread should post batches to a given THREAD_POOL.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+
+/* local imports */
+#include "structs.h"
+#include "../utilities/_utilities.h"
+
+/* header */
+#include "_objects.h"
+#include "thread_pool.h"
+
+/* private functions */
+static void*
+THREAD_POOL_Thread(void* arg);
+
+/*!  FUNCTION:  THREAD_POOL_Create()
+ *   SYNOPSIS:  Create <pool> of <N_threads> threads, and start them waiting for jobs.
+ *              If <N_threads> is 1, no threads are started and jobs are run by the caller.
+ */
+THREAD_POOL*
+THREAD_POOL_Create(int N_threads) {
+  THREAD_POOL* pool;
+  pool = ERROR_malloc(sizeof(THREAD_POOL));
+
+  pool->N_threads = MAX(N_threads, 1);
+  pool->N_started = 0;
+  pool->threads = NULL;
+  pool->job = NULL;
+  pool->data = NULL;
+  pool->N_jobs = 0;
+  pool->next_job = 0;
+  pool->N_done = 0;
+  pool->is_closed = false;
+
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->cond_job, NULL);
+  pthread_cond_init(&pool->cond_done, NULL);
+
+  if (pool->N_threads > 1) {
+    pool->threads = ERROR_malloc(sizeof(pthread_t) * pool->N_threads);
+    for (int i = 0; i < pool->N_threads; i++) {
+      if (pthread_create(&pool->threads[i], NULL, THREAD_POOL_Thread, pool) != 0) {
+        fprintf(stderr, "ERROR: Unable to start thread pool thread.\n");
+        ERRORCHECK_exit(EXIT_FAILURE);
+      }
+    }
+  }
+
+  return pool;
+}
+
+/*!  FUNCTION:  THREAD_POOL_Destroy()
+ *   SYNOPSIS:  Stop and join all threads, free memory and return NULL pointer.
+ */
+THREAD_POOL*
+THREAD_POOL_Destroy(THREAD_POOL* pool) {
+  if (pool == NULL) {
+    return pool;
+  }
+
+  if (pool->threads != NULL) {
+    pthread_mutex_lock(&pool->lock);
+    pool->is_closed = true;
+    pthread_cond_broadcast(&pool->cond_job);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->N_threads; i++) {
+      pthread_join(pool->threads[i], NULL);
+    }
+    pool->threads = ERROR_free(pool->threads);
+  }
+
+  pthread_mutex_destroy(&pool->lock);
+  pthread_cond_destroy(&pool->cond_job);
+  pthread_cond_destroy(&pool->cond_done);
+
+  pool = ERROR_free(pool);
+  return pool;
+}
+
+/*!  FUNCTION:  THREAD_POOL_Run()
+ *   SYNOPSIS:  Run <job> on each job id in [0,<N_jobs>), sharing <data>, and wait until all are finished.
+ *              Jobs are claimed by threads in order of job id, but may finish in any order.
+ *              Each job is passed the id of its thread in [0,<N_threads>), for thread-local data.
+ */
+void THREAD_POOL_Run(THREAD_POOL* pool,
+                     THREAD_JOB job,
+                     void* data,
+                     int N_jobs) {
+  /* single thread: run jobs in caller */
+  if (pool->threads == NULL) {
+    for (int i = 0; i < N_jobs; i++) {
+      job(data, i, 0);
+    }
+    return;
+  }
+
+  pthread_mutex_lock(&pool->lock);
+  pool->job = job;
+  pool->data = data;
+  pool->N_jobs = N_jobs;
+  pool->next_job = 0;
+  pool->N_done = 0;
+  pthread_cond_broadcast(&pool->cond_job);
+
+  while (pool->N_done < pool->N_jobs) {
+    pthread_cond_wait(&pool->cond_done, &pool->lock);
+  }
+  /* empty batch, so threads wait for the next one */
+  pool->N_jobs = 0;
+  pool->next_job = 0;
+  pthread_mutex_unlock(&pool->lock);
+}
+
+/*!  FUNCTION:  THREAD_POOL_Thread()
+ *   SYNOPSIS:  Pool thread: take thread id, then claim and run jobs until pool is closed.
+ */
+static void*
+THREAD_POOL_Thread(void* arg) {
+  THREAD_POOL* pool = (THREAD_POOL*)arg;
+  THREAD_JOB job;
+  void* data;
+  int job_id;
+  int thread_id;
+
+  pthread_mutex_lock(&pool->lock);
+  thread_id = pool->N_started++;
+  while (true) {
+    while (pool->is_closed == false && pool->next_job >= pool->N_jobs) {
+      pthread_cond_wait(&pool->cond_job, &pool->lock);
+    }
+    if (pool->is_closed == true) {
+      break;
+    }
+    job = pool->job;
+    data = pool->data;
+    job_id = pool->next_job++;
+    pthread_mutex_unlock(&pool->lock);
+
+    job(data, job_id, thread_id);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->N_done++;
+    if (pool->N_done == pool->N_jobs) {
+      pthread_cond_signal(&pool->cond_done);
+    }
+  }
+  pthread_mutex_unlock(&pool->lock);
+
+  return NULL;
+}
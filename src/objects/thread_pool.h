@@ -0,0 +1,27 @@
+/*******************************************************************************
+ *  - FILE:  thread_pool.h
+ *  - DESC:  THREAD_POOL Class. Fixed set of threads which run batches of independent jobs.
+ *******************************************************************************/
+
+#ifndef _THREAD_POOL_H
+#define _THREAD_POOL_H
+
+/*!  FUNCTION:  THREAD_POOL_Create()
+ *   SYNOPSIS:  Create <pool> of <N_threads> threads, and start them waiting for jobs.
+ *              If <N_threads> is 1, no threads are started and jobs are run by the caller.
+ */
+THREAD_POOL* THREAD_POOL_Create(int N_threads);
+
+/*!  FUNCTION:  THREAD_POOL_Destroy()
+ *   SYNOPSIS:  Stop and join all threads, free memory and return NULL pointer.
+ */
+THREAD_POOL* THREAD_POOL_Destroy(THREAD_POOL* pool);
+
+/*!  FUNCTION:  THREAD_POOL_Run()
+ *   SYNOPSIS:  Run <job> on each job id in [0,<N_jobs>), sharing <data>, and wait until all are finished.
+ *              Jobs are claimed by threads in order of job id, but may finish in any order.
+ *              Each job is passed the id of its thread in [0,<N_threads>), for thread-local data.
+ */
+void THREAD_POOL_Run(THREAD_POOL* pool, THREAD_JOB job, void* data, int N_jobs);
+
+#endif /* _THREAD_POOL_H */
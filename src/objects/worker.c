@@ -58,6 +58,7 @@ WORKER_Create() {
   worker->t_index_file = NULL;
   worker->mmseqs_file = NULL;
   worker->hitlist_file = NULL;
+  worker->cloudin_file = NULL;
 
   /* --- output files --- */
   worker->output_file = NULL;
@@ -67,6 +68,11 @@ WORKER_Create() {
   worker->mytimeout_file = NULL;
   worker->mythreshout_file = NULL;
   worker->hmmerout_file = NULL;
+  worker->perfout_file = NULL;
+  worker->traceout_file = NULL;
+  worker->traceout_writer = NULL;
+  worker->binout_file = NULL;
+  worker->cloudout_file = NULL;
 
   /* --- input data --- */
   /* m8 results from mmseqs */
@@ -75,6 +81,7 @@ WORKER_Create() {
   /* indexes of query and target data files */
   worker->q_index = NULL;
   worker->t_index = NULL;
+  worker->q_dupmap = NULL;
 
   /* --- output data --- */
   /* stats */
@@ -82,9 +89,11 @@ WORKER_Create() {
   /* results */
   worker->results = NULL;
   worker->result = NULL;
+  worker->is_results_writer = false;
   /* times */
   worker->times = NULL;
   worker->times_totals = NULL;
+  worker->perf = NULL;
   /* scores */
   // worker->scores          = NULL;
   // worker->evals           = NULL;
@@ -95,12 +104,14 @@ WORKER_Create() {
   worker->t_seq = NULL;
   worker->t_prof = NULL;
   worker->hmm_bg = NULL;
+  worker->t_builder = NULL;
   /* edgebounds for cloud search */
   worker->edg_fwd = NULL;
   worker->edg_bck = NULL;
   worker->edg_diag = NULL;
   worker->edg_row = NULL;
   worker->edg_rows_tmp = NULL;
+  worker->edg_anchors = NULL;
   /* left and right bound vectors for cloud search */
   for (int i = 0; i < 3; i++) {
     worker->lb_vec[i] = NULL;
@@ -108,9 +119,14 @@ WORKER_Create() {
   }
   /* cloud pruning parameters */
   worker->cloud_params = (CLOUD_PARAMS){-1, -1};
+  worker->cloud_policy = (CLOUD_POLICY){false};
   /* tracebacks */
   worker->trace_vit = NULL;
   worker->trace_post = NULL;
+  worker->vit_ptrs = NULL;
+  worker->i16_MX = NULL;
+  worker->cloudin_cache = NULL;
+  worker->cloudout_cache = NULL;
   /* quadratic space dp matrices */
   worker->st_MX = NULL;
   worker->st_MX_fwd = NULL;
@@ -146,6 +162,7 @@ WORKER_Create() {
   worker->mmseqs_id = -1;
   worker->mmseqs_cur = NULL;
   worker->mmseqs_prv = NULL;
+  worker->is_mmseqs_stream = false;
   /* hitlist variables */
   worker->hitlist_id = -1;
   worker->hitlist_cur = NULL;
@@ -185,6 +202,7 @@ WORKER_Init(WORKER* worker) {
   worker->tasks = ERROR_malloc(sizeof(TASKS));
   worker->times = ERROR_malloc(sizeof(TIMES));
   worker->times_totals = ERROR_malloc(sizeof(TIMES));
+  worker->perf = PERF_COUNTERS_Create();
   // worker->scores          = ERROR_malloc( sizeof(ALL_SCORES) );
   /* initialize all values to zero */
   memset(worker->stats, 0, sizeof(STATS));
@@ -210,12 +228,21 @@ WORKER_Create_with_Args(ARGS* args) {
  *  SYNOPSIS:  Creates {N_threads} WORKER_THREAD objects for {worker}.
  *             Stored in {worker->theads}.
  *             Exact number of threads are allocated (should not change during program lifetime).
+ *             Thread-local working data is left NULL, to be created by pipelines which use it.
  */
 void WORKER_Create_Threads(WORKER* worker,
                            int N_threads) {
-  WORKER_THREAD* threads;
-  threads = worker->threads;
-  threads = ERROR_realloc(threads, sizeof(WORKER_THREAD) * N_threads);
+  WORKER_THREAD* thread;
+
+  worker->threads = ERROR_realloc(worker->threads, sizeof(WORKER_THREAD) * N_threads);
+  for (int i = worker->Nalloc_threads; i < N_threads; i++) {
+    thread = &worker->threads[i];
+    thread->thread_id = i;
+    thread->t_prof = NULL;
+    thread->t_builder = NULL;
+  }
+  worker->N_threads = N_threads;
+  worker->Nalloc_threads = N_threads;
 }
 
 /*! FUNCTION:  WORKER_Destroy()
@@ -237,8 +264,15 @@ WORKER_Destroy(WORKER* worker) {
   worker->stats = ERROR_free(worker->stats);
   worker->times = ERROR_free(worker->times);
   worker->times_totals = ERROR_free(worker->times_totals);
+  worker->perf = PERF_COUNTERS_Destroy(worker->perf);
   // worker->scores          = ERROR_free( worker->scores );
 
+  for (int i = 0; i < worker->Nalloc_threads; i++) {
+    worker->threads[i].t_prof = HMM_PROFILE_Destroy(worker->threads[i].t_prof);
+    worker->threads[i].t_builder = SEQ_BUILDER_Destroy(worker->threads[i].t_builder);
+  }
+  worker->threads = ERROR_free(worker->threads);
+
   worker = ERROR_free(worker);
 
   return worker;
@@ -25,12 +25,20 @@ WORKER_THREAD_Create() {
   WORKER_THREAD* worker = NULL;
 
   worker = (WORKER_THREAD*)ERROR_malloc(sizeof(WORKER_THREAD));
+  worker->thread_id = 0;
+  worker->t_prof = NULL;
+  worker->t_builder = NULL;
 
   return worker;
 }
 
 /* destructor */
 void* WORKER_THREAD_Destroy(WORKER_THREAD* worker) {
+  if (worker == NULL) {
+    return NULL;
+  }
+  worker->t_prof = HMM_PROFILE_Destroy(worker->t_prof);
+  worker->t_builder = SEQ_BUILDER_Destroy(worker->t_builder);
   ERROR_free(worker);
   return NULL;
 }
@@ -7,10 +7,15 @@
 #define _PARSERS_H
 
 #include "arg_parser.h"
+#include "binout_parser.h"
+#include "dupmap_parser.h"
+#include "hitlist_parser.h"
 #include "hmm_parser.h"
 #include "index_parser.h"
 #include "m8_parser.h"
 #include "seq_parser.h"
+#include "msa_parser.h"
+#include "msa_to_profile.h"
 #include "seq_to_profile.h"
 
 #endif /* _PARSERS_H */
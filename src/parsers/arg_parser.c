@@ -83,6 +83,8 @@ void ARGS_SetDefaults(ARGS* args) {
   /* files/folders */
   args->is_run_prep = true;
   args->is_prep_copy = true;
+  args->is_prep_dedup = false;
+  args->is_prep_native = false;
   args->prep_folderpath = NULL;
   args->target_prep = NULL;
   args->query_prep = NULL;
@@ -96,6 +98,7 @@ void ARGS_SetDefaults(ARGS* args) {
   args->is_run_pruned = true;
   args->is_run_full = false; /* DEBUG */
   args->is_run_domains = true;
+  args->is_run_coalesce = true;
   args->is_run_mmseqsaln = false;
   args->is_run_vit_mmore = false; 
   args->is_run_vit = false;  
@@ -170,6 +173,15 @@ void ARGS_SetDefaults(ARGS* args) {
   args->mytime_fileout = STR_Create("mmore.results.mytimeout");
   args->is_mythreshout = false;
   args->mythresh_fileout = STR_Create("mmore.results.mythreshout");
+  args->is_perfout = false;
+  args->perf_fileout = STR_Create("mmore.results.perfout");
+  args->is_traceout = false;
+  args->trace_fileout = STR_Create("mmore.results.traceout.jsonl");
+  args->is_binout = false;
+  args->binout_fileout = STR_Create("mmore.results.bin");
+  args->is_cloudout = false;
+  args->cloudout_fileout = STR_Create("mmore.clouds.bin");
+  args->report_queue = REPORT_QUEUE_SIZE;
   // args->is_customout = false;
   // args->customout_fileout = STR_Create("results.customout");
 
@@ -179,11 +191,38 @@ void ARGS_SetDefaults(ARGS* args) {
   // args->use_range = false;
   args->list_range = (RANGE){-1, -1};
 
+  /* --- SHARD PLANNING OPTIONS --- */
+  args->plan_num_shards = 1;
+  args->plan_calib_filein = NULL;
+  args->plan_fileout = NULL;
+  args->plan_idlist_fileout = NULL;
+
+  /* --- CLOUD CALIBRATION OPTIONS --- */
+  args->calib_labels_filein = NULL;
+  args->calib_fileout = NULL;
+  args->calib_loss = 0.0f;
+
+  /* --- QUERY DEDUPLICATION OPTIONS --- */
+  args->dedup_fileout = NULL;
+  args->dupmap_fileout = NULL;
+
+  /* --- PROFILE BUILDING OPTIONS --- */
+  args->hmm_fileout = NULL;
+  args->cons_fileout = NULL;
+
   /* --- MMORE / FB-PRUNER --- */
   args->alpha = 12.0f;
   args->beta = 16.0f;
   args->gamma = 5;
   args->hard_limit = -12.0f;
+  args->is_cloud_i16 = false;
+  args->cloud_i16_margin = 6.0f;
+  args->cloud_path_band = -1;
+  args->is_cloud_adaptive = false;
+  args->cloud_adapt_margin = 20.0f;
+  args->cloud_adapt_min = 0.5f;
+  args->cloud_adapt_max = 1.5f;
+  args->cloud_adapt_cover = 0.0f;
   args->mmore_evalue = 2e2f;
   args->mmore_pvalue = 1e-3f;
 
@@ -255,6 +294,11 @@ void ARGS_Dump(ARGS* args,
   fprintf(fp, "# %*s:\t%s\n", align * pad, "T_INDEX_PATH", args->t_index_filein);
   fprintf(fp, "# %*s:\t%s\n", align * pad, "Q_INDEX_PATH", args->q_index_filein);
   fprintf(fp, "# %*s:\t%s\n", align * pad, "MMSEQS_M8", args->mmseqs_m8_filein);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "IDLIST_IN", args->idlist_filein);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "CLOUDIN_IN", args->cloudin_filein);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "DUPMAP_IN", args->dupmap_filein);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "BINOUT_IN", args->binout_filein);
+  fprintf(fp, "# %*s:\t%zu\n", align * pad, "SHARDS_IN", (args->shard_fileins != NULL ? args->shard_fileins->N : 0));
   fprintf(fp, "# %*s:\t%s\n", align * pad, "TMP_FOLDER", args->tmp_folderpath);
   fprintf(fp, "# %*s:\t%s\n", align * pad, "PREP_FOLDER", args->prep_folderpath);
   fprintf(fp, "# \n");
@@ -274,15 +318,31 @@ void ARGS_Dump(ARGS* args,
   fprintf(fp, "# %*s:\t%.2f\n", align * pad, "MMORE_BETA", args->beta);
   fprintf(fp, "# %*s:\t%d\n", align * pad, "MMORE_GAMMA", args->gamma);
   fprintf(fp, "# %*s:\t%.2f\n", align * pad, "MMORE_HARD_LIMIT", args->hard_limit);
+  fprintf(fp, "# %*s:\t%.2f [%d]\n", align * pad, "MMORE_CLOUD_I16_MARGIN", args->cloud_i16_margin, args->is_cloud_i16);
+  fprintf(fp, "# %*s:\t%d\n", align * pad, "MMORE_CLOUD_PATH_BAND", args->cloud_path_band);
+  fprintf(fp, "# %*s:\t%.2f %.2f %.2f %.2f [%d]\n", align * pad, "MMORE_CLOUD_ADAPTIVE",
+          args->cloud_adapt_margin, args->cloud_adapt_min, args->cloud_adapt_max, args->cloud_adapt_cover, args->is_cloud_adaptive);
   fprintf(fp, "# %*s:\t%.2e [%d]\n", align * pad, "MMORE_VITERBI_PVAL", args->threshold_vit, args->is_run_viterbi_filter);
   fprintf(fp, "# %*s:\t%.2e [%d]\n", align * pad, "MMORE_CLOUD_PVAL", args->threshold_cloud, args->is_run_cloud_filter);
   fprintf(fp, "# %*s:\t%.2e [%d]\n", align * pad, "MMORE_BOUNDFWD_PVAL", args->threshold_boundfwd, args->is_run_boundfwd_filter);
   fprintf(fp, "# %*s:\t%.2e [%d]\n", align * pad, "MMORE_REPORT_EVAL", args->threshold_report_eval, args->is_run_report_filter);
 
   fprintf(fp, "# %*s:\t(%d,%d)\n", align * pad, "MMORE_RANGE", args->list_range.beg, args->list_range.end);
+  fprintf(fp, "# %*s:\t%d\n", align * pad, "PLAN_SHARDS", args->plan_num_shards);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "PLAN_CALIBRATE", args->plan_calib_filein);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "PLAN_FILEPATH", args->plan_fileout);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "PLAN_IDLIST", args->plan_idlist_fileout);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "CALIB_LABELS", args->calib_labels_filein);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "CALIB_FILEPATH", args->calib_fileout);
+  fprintf(fp, "# %*s:\t%.3f\n", align * pad, "CALIB_LOSS", args->calib_loss);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "DEDUP_FILEPATH", args->dedup_fileout);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "DUPMAP_FILEPATH", args->dupmap_fileout);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "HMM_FILEPATH", args->hmm_fileout);
+  fprintf(fp, "# %*s:\t%s\n", align * pad, "CONSENSUS_FILEPATH", args->cons_fileout);
   fprintf(fp, "# %*s:\t[%d]\n", align * pad, "MMORE_FULL", args->is_run_full);
   fprintf(fp, "# %*s:\t[%d]\n", align * pad, "MMORE_VIT_MMORE", args->is_run_vit_mmore);
   fprintf(fp, "# %*s:\t[%d]\n", align * pad, "MMORE_DOMAINS", args->is_run_domains);
+  fprintf(fp, "# %*s:\t[%d]\n", align * pad, "MMORE_COALESCE", args->is_run_coalesce);
   fprintf(fp, "# %*s:\t[%d] [%d]\n", align * pad, "MMORE_VITALN", args->is_run_vitaln, args->is_run_vit);
   fprintf(fp, "# %*s:\t[%d] [%d]\n", align * pad, "MMORE_POSTALN", args->is_run_postaln, args->is_run_optacc);
   fprintf(fp, "# \n");
@@ -295,6 +355,11 @@ void ARGS_Dump(ARGS* args,
   fprintf(fp, "# %*s:\t%s [%d]\n", align * pad, "MYDOMOUT_FILEPATH", args->mydom_fileout, args->is_mydom);
   fprintf(fp, "# %*s:\t%s [%d]\n", align * pad, "MYTHRESHOUT_FILEPATH", args->mythresh_fileout, args->is_mythreshout);
   fprintf(fp, "# %*s:\t%s [%d]\n", align * pad, "MYTIMEOUT_FILEPATH", args->mytime_fileout, args->is_mytimeout);
+  fprintf(fp, "# %*s:\t%s [%d]\n", align * pad, "PERFOUT_FILEPATH", args->perf_fileout, args->is_perfout);
+  fprintf(fp, "# %*s:\t%s [%d]\n", align * pad, "TRACEOUT_FILEPATH", args->trace_fileout, args->is_traceout);
+  fprintf(fp, "# %*s:\t%s [%d]\n", align * pad, "BINOUT_FILEPATH", args->binout_fileout, args->is_binout);
+  fprintf(fp, "# %*s:\t%s [%d]\n", align * pad, "CLOUDOUT_FILEPATH", args->cloudout_fileout, args->is_cloudout);
+  fprintf(fp, "# %*s:\t%d\n", align * pad, "REPORT_QUEUE", args->report_queue);
   fprintf(fp, "# ==============================================\n\n");
 }
 
@@ -443,7 +508,7 @@ STATUS_FLAG ARGS_ParseCommand(ARGS* args,
 
   /* first argument is command pipeline */
   bool found_pipeline = false;
-  for (int i = 0; i < NUM_PIPELINE_MODES; i++) {
+  for (int i = 0; i < NUM_PIPELINES; i++) {
     PIPELINE* pipeline = &PIPELINES[i];
     if (STR_Compare(argv[1], pipeline->name) == 0) {
       args->pipeline_mode = i;
@@ -454,7 +519,7 @@ STATUS_FLAG ARGS_ParseCommand(ARGS* args,
   }
 
   /* check that valid pipeline mode was entered */
-  if (found_pipeline == false || (args->pipeline_mode < 0) || (args->pipeline_mode >= NUM_PIPELINE_MODES)) {
+  if (found_pipeline == false || (args->pipeline_mode < 0) || (args->pipeline_mode >= NUM_PIPELINES)) {
     fprintf(stderr, "ERROR: Invalid pipeline/command was given: %s.\n", argv[1]);
     ARGS_CommandHelpInfo(args);
     ERRORCHECK_exit(EXIT_FAILURE);
@@ -550,6 +615,65 @@ STATUS_FLAG ARGS_ParseCommand(ARGS* args,
     args->t_index_filein = STR_Set(args->t_index_filein, argv[4]);
     args->q_index_filein = STR_Set(args->q_index_filein, argv[5]);
   }
+  elif (STR_Equals(args->pipeline_name, "convert")) {
+    args->binout_filein = STR_Set(args->binout_filein, argv[2]);
+  }
+  elif (STR_Equals(args->pipeline_name, "plan")) {
+    args->t_filein = STR_Set(args->t_filein, argv[2]);
+    args->q_filein = STR_Set(args->q_filein, argv[3]);
+    args->mmseqs_m8_filein = STR_Set(args->mmseqs_m8_filein, argv[4]);
+    args->plan_num_shards = atoi(argv[5]);
+
+    args->t_filetype = FILE_HMM;
+    args->q_filetype = FILE_FASTA;
+
+    if (args->plan_num_shards < 1) {
+      fprintf(stderr, "ERROR: Number of shards must be at least 1 (given: '%s').\n", argv[5]);
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+  }
+  elif (STR_Equals(args->pipeline_name, "cloud-calibrate")) {
+    args->t_filein = STR_Set(args->t_filein, argv[2]);
+    args->q_filein = STR_Set(args->q_filein, argv[3]);
+    args->t_mmore_filein = STR_Set(args->t_mmore_filein, argv[2]);
+    args->q_mmore_filein = STR_Set(args->q_mmore_filein, argv[3]);
+    args->mmseqs_m8_filein = STR_Set(args->mmseqs_m8_filein, argv[4]);
+
+    args->t_filetype = FILE_HMM;
+    args->q_filetype = FILE_FASTA;
+  }
+  elif (STR_Equals(args->pipeline_name, "dedup")) {
+    args->q_filein = STR_Set(args->q_filein, argv[2]);
+    args->dedup_fileout = STR_Set(args->dedup_fileout, argv[3]);
+    args->dupmap_fileout = STR_Set(args->dupmap_fileout, argv[4]);
+
+    args->q_filetype = FILE_FASTA;
+  }
+  elif (STR_Equals(args->pipeline_name, "fasta-to-hmm")) {
+    args->t_filein = STR_Set(args->t_filein, argv[2]);
+    args->hmm_fileout = STR_Set(args->hmm_fileout, argv[3]);
+
+    args->t_filetype = FILE_FASTA;
+  }
+  elif (STR_Equals(args->pipeline_name, "msa-to-hmm")) {
+    args->t_filein = STR_Set(args->t_filein, argv[2]);
+    args->hmm_fileout = STR_Set(args->hmm_fileout, argv[3]);
+    args->cons_fileout = STR_Set(args->cons_fileout, argv[4]);
+
+    args->t_filetype = FILE_MSA;
+  }
+  elif (STR_Equals(args->pipeline_name, "merge")) {
+    /* takes any number of shards, up to first option */
+    if (args->shard_fileins == NULL) {
+      args->shard_fileins = VECTOR_STR_Create();
+    }
+    for (num_main_args = 0; 2 + num_main_args < argc; num_main_args++) {
+      if (STR_ComparePrefix(argv[2 + num_main_args], "--", 2) == 0) {
+        break;
+      }
+      VECTOR_STR_Pushback(args->shard_fileins, argv[2 + num_main_args]);
+    }
+  }
   else {
     fprintf(stderr, "ERROR: Command '%s' is currently not supported.\n", args->pipeline_name);
     ERRORCHECK_exit(EXIT_FAILURE);
@@ -916,6 +1040,26 @@ STATUS_FLAG ARGS_ParseOptions(ARGS* args,
           ERRORCHECK_exit(EXIT_FAILURE);
         }
       }
+      elif (STR_Equals(argv[i], (flag = "--prep-dedup"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->is_prep_dedup = atoi(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--prep-native"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->is_prep_native = atoi(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
       elif (STR_Equals(argv[i], (flag = "--prep-link-target-mmore"))) {
         req_args = 1;
         if (i + req_args < argc) {
@@ -1010,6 +1154,86 @@ STATUS_FLAG ARGS_ParseOptions(ARGS* args,
           ERRORCHECK_exit(EXIT_FAILURE);
         }
       }
+      elif (STR_Equals(argv[i], (flag = "--cloud-i16"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->is_cloud_i16 = atoi(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--cloud-i16-margin"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->cloud_i16_margin = atof(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--cloud-path-band"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->cloud_path_band = atoi(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--cloud-adaptive"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->is_cloud_adaptive = atoi(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--cloud-adapt-margin"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->cloud_adapt_margin = atof(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--cloud-adapt-min"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->cloud_adapt_min = atof(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--cloud-adapt-max"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->cloud_adapt_max = atof(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--cloud-adapt-cover"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->cloud_adapt_cover = atof(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
       /* ==== MMORE OPTIONS === */
       elif (STR_Equals(argv[i], (flag = "--run-prep"))) {
         req_args = 1;
@@ -1051,6 +1275,16 @@ STATUS_FLAG ARGS_ParseOptions(ARGS* args,
           ERRORCHECK_exit(EXIT_FAILURE);
         }
       }
+      elif (STR_Equals(argv[i], (flag = "--run-coalesce"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->is_run_coalesce = atoi(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
       elif (STR_Equals(argv[i], (flag = "--run-vit-mmore"))) {
         req_args = 1;
         if (i + req_args < argc) {
@@ -1344,6 +1578,98 @@ STATUS_FLAG ARGS_ParseOptions(ARGS* args,
           ERRORCHECK_exit(EXIT_FAILURE);
         }
       }
+      elif (STR_Equals(argv[i], (flag = "--idlist"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->idlist_filein = STR_Set(args->idlist_filein, argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--cloudin"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->cloudin_filein = STR_Set(args->cloudin_filein, argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--dupmap"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->dupmap_filein = STR_Set(args->dupmap_filein, argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      /* === SHARD PLANNING OPTIONS === */
+      elif (STR_Equals(argv[i], (flag = "--plan-calibrate"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->plan_calib_filein = STR_Set(args->plan_calib_filein, argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--planout"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->plan_fileout = STR_Set(args->plan_fileout, argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--plan-idlist"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->plan_idlist_fileout = STR_Set(args->plan_idlist_fileout, argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      /* === CLOUD CALIBRATION OPTIONS === */
+      elif (STR_Equals(argv[i], (flag = "--calib-labels"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->calib_labels_filein = STR_Set(args->calib_labels_filein, argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--calib-loss"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->calib_loss = atof(argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--calibout"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->calib_fileout = STR_Set(args->calib_fileout, argv[i]);
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
       elif (STR_Equals(argv[i], (flag = "--search-mode"))) {
         req_args = 1;
         if (i + req_args < argc) {
@@ -1420,6 +1746,9 @@ STATUS_FLAG ARGS_ParseOptions(ARGS* args,
           STR_Destroy(args->mythresh_fileout);
           args->mythresh_fileout = STR_Concat(argv[i], ".mythreshout");
           args->is_mythreshout = true;
+          STR_Destroy(args->perf_fileout);
+          args->perf_fileout = STR_Concat(argv[i], ".perfout");
+          args->is_perfout = true;
         } else {
           fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
           ERRORCHECK_exit(EXIT_FAILURE);
@@ -1509,6 +1838,68 @@ STATUS_FLAG ARGS_ParseOptions(ARGS* args,
           ERRORCHECK_exit(EXIT_FAILURE);
         }
       }
+      elif (STR_Equals(argv[i], (flag = "--perfout"))) {
+        req_args = 1;
+        if (i + req_args <= argc) {
+          i++;
+          ERROR_free(args->perf_fileout);
+          args->perf_fileout = STR_Create(argv[i]);
+          args->is_perfout = true;
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--traceout"))) {
+        req_args = 1;
+        if (i + req_args <= argc) {
+          i++;
+          ERROR_free(args->trace_fileout);
+          args->trace_fileout = STR_Create(argv[i]);
+          args->is_traceout = true;
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--binout"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          ERROR_free(args->binout_fileout);
+          args->binout_fileout = STR_Create(argv[i]);
+          args->is_binout = true;
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--cloudout"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          ERROR_free(args->cloudout_fileout);
+          args->cloudout_fileout = STR_Create(argv[i]);
+          args->is_cloudout = true;
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
+      elif (STR_Equals(argv[i], (flag = "--report-queue"))) {
+        req_args = 1;
+        if (i + req_args < argc) {
+          i++;
+          args->report_queue = atoi(argv[i]);
+          if (args->report_queue < 0) {
+            fprintf(stderr, "ERROR: Report queue size (%d) must be non-negative.\n", args->report_queue);
+            ERRORCHECK_exit(EXIT_FAILURE);
+          }
+        } else {
+          fprintf(stderr, "ERROR: %s flag requires (%d) argument.\n", flag, req_args);
+          ERRORCHECK_exit(EXIT_FAILURE);
+        }
+      }
       elif (STR_Equals(argv[i], (flag = "--customout"))) {
         req_args = 1;
         if (i + req_args <= argc) {
@@ -0,0 +1,341 @@
+/*******************************************************************************
+ *  - FILE:   binout_parser.c
+ *  - DESC:    Parser for binary results (binout) file.
+ *             See reporting/binout.c for format.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+
+/* header */
+#include "_parsers.h"
+
+/* private functions */
+static void
+BINOUT_read(FILE* fp, void* data, size_t size);
+static int
+BINOUT_read_int(FILE* fp);
+static float
+BINOUT_read_flt(FILE* fp);
+static bool
+BINOUT_read_bool(FILE* fp);
+static STR
+BINOUT_read_str(FILE* fp, STR str);
+static RANGE
+BINOUT_read_range(FILE* fp);
+static void
+BINOUT_read_chars(FILE* fp, VECTOR_CHAR* vec);
+static ALIGNMENT*
+BINOUT_read_alignment(FILE* fp, ALIGNMENT* aln);
+static void
+BINOUT_check_size(FILE* fp, const char* name, int size);
+
+/*! FUNCTION:  BINOUT_Parse_Header()
+ *  SYNOPSIS:  Parse binout header from <fp>, checking format is compatible with this build.
+ *             Input files and run options that were used to produce results are stored in <args>.
+ */
+void BINOUT_Parse_Header(ARGS* args,
+                         FILE* fp) {
+  char magic[BINOUT_MAGIC_LEN];
+  int version, endian;
+  STR pipeline_name = NULL;
+
+  /* format */
+  BINOUT_read(fp, magic, BINOUT_MAGIC_LEN);
+  if (memcmp(magic, BINOUT_MAGIC, BINOUT_MAGIC_LEN) != 0) {
+    fprintf(stderr, "ERROR: File is not a binout file.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  version = BINOUT_read_int(fp);
+  if (version != BINOUT_VERSION) {
+    fprintf(stderr, "ERROR: binout file version (%d) is not supported by this build (%d).\n",
+            version, BINOUT_VERSION);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  endian = BINOUT_read_int(fp);
+  if (endian != BINOUT_ENDIAN) {
+    fprintf(stderr, "ERROR: binout file was written on a machine with different byte order.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  BINOUT_check_size(fp, "SCORES", sizeof(SCORES));
+  BINOUT_check_size(fp, "ALL_SCORES", sizeof(ALL_SCORES));
+  BINOUT_check_size(fp, "TIMES", sizeof(TIMES));
+  BINOUT_check_size(fp, "STATS", sizeof(STATS));
+
+  /* input files */
+  pipeline_name = BINOUT_read_str(fp, pipeline_name);
+  for (int i = 0; i < NUM_PIPELINES; i++) {
+    if (STR_Equals(pipeline_name, PIPELINES[i].name)) {
+      args->pipeline_mode = i;
+    }
+  }
+  pipeline_name = STR_Destroy(pipeline_name);
+  args->t_filein = BINOUT_read_str(fp, args->t_filein);
+  args->q_filein = BINOUT_read_str(fp, args->q_filein);
+  args->t_index_filein = BINOUT_read_str(fp, args->t_index_filein);
+  args->q_index_filein = BINOUT_read_str(fp, args->q_index_filein);
+  args->mmseqs_m8_filein = BINOUT_read_str(fp, args->mmseqs_m8_filein);
+
+  /* options */
+  args->is_run_domains = BINOUT_read_bool(fp);
+  args->is_run_vitaln = BINOUT_read_bool(fp);
+  args->is_run_postaln = BINOUT_read_bool(fp);
+  args->is_run_mmseqsaln = BINOUT_read_bool(fp);
+  args->adjust_mmseqs_alns = BINOUT_read_bool(fp);
+}
+
+/*! FUNCTION:  BINOUT_Parse_Entry()
+ *  SYNOPSIS:  Parse next result record from <fp> into <result>, reusing memory owned by <result>.
+ *  RETURN:    True if record was parsed, false if footer was reached.
+ */
+bool BINOUT_Parse_Entry(RESULT* result,
+                        FILE* fp) {
+  int tag = fgetc(fp);
+  if (tag == BINOUT_TAG_FOOTER) {
+    return false;
+  }
+  if (tag != BINOUT_TAG_RESULT) {
+    fprintf(stderr, "ERROR: binout file is truncated or corrupt (bad record tag).\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  /* ids */
+  result->result_id = BINOUT_read_int(fp);
+  result->target_id = BINOUT_read_int(fp);
+  result->query_id = BINOUT_read_int(fp);
+  /* target/query metadata */
+  result->target_name = BINOUT_read_str(fp, result->target_name);
+  result->query_name = BINOUT_read_str(fp, result->query_name);
+  result->target_acc = BINOUT_read_str(fp, result->target_acc);
+  result->target_desc = BINOUT_read_str(fp, result->target_desc);
+  result->query_acc = BINOUT_read_str(fp, result->query_acc);
+  result->target_len = BINOUT_read_int(fp);
+  result->query_len = BINOUT_read_int(fp);
+  /* ranges */
+  result->target_range = BINOUT_read_range(fp);
+  result->query_range = BINOUT_read_range(fp);
+  result->target_bounds = BINOUT_read_range(fp);
+  result->query_bounds = BINOUT_read_range(fp);
+  /* alignments */
+  result->vit_trace = BINOUT_read_alignment(fp, result->vit_trace);
+  result->post_trace = BINOUT_read_alignment(fp, result->post_trace);
+  /* scores */
+  BINOUT_read(fp, &result->scores, sizeof(ALL_SCORES));
+  BINOUT_read(fp, &result->final_scores, sizeof(SCORES));
+  /* domain summary */
+  result->n_domains = BINOUT_read_int(fp);
+  result->dom_best = BINOUT_read_int(fp);
+  result->dom_best_range = BINOUT_read_range(fp);
+  result->dom_best_sc = BINOUT_read_flt(fp);
+  result->dom_best_presc = BINOUT_read_flt(fp);
+  result->dom_best_fwdsc = BINOUT_read_flt(fp);
+  result->dom_best_bias = BINOUT_read_flt(fp);
+  result->dom_sumsc = BINOUT_read_flt(fp);
+  /* runtimes */
+  BINOUT_read(fp, &result->times, sizeof(TIMES));
+  /* cell counts */
+  result->cpu_cloud_cells = BINOUT_read_int(fp);
+  result->cloud_cells = BINOUT_read_int(fp);
+  result->cpu_total_cells = BINOUT_read_int(fp);
+  result->total_cells = BINOUT_read_int(fp);
+  result->perc_cells = BINOUT_read_flt(fp);
+  /* threshold filters */
+  result->threshold_prefilter = BINOUT_read_flt(fp);
+  result->score_prefilter = BINOUT_read_flt(fp);
+  result->is_passed_prefilter = BINOUT_read_bool(fp);
+  result->threshold_viterbi = BINOUT_read_flt(fp);
+  result->score_viterbi = BINOUT_read_flt(fp);
+  result->is_passed_viterbi = BINOUT_read_bool(fp);
+  result->threshold_cloud = BINOUT_read_flt(fp);
+  result->score_cloud = BINOUT_read_flt(fp);
+  result->is_passed_cloud = BINOUT_read_bool(fp);
+  result->threshold_fwdback = BINOUT_read_flt(fp);
+  result->score_fwdback = BINOUT_read_flt(fp);
+  result->is_passed_fwdback = BINOUT_read_bool(fp);
+  result->threshold_report = BINOUT_read_flt(fp);
+  result->score_reported = BINOUT_read_flt(fp);
+  result->is_passed_report = BINOUT_read_bool(fp);
+
+  return true;
+}
+
+/*! FUNCTION:  BINOUT_Parse_Footer()
+ *  SYNOPSIS:  Parse binout footer from <fp> into <stats> and total runtimes <times>.
+ *             Must follow BINOUT_Parse_Entry() returning false.
+ */
+void BINOUT_Parse_Footer(STATS* stats,
+                         TIMES* times,
+                         FILE* fp) {
+  BINOUT_read(fp, stats, sizeof(STATS));
+  BINOUT_read(fp, times, sizeof(TIMES));
+}
+
+/*! FUNCTION:  BINOUT_read()
+ *  SYNOPSIS:  Read <size> bytes from <fp> into <data>. Exits if file ends early.
+ */
+static void
+BINOUT_read(FILE* fp,
+            void* data,
+            size_t size) {
+  if (fread(data, 1, size, fp) != size) {
+    fprintf(stderr, "ERROR: binout file is truncated or corrupt (unexpected end of file).\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+}
+
+/*! FUNCTION:  BINOUT_read_int()
+ *  SYNOPSIS:  Read int32 from <fp>.
+ */
+static int
+BINOUT_read_int(FILE* fp) {
+  int32_t data;
+  BINOUT_read(fp, &data, sizeof(int32_t));
+  return data;
+}
+
+/*! FUNCTION:  BINOUT_read_flt()
+ *  SYNOPSIS:  Read float from <fp>.
+ */
+static float
+BINOUT_read_flt(FILE* fp) {
+  float data;
+  BINOUT_read(fp, &data, sizeof(float));
+  return data;
+}
+
+/*! FUNCTION:  BINOUT_read_bool()
+ *  SYNOPSIS:  Read uint8 from <fp> as bool.
+ */
+static bool
+BINOUT_read_bool(FILE* fp) {
+  uint8_t data;
+  BINOUT_read(fp, &data, sizeof(uint8_t));
+  return (data != 0);
+}
+
+/*! FUNCTION:  BINOUT_read_str()
+ *  SYNOPSIS:  Read string from <fp>, replacing <str>.
+ *  RETURN:    Pointer to new string, or NULL if NULL string was written.
+ */
+static STR
+BINOUT_read_str(FILE* fp,
+                STR str) {
+  int len = BINOUT_read_int(fp);
+  if (len < 0) {
+    str = STR_Destroy(str);
+    return str;
+  }
+  str = ERROR_realloc(str, sizeof(char) * (len + 1));
+  BINOUT_read(fp, str, len);
+  str[len] = NULL_CHAR;
+  return str;
+}
+
+/*! FUNCTION:  BINOUT_read_range()
+ *  SYNOPSIS:  Read <beg,end> range from <fp>.
+ */
+static RANGE
+BINOUT_read_range(FILE* fp) {
+  RANGE range;
+  range.beg = BINOUT_read_int(fp);
+  range.end = BINOUT_read_int(fp);
+  return range;
+}
+
+/*! FUNCTION:  BINOUT_read_chars()
+ *  SYNOPSIS:  Read characters from <fp> into <vec>.
+ */
+static void
+BINOUT_read_chars(FILE* fp,
+                  VECTOR_CHAR* vec) {
+  int N = BINOUT_read_int(fp);
+  VECTOR_CHAR_SetSize(vec, N);
+  BINOUT_read(fp, vec->data, N);
+}
+
+/*! FUNCTION:  BINOUT_read_alignment()
+ *  SYNOPSIS:  Read alignment from <fp> into <aln>, creating it if NULL.
+ *  RETURN:    Pointer to alignment, or NULL if no alignment was written.
+ */
+static ALIGNMENT*
+BINOUT_read_alignment(FILE* fp,
+                      ALIGNMENT* aln) {
+  int num_traces, num_regions;
+
+  if (BINOUT_read_bool(fp) == false) {
+    aln = ALIGNMENT_Destroy(aln);
+    return aln;
+  }
+  if (aln == NULL) {
+    aln = ALIGNMENT_Create();
+  }
+
+  aln->Q = BINOUT_read_int(fp);
+  aln->T = BINOUT_read_int(fp);
+  ALIGNMENT_Reuse(aln, aln->Q, aln->T);
+  aln->full_len = BINOUT_read_int(fp);
+  aln->num_alns = BINOUT_read_int(fp);
+  aln->best_idx = BINOUT_read_int(fp);
+  aln->aln_len = BINOUT_read_int(fp);
+  aln->beg = BINOUT_read_int(fp);
+  aln->end = BINOUT_read_int(fp);
+  aln->num_gaps = BINOUT_read_int(fp);
+  aln->num_misses = BINOUT_read_int(fp);
+  aln->num_matches = BINOUT_read_int(fp);
+  aln->perc_id = BINOUT_read_flt(fp);
+  /* traces */
+  num_traces = BINOUT_read_int(fp);
+  VECTOR_TRACE_SetSize(aln->traces, num_traces);
+  for (int i = 0; i < num_traces; i++) {
+    TRACE* tr = &VEC_X(aln->traces, i);
+    tr->q_0 = BINOUT_read_int(fp);
+    tr->t_0 = BINOUT_read_int(fp);
+    tr->st = BINOUT_read_int(fp);
+  }
+  /* discrete alignment regions */
+  num_regions = BINOUT_read_int(fp);
+  VECTOR_INT_SetSize(aln->tr_beg, num_regions);
+  VECTOR_INT_SetSize(aln->tr_end, num_regions);
+  VECTOR_FLT_SetSize(aln->tr_score, num_regions);
+  for (int i = 0; i < num_regions; i++) {
+    VEC_X(aln->tr_beg, i) = BINOUT_read_int(fp);
+    VEC_X(aln->tr_end, i) = BINOUT_read_int(fp);
+    VEC_X(aln->tr_score, i) = BINOUT_read_flt(fp);
+  }
+  /* alignment strings */
+  aln->is_cigar_aln = BINOUT_read_bool(fp);
+  BINOUT_read_chars(fp, aln->cigar_aln);
+  aln->is_hmmer_aln = BINOUT_read_bool(fp);
+  BINOUT_read_chars(fp, aln->target_aln);
+  BINOUT_read_chars(fp, aln->center_aln);
+  BINOUT_read_chars(fp, aln->query_aln);
+  BINOUT_read_chars(fp, aln->state_aln);
+
+  return aln;
+}
+
+/*! FUNCTION:  BINOUT_check_size()
+ *  SYNOPSIS:  Read struct size from <fp> and check it matches <size> of <name> in this build.
+ */
+static void
+BINOUT_check_size(FILE* fp,
+                  const char* name,
+                  int size) {
+  int file_size = BINOUT_read_int(fp);
+  if (file_size != size) {
+    fprintf(stderr, "ERROR: binout file %s layout (%d bytes) does not match this build (%d bytes).\n",
+            name, file_size, size);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+}
@@ -0,0 +1,31 @@
+/*******************************************************************************
+ *  - FILE:   binout_parser.h
+ *  - DESC:    Parses binary results (binout) file into RESULT records.
+ *******************************************************************************/
+
+#ifndef _BINOUT_PARSER_H
+#define _BINOUT_PARSER_H
+
+/*! FUNCTION:  BINOUT_Parse_Header()
+ *  SYNOPSIS:  Parse binout header from <fp>, checking format is compatible with this build.
+ *             Input files and run options that were used to produce results are stored in <args>.
+ */
+void BINOUT_Parse_Header(ARGS* args,
+                         FILE* fp);
+
+/*! FUNCTION:  BINOUT_Parse_Entry()
+ *  SYNOPSIS:  Parse next result record from <fp> into <result>, reusing memory owned by <result>.
+ *  RETURN:    True if record was parsed, false if footer was reached.
+ */
+bool BINOUT_Parse_Entry(RESULT* result,
+                        FILE* fp);
+
+/*! FUNCTION:  BINOUT_Parse_Footer()
+ *  SYNOPSIS:  Parse binout footer from <fp> into <stats> and total runtimes <times>.
+ *             Must follow BINOUT_Parse_Entry() returning false.
+ */
+void BINOUT_Parse_Footer(STATS* stats,
+                         TIMES* times,
+                         FILE* fp);
+
+#endif /* _BINOUT_PARSER_H */
@@ -0,0 +1,300 @@
+/*******************************************************************************
+ *  - FILE:   dupmap_parser.c
+ *  - DESC:    Build a DUP_MAP object from: .dupmap file, or by deduplicating .fasta file.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+
+/* header */
+#include "_parsers.h"
+
+/* FNV-1a hash constants */
+#define DEDUP_HASH_INIT 14695981039346656037ULL
+#define DEDUP_HASH_PRIME 1099511628211ULL
+
+/* private functions */
+static char*
+DUP_MAP_Fasta_Name(char* header);
+static void
+DUP_MAP_Fasta_Append(VECTOR_CHAR* record, char* line, size_t line_size);
+static void
+DUP_MAP_Fasta_Rehash(int** table, int* table_size, DEDUP_SEQ* seqs, int N_seqs);
+
+/*! FUNCTION:  DUP_MAP_Load()
+ *  SYNOPSIS:  Load map of duplicate queries from .dupmap file at <filename> into <map>, and sort it by canonical name.
+ *             Each line holds tab-delimited {canonical name} and {duplicate name}.  Lines starting with '#' are ignored.
+ *             Creates <map> if NULL.
+ */
+DUP_MAP* DUP_MAP_Load(DUP_MAP* map,
+                      const char* filename) {
+  FILE* fp = NULL;
+  size_t line_buf_size = 0;
+  ssize_t line_size = 0;
+  char* line_buf = NULL;
+  char* canon_name = NULL;
+  char* dup_name = NULL;
+  char* delim = "\t\n";
+
+  /* create map object if necessary */
+  if (map == NULL) {
+    map = DUP_MAP_Create();
+  } else {
+    DUP_MAP_Reuse(map);
+  }
+
+  map->source_path = STR_Create(filename);
+
+  /* file open */
+  fp = ERROR_fopen(filename, "r");
+
+  /* read file line-by-line */
+  while ((line_size = getline(&line_buf, &line_buf_size, fp)), line_size >= 0) {
+    /* ignore commented lines */
+    if (line_buf[0] == '#')
+      continue;
+
+    /* first token is canonical name, second token is duplicate name */
+    canon_name = strtok(line_buf, delim);
+    if (canon_name == NULL)
+      continue;
+    dup_name = strtok(NULL, delim);
+    if (dup_name == NULL) {
+      fprintf(stderr, "ERROR: Duplicate map file '%s' has line without duplicate name: '%s'.\n", filename, canon_name);
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+
+    DUP_MAP_Pushback(map, canon_name, dup_name);
+  }
+
+  fclose(fp);
+  ERROR_free(line_buf);
+
+  DUP_MAP_Sort(map);
+  return map;
+}
+
+/*! FUNCTION:  DUP_MAP_Fasta_Dedup()
+ *  SYNOPSIS:  Remove duplicate sequences from .fasta file <filein>, writing first copy of each distinct sequence
+ *             to <fileout> (headers and lines as in <filein>), and adding each removed copy to <map>
+ *             under the name of the first copy.  Sequences are compared by their digitized residues,
+ *             found by hash, then confirmed against the stored first copy.  Stores <N_seqs> read from <filein>.
+ *             Creates <map> if NULL.
+ */
+DUP_MAP* DUP_MAP_Fasta_Dedup(DUP_MAP* map,
+                             const char* filein,
+                             const char* fileout,
+                             int* N_seqs) {
+  FILE* fp_in = NULL;
+  FILE* fp_out = NULL;
+  size_t line_buf_size = 0;
+  ssize_t line_size = 0;
+  char* line_buf = NULL;
+  char* name = NULL;
+  bool is_eof = false;
+  bool is_record = false;
+
+  /* current record: text as read, and digitized residues and name (appended to buffers, kept if distinct) */
+  VECTOR_CHAR* record = VECTOR_CHAR_Create();
+  VECTOR_CHAR* dseqs = VECTOR_CHAR_Create();
+  VECTOR_CHAR* names = VECTOR_CHAR_Create();
+  size_t seq_beg = 0;
+  size_t name_beg = 0;
+  uint64_t hash = DEDUP_HASH_INIT;
+
+  /* distinct sequences, and open-addressed hash table of their ids (-1 if empty) */
+  int N_distinct = 0;
+  int Nalloc_distinct = 256;
+  DEDUP_SEQ* seqs = ERROR_malloc(sizeof(DEDUP_SEQ) * Nalloc_distinct);
+  int table_size = 0;
+  int* table = NULL;
+  DUP_MAP_Fasta_Rehash(&table, &table_size, seqs, N_distinct);
+
+  /* create map object if necessary */
+  if (map == NULL) {
+    map = DUP_MAP_Create();
+  } else {
+    DUP_MAP_Reuse(map);
+  }
+  *N_seqs = 0;
+
+  /* file open */
+  fp_in = ERROR_fopen(filein, "r");
+  fp_out = ERROR_fopen(fileout, "w");
+
+  /* read file line-by-line, finishing current record at each header and at end of file */
+  while (is_eof == false) {
+    line_size = getline(&line_buf, &line_buf_size, fp_in);
+    is_eof = (line_size < 0);
+
+    /* ignore commented lines */
+    if (is_eof == false && line_buf[0] == '#')
+      continue;
+
+    /* finish current record: output it if distinct, otherwise map it to its first copy */
+    if (is_record == true && (is_eof == true || line_buf[0] == '>')) {
+      int seq_len = dseqs->N - seq_beg;
+      int mask = table_size - 1;
+      int slot = hash & mask;
+      int id = -1;
+
+      while ((id = table[slot]) != -1) {
+        DEDUP_SEQ* seq = &seqs[id];
+        if (seq->hash == hash && seq->seq_len == seq_len &&
+            memcmp(dseqs->data + seq->seq_beg, dseqs->data + seq_beg, seq_len) == 0) {
+          break;
+        }
+        slot = (slot + 1) & mask;
+      }
+
+      if (id != -1) {
+        DUP_MAP_Pushback(map, names->data + seqs[id].name_beg, names->data + name_beg);
+        VECTOR_CHAR_SetSize(dseqs, seq_beg);
+        VECTOR_CHAR_SetSize(names, name_beg);
+      }
+      else {
+        fwrite(record->data, 1, record->N, fp_out);
+        if (N_distinct + 1 >= Nalloc_distinct) {
+          Nalloc_distinct *= 2;
+          seqs = ERROR_realloc(seqs, sizeof(DEDUP_SEQ) * Nalloc_distinct);
+        }
+        seqs[N_distinct] = (DEDUP_SEQ){hash, seq_beg, seq_len, name_beg};
+        table[slot] = N_distinct;
+        N_distinct++;
+        /* keep table at most half full */
+        if (2 * N_distinct > table_size) {
+          DUP_MAP_Fasta_Rehash(&table, &table_size, seqs, N_distinct);
+        }
+      }
+      is_record = false;
+    }
+
+    if (is_eof == true)
+      break;
+
+    /* start new record */
+    if (line_buf[0] == '>') {
+      is_record = true;
+      *N_seqs += 1;
+      VECTOR_CHAR_Reuse(record);
+      DUP_MAP_Fasta_Append(record, line_buf, line_size);
+      seq_beg = dseqs->N;
+      name_beg = names->N;
+      hash = DEDUP_HASH_INIT;
+      /* name as given by sequence parser */
+      name = DUP_MAP_Fasta_Name(line_buf + 1);
+      for (int i = 0; name[i] != '\0'; i++) {
+        VECTOR_CHAR_Pushback(names, name[i]);
+      }
+      VECTOR_CHAR_Pushback(names, '\0');
+    }
+    /* otherwise, add line to current record and its residues to sequence */
+    elif (is_record == true) {
+      for (int i = 0; i < line_size; i++) {
+        int ch = toupper((unsigned char)line_buf[i]);
+        if (isspace(ch)) {
+          continue;
+        }
+        /* residues outside of alphabet are kept as text, so they stay distinct */
+        char digit = (ch < 'Z' + 1 && AA_REV[ch] >= 0) ? AA_REV[ch] : ch;
+        VECTOR_CHAR_Pushback(dseqs, digit);
+        hash = (hash ^ (unsigned char)digit) * DEDUP_HASH_PRIME;
+      }
+      DUP_MAP_Fasta_Append(record, line_buf, line_size);
+    }
+  }
+
+  fclose(fp_in);
+  fclose(fp_out);
+  ERROR_free(line_buf);
+  ERROR_free(seqs);
+  ERROR_free(table);
+  VECTOR_CHAR_Destroy(record);
+  VECTOR_CHAR_Destroy(dseqs);
+  VECTOR_CHAR_Destroy(names);
+
+  return map;
+}
+
+/*! FUNCTION:  DUP_MAP_Fasta_Name()
+ *  SYNOPSIS:  Get name from fasta <header> (without '>'), by same rule as SEQUENCE_Fasta_Parse(): first field
+ *             delimited by " ", or if it has structure >db|id|, the second field delimited by "|".
+ *             Modifies <header>.
+ */
+static char*
+DUP_MAP_Fasta_Name(char* header) {
+  char* token = NULL;
+  char* name = NULL;
+
+  header[strcspn(header, "\n")] = '\0';
+  token = strtok(header, " ");
+  if (token == NULL) {
+    return header;
+  }
+  if (strstr(token, "|") != NULL) {
+    name = strtok(token, "|");
+    name = strtok(NULL, "|");
+  }
+  else {
+    name = token;
+  }
+
+  return (name != NULL ? name : token);
+}
+
+/*! FUNCTION:  DUP_MAP_Fasta_Append()
+ *  SYNOPSIS:  Append <line> of length <line_size> to <record>, ending it with a newline.
+ */
+static void
+DUP_MAP_Fasta_Append(VECTOR_CHAR* record,
+                     char* line,
+                     size_t line_size) {
+  for (size_t i = 0; i < line_size; i++) {
+    VECTOR_CHAR_Pushback(record, line[i]);
+  }
+  if (line_size == 0 || line[line_size - 1] != '\n') {
+    VECTOR_CHAR_Pushback(record, '\n');
+  }
+}
+
+/*! FUNCTION:  DUP_MAP_Fasta_Rehash()
+ *  SYNOPSIS:  Grow hash <table> to hold <N_seqs> distinct sequences <seqs> at most half full, and reinsert them.
+ */
+static void
+DUP_MAP_Fasta_Rehash(int** table,
+                     int* table_size,
+                     DEDUP_SEQ* seqs,
+                     int N_seqs) {
+  int size = 1024;
+  int mask;
+
+  while (size < 4 * N_seqs) {
+    size *= 2;
+  }
+  mask = size - 1;
+
+  *table = ERROR_realloc(*table, sizeof(int) * size);
+  *table_size = size;
+  for (int i = 0; i < size; i++) {
+    (*table)[i] = -1;
+  }
+
+  for (int id = 0; id < N_seqs; id++) {
+    int slot = seqs[id].hash & mask;
+    while ((*table)[slot] != -1) {
+      slot = (slot + 1) & mask;
+    }
+    (*table)[slot] = id;
+  }
+}
@@ -0,0 +1,25 @@
+/*******************************************************************************
+ *  - FILE:   dupmap_parser.h
+ *  - DESC:    Build a DUP_MAP object from: .dupmap file, or by deduplicating .fasta file.
+ *******************************************************************************/
+
+#ifndef _DUPMAP_PARSER_H
+#define _DUPMAP_PARSER_H
+
+/*! FUNCTION:  DUP_MAP_Load()
+ *  SYNOPSIS:  Load map of duplicate queries from .dupmap file at <filename> into <map>, and sort it by canonical name.
+ *             Each line holds tab-delimited {canonical name} and {duplicate name}.  Lines starting with '#' are ignored.
+ *             Creates <map> if NULL.
+ */
+DUP_MAP* DUP_MAP_Load(DUP_MAP* map, const char* filename);
+
+/*! FUNCTION:  DUP_MAP_Fasta_Dedup()
+ *  SYNOPSIS:  Remove duplicate sequences from .fasta file <filein>, writing first copy of each distinct sequence
+ *             to <fileout> (headers and lines as in <filein>), and adding each removed copy to <map>
+ *             under the name of the first copy.  Sequences are compared by their digitized residues,
+ *             found by hash, then confirmed against the stored first copy.  Stores <N_seqs> read from <filein>.
+ *             Creates <map> if NULL.
+ */
+DUP_MAP* DUP_MAP_Fasta_Dedup(DUP_MAP* map, const char* filein, const char* fileout, int* N_seqs);
+
+#endif /* _DUPMAP_PARSER_H */
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *  - FILE:   hitlist_parser.c
+ *  - DESC:    Parser for binary hitlist file.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+
+/* header */
+#include "_parsers.h"
+
+/* === HITLIST FORMAT =================================
+   Native byte order, all fields are 4 bytes.
+   HEADER:
+        magic   char[8]   "MMOREHIT"
+      version   int32     HITLIST_VERSION
+       endian   int32     0x01020304
+        flags   int32     HITLIST_HAS_SCORE | HITLIST_HAS_WINDOW
+   RECORDS (until end of file):
+    target_id   int32     id of target hmm in target index
+     query_id   int32     id of query sequence in query index
+         eval   float     (if HITLIST_HAS_SCORE) prefilter e-value
+        bitsc   float     (if HITLIST_HAS_SCORE) prefilter bit score
+        t_beg   int32     (if HITLIST_HAS_WINDOW) start of alignment in target
+        t_end   int32     (if HITLIST_HAS_WINDOW) end of alignment in target
+        q_beg   int32     (if HITLIST_HAS_WINDOW) start of alignment in query
+        q_end   int32     (if HITLIST_HAS_WINDOW) end of alignment in query
+   Ids are the order of entries in the input files (as in the index files).
+   Window is 1-based and inclusive, as in .m8. Without a window, the cloud search
+   is seeded from the full extent of target and query.
+   ====================================================
+ */
+
+bool RESULTS_HITLIST_Is_Hitlist(char* filename) {
+  FILE* fp = NULL;
+  char magic[HITLIST_MAGIC_LEN];
+  bool is_hitlist = false;
+
+  fp = fopen(filename, "r");
+  if (fp == NULL) {
+    return false;
+  }
+  if (fread(magic, 1, HITLIST_MAGIC_LEN, fp) == HITLIST_MAGIC_LEN) {
+    is_hitlist = (memcmp(magic, HITLIST_MAGIC, HITLIST_MAGIC_LEN) == 0);
+  }
+  fclose(fp);
+  return is_hitlist;
+}
+
+void RESULTS_HITLIST_Parse(M8_RESULTS* results,
+                           char* filename,
+                           int start_idx,
+                           int end_idx) {
+  /* parser vars */
+  FILE* fp = NULL;
+  char magic[HITLIST_MAGIC_LEN];
+  int32_t header[3];     /* version, endian, flags */
+  int32_t* block = NULL; /* buffer of records read at once */
+  const int block_size = 4096;
+  int rec_size = 2;      /* number of 4-byte fields per record */
+  int flags;
+  int result_count = 0;  /* index of next record in file */
+  size_t N_read;
+
+  M8_RESULT res_tmp; /* temporary result for storing current record */
+  memset(&res_tmp, 0, sizeof(M8_RESULT));
+
+  /* open file */
+  fp = fopen(filename, "r");
+  /* check for file read error */
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Bad FILE POINTER for HITLIST PARSER => %s\n", filename);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  /* header */
+  if (fread(magic, 1, HITLIST_MAGIC_LEN, fp) != HITLIST_MAGIC_LEN ||
+      memcmp(magic, HITLIST_MAGIC, HITLIST_MAGIC_LEN) != 0 ||
+      fread(header, sizeof(int32_t), 3, fp) != 3) {
+    fprintf(stderr, "ERROR: File '%s' is not a hitlist file.\n", filename);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  if (header[0] != HITLIST_VERSION) {
+    fprintf(stderr, "ERROR: hitlist file version (%d) is not supported by this build (%d).\n",
+            header[0], HITLIST_VERSION);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  if (header[1] != HITLIST_ENDIAN) {
+    fprintf(stderr, "ERROR: hitlist file was written on a machine with different byte order.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  flags = header[2];
+  rec_size += (flags & HITLIST_HAS_SCORE ? 2 : 0);
+  rec_size += (flags & HITLIST_HAS_WINDOW ? 4 : 0);
+
+  /* entries without window are marked by negative bounds */
+  res_tmp.t_beg = res_tmp.t_end = -1;
+  res_tmp.q_beg = res_tmp.q_end = -1;
+
+  /* read records a block at a time */
+  block = ERROR_malloc(sizeof(int32_t) * rec_size * block_size);
+  while (result_count < end_idx &&
+         (N_read = fread(block, sizeof(int32_t) * rec_size, block_size, fp)) > 0) {
+    for (int i = 0; i < N_read && result_count < end_idx; i++, result_count++) {
+      /* if we are before start of target results */
+      if (result_count < start_idx) {
+        continue;
+      }
+      int32_t* rec = &block[i * rec_size];
+
+      res_tmp.result_id = result_count;
+      res_tmp.target_id = *rec++;
+      res_tmp.query_id = *rec++;
+      if (flags & HITLIST_HAS_SCORE) {
+        memcpy(&res_tmp.eval, rec++, sizeof(float));
+        memcpy(&res_tmp.bitsc, rec++, sizeof(float));
+      }
+      if (flags & HITLIST_HAS_WINDOW) {
+        res_tmp.t_beg = *rec++;
+        res_tmp.t_end = *rec++;
+        res_tmp.q_beg = *rec++;
+        res_tmp.q_end = *rec++;
+      }
+
+      /* add new result to results list */
+      M8_RESULTS_Pushback(results, &res_tmp);
+    }
+  }
+  if (ferror(fp)) {
+    fprintf(stderr, "ERROR: Failed to read hitlist file '%s'.\n", filename);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  results->num_hits = result_count;
+  results->num_searches = result_count;
+
+  block = ERROR_free(block);
+  fclose(fp);
+}
@@ -0,0 +1,26 @@
+/*******************************************************************************
+ *  - FILE:   hitlist_parser.h
+ *  - DESC:    Parses binary hitlist file into M8_RESULTS object.
+ *******************************************************************************/
+
+#ifndef _HITLIST_PARSER_H
+#define _HITLIST_PARSER_H
+
+/*! FUNCTION:  RESULTS_HITLIST_Is_Hitlist()
+ *  SYNOPSIS:  Check whether file at <filename> starts with binary hitlist signature.
+ *  RETURN:    True if file is a hitlist, false otherwise (e.g. an .m8 file).
+ */
+bool RESULTS_HITLIST_Is_Hitlist(char* filename);
+
+/*! FUNCTION:  RESULTS_HITLIST_Parse()
+ *  SYNOPSIS:  Parse binary hitlist file at <filename> and
+ * 				stores data in M8_RESULTS object <results>.
+ * 				Entries have no names, only target/query ids (position in index sorted by id).
+ * 				Only imports over the range [<start_idx>, <end_idx>).
+ */
+void RESULTS_HITLIST_Parse(M8_RESULTS* results,
+                           char* filename,
+                           int start_idx,
+                           int end_idx);
+
+#endif /* _HITLIST_PARSER_H */
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <ctype.h>
 
 /* local imports */
 #include "../objects/structs.h"
@@ -36,6 +37,7 @@ F_INDEX* F_INDEX_Hmm_Build(F_INDEX* f_index,
   int id = 0;
   char* name = NULL;
   int mmseqs_id = -1;
+  bool is_named = false;
 
   /* create index object if necessary */
   if (f_index == NULL) {
@@ -65,10 +67,11 @@ F_INDEX* F_INDEX_Hmm_Build(F_INDEX* f_index,
     if (STR_ComparePrefix(line_buf, "HMMER", 5) == 0) {
       cur_offset = prv_offset;
 
+      is_named = false;
       while ((line_size = getline(&line_buf, &line_buf_size, fp)), line_size >= 0) {
         if (STR_ComparePrefix(line_buf, "NAME", 4) == 0) {
           int i = 0;
-          for (i = 4; line_buf[i] != ' '; i++) {
+          for (i = 4; line_buf[i] == ' '; i++) {
           } /* skip whitespace after NAME */
           name = &line_buf[i];
           name[strlen(name) - 1] = '\0';
@@ -78,9 +81,21 @@ F_INDEX* F_INDEX_Hmm_Build(F_INDEX* f_index,
           node.name = name;
           node.offset = cur_offset;
           node.mmseqs_id = mmseqs_id;
+          node.length = -1;
           F_INDEX_Pushback(f_index, &node);
 
           id++;
+          is_named = true;
+        }
+        /* model length follows name in header */
+        elif (STR_ComparePrefix(line_buf, "LENG", 4) == 0) {
+          if (is_named == true) {
+            f_index->nodes[f_index->N - 1].length = atoi(&line_buf[4]);
+          }
+          break;
+        }
+        /* end of header */
+        elif (STR_ComparePrefix(line_buf, "HMM ", 4) == 0) {
           break;
         }
       }
@@ -169,9 +184,18 @@ F_INDEX* F_INDEX_Fasta_Build(F_INDEX* f_index,
       node.name = name;
       node.offset = prv_offset;
       node.mmseqs_id = -1;
+      node.length = 0;
       F_INDEX_Pushback(f_index, &node);
       id++;
     }
+    /* otherwise, add residues to length of current sequence */
+    elif (f_index->N > 0) {
+      for (int i = 0; i < line_size; i++) {
+        if (isspace(line_buf[i]) == false) {
+          f_index->nodes[f_index->N - 1].length++;
+        }
+      }
+    }
 
     line_count++;
     prv_offset = ftell(fp);
@@ -241,6 +265,10 @@ F_INDEX* F_INDEX_Load(F_INDEX* f_index,
       continue;
     name = token;
 
+    /* fourth token is the length (not in older index files) */
+    token = strtok(NULL, delim);
+    node.length = (token != NULL ? atoi(token) : -1);
+
     node.id = id;
     node.name = name;
     node.offset = cur_offset;
@@ -13,6 +13,7 @@
 #include <math.h>
 #include <ctype.h>
 #include <time.h>
+#include <sys/stat.h>
 
 /* local imports */
 #include "../objects/structs.h"
@@ -22,6 +23,10 @@
 /* header */
 #include "_parsers.h"
 
+/* private functions */
+static void
+RESULTS_M8_Parse_Line(M8_RESULT* res, char* line_buf);
+
 /* === M8 FORMAT ======================================
            qseqid means Query Seq-id
            sseqid means Subject Seq-id
@@ -35,6 +40,8 @@
              send means End of alignment in subject
            evalue means Expect value
          bitscore means Bit score
+   (optional)
+            cigar means MMseqs-style CIGAR alignment (from --format-output ...,cigar)
    ====================================================
  */
 
@@ -50,9 +57,7 @@ void RESULTS_M8_Parse(M8_RESULTS* results,
   size_t line_buf_size = 0; /* length of entire <line_buf> array */
   size_t line_size = 0;     /* length of current line in <line_buf> array */
 
-  M8_RESULT res_tmp;     /* temporary result for storing current line */
-  char* line_ptr = NULL; /* moving pointer for iterating over tokens in <line_buf> */
-  char* token = NULL;    /* token that tracks each word in <line_buf> */
+  M8_RESULT res_tmp; /* temporary result for storing current line */
 
   /* open file */
   fp = fopen(filename, "r");
@@ -102,63 +107,164 @@ void RESULTS_M8_Parse(M8_RESULTS* results,
     // fprintf(stdout, "[%d] %s\n", line_count, line_buf);
     res_tmp.result_id = result_count;
 
-    /* split line on spaces, tabs, and newlines */
-    line_ptr = line_buf;
-
-    /* [1] query */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    // if (res_tmp.query_name != NULL) ERROR_free(res_tmp.query_name);
-    res_tmp.query_name = STR_Create(token);
+    /* split line into fields */
+    RESULTS_M8_Parse_Line(&res_tmp, line_buf);
 
-    /* [2] target */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    // if (res_tmp.target_name != NULL) ERROR_free(res_tmp.target_name);
-    res_tmp.target_name = STR_Create(token);
+    /* add new result to results list */
+    M8_RESULTS_Pushback(results, &res_tmp);
+  }
 
-    /* [3] percent id */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    res_tmp.perc_id = atof(token);
+  results->num_hits = line_count + 1;
+  results->num_searches = line_count + 1;
+}
 
-    /* [4] alignment length */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    res_tmp.aln_len = atoi(token);
+/*! FUNCTION:  RESULTS_M8_Is_Stream()
+ *  SYNOPSIS:  Check whether .m8 file at <filename> is a pipe (e.g. a named FIFO, or /dev/stdin
+ *             fed by a pipe), which can only be read once, front to back, as entries arrive.
+ */
+bool RESULTS_M8_Is_Stream(char* filename) {
+  struct stat st;
 
-    /* [5] alignment length */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    res_tmp.mismatch = atoi(token);
+  if (stat(filename, &st) != 0) {
+    return false;
+  }
+  return S_ISFIFO(st.st_mode);
+}
 
-    /* [6] gap openings */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    res_tmp.gap_openings = atoi(token);
+/*! FUNCTION:  RESULTS_M8_Parse_Next()
+ *  SYNOPSIS:  Read .m8 entries from open <fp> until the next one in the range [<start_idx>, <end_idx>)
+ *             has been added to <results>. <results->num_hits> counts all entries read so far.
+ *             Blocks until entry arrives, if <fp> is a pipe.
+ *             Returns false if end of file or <end_idx> is reached first.
+ */
+bool RESULTS_M8_Parse_Next(M8_RESULTS* results,
+                           FILE* fp,
+                           int start_idx,
+                           int end_idx) {
+  char* line_buf = NULL;    /* pointer to start of buffered line */
+  size_t line_buf_size = 0; /* length of entire <line_buf> array */
+  ssize_t line_size = 0;    /* length of current line in <line_buf> array */
+  M8_RESULT res_tmp;        /* temporary result for storing current line */
+  bool is_added = false;
 
-    /* [7] query start */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    res_tmp.q_beg = atoi(token);
+  while (results->num_hits < end_idx &&
+         (line_size = getline(&line_buf, &line_buf_size, fp)) != -1) {
+    /* ignore comment lines */
+    if (line_buf[0] == '#' || line_size <= 1) {
+      continue;
+    }
 
-    /* [8] query end */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    res_tmp.q_end = atoi(token);
+    /* skip entries before start */
+    res_tmp.result_id = results->num_hits++;
+    if (res_tmp.result_id < start_idx) {
+      continue;
+    }
 
-    /* [9] target start */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    res_tmp.t_beg = atoi(token);
+    /* remove newline from end of line */
+    if (line_buf[line_size - 1] == '\n') {
+      line_buf[--line_size] = '\0';
+    }
+    RESULTS_M8_Parse_Line(&res_tmp, line_buf);
+    M8_RESULTS_Pushback(results, &res_tmp);
+    is_added = true;
+    break;
+  }
 
-    /* [10] target end */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    res_tmp.t_end = atoi(token);
+  ERROR_free(line_buf);
+  return is_added;
+}
 
-    /* [11] E-value */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    res_tmp.eval = atof(token);
+void RESULTS_M8_Parse_Idlist(VECTOR_INT* ids,
+                             char* filename) {
+  FILE* fp = NULL;
+  char* line_buf = NULL;    /* pointer to start of buffered line */
+  size_t line_buf_size = 0; /* length of entire <line_buf> array */
+  ssize_t line_size = 0;    /* length of current line in <line_buf> array */
 
-    /* [12] bit-score */
-    token = strtok_r(line_ptr, " \t", &line_ptr);
-    res_tmp.bitsc = atoi(token);
+  fp = fopen(filename, "r");
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Bad FILE POINTER for IDLIST PARSER => %s\n", filename);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
 
-    /* add new result to results list */
-    M8_RESULTS_Pushback(results, &res_tmp);
+  VECTOR_INT_Reuse(ids);
+  while ((line_size = getline(&line_buf, &line_buf_size, fp)), line_size != -1) {
+    /* ignore comment lines */
+    if (line_buf[0] == '#' || line_size <= 1) {
+      continue;
+    }
+    VECTOR_INT_Pushback(ids, atoi(line_buf));
   }
+  VECTOR_INT_Sort(ids);
 
-  results->num_hits = line_count + 1;
-  results->num_searches = line_count + 1;
+  fclose(fp);
+  ERROR_free(line_buf);
+}
+
+/*! FUNCTION:  RESULTS_M8_Parse_Line()
+ *  SYNOPSIS:  Parse fields of .m8 entry <line_buf> (without newline) into <res>.
+ *             Splits <line_buf> in place.
+ */
+static void
+RESULTS_M8_Parse_Line(M8_RESULT* res,
+                      char* line_buf) {
+  char* line_ptr = NULL; /* moving pointer for iterating over tokens in <line_buf> */
+  char* token = NULL;    /* token that tracks each word in <line_buf> */
+
+  /* split line on spaces, tabs, and newlines */
+  line_ptr = line_buf;
+
+  /* [1] query */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  // if (res->query_name != NULL) ERROR_free(res->query_name);
+  res->query_name = STR_Create(token);
+
+  /* [2] target */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  // if (res->target_name != NULL) ERROR_free(res->target_name);
+  res->target_name = STR_Create(token);
+
+  /* [3] percent id */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->perc_id = atof(token);
+
+  /* [4] alignment length */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->aln_len = atoi(token);
+
+  /* [5] alignment length */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->mismatch = atoi(token);
+
+  /* [6] gap openings */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->gap_openings = atoi(token);
+
+  /* [7] query start */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->q_beg = atoi(token);
+
+  /* [8] query end */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->q_end = atoi(token);
+
+  /* [9] target start */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->t_beg = atoi(token);
+
+  /* [10] target end */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->t_end = atoi(token);
+
+  /* [11] E-value */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->eval = atof(token);
+
+  /* [12] bit-score */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->bitsc = atoi(token);
+
+  /* [13] (optional) cigar alignment */
+  token = strtok_r(line_ptr, " \t", &line_ptr);
+  res->cigar_aln = (token != NULL ? STR_Create(token) : NULL);
 }
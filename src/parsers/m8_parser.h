@@ -16,4 +16,28 @@ void RESULTS_M8_Parse(M8_RESULTS* results,
                       int start_idx,
                       int end_idx);
 
+/*! FUNCTION:  RESULTS_M8_Is_Stream()
+ *  SYNOPSIS:  Check whether .m8 file at <filename> is a pipe (e.g. a named FIFO, or /dev/stdin
+ * 				fed by a pipe), which can only be read once, front to back, as entries arrive.
+ */
+bool RESULTS_M8_Is_Stream(char* filename);
+
+/*! FUNCTION:  RESULTS_M8_Parse_Next()
+ *  SYNOPSIS:  Read .m8 entries from open <fp> until the next one in the range [<start_idx>, <end_idx>)
+ * 				has been added to <results>. <results->num_hits> counts all entries read so far.
+ * 				Blocks until entry arrives, if <fp> is a pipe.
+ * 				Returns false if end of file or <end_idx> is reached first.
+ */
+bool RESULTS_M8_Parse_Next(M8_RESULTS* results,
+                           FILE* fp,
+                           int start_idx,
+                           int end_idx);
+
+/*! FUNCTION:  RESULTS_M8_Parse_Idlist()
+ *  SYNOPSIS:  Parse id list file at <filename> (one .m8 result id per line) into <ids>.
+ * 				Ids are returned in ascending order.
+ */
+void RESULTS_M8_Parse_Idlist(VECTOR_INT* ids,
+                             char* filename);
+
 #endif /* _M8_PARSER_H */
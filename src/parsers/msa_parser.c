@@ -0,0 +1,171 @@
+/*******************************************************************************
+ *  - FILE:   msa_parser.c
+ *  - DESC:    Parses MSA families from Stockholm file.
+ *             File is read one family at a time, so a database of many families is only read once.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+
+/* header */
+#include "_parsers.h"
+
+/* private functions */
+static void
+MSA_Stockholm_Annotation(MSA* msa, char* line);
+
+/*! FUNCTION:  MSA_Stockholm_Parse()
+ *  SYNOPSIS:  Parse next family of Stockholm file <fp> into <msa>, reading up to and including its "//" line.
+ *             Keeps ID, AC and DE annotation of family and aligned text of each sequence; other annotation is ignored.
+ *             Sequences split over multiple blocks are joined by name.
+ *     RETURN: <true> if family was parsed; <false> if end of file was reached first.
+ */
+bool MSA_Stockholm_Parse(MSA* msa,
+                         FILE* fp) {
+  size_t line_buf_size = 0;
+  ssize_t line_size = 0;
+  char* line_buf = NULL;
+  char* sqname = NULL;
+  char* text = NULL;
+  int text_len = 0;
+  int idx = 0;
+  int blk_idx = 0;        /* index of next sequence expected in current block */
+  bool is_started = false; /* has any line of family been read? */
+  bool is_ended = false;   /* has "//" been read? */
+  bool in_block = false;   /* has any sequence line of current block been read? */
+
+  MSA_Reuse(msa);
+
+  while ((line_size = getline(&line_buf, &line_buf_size, fp)), line_size >= 0) {
+    /* remove end line */
+    while (line_size > 0 && (line_buf[line_size - 1] == '\n' || line_buf[line_size - 1] == '\r')) {
+      line_buf[--line_size] = '\0';
+    }
+
+    /* end of family */
+    if (STR_ComparePrefix(line_buf, "//", 2) == 0) {
+      is_ended = true;
+      break;
+    }
+
+    /* blank line ends block */
+    text = line_buf;
+    while (isspace(*text)) {
+      text++;
+    }
+    if (*text == '\0') {
+      if (in_block == true) {
+        blk_idx = 0;
+        in_block = false;
+      }
+      continue;
+    }
+    is_started = true;
+
+    /* family annotation */
+    if (STR_ComparePrefix(line_buf, "#=GF", 4) == 0) {
+      MSA_Stockholm_Annotation(msa, line_buf + 4);
+      continue;
+    }
+    /* header, other annotation, and comments */
+    if (line_buf[0] == '#') {
+      continue;
+    }
+
+    /* sequence line: {name} {aligned text} */
+    sqname = line_buf;
+    for (text = line_buf; *text != '\0' && isspace(*text) == false; text++) {
+    }
+    if (*text != '\0') {
+      *text = '\0';
+      text++;
+    }
+    while (isspace(*text)) {
+      text++;
+    }
+    for (text_len = 0; text[text_len] != '\0' && isspace(text[text_len]) == false; text_len++) {
+    }
+
+    /* sequences are usually in same order in each block */
+    in_block = true;
+    if (blk_idx < msa->N && strcmp(msa->sqnames[blk_idx], sqname) == 0) {
+      idx = blk_idx;
+    } else {
+      idx = MSA_Search_Name(msa, sqname);
+      if (idx < 0) {
+        idx = MSA_Pushback(msa, sqname);
+      }
+    }
+    MSA_AppendSeq(msa, idx, text, text_len);
+    blk_idx = idx + 1;
+  }
+  ERROR_free(line_buf);
+
+  if (is_started == false && is_ended == false) {
+    return false;
+  }
+
+  /* all sequences must be aligned to same length */
+  msa->alen = (msa->N > 0) ? msa->aseq_lens[0] : 0;
+  for (int i = 1; i < msa->N; i++) {
+    if (msa->aseq_lens[i] != msa->alen) {
+      fprintf(stderr, "ERROR: Sequence '%s' of MSA '%s' has aligned length %d, but expected %d.\n",
+              msa->sqnames[i], (msa->name != NULL ? msa->name : "(unnamed)"), msa->aseq_lens[i], msa->alen);
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+  }
+
+  return true;
+}
+
+/*! FUNCTION:  MSA_Stockholm_Annotation()
+ *  SYNOPSIS:  Parse family annotation <line> (following "#=GF") into <msa>.
+ *             Multiple DE lines are joined by spaces.
+ */
+static void
+MSA_Stockholm_Annotation(MSA* msa,
+                         char* line) {
+  char* tag = NULL;
+  char* value = NULL;
+  char* desc = NULL;
+
+  /* split into tag and value */
+  for (tag = line; isspace(*tag); tag++) {
+  }
+  for (value = tag; *value != '\0' && isspace(*value) == false; value++) {
+  }
+  if (*value != '\0') {
+    *value = '\0';
+    value++;
+  }
+  while (isspace(*value)) {
+    value++;
+  }
+
+  if (strcmp(tag, "ID") == 0) {
+    msa->name = STR_Set(msa->name, value);
+  }
+  elif (strcmp(tag, "AC") == 0) {
+    msa->acc = STR_Set(msa->acc, value);
+  }
+  elif (strcmp(tag, "DE") == 0) {
+    if (msa->desc == NULL) {
+      msa->desc = STR_Create(value);
+    } else {
+      desc = STR_Concat(msa->desc, " ");
+      msa->desc = STR_Destroy(msa->desc);
+      msa->desc = STR_Concat(desc, value);
+      desc = STR_Destroy(desc);
+    }
+  }
+}
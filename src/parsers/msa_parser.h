@@ -0,0 +1,17 @@
+/*******************************************************************************
+ *  - FILE:   msa_parser.h
+ *  - DESC:    Parses MSA families from Stockholm file.
+ *******************************************************************************/
+
+#ifndef _MSA_PARSER_H
+#define _MSA_PARSER_H
+
+/*! FUNCTION:  MSA_Stockholm_Parse()
+ *  SYNOPSIS:  Parse next family of Stockholm file <fp> into <msa>, reading up to and including its "//" line.
+ *             Keeps ID, AC and DE annotation of family and aligned text of each sequence; other annotation is ignored.
+ *             Sequences split over multiple blocks are joined by name.
+ *     RETURN: <true> if family was parsed; <false> if end of file was reached first.
+ */
+bool MSA_Stockholm_Parse(MSA* msa, FILE* fp);
+
+#endif /* _MSA_PARSER_H */
@@ -0,0 +1,463 @@
+/*******************************************************************************
+ *  - FILE:   msa_to_profile.c
+ *  - DESC:    Converts an MSA to HMM_PROFILE.
+ *             Modeled after HMMER p7_Builder() with default options: builds model from weighted
+ *             counts of alignment, then calibrates its e-value distribution parameters on random sequences.
+ *             Match emission priors use substitution matrix pseudocounts of SEQ_BUILDER, in place of
+ *             HMMER's dirichlet mixture.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+
+/* self header */
+#include "_parsers.h"
+
+/* states of sequence path through model, for counting */
+#define PATH_NONE 0
+#define PATH_M 1
+#define PATH_I 2
+#define PATH_D 3
+
+/* private functions */
+static void
+MSA_Digitize(MSA* msa, signed char* dsq);
+static void
+MSA_Weights_PB(MSA* msa, signed char* dsq, int* first, int* last, float symfrac, double* wgt);
+static void
+MSA_Count(MSA* msa, signed char* dsq, double* wgt, int* first, int* last, bool* is_matcol, int T, double* mcount, double* tcount);
+static double
+HMM_PROFILE_From_Counts(SEQ_BUILDER* bld, HMM_PROFILE* prof, double* mcount, double* mpseudo, double* tcount, double scale);
+
+/*! FUNCTION:  MSA_to_HMM_PROFILE()
+ *  SYNOPSIS:  Converts MSA <msa> to HMM_PROFILE model <prof>, using builder <bld>.
+ *             Profile is left in real space: caller must run HMM_PROFILE_Config() before searching.
+ *             Each thread needs its own <bld>.
+ */
+void MSA_to_HMM_PROFILE(SEQ_BUILDER* bld,
+                        MSA* msa,
+                        HMM_PROFILE* prof) {
+  HMM_PROFILE_From_MSA(bld, prof, msa);
+  HMM_PROFILE_SetComposition(prof);
+  HMM_PROFILE_Calibrate(bld, prof);
+}
+
+/*! FUNCTION:  HMM_PROFILE_From_MSA()
+ *  SYNOPSIS:  Create HMM <prof> from MSA <msa> (modeled after HMMER p7_Builder(), with its default options).
+ *             Sequences are weighted by position-based weights; columns with enough weighted residues are match nodes;
+ *             sequences spanning only part of the alignment are fragments, whose flanking gaps are not counted.
+ *             Counts are scaled down to an effective number of sequences so that mean match relative entropy
+ *             meets target (entropy weighting).  Match emissions are mixed with BLOSUM62 pseudocounts, transitions
+ *             use a dirichlet prior, and insert emissions are background.
+ */
+void HMM_PROFILE_From_MSA(SEQ_BUILDER* bld,
+                          HMM_PROFILE* prof,
+                          MSA* msa) {
+  int N = msa->N;
+  int alen = msa->alen;
+  int T = 0;                   /* number of match nodes */
+  signed char* dsq = NULL;     /* digitized alignment: residue, NUM_AMINO for unknown residue, or -1 for gap */
+  double* wgt = NULL;          /* weight of each sequence */
+  int* first = NULL;           /* first residue column of each sequence */
+  int* last = NULL;            /* last residue column of each sequence */
+  bool* is_matcol = NULL;      /* whether each column is match node */
+  double* mcount = NULL;       /* weighted match emission counts of each node */
+  double* mpseudo = NULL;      /* substitution matrix pseudocount frequencies of each node */
+  double* tcount = NULL;       /* weighted transition counts of each node */
+  double res, gap, sum;
+  double etarget, re, scale, lo, hi;
+  HMM_NODE* node = NULL;
+
+  dsq = ERROR_malloc(sizeof(signed char) * MAX(N * alen, 1));
+  wgt = ERROR_malloc(sizeof(double) * MAX(N, 1));
+  first = ERROR_malloc(sizeof(int) * MAX(N, 1));
+  last = ERROR_malloc(sizeof(int) * MAX(N, 1));
+  is_matcol = ERROR_malloc(sizeof(bool) * MAX(alen, 1));
+
+  MSA_Digitize(msa, dsq);
+
+  /* span of each sequence: fragments are shorter than threshold of alignment length */
+  for (int i = 0; i < N; i++) {
+    first[i] = -1;
+    last[i] = -1;
+    for (int c = 0; c < alen; c++) {
+      if (dsq[i * alen + c] >= 0) {
+        if (first[i] < 0) {
+          first[i] = c;
+        }
+        last[i] = c;
+      }
+    }
+    /* full sequences count all gaps */
+    if (first[i] >= 0 && (last[i] - first[i] + 1) >= bld->fragthresh * alen) {
+      first[i] = 0;
+      last[i] = alen - 1;
+    }
+  }
+  MSA_Weights_PB(msa, dsq, first, last, bld->symfrac, wgt);
+
+  /* match columns: weighted fraction of residues (ignoring gaps outside of fragment span) */
+  for (int c = 0; c < alen; c++) {
+    res = 0.0;
+    gap = 0.0;
+    for (int i = 0; i < N; i++) {
+      if (dsq[i * alen + c] >= 0) {
+        res += wgt[i];
+      }
+      elif (c >= first[i] && c <= last[i]) {
+        gap += wgt[i];
+      }
+    }
+    is_matcol[c] = (res > 0.0 && res / (res + gap) >= bld->symfrac);
+    T += (is_matcol[c] == true);
+  }
+  if (T == 0) {
+    fprintf(stderr, "ERROR: MSA '%s' has no match columns (no column has residues in at least %.2f of sequences).\n",
+            (msa->name != NULL ? msa->name : "(unnamed)"), bld->symfrac);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  /* weighted counts of sequence paths */
+  mcount = ERROR_malloc(sizeof(double) * (T + 1) * NUM_AMINO);
+  mpseudo = ERROR_malloc(sizeof(double) * (T + 1) * NUM_AMINO);
+  tcount = ERROR_malloc(sizeof(double) * (T + 1) * NUM_TRANS_STATES);
+  MSA_Count(msa, dsq, wgt, first, last, is_matcol, T, mcount, tcount);
+
+  /* pseudocount frequencies: observed frequencies of node, substituted by BLOSUM62 conditional probabilities */
+  for (int k = 1; k <= T; k++) {
+    sum = 0.0;
+    for (int a = 0; a < NUM_AMINO; a++) {
+      sum += mcount[k * NUM_AMINO + a];
+    }
+    for (int b = 0; b < NUM_AMINO; b++) {
+      mpseudo[k * NUM_AMINO + b] = 0.0;
+      for (int a = 0; a < NUM_AMINO; a++) {
+        mpseudo[k * NUM_AMINO + b] += (sum > 0.0) ? (mcount[k * NUM_AMINO + a] / sum) * bld->cond[a][b] : BG_MODEL[a] * bld->cond[a][b];
+      }
+    }
+  }
+
+  /* set up profile */
+  HMM_PROFILE_Reuse(prof);
+  HMM_PROFILE_SetModel_Length(prof, T);
+  HMM_PROFILE_SetTextField(&prof->name, msa->name);
+  HMM_PROFILE_SetTextField(&prof->acc, msa->acc);
+  HMM_PROFILE_SetTextField(&prof->desc, msa->desc);
+
+  /* entropy weighting: target relative entropy is raised for short models, so they have enough total information */
+  etarget = (bld->esigma - log2(2.0 / ((double)T * (double)(T + 1)))) / (double)T;
+  etarget = MAX(etarget, bld->ere);
+  scale = 1.0;
+  re = HMM_PROFILE_From_Counts(bld, prof, mcount, mpseudo, tcount, scale);
+  if (re > etarget) {
+    lo = 0.0;
+    hi = 1.0;
+    for (int it = 0; it < 50 && fabs(re - etarget) > 1e-3; it++) {
+      scale = (lo + hi) / 2.0;
+      re = HMM_PROFILE_From_Counts(bld, prof, mcount, mpseudo, tcount, scale);
+      if (re > etarget) {
+        hi = scale;
+      } else {
+        lo = scale;
+      }
+    }
+  }
+  prof->nseq = N;
+  prof->effn = scale * N;
+
+  /* special match probabilities and delete transitions for initial node */
+  node = &prof->hmm_model[0];
+  node->match[0] = 1.0f;
+  for (int j = 1; j < NUM_AMINO_PLUS_SPEC; j++) {
+    node->match[j] = 0.0f;
+  }
+  node->trans[D2M] = 1.0;
+  node->trans[D2D] = 0.0;
+
+  /* update bg data to reflect insert and transition of initial node (as parsed from .hmm file) */
+  for (int j = 0; j < NUM_AMINO; j++) {
+    prof->bg_model->freq[j] = BG_MODEL[j];
+    prof->bg_model->insert[j] = prof->hmm_model[0].insert[j];
+  }
+  for (int j = 0; j < NUM_TRANS_STATES; j++) {
+    prof->bg_model->trans[j] = prof->hmm_model[0].trans[j];
+  }
+
+  prof->numberFormat = PROF_FORMAT_REAL;
+
+  ERROR_free(dsq);
+  ERROR_free(wgt);
+  ERROR_free(first);
+  ERROR_free(last);
+  ERROR_free(is_matcol);
+  ERROR_free(mcount);
+  ERROR_free(mpseudo);
+  ERROR_free(tcount);
+}
+
+/*! FUNCTION:  MSA_Digitize()
+ *  SYNOPSIS:  Digitize aligned text of <msa> into <dsq>, one row of <alen> per sequence.
+ *             Residues map to alphabet index, residues outside of alphabet to NUM_AMINO, and gaps to -1.
+ */
+static void
+MSA_Digitize(MSA* msa,
+             signed char* dsq) {
+  int alen = msa->alen;
+  int ch, a;
+
+  for (int i = 0; i < msa->N; i++) {
+    for (int c = 0; c < alen; c++) {
+      ch = (unsigned char)msa->aseqs[i][c];
+      if (isalpha(ch) == false) {
+        dsq[i * alen + c] = -1;
+        continue;
+      }
+      ch = toupper(ch);
+      a = (ch < 100) ? AA_REV[ch] : -1;
+      dsq[i * alen + c] = (a >= 0 && a < NUM_AMINO) ? a : NUM_AMINO;
+    }
+  }
+}
+
+/*! FUNCTION:  MSA_Weights_PB()
+ *  SYNOPSIS:  Set position-based sequence weights <wgt> of digitized <dsq> of <msa> (modeled after Easel esl_msaweight_PB_adv()).
+ *             Each residue is weighted by inverse of number of residue types in its column and their count,
+ *             normalized by number of residues counted.  Only consensus columns are counted: those with at least
+ *             <symfrac> of residues (ignoring gaps outside of fragment span [<first>,<last>]), or all columns if none are.
+ *             Weights sum to number of sequences.
+ */
+static void
+MSA_Weights_PB(MSA* msa,
+               signed char* dsq,
+               int* first,
+               int* last,
+               float symfrac,
+               double* wgt) {
+  int N = msa->N;
+  int alen = msa->alen;
+  int nres[NUM_AMINO + 1];
+  int ntypes, res, gap;
+  int* rlen = NULL;
+  bool* is_conscol = NULL;
+  bool is_any_cons = false;
+  double sum = 0.0;
+  int x;
+
+  /* consensus columns (unweighted) */
+  is_conscol = ERROR_malloc(sizeof(bool) * MAX(alen, 1));
+  for (int c = 0; c < alen; c++) {
+    res = 0;
+    gap = 0;
+    for (int i = 0; i < N; i++) {
+      if (dsq[i * alen + c] >= 0) {
+        res++;
+      }
+      elif (c >= first[i] && c <= last[i]) {
+        gap++;
+      }
+    }
+    is_conscol[c] = (res > 0 && (float)res / (float)(res + gap) >= symfrac);
+    is_any_cons = (is_any_cons || is_conscol[c]);
+  }
+
+  rlen = ERROR_malloc(sizeof(int) * MAX(N, 1));
+  for (int i = 0; i < N; i++) {
+    wgt[i] = 0.0;
+    rlen[i] = 0;
+  }
+
+  for (int c = 0; c < alen; c++) {
+    if (is_any_cons == true && is_conscol[c] == false) {
+      continue;
+    }
+    for (int a = 0; a <= NUM_AMINO; a++) {
+      nres[a] = 0;
+    }
+    for (int i = 0; i < N; i++) {
+      x = dsq[i * alen + c];
+      if (x >= 0) {
+        nres[x]++;
+      }
+    }
+    ntypes = 0;
+    for (int a = 0; a <= NUM_AMINO; a++) {
+      ntypes += (nres[a] > 0);
+    }
+    for (int i = 0; i < N; i++) {
+      x = dsq[i * alen + c];
+      if (x >= 0) {
+        wgt[i] += 1.0 / (double)(ntypes * nres[x]);
+        rlen[i]++;
+      }
+    }
+  }
+
+  for (int i = 0; i < N; i++) {
+    if (rlen[i] > 0) {
+      wgt[i] /= (double)rlen[i];
+    }
+    sum += wgt[i];
+  }
+  for (int i = 0; i < N; i++) {
+    wgt[i] = (sum > 0.0) ? wgt[i] * (double)N / sum : 1.0;
+  }
+
+  ERROR_free(rlen);
+  ERROR_free(is_conscol);
+}
+
+/*! FUNCTION:  MSA_Count()
+ *  SYNOPSIS:  Count weighted match emissions <mcount> and transitions <tcount> of each node of <T> match columns,
+ *             from path of each sequence of digitized <dsq> of <msa> (modeled after HMMER p7_trace_Count()).
+ *             Each path starts at begin (node 0 match state) and is counted within span [<first>,<last>] of sequence;
+ *             fragment paths start and end at their first and last residue (local entry and exit, not counted).
+ *             Inserts before first or after last node are flanking, and are not counted.
+ *             Delete-insert transitions are not in model, and are not counted.
+ */
+static void
+MSA_Count(MSA* msa,
+          signed char* dsq,
+          double* wgt,
+          int* first,
+          int* last,
+          bool* is_matcol,
+          int T,
+          double* mcount,
+          double* tcount) {
+  int alen = msa->alen;
+  int prv, cur, k, x;
+
+  for (int i = 0; i < (T + 1) * NUM_AMINO; i++) {
+    mcount[i] = 0.0;
+  }
+  for (int i = 0; i < (T + 1) * NUM_TRANS_STATES; i++) {
+    tcount[i] = 0.0;
+  }
+
+  for (int i = 0; i < msa->N; i++) {
+    if (first[i] < 0) {
+      continue;
+    }
+
+    /* full sequences start from begin; fragments start at their first residue */
+    prv = (first[i] == 0 && last[i] == alen - 1) ? PATH_M : PATH_NONE;
+    k = 0;
+    for (int c = 0; c < first[i]; c++) {
+      k += (is_matcol[c] == true);
+    }
+
+    for (int c = first[i]; c <= last[i]; c++) {
+      x = dsq[i * alen + c];
+      if (is_matcol[c] == true) {
+        cur = (x >= 0) ? PATH_M : PATH_D;
+        /* transition from node k to node k+1 */
+        if (prv == PATH_M) {
+          tcount[k * NUM_TRANS_STATES + (cur == PATH_M ? M2M : M2D)] += wgt[i];
+        }
+        elif (prv == PATH_I && cur == PATH_M) {
+          tcount[k * NUM_TRANS_STATES + I2M] += wgt[i];
+        }
+        elif (prv == PATH_D) {
+          tcount[k * NUM_TRANS_STATES + (cur == PATH_M ? D2M : D2D)] += wgt[i];
+        }
+        k++;
+        if (cur == PATH_M && x < NUM_AMINO) {
+          mcount[k * NUM_AMINO + x] += wgt[i];
+        }
+        prv = cur;
+      }
+      elif (x >= 0 && k > 0 && k < T) {
+        cur = PATH_I;
+        if (prv == PATH_M) {
+          tcount[k * NUM_TRANS_STATES + M2I] += wgt[i];
+        }
+        elif (prv == PATH_I) {
+          tcount[k * NUM_TRANS_STATES + I2I] += wgt[i];
+        }
+        prv = cur;
+      }
+    }
+  }
+}
+
+/*! FUNCTION:  HMM_PROFILE_From_Counts()
+ *  SYNOPSIS:  Set emissions and transitions of <prof> from counts <mcount> and <tcount> scaled by <scale>, mixed with
+ *             <pseudo> weight of pseudocount frequencies <mpseudo> and dirichlet prior <tprior> of builder <bld>.
+ *     RETURN: Mean match relative entropy of <prof> (in bits).
+ */
+static double
+HMM_PROFILE_From_Counts(SEQ_BUILDER* bld,
+                        HMM_PROFILE* prof,
+                        double* mcount,
+                        double* mpseudo,
+                        double* tcount,
+                        double scale) {
+  int T = prof->N;
+  double* tc = NULL;
+  double sum, p;
+  double re = 0.0;
+  HMM_NODE* node = NULL;
+
+  for (int k = 0; k <= T; k++) {
+    node = &prof->hmm_model[k];
+    tc = &tcount[k * NUM_TRANS_STATES];
+
+    /* match emission */
+    if (k > 0) {
+      sum = 0.0;
+      for (int a = 0; a < NUM_AMINO; a++) {
+        sum += mcount[k * NUM_AMINO + a];
+      }
+      for (int a = 0; a < NUM_AMINO; a++) {
+        p = (scale * mcount[k * NUM_AMINO + a] + bld->pseudo * mpseudo[k * NUM_AMINO + a]) / (scale * sum + bld->pseudo);
+        node->match[a] = p;
+        re += (p > 0.0) ? p * log2(p / BG_MODEL[a]) : 0.0;
+      }
+    }
+    for (int a = NUM_AMINO; a < NUM_AMINO_PLUS_SPEC; a++) {
+      node->match[a] = 0.0f;
+    }
+
+    /* insertion emmission (uses hardcoded background frequencies) */
+    for (int a = 0; a < NUM_AMINO; a++) {
+      node->insert[a] = BG_MODEL[a];
+    }
+    for (int a = NUM_AMINO; a < NUM_AMINO_PLUS_SPEC; a++) {
+      node->insert[a] = 0.0f;
+    }
+
+    /* transitions: match, insert, and delete groups */
+    sum = scale * (tc[M2M] + tc[M2I] + tc[M2D]) + bld->tprior[M2M] + bld->tprior[M2I] + bld->tprior[M2D];
+    node->trans[M2M] = (scale * tc[M2M] + bld->tprior[M2M]) / sum;
+    node->trans[M2I] = (scale * tc[M2I] + bld->tprior[M2I]) / sum;
+    node->trans[M2D] = (scale * tc[M2D] + bld->tprior[M2D]) / sum;
+    sum = scale * (tc[I2M] + tc[I2I]) + bld->tprior[I2M] + bld->tprior[I2I];
+    node->trans[I2M] = (scale * tc[I2M] + bld->tprior[I2M]) / sum;
+    node->trans[I2I] = (scale * tc[I2I] + bld->tprior[I2I]) / sum;
+    sum = scale * (tc[D2M] + tc[D2D]) + bld->tprior[D2M] + bld->tprior[D2D];
+    node->trans[D2M] = (scale * tc[D2M] + bld->tprior[D2M]) / sum;
+    node->trans[D2D] = (scale * tc[D2D] + bld->tprior[D2D]) / sum;
+  }
+
+  /* final node transitions: no delete state follows */
+  node = &prof->hmm_model[T];
+  sum = node->trans[M2M] + node->trans[M2I];
+  node->trans[M2M] /= sum;
+  node->trans[M2I] /= sum;
+  node->trans[M2D] = 0.0;
+  node->trans[D2M] = 1.0;
+  node->trans[D2D] = 0.0;
+
+  return re / (double)T;
+}
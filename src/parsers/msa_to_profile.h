@@ -0,0 +1,26 @@
+/*******************************************************************************
+ *  - FILE:   msa_to_profile.h
+ *  - DESC:    Converts an MSA to HMM_PROFILE model.
+ *******************************************************************************/
+
+#ifndef _MSA_TO_PROFILE_H
+#define _MSA_TO_PROFILE_H
+
+/*! FUNCTION:  MSA_to_HMM_PROFILE()
+ *  SYNOPSIS:  Converts MSA <msa> to HMM_PROFILE model <prof>, using builder <bld>.
+ *             Profile is left in real space: caller must run HMM_PROFILE_Config() before searching.
+ *             Each thread needs its own <bld>.
+ */
+void MSA_to_HMM_PROFILE(SEQ_BUILDER* bld, MSA* msa, HMM_PROFILE* prof);
+
+/*! FUNCTION:  HMM_PROFILE_From_MSA()
+ *  SYNOPSIS:  Create HMM <prof> from MSA <msa> (modeled after HMMER p7_Builder(), with its default options).
+ *             Sequences are weighted by position-based weights; columns with enough weighted residues are match nodes;
+ *             sequences spanning only part of the alignment are fragments, whose flanking gaps are not counted.
+ *             Counts are scaled down to an effective number of sequences so that mean match relative entropy
+ *             meets target (entropy weighting).  Match emissions are mixed with BLOSUM62 pseudocounts, transitions
+ *             use a dirichlet prior, and insert emissions are background.
+ */
+void HMM_PROFILE_From_MSA(SEQ_BUILDER* bld, HMM_PROFILE* prof, MSA* msa);
+
+#endif /* _MSA_TO_PROFILE_H */
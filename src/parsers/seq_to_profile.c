@@ -1,6 +1,8 @@
 /*******************************************************************************
  *  - FILE:   seq_to_model.c
  *  - DESC:    Converts a SEQUENCE to HMM_PROFILE.
+ *             Modeled after HMMER p7_SingleBuilder(): builds model from sequence,
+ *             then calibrates its e-value distribution parameters on random sequences.
  *******************************************************************************/
 
 /* imports */
@@ -12,114 +14,133 @@
 #include <math.h>
 #include <ctype.h>
 
+/* easel imports */
+#include "esl_gumbel.h"
+
 /* local imports */
 #include "../objects/structs.h"
 #include "../utilities/_utilities.h"
 #include "../objects/_objects.h"
+#include "../algs_linear/_algs_linear.h"
 
 /* self header */
 #include "_parsers.h"
 
-/* converts single SEQUENCE to HMM_PROFILE model */
-void SEQUENCE_to_HMM_PROFILE(SEQUENCE* seq,
+/* private functions */
+static void
+HMM_PROFILE_Calibrate_Sample(SEQ_BUILDER* bld, unsigned int* seed, int L);
+static float
+HMM_PROFILE_Calibrate_MSV(SEQ_BUILDER* bld, HMM_PROFILE* prof, SEQUENCE* seq);
+static double
+HMM_PROFILE_Calibrate_NullScore(int L);
+
+/*! FUNCTION:  SEQUENCE_to_HMM_PROFILE()
+ *  SYNOPSIS:  Converts single SEQUENCE <seq> to HMM_PROFILE model <prof>, using builder <bld>.
+ *             Profile is left in real space: caller must run HMM_PROFILE_Config() before searching.
+ *             Each thread needs its own <bld>.
+ */
+void SEQUENCE_to_HMM_PROFILE(SEQ_BUILDER* bld,
+                             SEQUENCE* seq,
                              HMM_PROFILE* prof) {
-  printf("# converting sequence to profile...\n");
-  HMM_PROFILE_From_Seq(prof, seq);
+  HMM_PROFILE_From_Seq(bld, prof, seq);
   HMM_PROFILE_SetComposition(prof);
-  HMM_PROFILE_Calibrate(prof);
+  HMM_PROFILE_Calibrate(bld, prof);
 }
 
-/* create HMM from SEQUENCE */
-void HMM_PROFILE_From_Seq(HMM_PROFILE* prof,
+/*! FUNCTION:  HMM_PROFILE_From_Seq()
+ *  SYNOPSIS:  Create HMM <prof> from SEQUENCE <seq> (modeled after HMMER p7_Seqmodel()).
+ *             Match emissions of each node are conditional probabilities of its residue under BLOSUM62,
+ *             residues outside of alphabet emit background.  Insert emissions are background.
+ */
+void HMM_PROFILE_From_Seq(SEQ_BUILDER* bld,
+                          HMM_PROFILE* prof,
                           SEQUENCE* seq) {
-  FILE* fp = NULL; /* debugger filepointer */
-
-  int N = 0;  /* length of sequence */
-  char a = 0; /* profile emission */
-  char b = 0; /* sequence emission */
-
-  double popen = 0.;   /* gap open probability */
-  double pextend = 0.; /* gap extention probability */
-
-  char* bld_path = NULL;  /* path to data folder */
-  char* bld_fname = NULL; /* path to singlebuilder matrix */
-  /* NOTE: this is global so it only needs to be initialized once */
-  // SCORE_MATRIX*  bld            = NULL;
-
-  /* gap open/extend (defaults from HMMER) */
-  popen = 0.02;
-  pextend = 0.4;
-
-  /* SingleBuilder probability matrix (created by HMMER using p7_SingleBuilder, dependent on only bg frequencies) */
-  /* NOTE: currently stored externally, but could be integrated in worker object.  Also, never freed. */
-  /* TODO: need to set PREFIX in makefile */
-  if (bld == NULL) {
-    bld_path = STR_Create(MACRO_STR(PREFIX));
-    bld_fname = STR_Create("data/submat/singlebuilder.submat");
-    bld = SCORE_MATRIX_Load(bld_fname);
-    ERROR_free(bld_path);
-    ERROR_free(bld_fname);
-  }
+  int N = 0;             /* length of sequence */
+  int a = 0;             /* sequence residue */
+  HMM_NODE* node = NULL; /* current node */
+  float popen = bld->popen;
+  float pextend = bld->pextend;
 
   /* resize profile if necessary */
   N = seq->N;
-  HMM_PROFILE_SetModel_Length(prof, seq->N);
+  HMM_PROFILE_Reuse(prof);
+  HMM_PROFILE_SetModel_Length(prof, N);
   HMM_PROFILE_SetTextField(&prof->name, seq->name);
-
-  /* special match probabilities for initial node */
-  MSC_X(prof, 0, 0) = 1.;
-  for (int j = 1; j < NUM_AMINO; j++)
-    MSC_X(prof, 0, j) = 0.;
+  HMM_PROFILE_SetTextField(&prof->acc, NULL);
+  HMM_PROFILE_SetTextField(&prof->desc, NULL);
+  prof->nseq = 1;
+  prof->effn = 1.0f;
 
   /* for each node in sequence */
   for (int i = 0; i <= N; i++) {
+    node = &prof->hmm_model[i];
+
+    /* match emission (uses BLOSUM62 conditional probabilities) */
     if (i > 0) {
-      a = seq->seq[i - 1];
-      /* match emission (uses singlebuilder ) */
+      a = toupper((unsigned char)seq->seq[i - 1]);
+      a = (a < 100) ? AA_REV[a] : -1;
       for (int j = 0; j < NUM_AMINO; j++) {
-        b = AA[j];
-        MSC_X(prof, i, j) = SCORE_MATRIX_GetScore(bld, a, b);
+        node->match[j] = (a >= 0 && a < NUM_AMINO) ? bld->cond[a][j] : BG_MODEL[j];
       }
     }
+    for (int j = NUM_AMINO; j < NUM_AMINO_PLUS_SPEC; j++) {
+      node->match[j] = 0.0f;
+    }
 
     /* insertion emmission (uses hardcoded background frequencies) */
     for (int j = 0; j < NUM_AMINO; j++) {
-      ISC_X(prof, i, j) = BG_MODEL[j];
+      node->insert[j] = BG_MODEL[j];
+    }
+    for (int j = NUM_AMINO; j < NUM_AMINO_PLUS_SPEC; j++) {
+      node->insert[j] = 0.0f;
     }
 
     /* transition scores */
-    TSC_X(prof, i, M2M) = 1.0 - 2 * popen;
-    TSC_X(prof, i, M2I) = popen;
-    TSC_X(prof, i, M2D) = popen;
-    TSC_X(prof, i, I2M) = 1.0 - pextend;
-    TSC_X(prof, i, I2I) = pextend;
-    TSC_X(prof, i, D2M) = 1.0 - pextend;
-    TSC_X(prof, i, D2D) = pextend;
+    node->trans[M2M] = 1.0 - 2 * popen;
+    node->trans[M2I] = popen;
+    node->trans[M2D] = popen;
+    node->trans[I2M] = 1.0 - pextend;
+    node->trans[I2I] = pextend;
+    node->trans[D2M] = 1.0 - pextend;
+    node->trans[D2D] = pextend;
+  }
+
+  /* special match probabilities and delete transitions for initial node */
+  node = &prof->hmm_model[0];
+  node->match[0] = 1.0f;
+  for (int j = 1; j < NUM_AMINO; j++) {
+    node->match[j] = 0.0f;
   }
+  node->trans[D2M] = 1.0;
+  node->trans[D2D] = 0.0;
 
   /* final node transitions */
-  TSC_X(prof, N, M2M) = 1.0 - popen;
-  TSC_X(prof, N, M2D) = 0.0;
-  TSC_X(prof, N, D2M) = 1.0;
-  TSC_X(prof, N, D2D) = 0.0;
+  node = &prof->hmm_model[N];
+  node->trans[M2M] = 1.0 - popen;
+  node->trans[M2D] = 0.0;
+  node->trans[D2M] = 1.0;
+  node->trans[D2D] = 0.0;
 
-  /* update bg data to reflect insert and transition (same as all but first and last node) */
+  /* update bg data to reflect insert and transition of initial node (as parsed from .hmm file) */
   for (int j = 0; j < NUM_AMINO; j++) {
-    prof->bg_model->insert[j] = prof->hmm_model[1].insert[j];
+    prof->bg_model->freq[j] = BG_MODEL[j];
+    prof->bg_model->insert[j] = prof->hmm_model[0].insert[j];
   }
   for (int j = 0; j < NUM_TRANS_STATES; j++) {
-    prof->bg_model->trans[j] = prof->hmm_model[1].trans[j];
+    prof->bg_model->trans[j] = prof->hmm_model[0].trans[j];
   }
 
-  /* free data */
-  // SCORE_MATRIX_Destroy( bld );
+  prof->numberFormat = PROF_FORMAT_REAL;
 }
 
-/* set background composition of sequence */
+/*! FUNCTION:  HMM_PROFILE_SetComposition()
+ *  SYNOPSIS:  Set background composition of <prof> to its mean residue composition, weighted by
+ *             state occupancy (modeled after HMMER p7_hmm_SetComposition()).
+ */
 void HMM_PROFILE_SetComposition(HMM_PROFILE* prof) {
   float* mocc = NULL; /* match occupancy */
   float* iocc = NULL; /* insert occupancy */
-  int k;
+  float sum = 0.0f;
 
   /* */
   mocc = (float*)ERROR_malloc(sizeof(float) * (prof->N + 1));
@@ -141,7 +162,6 @@ void HMM_PROFILE_SetComposition(HMM_PROFILE* prof) {
   }
 
   /* normalize the composition */
-  int sum = 0;
   for (int i = 0; i < NUM_AMINO; i++) {
     sum += prof->bg_model->compo[i];
   }
@@ -159,77 +179,155 @@ void HMM_PROFILE_SetComposition(HMM_PROFILE* prof) {
   ERROR_free(iocc);
 }
 
-/* TODO */
-// void HMM_BG_SetLength( HMM_BG*  bg,
-//                         int      L )
-// {
-//    bg->p1 = (float) L / (float) (L+1);
-
-//    bg->fhmm->t[0][0] = bg->p1;
-//    bg->fhmm->t[0][1] = 1.0f - bg->p1;
-// }
-
-/* TODO */
-/* run simulation to calibrate e-value parameters of model */
-void HMM_PROFILE_Calibrate(HMM_PROFILE* prof) {
-  // ESL_RANDOMNESS*   r        = NULL;
-  // int               EmL      = 200;
-  // int               EmN      = 200;
-  // int               EvL      = 200;
-  // int               EvN      = 200;
-  // int               EfL      = 100;
-  // int               EfN      = 200;
-  // double            Eft      = 0.04;
-  // double            lambda, mmu, vmu, tau;
-
-  // /* initialize random number generator */
-  // ((r = esl_randomness_CreateFast(42)) == NULL) ESL_XFAIL(eslEMEM, errbuf, "failed to create RNG");
-  // /* lambda: MSV, VITERBI, FORWARD */
-  // HMM_PROFILE_CalibrateLambda( prof, &lambda );
-  // /* mu: MSV */
-  // // HMM_PROFILE_CalibrateMSVMu( prof, r, EmL, EmN, lambda, &mmu );
-  // /* mu: Viterbi */
-  // // HMM_PROFILE_CalibrateViterbiMu( prof, r, EmL, EmN, lambda, &mmu );
-  // /* tau */
-  // HMM_PROFILE_CalibrateTau( prof, r, EfL, EfN, lambda, Eft, &tau );
-
-  // esl_randomness_Destroy(r);
+/*! FUNCTION:  HMM_PROFILE_Calibrate()
+ *  SYNOPSIS:  Run simulation to calibrate e-value distribution parameters of <prof> (modeled after HMMER p7_Calibrate()).
+ *             Lambda is estimated from mean match relative entropy (p7_Lambda()); MSV and Viterbi mu are fit to
+ *             Gumbel scores of random background sequences; Forward tau is fit to the tail of their Forward scores.
+ *             Random sequences are seeded the same for each profile, so results do not depend on profile order or thread.
+ */
+void HMM_PROFILE_Calibrate(SEQ_BUILDER* bld,
+                           HMM_PROFILE* prof) {
+  HMM_PROFILE* cal_prof = bld->cal_prof;
+  SEQUENCE* cal_seq = bld->cal_seq;
+  double* scores = NULL;
+  unsigned int seed = bld->seed;
+  int T = prof->N;
+  double H = 0.0; /* mean match relative entropy (in bits) */
+  double lambda, mmu, vmu, tau, gmu, glam;
+  float sc;
+
+  SEQ_BUILDER_Reserve(bld, T);
+  scores = bld->cal_scores;
+
+  /* lambda: MSV, VITERBI, FORWARD (modeled after p7_Lambda()) */
+  for (int k = 1; k <= T; k++) {
+    for (int j = 0; j < NUM_AMINO; j++) {
+      if (prof->hmm_model[k].match[j] > 0.0f) {
+        H += prof->hmm_model[k].match[j] * log2(prof->hmm_model[k].match[j] / BG_MODEL[j]);
+      }
+    }
+  }
+  H /= (double)T;
+  lambda = CONST_LOG2 + 1.44 / ((double)T * H);
+
+  /* scores are computed by configured (multihit local) copy of profile */
+  HMM_PROFILE_Copy(cal_prof, prof);
+  HMM_PROFILE_Config(cal_prof, MODE_MULTILOCAL);
+
+  /* mu: MSV (modeled after p7_MSVMu()) */
+  HMM_PROFILE_ReconfigLength(cal_prof, bld->EmL);
+  for (int i = 0; i < bld->EmN; i++) {
+    HMM_PROFILE_Calibrate_Sample(bld, &seed, bld->EmL);
+    sc = HMM_PROFILE_Calibrate_MSV(bld, cal_prof, cal_seq);
+    scores[i] = (sc - HMM_PROFILE_Calibrate_NullScore(bld->EmL)) / CONST_LOG2;
+  }
+  esl_gumbel_FitCompleteLoc(scores, bld->EmN, lambda, &mmu);
+
+  /* mu: Viterbi (modeled after p7_ViterbiMu()) */
+  HMM_PROFILE_ReconfigLength(cal_prof, bld->EvL);
+  MATRIX_3D_Reuse_Clean(bld->st_MX3, NUM_NORMAL_STATES, 3, (bld->EvL + 1) + (T + 1));
+  MATRIX_2D_Reuse_Clean(bld->sp_MX, NUM_SPECIAL_STATES, bld->EvL + 1);
+  for (int i = 0; i < bld->EvN; i++) {
+    HMM_PROFILE_Calibrate_Sample(bld, &seed, bld->EvL);
+    run_Viterbi_Linear(cal_seq, cal_prof, bld->EvL, T, bld->st_MX3, bld->sp_MX, &sc);
+    scores[i] = (sc - HMM_PROFILE_Calibrate_NullScore(bld->EvL)) / CONST_LOG2;
+  }
+  esl_gumbel_FitCompleteLoc(scores, bld->EvN, lambda, &vmu);
+
+  /* tau: Forward (modeled after p7_Tau()) */
+  HMM_PROFILE_ReconfigLength(cal_prof, bld->EfL);
+  MATRIX_3D_Reuse_Clean(bld->st_MX3, NUM_NORMAL_STATES, 3, (bld->EfL + 1) + (T + 1));
+  MATRIX_2D_Reuse_Clean(bld->sp_MX, NUM_SPECIAL_STATES, bld->EfL + 1);
+  for (int i = 0; i < bld->EfN; i++) {
+    HMM_PROFILE_Calibrate_Sample(bld, &seed, bld->EfL);
+    run_Forward_Linear(cal_seq, cal_prof, bld->EfL, T, bld->st_MX3, bld->sp_MX, &sc);
+    scores[i] = (sc - HMM_PROFILE_Calibrate_NullScore(bld->EfL)) / CONST_LOG2;
+  }
+  esl_gumbel_FitComplete(scores, bld->EfN, &gmu, &glam);
+  tau = esl_gumbel_invcdf(1.0 - bld->Eft, gmu, glam);
+  tau += log(bld->Eft) / lambda;
+
+  HMM_PROFILE_SetDistribution_Params(prof, mmu, lambda, "MSV");
+  HMM_PROFILE_SetDistribution_Params(prof, vmu, lambda, "VITERBI");
+  HMM_PROFILE_SetDistribution_Params(prof, tau, lambda, "FORWARD");
+}
+
+/*! FUNCTION:  HMM_PROFILE_Calibrate_Sample()
+ *  SYNOPSIS:  Set calibration sequence of <bld> to random sequence of length <L>, with iid residues of
+ *             background frequencies (modeled after esl_rsq_xfIID()).  Uses and updates random <seed>.
+ */
+static void
+HMM_PROFILE_Calibrate_Sample(SEQ_BUILDER* bld,
+                             unsigned int* seed,
+                             int L) {
+  double u;
+  int j;
+
+  for (int i = 0; i < L; i++) {
+    u = (double)rand_r(seed) / ((double)RAND_MAX + 1.0);
+    for (j = 0; j < NUM_AMINO - 1; j++) {
+      u -= BG_MODEL[j];
+      if (u < 0.0) {
+        break;
+      }
+    }
+    bld->cal_text[i] = AA[j];
+  }
+  bld->cal_text[L] = '\0';
+
+  SEQUENCE_SetSeq(bld->cal_seq, bld->cal_text);
+}
+
+/*! FUNCTION:  HMM_PROFILE_Calibrate_MSV()
+ *  SYNOPSIS:  Ungapped local Viterbi (MSV) score of <seq> against configured <prof>, in nats (modeled after p7_GMSV()).
+ *             Uniform local entry, and multihit with length configured to <seq>.
+ */
+static float
+HMM_PROFILE_Calibrate_MSV(SEQ_BUILDER* bld,
+                          HMM_PROFILE* prof,
+                          SEQUENCE* seq) {
+  int T = prof->N;
+  int L = seq->N;
+  float* dp = bld->msv_row;
+  float tloop = logf((float)L / (float)(L + 3));
+  float tmove = logf(3.0f / (float)(L + 3));
+  float tbmk = logf(2.0f / ((float)T * (float)(T + 1)));
+  float tec = logf(0.5f);
+  float xN, xB, xE, xJ, xC, sc;
+  int a;
+
+  xN = 0.0f;
+  xB = tmove;
+  xJ = -INF;
+  xC = -INF;
+  for (int k = 0; k <= T; k++) {
+    dp[k] = -INF;
+  }
+
+  for (int i = 0; i < L; i++) {
+    a = AA_REV[(int)seq->seq[i]];
+    xE = -INF;
+    /* diagonal of previous row is still in dp[k-1], when updating row right-to-left */
+    for (int k = T; k >= 1; k--) {
+      sc = MAX(dp[k - 1], xB + tbmk) + prof->hmm_model[k].match[a];
+      dp[k] = sc;
+      xE = MAX(xE, sc);
+    }
+    xJ = MAX(xJ + tloop, xE + tec);
+    xC = MAX(xC + tloop, xE + tec);
+    xN = xN + tloop;
+    xB = MAX(xN, xJ) + tmove;
+  }
+
+  return xC + tmove;
 }
 
-// /* modeled after: p7_Lambda() */
-// void HMM_PROFILE_CalibrateLambda(   HMM_PROFILE*   prof,
-//                                     int*           ret_lambda )
-// {
-//    double H = HMM_PROFILE_MeanMatchRelativeEntropy( prof );
-
-//    *ret_lambda = eslCONST_LOG2 + 1.44 / ((double) hmm->M * H);
-// }
-
-// /* modeled after: p7_MeanMatchRelativeEntropy() */
-// double HMM_PROFILE_MeanMatchRelativeEntropy( HMM_PROFILE* prof )
-// {
-//    int         k;
-//    double      KL = 0.0;
-//    HMM_COMPO*  bg = prof->bg_model;
-
-//    for (k = 1; k <= prof->N; k++) {
-//       KL += esl_vec_FRelEntropy( prof->hmm_model[k].match, bg->freq, NUM_AMINO);
-//    }
-//    KL /= (double) prof->N;
-//    return KL;
-// }
-
-// /* modeled after: esl_vec_FRelEntropy() */
-// float HMM_PROFILE_RelativeEntropy(const float *p, const float *q, int n)
-// {
-//   int    i;
-//   float  kl;
-
-//   kl = 0.;
-//   for(i = 0; i < n; i++)
-//     if (p[i] > 0.) {
-//       if (q[i] == 0.) return eslINFINITY;
-//       else            kl += p[i] * log2(p[i]/q[i]);
-//     }
-//   return kl;
-// }
+/*! FUNCTION:  HMM_PROFILE_Calibrate_NullScore()
+ *  SYNOPSIS:  Null model score of sequence of length <L>, in nats (modeled after p7_bg_NullOne()).
+ */
+static double
+HMM_PROFILE_Calibrate_NullScore(int L) {
+  double p1 = (double)L / (double)(L + 1);
+
+  return (double)L * log(p1) + log(1.0 - p1);
+}
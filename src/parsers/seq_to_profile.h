@@ -6,16 +6,32 @@
 #ifndef _SEQ_TO_MODEL_H
 #define _SEQ_TO_MODEL_H
 
-/* converts single SEQUENCE to HMM_PROFILE model */
-void SEQUENCE_to_HMM_PROFILE(SEQUENCE* seq, HMM_PROFILE* prof);
+/*! FUNCTION:  SEQUENCE_to_HMM_PROFILE()
+ *  SYNOPSIS:  Converts single SEQUENCE <seq> to HMM_PROFILE model <prof>, using builder <bld>.
+ *             Profile is left in real space: caller must run HMM_PROFILE_Config() before searching.
+ *             Each thread needs its own <bld>.
+ */
+void SEQUENCE_to_HMM_PROFILE(SEQ_BUILDER* bld, SEQUENCE* seq, HMM_PROFILE* prof);
 
-/* create HMM from SEQUENCE */
-void HMM_PROFILE_From_Seq(HMM_PROFILE* prof, SEQUENCE* seq);
+/*! FUNCTION:  HMM_PROFILE_From_Seq()
+ *  SYNOPSIS:  Create HMM <prof> from SEQUENCE <seq> (modeled after HMMER p7_Seqmodel()).
+ *             Match emissions of each node are conditional probabilities of its residue under BLOSUM62,
+ *             residues outside of alphabet emit background.  Insert emissions are background.
+ */
+void HMM_PROFILE_From_Seq(SEQ_BUILDER* bld, HMM_PROFILE* prof, SEQUENCE* seq);
 
-/* set background composition of sequence */
+/*! FUNCTION:  HMM_PROFILE_SetComposition()
+ *  SYNOPSIS:  Set background composition of <prof> to its mean residue composition, weighted by
+ *             state occupancy (modeled after HMMER p7_hmm_SetComposition()).
+ */
 void HMM_PROFILE_SetComposition(HMM_PROFILE* prof);
 
-/* run simulation to calibrate e-value parameters of model */
-void HMM_PROFILE_Calibrate(HMM_PROFILE* prof);
+/*! FUNCTION:  HMM_PROFILE_Calibrate()
+ *  SYNOPSIS:  Run simulation to calibrate e-value distribution parameters of <prof> (modeled after HMMER p7_Calibrate()).
+ *             Lambda is estimated from mean match relative entropy (p7_Lambda()); MSV and Viterbi mu are fit to
+ *             Gumbel scores of random background sequences; Forward tau is fit to the tail of their Forward scores.
+ *             Random sequences are seeded the same for each profile, so results do not depend on profile order or thread.
+ */
+void HMM_PROFILE_Calibrate(SEQ_BUILDER* bld, HMM_PROFILE* prof);
 
 #endif /* _SEQ_TO_MODEL_H */
@@ -65,4 +65,47 @@ mmoreseqs_mmore_pipeline(WORKER* worker);
 STATUS_FLAG
 index_pipeline(WORKER* worker);
 
+/*! FUNCTION: convert_pipeline()
+ *  SYNOPSIS: Convert Pipeline: Renders text reports from binary results (binout) file.
+ */
+STATUS_FLAG
+convert_pipeline(WORKER* worker);
+
+/*! FUNCTION: merge_pipeline()
+ *  SYNOPSIS: Merge Pipeline: Merges binary results (binout) files of shards into single set of reports.
+ */
+STATUS_FLAG
+merge_pipeline(WORKER* worker);
+
+/*! FUNCTION: plan_pipeline()
+ *  SYNOPSIS: Plan Pipeline: Splits mmseqs results into shards of balanced estimated runtime.
+ */
+STATUS_FLAG
+plan_pipeline(WORKER* worker);
+
+/*! FUNCTION: cloud_calibrate_pipeline()
+ *  SYNOPSIS: Cloud Calibrate Pipeline: Fits adaptive cloud search policy, reporting cells-vs-sensitivity curves.
+ */
+STATUS_FLAG
+cloud_calibrate_pipeline(WORKER* worker);
+
+/*! FUNCTION: dedup_pipeline()
+ *  SYNOPSIS: Dedup Pipeline: Removes duplicate sequences from query FASTA file, outputting map of duplicates.
+ */
+STATUS_FLAG
+dedup_pipeline(WORKER* worker);
+
+/*! FUNCTION: fasta_to_hmm_pipeline()
+ *  SYNOPSIS: Fasta-to-HMM Pipeline: Builds calibrated profile from each sequence of FASTA file, outputting .hmm file.
+ */
+STATUS_FLAG
+fasta_to_hmm_pipeline(WORKER* worker);
+
+/*! FUNCTION: msa_to_hmm_pipeline()
+ *  SYNOPSIS: MSA-to-HMM Pipeline: Builds calibrated profile from each family of Stockholm file, outputting .hmm file,
+ *            its index, and .fasta file of consensus sequences.
+ */
+STATUS_FLAG
+msa_to_hmm_pipeline(WORKER* worker);
+
 #endif /* _PIPELINE_MAIN_H */
@@ -0,0 +1,398 @@
+/*******************************************************************************
+ *  - FILE:      pipeline_cloud_calibrate.c
+ *  - DESC:    Cloud Calibrate pipeline.
+ *             Fits policy for scaling the cloud search x-drops (alpha, beta) of each search
+ *             (see --cloud-adaptive), and reports curves of cells computed versus sensitivity.
+ *  NOTES:
+ *    - Each search is run with its x-drops scaled by each of a grid of scales, recording the cells
+ *      computed (cloud search plus merged cloud) and whether its bound forward score passes the
+ *      reporting threshold.
+ *    - Results are labeled true if their target/query pair is listed in --calib-labels. Without
+ *      labels, results found with the widest x-drops are taken as true.
+ *    - Policies are evaluated on the grid: a result is found if it is found at the nearest grid
+ *      scale below its policy scale, and its cells are interpolated between grid scales.
+ *    - Fitted policy is the one with fewest cells whose sensitivity is no more than --calib-loss
+ *      below that of fixed x-drops.
+ *    - Consecutive entries for the same target/query pair are searched separately.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+#include "../parsers/_parsers.h"
+#include "../reporting/_reporting.h"
+#include "../work/_work.h"
+
+/* header */
+#include "_pipelines.h"
+
+/* private functions */
+static void
+calibrate_SetDefault_Tasks(TASKS* tasks);
+static void
+calibrate_Search(WORKER* worker, int id, CALIB_HIT* hit);
+static int
+calibrate_Load_Labels(WORKER* worker, CALIB_HIT* hits, int N_hits);
+static void
+calibrate_Evaluate(CALIB_HIT* hits, int N_hits, CALIB_POLICY* eval);
+static void
+calibrate_Report_Policy(CALIB_POLICY* eval, int N_true, double ref_cells, FILE* fp);
+static int
+calibrate_Compare_Names(const void* a, const void* b);
+static int
+calibrate_Compare_Cells(const void* a, const void* b);
+
+/* grid of x-drop scales each search is run with (ascending, must include 1.0) */
+static const float CALIB_SCALES[NUM_CALIB_SCALES] = {0.25f, 0.5f, 0.75f, 1.0f, 1.5f, 2.0f, 3.0f};
+static const int CALIB_FIXED = 3;
+/* grid of policy margins (in bits) and cover widenings tried in fit */
+static const float CALIB_MARGINS[] = {5.0f, 10.0f, 20.0f, 40.0f, 80.0f};
+static const int NUM_CALIB_MARGINS = 5;
+static const float CALIB_COVERS[] = {0.0f, 0.5f, 1.0f};
+static const int NUM_CALIB_COVERS = 3;
+
+/*! FUNCTION:  cloud_calibrate_pipeline()
+ *  SYNOPSIS:  Cloud Calibrate Pipeline: Runs cloud search of each mmseqs result over a grid of x-drop scales,
+ *             then fits policy for --cloud-adaptive, and outputs cells-vs-sensitivity curves of fixed x-drops
+ *             and of adaptive policies.
+ */
+STATUS_FLAG
+cloud_calibrate_pipeline(WORKER* worker) {
+  ARGS* args = worker->args;
+  CALIB_HIT* hits = NULL;
+  CALIB_POLICY* evals = NULL;
+  CALIB_POLICY fixed[NUM_CALIB_SCALES];
+  CALIB_POLICY* best = NULL;
+  int N_hits = 0;
+  int N_true = 0;
+  int N_evals = 0;
+  int min_found;
+  double ref_cells;
+  FILE* fp = NULL;
+  printf_vlo("=== CLOUD CALIBRATE PIPELINE ===\n");
+
+  /* load mmseqs results to be searched */
+  WORK_init(worker);
+  calibrate_SetDefault_Tasks(worker->tasks);
+  WORK_load_mmseqs_file(worker);
+  /* read all entries now, if .m8 is a pipe */
+  WORK_load_mmseqs_ahead(worker, INT_MAX);
+  if (args->hitlist_filein != NULL) {
+    fprintf(stderr, "ERROR: Cloud calibration requires .m8 results, binary hitlists are not supported.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  WORK_load_indexes(worker);
+  WORK_thresholds_pval_to_eval(worker);
+  N_hits = args->list_range.end - args->list_range.beg;
+
+  /* search each result at each scale */
+  hits = ERROR_malloc(sizeof(CALIB_HIT) * MAX(N_hits, 1));
+  for (int i = 0; i < N_hits; i++) {
+    printf_vall("# (%d/%d): Running cloud search over x-drop scales...\n", i, N_hits);
+    calibrate_Search(worker, i, &hits[i]);
+  }
+
+  /* label results */
+  if (args->calib_labels_filein != NULL) {
+    N_true = calibrate_Load_Labels(worker, hits, N_hits);
+  }
+  else {
+    for (int i = 0; i < N_hits; i++) {
+      hits[i].is_true = hits[i].is_found[NUM_CALIB_SCALES - 1];
+      N_true += hits[i].is_true;
+    }
+  }
+
+  /* curve of fixed x-drops */
+  for (int k = 0; k < NUM_CALIB_SCALES; k++) {
+    fixed[k].policy = (CLOUD_POLICY){true, 0.0f, CALIB_SCALES[k], CALIB_SCALES[k], 0.0f};
+    calibrate_Evaluate(hits, N_hits, &fixed[k]);
+  }
+  ref_cells = fixed[CALIB_FIXED].cells;
+
+  /* all adaptive policies on grid, which never prune tighter for weaker hits */
+  evals = ERROR_malloc(sizeof(CALIB_POLICY) * NUM_CALIB_MARGINS * NUM_CALIB_COVERS * NUM_CALIB_SCALES * NUM_CALIB_SCALES);
+  for (int m = 0; m < NUM_CALIB_MARGINS; m++) {
+    for (int c = 0; c < NUM_CALIB_COVERS; c++) {
+      for (int k_min = 0; k_min <= CALIB_FIXED; k_min++) {
+        for (int k_max = CALIB_FIXED; k_max < NUM_CALIB_SCALES; k_max++) {
+          evals[N_evals].policy = (CLOUD_POLICY){true, CALIB_MARGINS[m], CALIB_SCALES[k_min], CALIB_SCALES[k_max], CALIB_COVERS[c]};
+          calibrate_Evaluate(hits, N_hits, &evals[N_evals]);
+          N_evals++;
+        }
+      }
+    }
+  }
+  qsort(evals, N_evals, sizeof(CALIB_POLICY), calibrate_Compare_Cells);
+
+  /* fit: fewest cells within allowed loss of fixed x-drops (policy with fixed x-drops is always on grid) */
+  min_found = (int)ceil((double)fixed[CALIB_FIXED].N_found_true - args->calib_loss * N_true - 1e-6);
+  for (int j = 0; j < N_evals && best == NULL; j++) {
+    if (evals[j].N_found_true >= min_found) {
+      best = &evals[j];
+    }
+  }
+  if (best == NULL) {
+    best = &fixed[CALIB_FIXED];
+  }
+
+  /* write report */
+  fp = (args->calib_fileout != NULL ? ERROR_fopen(args->calib_fileout, "w") : stdout);
+  fprintf(fp, "# mmoreseqs cloud-calibrate: %d searches, %d true ", N_hits, N_true);
+  if (args->calib_labels_filein != NULL) {
+    fprintf(fp, "[labeled by '%s']\n", args->calib_labels_filein);
+  } else {
+    fprintf(fp, "[found with widest x-drops]\n");
+  }
+  fprintf(fp, "# x-drops: alpha = %.2f, beta = %.2f, scaled by policy. cells are relative to fixed x-drops (%.3e)\n",
+          args->alpha, args->beta, ref_cells);
+  {
+    const int num_fields = 8;
+    const char* headers[] = {"margin", "scale-min", "scale-max", "cover", "cells", "rel-cells", "sensitivity", "false-found"};
+    fprintf(fp, "# === FIXED X-DROPS ===\n");
+    REPORT_header(fp, headers, num_fields);
+    for (int k = 0; k < NUM_CALIB_SCALES; k++) {
+      calibrate_Report_Policy(&fixed[k], N_true, ref_cells, fp);
+    }
+    /* only policies with better sensitivity than all policies with fewer cells */
+    fprintf(fp, "# === ADAPTIVE X-DROPS (frontier) ===\n");
+    REPORT_header(fp, headers, num_fields);
+    for (int j = 0, max_found = -1; j < N_evals; j++) {
+      if (evals[j].N_found_true > max_found) {
+        calibrate_Report_Policy(&evals[j], N_true, ref_cells, fp);
+        max_found = evals[j].N_found_true;
+      }
+    }
+    fprintf(fp, "# === FITTED POLICY (sensitivity loss <= %.3f) ===\n", args->calib_loss);
+    REPORT_header(fp, headers, num_fields);
+    calibrate_Report_Policy(best, N_true, ref_cells, fp);
+  }
+  fprintf(fp, "# options: --cloud-adaptive 1 --cloud-adapt-margin %.1f --cloud-adapt-min %.2f --cloud-adapt-max %.2f --cloud-adapt-cover %.2f\n",
+          best->policy.margin, best->policy.scale_min, best->policy.scale_max, best->policy.cover);
+  if (fp != stdout) {
+    fclose(fp);
+  }
+
+  /* clean up worker data structs */
+  hits = ERROR_free(hits);
+  evals = ERROR_free(evals);
+  WORK_cleanup(worker);
+
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION:  calibrate_SetDefault_Tasks()
+ *  SYNOPSIS:  Set tasks for cloud search, merge and bound forward, as in mmore pipeline.
+ */
+static void
+calibrate_SetDefault_Tasks(TASKS* tasks) {
+  tasks->linear = true;
+  tasks->lin_cloud_fwd = true;
+  tasks->lin_cloud_bck = true;
+  tasks->lin_bound_fwd = true;
+  tasks->lin_bound_bck = false;
+  tasks->quadratic = false;
+}
+
+/*! FUNCTION:  calibrate_Search()
+ *  SYNOPSIS:  Run cloud search of <id>th mmseqs result with x-drops at each scale, and store the cells
+ *             computed and whether result was found in <hit>.
+ */
+static void
+calibrate_Search(WORKER* worker,
+                 int id,
+                 CALIB_HIT* hit) {
+  ARGS* args = worker->args;
+  CLOUD_PARAMS* cloud_params = &(worker->cloud_params);
+  RESULT* result = worker->result;
+  SCORES* finalsc = &result->final_scores;
+
+  WORK_preiter(worker);
+  WORK_load_mmseqs_by_id(worker, id);
+  WORK_load_target(worker);
+  WORK_load_query(worker);
+  WORK_reuse(worker);
+  WORK_load_mmseqs_alignment(worker);
+
+  hit->result_id = worker->mmseqs_cur->result_id;
+  hit->is_true = false;
+  WORK_cloud_policy_features(worker, &hit->margin, &hit->cover);
+
+  for (int k = 0; k < NUM_CALIB_SCALES; k++) {
+    cloud_params->alpha = args->alpha * CALIB_SCALES[k];
+    cloud_params->beta = args->beta * CALIB_SCALES[k];
+
+    WORK_cloud_search_linear(worker);
+    WORK_cloud_natsc_to_eval(worker);
+    hit->cells[k] = (double)EDGEBOUNDS_Count(worker->edg_fwd) + (double)EDGEBOUNDS_Count(worker->edg_bck);
+    hit->is_found[k] = false;
+    if (WORK_cloud_test_threshold(worker) == true) {
+      WORK_cloud_merge_and_reorient(worker);
+      WORK_bound_fwdback_linear(worker);
+      WORK_bound_fwdback_natsc_to_eval(worker);
+      hit->cells[k] += (double)result->cloud_cells;
+      hit->is_found[k] = (WORK_bound_fwdback_test_threshold(worker) == true &&
+                          finalsc->fwdback_eval < args->threshold_report_eval);
+    }
+  }
+  WORK_postiter(worker);
+}
+
+/*! FUNCTION:  calibrate_Load_Labels()
+ *  SYNOPSIS:  Label each of <hits> true if its target/query pair is listed in <calib_labels_filein>.
+ *             Labels file is tab-delimited: [1] target (profile) name, [2] query (sequence) name.
+ *  RETURN:    Number of true hits.
+ */
+static int
+calibrate_Load_Labels(WORKER* worker,
+                      CALIB_HIT* hits,
+                      int N_hits) {
+  ARGS* args = worker->args;
+  M8_RESULTS* m8_data = worker->mmseqs_data;
+  M8_RESULT** sorted = NULL;
+  M8_RESULT key;
+  M8_RESULT* key_ptr = &key;
+  M8_RESULT** found = NULL;
+  int N_true = 0;
+  int i;
+
+  FILE* fp = NULL;
+  char* line_buf = NULL;
+  size_t line_buf_size = 0;
+  ssize_t line_size = 0;
+  char* line_ptr = NULL;
+
+  /* results sorted by target/query name, to look up each label */
+  sorted = ERROR_malloc(sizeof(M8_RESULT*) * MAX(N_hits, 1));
+  for (i = 0; i < N_hits; i++) {
+    sorted[i] = &m8_data->data[i];
+  }
+  qsort(sorted, N_hits, sizeof(M8_RESULT*), calibrate_Compare_Names);
+
+  fp = ERROR_fopen(args->calib_labels_filein, "r");
+  while ((line_size = getline(&line_buf, &line_buf_size, fp)), line_size != -1) {
+    /* ignore comment lines */
+    if (line_buf[0] == '#' || line_size <= 1) {
+      continue;
+    }
+    line_ptr = line_buf;
+    key.target_name = strtok_r(line_ptr, "\t\n", &line_ptr);
+    key.query_name = strtok_r(line_ptr, "\t\n", &line_ptr);
+    if (key.target_name == NULL || key.query_name == NULL) {
+      continue;
+    }
+    found = bsearch(&key_ptr, sorted, N_hits, sizeof(M8_RESULT*), calibrate_Compare_Names);
+    if (found == NULL) {
+      continue;
+    }
+    /* mark all results of pair */
+    while (found > sorted && calibrate_Compare_Names(found - 1, &key_ptr) == 0) {
+      found--;
+    }
+    for (; found < sorted + N_hits && calibrate_Compare_Names(found, &key_ptr) == 0; found++) {
+      hits[*found - m8_data->data].is_true = true;
+    }
+  }
+  fclose(fp);
+  ERROR_free(line_buf);
+  sorted = ERROR_free(sorted);
+
+  for (i = 0; i < N_hits; i++) {
+    N_true += hits[i].is_true;
+  }
+  if (N_true == 0) {
+    fprintf(stderr, "WARNING: No searches are labeled true by '%s'.\n", args->calib_labels_filein);
+  }
+  return N_true;
+}
+
+/*! FUNCTION:  calibrate_Evaluate()
+ *  SYNOPSIS:  Evaluate total cells and results found of policy of <eval> over <hits>.
+ *             A hit is found if it is found at nearest grid scale at or below its policy scale.
+ *             Its cells are interpolated between nearest grid scales.
+ */
+static void
+calibrate_Evaluate(CALIB_HIT* hits,
+                   int N_hits,
+                   CALIB_POLICY* eval) {
+  CALIB_HIT* hit = NULL;
+  float scale, w;
+  int lo, hi;
+  bool is_found;
+
+  eval->cells = 0.0;
+  eval->N_found_true = 0;
+  eval->N_found_false = 0;
+  for (int i = 0; i < N_hits; i++) {
+    hit = &hits[i];
+    scale = WORK_cloud_policy_scale(&eval->policy, hit->margin, hit->cover);
+
+    for (hi = 0; hi < NUM_CALIB_SCALES - 1 && CALIB_SCALES[hi] < scale; hi++);
+    lo = (CALIB_SCALES[hi] > scale && hi > 0 ? hi - 1 : hi);
+    w = (hi > lo ? (scale - CALIB_SCALES[lo]) / (CALIB_SCALES[hi] - CALIB_SCALES[lo]) : 0.0f);
+    w = MAX(0.0f, MIN(1.0f, w));
+
+    eval->cells += hit->cells[lo] + w * (hit->cells[hi] - hit->cells[lo]);
+    is_found = hit->is_found[lo];
+    if (is_found && hit->is_true) {
+      eval->N_found_true += 1;
+    }
+    elif (is_found) {
+      eval->N_found_false += 1;
+    }
+  }
+}
+
+/*! FUNCTION:  calibrate_Report_Policy()
+ *  SYNOPSIS:  Write row of policy of <eval> to <fp>, with cells relative to <ref_cells> and
+ *             sensitivity out of <N_true>.
+ */
+static void
+calibrate_Report_Policy(CALIB_POLICY* eval,
+                        int N_true,
+                        double ref_cells,
+                        FILE* fp) {
+  fprintf(fp, "%.1f\t%.2f\t%.2f\t%.2f\t%.3e\t%.4f\t%.4f\t%d\n",
+          eval->policy.margin, eval->policy.scale_min, eval->policy.scale_max, eval->policy.cover,
+          eval->cells, (ref_cells > 0.0 ? eval->cells / ref_cells : 1.0),
+          (N_true > 0 ? (double)eval->N_found_true / N_true : 1.0), eval->N_found_false);
+}
+
+/*! FUNCTION:  calibrate_Compare_Names()
+ *  SYNOPSIS:  Compare m8 results by target name, then query name (for qsort/bsearch of M8_RESULT*).
+ */
+static int
+calibrate_Compare_Names(const void* a,
+                        const void* b) {
+  const M8_RESULT* m8_a = *(M8_RESULT* const*)a;
+  const M8_RESULT* m8_b = *(M8_RESULT* const*)b;
+  int cmp = strcmp(m8_a->target_name, m8_b->target_name);
+
+  return (cmp != 0 ? cmp : strcmp(m8_a->query_name, m8_b->query_name));
+}
+
+/*! FUNCTION:  calibrate_Compare_Cells()
+ *  SYNOPSIS:  Compare policies by total cells ascending, then by true results found descending (for qsort).
+ */
+static int
+calibrate_Compare_Cells(const void* a,
+                        const void* b) {
+  const CALIB_POLICY* eval_a = (const CALIB_POLICY*)a;
+  const CALIB_POLICY* eval_b = (const CALIB_POLICY*)b;
+
+  if (eval_a->cells != eval_b->cells) {
+    return (eval_a->cells < eval_b->cells ? -1 : 1);
+  }
+  return eval_b->N_found_true - eval_a->N_found_true;
+}
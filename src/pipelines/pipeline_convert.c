@@ -0,0 +1,65 @@
+/*******************************************************************************
+ *  - FILE:      pipeline_convert.c
+ *  - DESC:    Convert pipeline.
+ *             Renders text reports from binary results (binout) file.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+#include "../parsers/_parsers.h"
+#include "../work/_work.h"
+
+/* header */
+#include "_pipelines.h"
+
+/*! FUNCTION:  convert_pipeline()
+ *  SYNOPSIS:  Convert Pipeline: Renders text reports from binary results (binout) file.
+ *             Reports are selected by the usual output options (--m8out, --myout, etc).
+ */
+STATUS_FLAG
+convert_pipeline(WORKER* worker) {
+  ARGS* args = worker->args;
+  FILER* binin_file = NULL;
+  RESULT* record = NULL;
+  printf_vlo("=== CONVERT PIPELINE ===\n");
+
+  /* restore input files and options of search that produced results */
+  binin_file = FILER_Create(args->binout_filein, "r");
+  FILER_Open(binin_file);
+  BINOUT_Parse_Header(args, binin_file->fp);
+
+  /* initialize data structures needed for tasks */
+  WORK_init(worker);
+  WORK_open(worker);
+
+  /* queue each record to be written to all reports */
+  WORK_report_header(worker);
+  while (true) {
+    record = RESULTS_Queue_Back(worker->results);
+    if (BINOUT_Parse_Entry(record, binin_file->fp) == false) {
+      break;
+    }
+    WORK_report_result_push(worker);
+  }
+  BINOUT_Parse_Footer(worker->stats, worker->times_totals, binin_file->fp);
+  WORK_report_footer(worker);
+
+  /* clean up worker data structs */
+  binin_file = FILER_Destroy(binin_file);
+  WORK_close(worker);
+  WORK_cleanup(worker);
+
+  return STATUS_SUCCESS;
+}
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *  - FILE:      pipeline_dedup.c
+ *  - DESC:    Dedup pipeline.
+ *             Removes duplicate sequences from query FASTA file, so that each distinct query
+ *             is only searched once. Outputs map of each removed duplicate to its canonical query
+ *             (the first copy), which `mmore-search --dupmap` uses to report results of the
+ *             canonical query under each of its duplicates.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+#include "../parsers/_parsers.h"
+#include "../work/_work.h"
+
+/* header */
+#include "_pipelines.h"
+
+/*! FUNCTION:  dedup_pipeline()
+ *  SYNOPSIS:  Dedup Pipeline: Removes duplicate sequences from query FASTA file, outputting map of duplicates.
+ */
+STATUS_FLAG
+dedup_pipeline(WORKER* worker) {
+  ARGS* args = worker->args;
+  CLOCK* timer = worker->timer;
+  DUP_MAP* dupmap = NULL;
+  FILE* fp = NULL;
+  int N_seqs = 0;
+  printf_vlo("=== DEDUP PIPELINE ===\n");
+
+  CLOCK_Start(timer);
+
+  /* write distinct sequences, and collect duplicates */
+  printf_vhi("# deduplicating query sequences from:\t%s\n", args->q_filein);
+  dupmap = DUP_MAP_Fasta_Dedup(dupmap, args->q_filein, args->dedup_fileout, &N_seqs);
+  printf_vhi("# outputting distinct query sequences to:\t%s\n", args->dedup_fileout);
+
+  /* write duplicates in order of query file */
+  printf_vhi("# outputting duplicate map to:\t%s\n", args->dupmap_fileout);
+  fp = ERROR_fopen(args->dupmap_fileout, "w");
+  DUP_MAP_Dump(dupmap, fp);
+  fclose(fp);
+
+  CLOCK_Stop(timer);
+
+  printf_vlo("# queries: %d, distinct: %d, duplicates: %d (%.3f sec)\n",
+             N_seqs, N_seqs - dupmap->N, dupmap->N, CLOCK_Duration(timer));
+
+  dupmap = DUP_MAP_Destroy(dupmap);
+
+  return STATUS_SUCCESS;
+}
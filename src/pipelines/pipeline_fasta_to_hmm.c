@@ -0,0 +1,139 @@
+/*******************************************************************************
+ *  - FILE:      pipeline_fasta_to_hmm.c
+ *  - DESC:    Fasta-to-HMM pipeline.
+ *             Builds a calibrated single-sequence profile from each sequence of FASTA file,
+ *             and outputs them as .hmm file, so that a sequence database can be searched as target profiles.
+ *             Sequences are parsed in batches on the main thread, built into profiles in parallel by
+ *             a thread pool, then output in order of FASTA file.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+#include "../parsers/_parsers.h"
+#include "../work/_work.h"
+
+/* header */
+#include "_pipelines.h"
+
+/* number of sequences per thread in each batch */
+#define BUILD_BATCH_PER_THREAD 16
+
+/* private functions */
+static void
+fasta_to_hmm_Build(void* data, int job_id, int thread_id);
+
+/*! FUNCTION:  fasta_to_hmm_pipeline()
+ *  SYNOPSIS:  Fasta-to-HMM Pipeline: Builds calibrated profile from each sequence of FASTA file, outputting .hmm file.
+ */
+STATUS_FLAG
+fasta_to_hmm_pipeline(WORKER* worker) {
+  ARGS* args = worker->args;
+  CLOCK* timer = worker->timer;
+  F_INDEX* index = NULL;
+  THREAD_POOL* pool = NULL;
+  BUILD_BATCH batch;
+  FILE* fp = NULL;
+  int N_threads = args->num_threads;
+  int N_seqs = 0;
+  double duration = 0.0;
+  printf_vlo("=== FASTA-TO-HMM PIPELINE ===\n");
+
+  CLOCK_Start(timer);
+
+  /* index sequences, in order of file */
+  printf_vhi("# indexing sequences from:\t%s\n", args->t_filein);
+  index = F_INDEX_Fasta_Build(index, args->t_filein);
+  N_seqs = index->N;
+
+  /* thread-local builders and profiles */
+  WORKER_Create_Threads(worker, N_threads);
+  for (int i = 0; i < N_threads; i++) {
+    worker->threads[i].t_builder = SEQ_BUILDER_Create();
+    worker->threads[i].t_prof = HMM_PROFILE_Create();
+  }
+  pool = THREAD_POOL_Create(N_threads);
+
+  batch.N = 0;
+  batch.Nalloc = N_threads * BUILD_BATCH_PER_THREAD;
+  batch.seqs = ERROR_malloc(sizeof(SEQUENCE*) * batch.Nalloc);
+  batch.msas = NULL;
+  batch.texts = ERROR_malloc(sizeof(char*) * batch.Nalloc);
+  batch.text_lens = ERROR_malloc(sizeof(size_t) * batch.Nalloc);
+  batch.cons_texts = NULL;
+  batch.cons_lens = NULL;
+  batch.prof_lens = NULL;
+  batch.threads = worker->threads;
+  for (int i = 0; i < batch.Nalloc; i++) {
+    batch.seqs[i] = SEQUENCE_Create();
+    batch.texts[i] = NULL;
+    batch.text_lens[i] = 0;
+  }
+
+  printf_vhi("# outputting profiles to:\t%s\n", args->hmm_fileout);
+  fp = ERROR_fopen(args->hmm_fileout, "w");
+  for (int beg = 0; beg < N_seqs; beg += batch.Nalloc) {
+    batch.N = MIN(batch.Nalloc, N_seqs - beg);
+    /* sequence parser is not thread-safe, so parse batch before handing it to threads */
+    for (int i = 0; i < batch.N; i++) {
+      SEQUENCE_Fasta_Parse(batch.seqs[i], args->t_filein, index->nodes[beg + i].offset);
+    }
+    THREAD_POOL_Run(pool, fasta_to_hmm_Build, &batch, batch.N);
+    for (int i = 0; i < batch.N; i++) {
+      fwrite(batch.texts[i], 1, batch.text_lens[i], fp);
+      batch.texts[i] = ERROR_free(batch.texts[i]);
+    }
+  }
+  fclose(fp);
+
+  CLOCK_Stop(timer);
+  duration = CLOCK_Duration(timer);
+
+  printf_vlo("# profiles: %d, threads: %d (%.3f sec, %.1f profiles/sec)\n",
+             N_seqs, N_threads, duration, (duration > 0.0 ? N_seqs / duration : 0.0));
+
+  pool = THREAD_POOL_Destroy(pool);
+  for (int i = 0; i < batch.Nalloc; i++) {
+    SEQUENCE_Destroy(batch.seqs[i]);
+  }
+  ERROR_free(batch.seqs);
+  ERROR_free(batch.texts);
+  ERROR_free(batch.text_lens);
+  index = F_INDEX_Destroy(index);
+
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION:  fasta_to_hmm_Build()
+ *  SYNOPSIS:  Thread job: build profile from sequence <job_id> of batch <data>, using builder of <thread_id>,
+ *             and output it to text of batch in .hmm file format.
+ */
+static void
+fasta_to_hmm_Build(void* data,
+                   int job_id,
+                   int thread_id) {
+  BUILD_BATCH* batch = (BUILD_BATCH*)data;
+  WORKER_THREAD* thread = &batch->threads[thread_id];
+  FILE* fp = NULL;
+
+  SEQUENCE_to_HMM_PROFILE(thread->t_builder, batch->seqs[job_id], thread->t_prof);
+
+  fp = open_memstream(&batch->texts[job_id], &batch->text_lens[job_id]);
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to open memory stream for profile '%s'.\n", batch->seqs[job_id]->name);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  HMM_FILE_Dump(thread->t_prof, fp);
+  fclose(fp);
+}
@@ -0,0 +1,271 @@
+/*******************************************************************************
+ *  - FILE:      pipeline_merge.c
+ *  - DESC:    Merge pipeline.
+ *             Merges binary results (binout) files from shards of a search
+ *             (split by --range) into a single set of reports.
+ *  NOTES:
+ *    - Shards are k-way merged by result id. Only the current record of each shard is held
+ *      in memory, so memory does not grow with number of results.
+ *    - Summary stats and time totals are summed over shard footers.
+ *    - Results fanned out to duplicate queries (--dupmap) share a result id, so results are
+ *      only skipped as repeats if both result id and query name were already merged.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+#include "../parsers/_parsers.h"
+#include "../work/_work.h"
+
+/* header */
+#include "_pipelines.h"
+
+/* private functions */
+static void
+merge_Check_Header(ARGS* args, ARGS* shard_args, STR shard_filein);
+static void
+merge_Add_Footer(WORKER* worker, FILER* shard_file, bool is_first);
+static void
+merge_Heap_Down(int* heap, int N_heap, int i_root, RESULT* records);
+static bool
+merge_Is_Merged(VECTOR_STR* merged_names, STR query_name);
+static void
+merge_Reuse_Names(VECTOR_STR* merged_names);
+
+/*! FUNCTION:  merge_pipeline()
+ *  SYNOPSIS:  Merge Pipeline: Merges binary results (binout) files of shards into single set of reports.
+ *             Reports are selected by the usual output options (--m8out, --myout, --binout, etc).
+ */
+STATUS_FLAG
+merge_pipeline(WORKER* worker) {
+  ARGS* args = worker->args;
+  VECTOR_STR* shard_fileins = args->shard_fileins;
+  int N_shards = VECTOR_STR_GetSize(shard_fileins);
+  ARGS* shard_args = NULL;
+  FILER** shard_files = NULL;
+  RESULT* shard_records = NULL; /* current record of each shard */
+  int* heap = NULL;             /* min-heap of shards with records left, by result id of current record */
+  int N_heap = 0;
+  int N_dups = 0;
+  int last_id, cur_id;
+  VECTOR_STR* merged_names = NULL; /* query names already merged for <last_id> */
+  printf_vlo("=== MERGE PIPELINE ===\n");
+
+  /* open all shards, and check they were run with same options */
+  shard_files = ERROR_malloc(sizeof(FILER*) * N_shards);
+  shard_records = ERROR_malloc(sizeof(RESULT) * N_shards);
+  heap = ERROR_malloc(sizeof(int) * N_shards);
+  shard_args = ARGS_Create();
+  for (int i = 0; i < N_shards; i++) {
+    shard_files[i] = FILER_Create(VEC_X(shard_fileins, i), "r");
+    FILER_Open(shard_files[i]);
+    RESULT_Init(&shard_records[i]);
+    if (i == 0) {
+      BINOUT_Parse_Header(args, shard_files[i]->fp);
+    }
+    else {
+      BINOUT_Parse_Header(shard_args, shard_files[i]->fp);
+      merge_Check_Header(args, shard_args, VEC_X(shard_fileins, i));
+    }
+  }
+  shard_args = ARGS_Destroy(shard_args);
+
+  /* initialize data structures needed for tasks */
+  WORK_init(worker);
+  WORK_open(worker);
+  WORK_report_header(worker);
+
+  /* fill heap with first record of each shard */
+  for (int i = 0; i < N_shards; i++) {
+    if (BINOUT_Parse_Entry(&shard_records[i], shard_files[i]->fp) == true) {
+      heap[N_heap++] = i;
+    }
+    else {
+      merge_Add_Footer(worker, shard_files[i], i == 0);
+    }
+  }
+  for (int i = N_heap / 2 - 1; i >= 0; i--) {
+    merge_Heap_Down(heap, N_heap, i, shard_records);
+  }
+
+  /* queue lowest result id, then replace it with next record from same shard */
+  merged_names = VECTOR_STR_Create();
+  last_id = -1;
+  while (N_heap > 0) {
+    int i_shard = heap[0];
+    RESULT* shard_record = &shard_records[i_shard];
+    cur_id = shard_record->result_id;
+
+    if (cur_id != last_id) {
+      merge_Reuse_Names(merged_names);
+      last_id = cur_id;
+    }
+
+    /* overlapping shard ranges give the same result more than once */
+    if (merge_Is_Merged(merged_names, shard_record->query_name) == true) {
+      N_dups += 1;
+    }
+    else {
+      RESULT* record = RESULTS_Queue_Back(worker->results);
+      RESULT_Copy(record, shard_record);
+      WORK_report_result_push(worker);
+      VECTOR_STR_Pushback(merged_names, shard_record->query_name);
+    }
+
+    if (BINOUT_Parse_Entry(shard_record, shard_files[i_shard]->fp) == true) {
+      if (shard_record->result_id < cur_id) {
+        fprintf(stderr, "ERROR: Shard '%s' is not sorted by result id (%d after %d).\n",
+                VEC_X(shard_fileins, i_shard), shard_record->result_id, cur_id);
+        ERRORCHECK_exit(EXIT_FAILURE);
+      }
+    }
+    else {
+      merge_Add_Footer(worker, shard_files[i_shard], i_shard == 0);
+      heap[0] = heap[--N_heap];
+    }
+    merge_Heap_Down(heap, N_heap, 0, shard_records);
+  }
+  if (N_dups > 0) {
+    fprintf(stderr, "WARNING: Skipped %d results found in more than one shard (do shard ranges overlap?).\n", N_dups);
+  }
+
+  WORK_report_footer(worker);
+
+  /* clean up worker data structs */
+  for (int i = 0; i < N_shards; i++) {
+    shard_files[i] = FILER_Destroy(shard_files[i]);
+    RESULT_Cleanup(&shard_records[i]);
+  }
+  shard_files = ERROR_free(shard_files);
+  shard_records = ERROR_free(shard_records);
+  heap = ERROR_free(heap);
+  merge_Reuse_Names(merged_names);
+  merged_names = VECTOR_STR_Destroy(merged_names);
+  WORK_close(worker);
+  WORK_cleanup(worker);
+
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION:  merge_Check_Header()
+ *  SYNOPSIS:  Check that options of shard <shard_args> which change report layout match merged <args>.
+ */
+static void
+merge_Check_Header(ARGS* args,
+                   ARGS* shard_args,
+                   STR shard_filein) {
+  if (shard_args->is_run_domains != args->is_run_domains ||
+      shard_args->is_run_vitaln != args->is_run_vitaln ||
+      shard_args->is_run_postaln != args->is_run_postaln ||
+      shard_args->is_run_mmseqsaln != args->is_run_mmseqsaln ||
+      shard_args->adjust_mmseqs_alns != args->adjust_mmseqs_alns) {
+    fprintf(stderr, "ERROR: Shard '%s' was not run with same options as first shard.\n", shard_filein);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+}
+
+/*! FUNCTION:  merge_Add_Footer()
+ *  SYNOPSIS:  Parse footer of <shard_file> and add its stats and time totals to <worker> totals.
+ *             Database sizes are the same for all shards, so are only taken from first shard.
+ */
+static void
+merge_Add_Footer(WORKER* worker,
+                 FILER* shard_file,
+                 bool is_first) {
+  STATS* stats = worker->stats;
+  STATS shard_stats;
+
+  /* shard totals are parsed as current times, so they can be added to totals as usual */
+  BINOUT_Parse_Footer(&shard_stats, worker->times, shard_file->fp);
+  WORK_times_add(worker);
+
+  if (is_first) {
+    stats->n_query_db = shard_stats.n_query_db;
+    stats->n_target_db = shard_stats.n_target_db;
+    stats->n_nodes_total = shard_stats.n_nodes_total;
+    stats->n_resides_total = shard_stats.n_resides_total;
+  }
+  stats->n_query_search += shard_stats.n_query_search;
+  stats->n_target_search += shard_stats.n_target_search;
+  stats->n_searches += shard_stats.n_searches;
+  stats->n_passed_prefilter += shard_stats.n_passed_prefilter;
+  stats->n_passed_viterbi += shard_stats.n_passed_viterbi;
+  stats->n_passed_cloud += shard_stats.n_passed_cloud;
+  stats->n_passed_fwdback += shard_stats.n_passed_fwdback;
+  stats->n_passed_report += shard_stats.n_passed_report;
+  stats->n_expected_prefilter += shard_stats.n_expected_prefilter;
+  stats->n_expected_viterbi += shard_stats.n_expected_viterbi;
+  stats->n_expected_cloud += shard_stats.n_expected_cloud;
+  stats->n_expected_fwdback += shard_stats.n_expected_fwdback;
+  stats->n_reported_searches += shard_stats.n_reported_searches;
+  stats->n_reported_domains += shard_stats.n_reported_domains;
+  stats->n_reported_targets += shard_stats.n_reported_targets;
+  stats->n_reported_queries += shard_stats.n_reported_queries;
+}
+
+/*! FUNCTION:  merge_Heap_Down()
+ *  SYNOPSIS:  Sift <i_root> of <heap> of shard indexes down, until subheap is ordered by
+ *             result id of each shard's current record in <records>.
+ */
+static void
+merge_Heap_Down(int* heap,
+                int N_heap,
+                int i_root,
+                RESULT* records) {
+  int i = i_root;
+  while (true) {
+    int min = i;
+    int left = 2 * i + 1;
+    int right = 2 * i + 2;
+    if (left < N_heap && records[heap[left]].result_id < records[heap[min]].result_id) {
+      min = left;
+    }
+    if (right < N_heap && records[heap[right]].result_id < records[heap[min]].result_id) {
+      min = right;
+    }
+    if (min == i) {
+      break;
+    }
+    int tmp = heap[i];
+    heap[i] = heap[min];
+    heap[min] = tmp;
+    i = min;
+  }
+}
+
+/*! FUNCTION:  merge_Is_Merged()
+ *  SYNOPSIS:  Check whether <query_name> is in <merged_names> of current result id.
+ *             Only holds more than one name if result was fanned out to duplicate queries.
+ */
+static bool
+merge_Is_Merged(VECTOR_STR* merged_names,
+                STR query_name) {
+  for (int i = 0; i < VECTOR_STR_GetSize(merged_names); i++) {
+    if (STR_Equals(VEC_X(merged_names, i), query_name) == true) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*! FUNCTION:  merge_Reuse_Names()
+ *  SYNOPSIS:  Free strings of <merged_names> and empty it (VECTOR_STR_Reuse() does not free them).
+ */
+static void
+merge_Reuse_Names(VECTOR_STR* merged_names) {
+  for (int i = 0; i < VECTOR_STR_GetSize(merged_names); i++) {
+    VEC_X(merged_names, i) = STR_Destroy(VEC_X(merged_names, i));
+  }
+  VECTOR_STR_Reuse(merged_names);
+}
@@ -50,15 +50,15 @@ mmoreseqs_mmore_pipeline(WORKER* worker) {
   /* set default tasks needed to run pipeline */
   mmore_main_SetDefault_Tasks(worker->tasks);
 
-  /* load indexes  */
+  /* load entries from the results file generated by mmseqs (or hitlist), or open it to read entries as they arrive */
+  WORK_load_mmseqs_file(worker);
+
+  /* load indexes (by id for hitlist) */
   WORK_load_indexes(worker);
 
   /* update thresholds to e-values to reflect database size */
   WORK_thresholds_pval_to_eval(worker);
 
-  /* load entries from the results file generated by mmseqs */
-  WORK_load_mmseqs_file(worker);
-
   /* add header to all reports */
   WORK_report_header(worker);
 
@@ -71,10 +71,14 @@ mmoreseqs_mmore_pipeline(WORKER* worker) {
 
   /* threshold tests */
   bool passed[4];
+  /* number of consecutive entries for current target/query pair */
+  int N_anchors;
+  /* whether cloud was loaded from cloud cache */
+  bool is_cached;
 
   /* === ITERATE OVER EACH RESULT === */
   /* Look through each input result (i = index in full list, i_cnt = index relative to search range) */
-  for (int i = i_beg; i < i_end; i++, i_cnt++) {
+  for (int i = i_beg; i < i_end && WORK_load_mmseqs_ahead(worker, i_cnt + 1); i++, i_cnt++) {
     printf_vall("\n# (%d/%d): Running cloud search for result (%d of %d)...\n",
                i_cnt, i_rng, i + 1, i_end);
 
@@ -82,11 +86,23 @@ mmoreseqs_mmore_pipeline(WORKER* worker) {
     passed[1] = false;
     passed[2] = false;
     passed[3] = false;
+    is_cached = false;
 
     /* prep for current iteration */
     WORK_preiter(worker);
     /* get next mmseqs entry */
     WORK_load_mmseqs_by_id(worker, i_cnt);
+    /* find following entries for same target/query pair, to search as one */
+    N_anchors = 1;
+    while (args->is_run_coalesce == true && i + N_anchors < i_end &&
+           WORK_load_mmseqs_ahead(worker, i_cnt + N_anchors + 1) &&
+           M8_RESULT_Is_Same_Pair(worker->mmseqs_cur, &VEC_X(worker->mmseqs_data, i_cnt + N_anchors))) {
+      /* best entry stands for pair in filters and reports */
+      if (VEC_X(worker->mmseqs_data, i_cnt + N_anchors).eval < worker->mmseqs_cur->eval) {
+        WORK_load_mmseqs_by_id(worker, i_cnt + N_anchors);
+      }
+      N_anchors++;
+    }
     /* evaluate mmseqs viterbi scoring filter */
     passed[0] = WORK_viterbi_test_threshold(worker);
 
@@ -101,12 +117,24 @@ mmoreseqs_mmore_pipeline(WORKER* worker) {
       WORK_reuse(worker);
       /* get viterbi alignment bounds from mmseqs entry */
       WORK_load_mmseqs_alignment(worker);
+      /* scale cloud search parameters to mmseqs entry, if adaptive */
+      WORK_cloud_adapt_params(worker);
     }
 
     /* check if mmseqs viterbi passes threshold */
     if (passed[0] == true) {
-      /* run cloud search */
-      WORK_cloud_search_linear(worker);
+      /* reuse cloud from previous run, if available */
+      is_cached = WORK_cloud_cache_load(worker);
+      /* run cloud search (from each entry for target/query pair) */
+      if (is_cached == true) {
+        fprintf_vall(stdout, ":: CLOUD CACHED ::\n");
+      }
+      elif (N_anchors > 1) {
+        WORK_cloud_search_anchors(worker, i_cnt, N_anchors);
+      }
+      else {
+        WORK_cloud_search_linear(worker);
+      }
       /* evaluate cloud search scoring filter */
       WORK_cloud_natsc_to_eval(worker);
 
@@ -124,8 +152,15 @@ mmoreseqs_mmore_pipeline(WORKER* worker) {
     /* check if cloud search composite score passes threshold */
     if (passed[0] == true && passed[1] == true) {
       fprintf_vall(stdout, ":: CLOUD PASSED ::\n");
-      /* merge and reorient cloud */
-      WORK_cloud_merge_and_reorient(worker);
+      /* merge and reorient cloud (clouds of multiple entries are already merged, cached clouds are already row-wise) */
+      if (is_cached == false && N_anchors > 1) {
+        WORK_cloud_reorient(worker);
+      }
+      elif (is_cached == false) {
+        WORK_cloud_merge_and_reorient(worker);
+      }
+      /* save cloud for later runs */
+      WORK_cloud_cache_save(worker);
       /* run bound forward */
       WORK_bound_fwdback_linear(worker);
       /* bound forward scoring filter */
@@ -153,8 +188,16 @@ mmoreseqs_mmore_pipeline(WORKER* worker) {
                  passed[0], passed[1], passed[2], passed[3]);
     }
 
+    /* store thresholds which passed */
+    worker->vit_passed = passed[0];
+    worker->cld_passed = passed[1];
+    worker->fwd_passed = passed[2];
+    worker->post_passed = passed[3];
+
     /* cleanup for current iteration */
     WORK_postiter(worker);
+    /* trace all searches, including filtered ones */
+    WORK_report_trace(worker);
 
     /* only report if all thresholds passed */
     if ((passed[0] == true && passed[1] == true && passed[2] == true && passed[3] == true)) {
@@ -162,6 +205,10 @@ mmoreseqs_mmore_pipeline(WORKER* worker) {
       /* print results */
       WORK_report_result_current(worker);
     }
+
+    /* skip entries searched with current pair */
+    i += N_anchors - 1;
+    i_cnt += N_anchors - 1;
   }
 
   /* cleanup for end of loop */
@@ -0,0 +1,241 @@
+/*******************************************************************************
+ *  - FILE:      pipeline_msa_to_hmm.c
+ *  - DESC:    MSA-to-HMM pipeline.
+ *             Builds a calibrated profile from each family of Stockholm MSA database, in one pass:
+ *             outputs them as .hmm file with its index, and their consensus sequences as .fasta file
+ *             (for building mmseqs target database).
+ *             Families are parsed in batches on the main thread, built into profiles in parallel by
+ *             a thread pool, then output in order of MSA file.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+#include "../parsers/_parsers.h"
+#include "../work/_work.h"
+
+/* header */
+#include "_pipelines.h"
+
+/* number of families per thread in each batch */
+#define BUILD_BATCH_PER_THREAD 4
+/* residues per line of consensus .fasta file */
+#define CONSENSUS_LINE_LEN 60
+
+/* private functions */
+static void
+msa_to_hmm_Build(void* data, int job_id, int thread_id);
+static void
+msa_to_hmm_Consensus(HMM_PROFILE* prof, FILE* fp);
+
+/*! FUNCTION:  msa_to_hmm_pipeline()
+ *  SYNOPSIS:  MSA-to-HMM Pipeline: Builds calibrated profile from each family of Stockholm file, outputting .hmm file,
+ *             its index, and .fasta file of consensus sequences.
+ */
+STATUS_FLAG
+msa_to_hmm_pipeline(WORKER* worker) {
+  ARGS* args = worker->args;
+  CLOCK* timer = worker->timer;
+  F_INDEX* index = NULL;
+  F_INDEX_NODE node;
+  THREAD_POOL* pool = NULL;
+  BUILD_BATCH batch;
+  FILE* fp_msa = NULL;
+  FILE* fp_hmm = NULL;
+  FILE* fp_cons = NULL;
+  FILE* fp_index = NULL;
+  char* index_path = NULL;
+  int N_threads = args->num_threads;
+  int N_fams = 0;
+  long offset = 0;
+  bool is_eof = false;
+  double duration = 0.0;
+  printf_vlo("=== MSA-TO-HMM PIPELINE ===\n");
+
+  CLOCK_Start(timer);
+
+  /* thread-local builders and profiles */
+  WORKER_Create_Threads(worker, N_threads);
+  for (int i = 0; i < N_threads; i++) {
+    worker->threads[i].t_builder = SEQ_BUILDER_Create();
+    worker->threads[i].t_prof = HMM_PROFILE_Create();
+  }
+  pool = THREAD_POOL_Create(N_threads);
+
+  batch.N = 0;
+  batch.Nalloc = N_threads * BUILD_BATCH_PER_THREAD;
+  batch.seqs = NULL;
+  batch.msas = ERROR_malloc(sizeof(MSA*) * batch.Nalloc);
+  batch.texts = ERROR_malloc(sizeof(char*) * batch.Nalloc);
+  batch.text_lens = ERROR_malloc(sizeof(size_t) * batch.Nalloc);
+  batch.cons_texts = NULL;
+  batch.cons_lens = NULL;
+  batch.prof_lens = ERROR_malloc(sizeof(int) * batch.Nalloc);
+  batch.threads = worker->threads;
+  if (args->cons_fileout != NULL) {
+    batch.cons_texts = ERROR_malloc(sizeof(char*) * batch.Nalloc);
+    batch.cons_lens = ERROR_malloc(sizeof(size_t) * batch.Nalloc);
+  }
+  for (int i = 0; i < batch.Nalloc; i++) {
+    batch.msas[i] = MSA_Create();
+    batch.texts[i] = NULL;
+    batch.text_lens[i] = 0;
+    if (batch.cons_texts != NULL) {
+      batch.cons_texts[i] = NULL;
+      batch.cons_lens[i] = 0;
+    }
+  }
+
+  /* index of output profiles, in order of file */
+  index = F_INDEX_Create();
+  index->source_path = STR_Create(args->hmm_fileout);
+  index->mmseqs_names = false;
+
+  printf_vhi("# reading msas from:\t%s\n", args->t_filein);
+  printf_vhi("# outputting profiles to:\t%s\n", args->hmm_fileout);
+  fp_msa = ERROR_fopen(args->t_filein, "r");
+  fp_hmm = ERROR_fopen(args->hmm_fileout, "w");
+  if (args->cons_fileout != NULL) {
+    printf_vhi("# outputting consensus sequences to:\t%s\n", args->cons_fileout);
+    fp_cons = ERROR_fopen(args->cons_fileout, "w");
+  }
+
+  while (is_eof == false) {
+    /* stockholm parser reads file in order, so parse batch before handing it to threads */
+    for (batch.N = 0; batch.N < batch.Nalloc; batch.N++) {
+      if (MSA_Stockholm_Parse(batch.msas[batch.N], fp_msa) == false) {
+        is_eof = true;
+        break;
+      }
+      if (batch.msas[batch.N]->name == NULL) {
+        fprintf(stderr, "ERROR: MSA #%d of '%s' has no name (#=GF ID).\n", N_fams + batch.N, args->t_filein);
+        ERRORCHECK_exit(EXIT_FAILURE);
+      }
+    }
+    if (batch.N == 0) {
+      break;
+    }
+
+    THREAD_POOL_Run(pool, msa_to_hmm_Build, &batch, batch.N);
+
+    for (int i = 0; i < batch.N; i++) {
+      node.id = N_fams;
+      node.name = batch.msas[i]->name;
+      node.offset = offset;
+      node.mmseqs_id = -1;
+      node.length = batch.prof_lens[i];
+      F_INDEX_Pushback(index, &node);
+      N_fams++;
+
+      fwrite(batch.texts[i], 1, batch.text_lens[i], fp_hmm);
+      offset += batch.text_lens[i];
+      batch.texts[i] = ERROR_free(batch.texts[i]);
+      if (fp_cons != NULL) {
+        fwrite(batch.cons_texts[i], 1, batch.cons_lens[i], fp_cons);
+        batch.cons_texts[i] = ERROR_free(batch.cons_texts[i]);
+      }
+    }
+  }
+  fclose(fp_msa);
+  fclose(fp_hmm);
+  if (fp_cons != NULL) {
+    fclose(fp_cons);
+  }
+
+  /* output index next to profiles, as by `mmoreseqs index` */
+  index_path = STR_Concat(args->hmm_fileout, ".idx");
+  printf_vhi("# outputting profile index to:\t%s\n", index_path);
+  fp_index = ERROR_fopen(index_path, "w");
+  F_INDEX_Dump(index, fp_index);
+  fclose(fp_index);
+
+  CLOCK_Stop(timer);
+  duration = CLOCK_Duration(timer);
+
+  printf_vlo("# families: %d, threads: %d (%.3f sec, %.1f families/sec)\n",
+             N_fams, N_threads, duration, (duration > 0.0 ? N_fams / duration : 0.0));
+
+  pool = THREAD_POOL_Destroy(pool);
+  for (int i = 0; i < batch.Nalloc; i++) {
+    MSA_Destroy(batch.msas[i]);
+  }
+  ERROR_free(batch.msas);
+  ERROR_free(batch.texts);
+  ERROR_free(batch.text_lens);
+  ERROR_free(batch.cons_texts);
+  ERROR_free(batch.cons_lens);
+  ERROR_free(batch.prof_lens);
+  index = F_INDEX_Destroy(index);
+  index_path = STR_Destroy(index_path);
+
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION:  msa_to_hmm_Build()
+ *  SYNOPSIS:  Thread job: build profile from msa <job_id> of batch <data>, using builder of <thread_id>,
+ *             and output it to text of batch in .hmm file format (and its consensus in .fasta format).
+ */
+static void
+msa_to_hmm_Build(void* data,
+                 int job_id,
+                 int thread_id) {
+  BUILD_BATCH* batch = (BUILD_BATCH*)data;
+  WORKER_THREAD* thread = &batch->threads[thread_id];
+  FILE* fp = NULL;
+
+  MSA_to_HMM_PROFILE(thread->t_builder, batch->msas[job_id], thread->t_prof);
+  batch->prof_lens[job_id] = thread->t_prof->N;
+
+  fp = open_memstream(&batch->texts[job_id], &batch->text_lens[job_id]);
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Unable to open memory stream for profile '%s'.\n", batch->msas[job_id]->name);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  HMM_FILE_Dump(thread->t_prof, fp);
+  fclose(fp);
+
+  if (batch->cons_texts != NULL) {
+    fp = open_memstream(&batch->cons_texts[job_id], &batch->cons_lens[job_id]);
+    if (fp == NULL) {
+      fprintf(stderr, "ERROR: Unable to open memory stream for consensus '%s'.\n", batch->msas[job_id]->name);
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+    msa_to_hmm_Consensus(thread->t_prof, fp);
+    fclose(fp);
+  }
+}
+
+/*! FUNCTION:  msa_to_hmm_Consensus()
+ *  SYNOPSIS:  Output consensus sequence of <prof> to <fp> in .fasta format, named by profile
+ *             (most likely residue of each match node, as by `hmmemit -c`).
+ */
+static void
+msa_to_hmm_Consensus(HMM_PROFILE* prof,
+                     FILE* fp) {
+  int best;
+
+  fprintf(fp, ">%s\n", prof->name);
+  for (int k = 1; k <= prof->N; k++) {
+    best = 0;
+    for (int a = 1; a < NUM_AMINO; a++) {
+      if (prof->hmm_model[k].match[a] > prof->hmm_model[k].match[best]) {
+        best = a;
+      }
+    }
+    fputc(AA[best], fp);
+    if (k % CONSENSUS_LINE_LEN == 0 || k == prof->N) {
+      fputc('\n', fp);
+    }
+  }
+}
@@ -0,0 +1,614 @@
+/*******************************************************************************
+ *  - FILE:      pipeline_plan.c
+ *  - DESC:    Plan pipeline.
+ *             Splits mmseqs results into shards for a number of workers, balanced by
+ *             estimated search cost rather than by number of results.
+ *  NOTES:
+ *    - Cost of each search is estimated from target and query lengths (from F_INDEX) and
+ *      the span of its mmseqs alignment. Model can be calibrated by a least-squares fit
+ *      to the per-search runtimes in the mytimeout report of a previous run.
+ *    - Range shards are contiguous (for --range). Id list shards are not (for --idlist),
+ *      so can be balanced more closely.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+#include "../parsers/_parsers.h"
+#include "../reporting/_reporting.h"
+#include "../work/_work.h"
+
+/* header */
+#include "_pipelines.h"
+
+/* private functions */
+static void
+plan_Load_Indexes(WORKER* worker);
+static bool
+plan_Has_Lengths(F_INDEX* index);
+static void
+plan_Terms(WORKER* worker, M8_RESULT* m8, double* terms);
+static int
+plan_Calibrate(WORKER* worker, double* coeffs);
+static bool
+plan_Fit(double* A, double* b, double* coeffs);
+static void
+plan_Shard_Range(PLAN_HIT* hits, int N_hits, int N_shards);
+static int
+plan_Range_Count(PLAN_HIT* hits, int N_hits, double max_cost);
+static void
+plan_Shard_Idlist(PLAN_HIT* hits, int N_hits, int N_shards);
+static void
+plan_Heap_Down(int* heap, int N_heap, int i_root, double* loads);
+static int
+plan_Compare_Cost(const void* a, const void* b);
+static int
+plan_Compare_Shard(const void* a, const void* b);
+
+/*! FUNCTION:  plan_pipeline()
+ *  SYNOPSIS:  Plan Pipeline: Splits mmseqs results into shards of balanced estimated runtime.
+ *             Outputs table of shards, as ranges (for --range) or id list files (for --idlist).
+ */
+STATUS_FLAG
+plan_pipeline(WORKER* worker) {
+  ARGS* args = worker->args;
+  M8_RESULTS* m8_data = NULL;
+  PLAN_HIT* hits = NULL;
+  int N_hits = 0;
+  int N_shards = args->plan_num_shards;
+  bool is_idlist = (args->plan_idlist_fileout != NULL);
+  double coeffs[NUM_PLAN_TERMS] = {PLAN_COST_FIXED, PLAN_COST_LINEAR, PLAN_COST_WINDOW, PLAN_COST_FULL};
+  double terms[NUM_PLAN_TERMS];
+  int N_timed = 0;
+  double* shard_costs = NULL;
+  int* shard_sizes = NULL;
+  double total_cost, max_cost;
+  FILE* fp = NULL;
+  printf_vlo("=== PLAN PIPELINE ===\n");
+
+  /* load target/query lengths and mmseqs results to be split */
+  WORK_init(worker);
+  WORK_load_mmseqs_file(worker);
+  /* read all entries now, if .m8 is a pipe */
+  WORK_load_mmseqs_ahead(worker, INT_MAX);
+  if (args->hitlist_filein != NULL) {
+    fprintf(stderr, "ERROR: Plan requires .m8 results, binary hitlists are not supported.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  plan_Load_Indexes(worker);
+  m8_data = worker->mmseqs_data;
+  N_hits = args->list_range.end - args->list_range.beg;
+
+  /* fit cost model to runtimes of previous run */
+  if (args->plan_calib_filein != NULL) {
+    N_timed = plan_Calibrate(worker, coeffs);
+  }
+
+  /* estimate cost of each search */
+  hits = ERROR_malloc(sizeof(PLAN_HIT) * MAX(N_hits, 1));
+  total_cost = 0.0;
+  for (int i = 0; i < N_hits; i++) {
+    M8_RESULT* m8 = &m8_data->data[i];
+    plan_Terms(worker, m8, terms);
+    hits[i].result_id = m8->result_id;
+    hits[i].shard_id = 0;
+    hits[i].cost = 0.0;
+    for (int k = 0; k < NUM_PLAN_TERMS; k++) {
+      hits[i].cost += coeffs[k] * terms[k];
+    }
+    total_cost += hits[i].cost;
+  }
+  /* without any cost information, balance by number of searches */
+  if (total_cost <= 0.0) {
+    for (int i = 0; i < N_hits; i++) {
+      hits[i].cost = 1.0;
+    }
+  }
+
+  /* split into shards. afterwards, <hits> are ordered by shard, then by result id */
+  if (is_idlist) {
+    plan_Shard_Idlist(hits, N_hits, N_shards);
+  }
+  else {
+    plan_Shard_Range(hits, N_hits, N_shards);
+  }
+
+  /* shard totals */
+  shard_costs = ERROR_malloc(sizeof(double) * N_shards);
+  shard_sizes = ERROR_malloc(sizeof(int) * N_shards);
+  for (int k = 0; k < N_shards; k++) {
+    shard_costs[k] = 0.0;
+    shard_sizes[k] = 0;
+  }
+  for (int i = 0; i < N_hits; i++) {
+    shard_costs[hits[i].shard_id] += hits[i].cost;
+    shard_sizes[hits[i].shard_id] += 1;
+  }
+  total_cost = 0.0;
+  max_cost = 0.0;
+  for (int k = 0; k < N_shards; k++) {
+    total_cost += shard_costs[k];
+    max_cost = MAX(max_cost, shard_costs[k]);
+  }
+
+  /* write plan */
+  fp = (args->plan_fileout != NULL ? ERROR_fopen(args->plan_fileout, "w") : stdout);
+  fprintf(fp, "# mmoreseqs plan: %d searches in %d %s shards\n",
+          N_hits, N_shards, (is_idlist ? "idlist" : "range"));
+  fprintf(fp, "# cost model: %.3e + %.3e*(Q+T) + %.3e*(Q_aln*T_aln) + %.3e*(Q*T)",
+          coeffs[PLAN_FIXED], coeffs[PLAN_LINEAR], coeffs[PLAN_WINDOW], coeffs[PLAN_FULL]);
+  if (N_timed > 0) {
+    fprintf(fp, " [calibrated from '%s' on %d searches, in secs]\n", args->plan_calib_filein, N_timed);
+  } else {
+    fprintf(fp, " [default, in dp cells]\n");
+  }
+  fprintf(fp, "# est. cost: total = %.3e, max/mean shard = %.3f\n",
+          total_cost, (total_cost > 0.0 ? max_cost / (total_cost / N_shards) : 1.0));
+
+  if (is_idlist) {
+    const int num_fields = 4;
+    const char* headers[] = {"shard-id", "num-searches", "est-cost", "idlist"};
+    REPORT_header(fp, headers, num_fields);
+  } else {
+    const int num_fields = 5;
+    const char* headers[] = {"shard-id", "num-searches", "est-cost", "range-beg", "range-end"};
+    REPORT_header(fp, headers, num_fields);
+  }
+
+  int i = 0;
+  int prv_end = args->list_range.beg;
+  for (int k = 0; k < N_shards; k++) {
+    int i_beg = i;
+    while (i < N_hits && hits[i].shard_id == k) {
+      i++;
+    }
+
+    if (is_idlist) {
+      char idlist_fileout[MAX_PATH_LEN];
+      snprintf(idlist_fileout, MAX_PATH_LEN, "%s.%d.idlist", args->plan_idlist_fileout, k);
+      FILE* idlist_fp = ERROR_fopen(idlist_fileout, "w");
+      fprintf(idlist_fp, "# shard %d of %d: %d searches, est. cost %.3e\n",
+              k, N_shards, shard_sizes[k], shard_costs[k]);
+      for (int j = i_beg; j < i; j++) {
+        fprintf(idlist_fp, "%d\n", hits[j].result_id);
+      }
+      fclose(idlist_fp);
+      fprintf(fp, "%d\t%d\t%.3e\t%s\n", k, shard_sizes[k], shard_costs[k], idlist_fileout);
+    }
+    else {
+      /* empty shards get an empty range */
+      int beg = (i > i_beg ? hits[i_beg].result_id : prv_end);
+      int end = (i > i_beg ? hits[i - 1].result_id + 1 : prv_end);
+      prv_end = end;
+      fprintf(fp, "%d\t%d\t%.3e\t%d\t%d\n", k, shard_sizes[k], shard_costs[k], beg, end);
+    }
+  }
+  if (fp != stdout) {
+    fclose(fp);
+  }
+
+  /* clean up worker data structs */
+  hits = ERROR_free(hits);
+  shard_costs = ERROR_free(shard_costs);
+  shard_sizes = ERROR_free(shard_sizes);
+  WORK_cleanup(worker);
+
+  return STATUS_SUCCESS;
+}
+
+/*! FUNCTION:  plan_Load_Indexes()
+ *  SYNOPSIS:  Load target and query indexes of <worker>, sorted by name.
+ *             Indexes from older builds do not store lengths, so are rebuilt from source files.
+ */
+static void
+plan_Load_Indexes(WORKER* worker) {
+  ARGS* args = worker->args;
+
+  WORK_load_indexes(worker);
+  if (plan_Has_Lengths(worker->t_index) == false) {
+    printf_vlo("# target index has no lengths, rebuilding from '%s'...\n", args->t_filein);
+    WORK_build_target_index(worker);
+    F_INDEX_Sort_by_Name(worker->t_index);
+  }
+  if (plan_Has_Lengths(worker->q_index) == false) {
+    printf_vlo("# query index has no lengths, rebuilding from '%s'...\n", args->q_filein);
+    WORK_build_query_index(worker);
+    F_INDEX_Sort_by_Name(worker->q_index);
+  }
+}
+
+/*! FUNCTION:  plan_Has_Lengths()
+ *  SYNOPSIS:  Check whether all nodes of <index> have a known length.
+ */
+static bool
+plan_Has_Lengths(F_INDEX* index) {
+  for (int i = 0; i < index->N; i++) {
+    if (index->nodes[i].length < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*! FUNCTION:  plan_Terms()
+ *  SYNOPSIS:  Compute cost model <terms> of search for mmseqs result <m8>.
+ */
+static void
+plan_Terms(WORKER* worker,
+           M8_RESULT* m8,
+           double* terms) {
+  F_INDEX_NODE* t_node = F_INDEX_Getby_Name(worker->t_index, m8->target_name);
+  F_INDEX_NODE* q_node = F_INDEX_Getby_Name(worker->q_index, m8->query_name);
+  if (t_node == NULL) {
+    fprintf(stderr, "ERROR: Target name '%s' not found in F_INDEX.\n", m8->target_name);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  if (q_node == NULL) {
+    fprintf(stderr, "ERROR: Query name '%s' not found in F_INDEX.\n", m8->query_name);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  double T = t_node->length;
+  double Q = q_node->length;
+  double T_aln = abs(m8->t_end - m8->t_beg) + 1;
+  double Q_aln = abs(m8->q_end - m8->q_beg) + 1;
+
+  terms[PLAN_FIXED] = 1.0;
+  terms[PLAN_LINEAR] = Q + T;
+  terms[PLAN_WINDOW] = Q_aln * T_aln;
+  terms[PLAN_FULL] = Q * T;
+}
+
+/*! FUNCTION:  plan_Calibrate()
+ *  SYNOPSIS:  Fit <coeffs> of cost model to per-search runtimes in mytimeout report of previous run.
+ *             Rows are matched to mmseqs results by target and query name, in order.
+ *  RETURN:    Number of searches fit to, or 0 if fit failed (<coeffs> are unchanged).
+ */
+static int
+plan_Calibrate(WORKER* worker,
+               double* coeffs) {
+  ARGS* args = worker->args;
+  M8_RESULTS* m8_data = worker->mmseqs_data;
+  int N_m8 = args->list_range.end - args->list_range.beg;
+  const int N = NUM_PLAN_TERMS;
+  double A[NUM_PLAN_TERMS * NUM_PLAN_TERMS] = {0}; /* normal equations: sum of terms * terms^T */
+  double b[NUM_PLAN_TERMS] = {0};                  /* normal equations: sum of terms * runtime */
+  double terms[NUM_PLAN_TERMS];
+  double fit[NUM_PLAN_TERMS];
+  int N_timed = 0;
+  int N_unmatched = 0;
+  int j = 0;
+
+  FILE* fp = NULL;
+  char* line_buf = NULL;
+  size_t line_buf_size = 0;
+  ssize_t line_size = 0;
+  char* line_ptr = NULL;
+  char* t_name = NULL;
+  char* q_name = NULL;
+  char* token = NULL;
+
+  fp = ERROR_fopen(args->plan_calib_filein, "r");
+  while ((line_size = getline(&line_buf, &line_buf_size, fp)), line_size != -1) {
+    /* ignore comment lines */
+    if (line_buf[0] == '#' || line_size <= 1) {
+      continue;
+    }
+    /* [1] target, [2] query, [3] total runtime */
+    line_ptr = line_buf;
+    t_name = strtok_r(line_ptr, "\t\n", &line_ptr);
+    q_name = strtok_r(line_ptr, "\t\n", &line_ptr);
+    token = strtok_r(line_ptr, "\t\n", &line_ptr);
+    if (t_name == NULL || q_name == NULL || token == NULL) {
+      continue;
+    }
+
+    /* report rows are in same order as mmseqs results, so search forward from last match */
+    int k = j;
+    while (k < N_m8 &&
+           (STR_Equals(m8_data->data[k].target_name, t_name) == false ||
+            STR_Equals(m8_data->data[k].query_name, q_name) == false)) {
+      k++;
+    }
+    if (k == N_m8) {
+      N_unmatched += 1;
+      continue;
+    }
+    j = k + 1;
+
+    plan_Terms(worker, &m8_data->data[k], terms);
+    for (int r = 0; r < N; r++) {
+      for (int c = 0; c < N; c++) {
+        A[r * N + c] += terms[r] * terms[c];
+      }
+      b[r] += terms[r] * atof(token);
+    }
+    N_timed += 1;
+  }
+  fclose(fp);
+  ERROR_free(line_buf);
+
+  if (N_unmatched > 0) {
+    fprintf(stderr, "WARNING: %d searches in '%s' were not found in mmseqs results.\n",
+            N_unmatched, args->plan_calib_filein);
+  }
+  if (N_timed < N || plan_Fit(A, b, fit) == false) {
+    fprintf(stderr, "WARNING: Unable to calibrate cost model from '%s' (%d searches), using default.\n",
+            args->plan_calib_filein, N_timed);
+    return 0;
+  }
+  for (int k = 0; k < N; k++) {
+    coeffs[k] = fit[k];
+  }
+  return N_timed;
+}
+
+/*! FUNCTION:  plan_Fit()
+ *  SYNOPSIS:  Solve normal equations <A> * <coeffs> = <b> for non-negative <coeffs>.
+ *             Terms that are collinear or would get a negative coefficient are dropped (coefficient 0),
+ *             and the rest refit, since runtimes of each part of the search only add up.
+ *  RETURN:    False if no terms could be fit.
+ */
+static bool
+plan_Fit(double* A,
+         double* b,
+         double* coeffs) {
+  const int N = NUM_PLAN_TERMS;
+  double scale[NUM_PLAN_TERMS];
+  bool is_used[NUM_PLAN_TERMS];
+  double M[NUM_PLAN_TERMS * (NUM_PLAN_TERMS + 1)];
+  double z[NUM_PLAN_TERMS];
+  int idx[NUM_PLAN_TERMS];
+
+  /* scale terms to same magnitude, so that system is well-conditioned */
+  for (int k = 0; k < N; k++) {
+    scale[k] = sqrt(A[k * N + k]);
+    is_used[k] = (scale[k] > 0.0);
+  }
+
+  while (true) {
+    int n = 0;
+    int i_drop = -1;
+    for (int k = 0; k < N; k++) {
+      if (is_used[k]) {
+        idx[n++] = k;
+      }
+    }
+    if (n == 0) {
+      return false;
+    }
+
+    /* augmented matrix of scaled system over used terms */
+    const int W = n + 1;
+    for (int r = 0; r < n; r++) {
+      for (int c = 0; c < n; c++) {
+        M[r * W + c] = A[idx[r] * N + idx[c]] / (scale[idx[r]] * scale[idx[c]]);
+      }
+      M[r * W + n] = b[idx[r]] / scale[idx[r]];
+    }
+
+    /* gaussian elimination with partial pivoting */
+    for (int c = 0; c < n && i_drop < 0; c++) {
+      int p = c;
+      for (int r = c + 1; r < n; r++) {
+        if (fabs(M[r * W + c]) > fabs(M[p * W + c])) {
+          p = r;
+        }
+      }
+      /* term is collinear with previous terms */
+      if (fabs(M[p * W + c]) < 1e-9) {
+        i_drop = idx[c];
+        break;
+      }
+      for (int k = 0; k < W; k++) {
+        double tmp = M[c * W + k];
+        M[c * W + k] = M[p * W + k];
+        M[p * W + k] = tmp;
+      }
+      for (int r = c + 1; r < n; r++) {
+        double f = M[r * W + c] / M[c * W + c];
+        for (int k = c; k < W; k++) {
+          M[r * W + k] -= f * M[c * W + k];
+        }
+      }
+    }
+    if (i_drop >= 0) {
+      is_used[i_drop] = false;
+      continue;
+    }
+    for (int r = n - 1; r >= 0; r--) {
+      z[r] = M[r * W + n];
+      for (int c = r + 1; c < n; c++) {
+        z[r] -= M[r * W + c] * z[c];
+      }
+      z[r] /= M[r * W + r];
+    }
+
+    /* drop most negative coefficient and refit */
+    double z_min = 0.0;
+    for (int r = 0; r < n; r++) {
+      if (z[r] < z_min) {
+        z_min = z[r];
+        i_drop = idx[r];
+      }
+    }
+    if (i_drop >= 0) {
+      is_used[i_drop] = false;
+      continue;
+    }
+
+    for (int k = 0; k < N; k++) {
+      coeffs[k] = 0.0;
+    }
+    for (int r = 0; r < n; r++) {
+      coeffs[idx[r]] = z[r] / scale[idx[r]];
+    }
+    return true;
+  }
+}
+
+/*! FUNCTION:  plan_Shard_Range()
+ *  SYNOPSIS:  Split <hits> (in result id order) into at most <N_shards> contiguous ranges,
+ *             minimizing cost of most costly range.
+ */
+static void
+plan_Shard_Range(PLAN_HIT* hits,
+                 int N_hits,
+                 int N_shards) {
+  double lo = 0.0;
+  double hi = 0.0;
+  for (int i = 0; i < N_hits; i++) {
+    lo = MAX(lo, hits[i].cost);
+    hi += hits[i].cost;
+  }
+
+  /* bisect smallest max shard cost for which ranges fit in <N_shards> */
+  for (int iter = 0; iter < 64; iter++) {
+    double mid = (lo + hi) / 2.0;
+    if (plan_Range_Count(hits, N_hits, mid) <= N_shards) {
+      hi = mid;
+    } else {
+      lo = mid;
+    }
+  }
+
+  /* assign ranges greedily, same as counted */
+  int shard_id = 0;
+  int N_in_shard = 0;
+  double shard_cost = 0.0;
+  for (int i = 0; i < N_hits; i++) {
+    if (N_in_shard > 0 && shard_cost + hits[i].cost > hi) {
+      shard_id = MIN(shard_id + 1, N_shards - 1);
+      N_in_shard = 0;
+      shard_cost = 0.0;
+    }
+    hits[i].shard_id = shard_id;
+    N_in_shard += 1;
+    shard_cost += hits[i].cost;
+  }
+}
+
+/*! FUNCTION:  plan_Range_Count()
+ *  SYNOPSIS:  Count number of contiguous ranges needed to split <hits>, so that no range costs more than <max_cost>.
+ */
+static int
+plan_Range_Count(PLAN_HIT* hits,
+                 int N_hits,
+                 double max_cost) {
+  int N_ranges = 1;
+  int N_in_shard = 0;
+  double shard_cost = 0.0;
+  for (int i = 0; i < N_hits; i++) {
+    if (N_in_shard > 0 && shard_cost + hits[i].cost > max_cost) {
+      N_ranges += 1;
+      N_in_shard = 0;
+      shard_cost = 0.0;
+    }
+    N_in_shard += 1;
+    shard_cost += hits[i].cost;
+  }
+  return N_ranges;
+}
+
+/*! FUNCTION:  plan_Shard_Idlist()
+ *  SYNOPSIS:  Split <hits> into <N_shards> id lists, assigning each search to least loaded shard,
+ *             most costly first (longest processing time first).
+ *             Afterwards, <hits> are ordered by shard, then by result id.
+ */
+static void
+plan_Shard_Idlist(PLAN_HIT* hits,
+                  int N_hits,
+                  int N_shards) {
+  double* loads = ERROR_malloc(sizeof(double) * N_shards);
+  int* heap = ERROR_malloc(sizeof(int) * N_shards); /* min-heap of shards by load */
+
+  /* all loads are equal, so heap is ordered by shard id */
+  for (int k = 0; k < N_shards; k++) {
+    loads[k] = 0.0;
+    heap[k] = k;
+  }
+
+  qsort(hits, N_hits, sizeof(PLAN_HIT), plan_Compare_Cost);
+  for (int i = 0; i < N_hits; i++) {
+    int k = heap[0];
+    hits[i].shard_id = k;
+    loads[k] += hits[i].cost;
+    plan_Heap_Down(heap, N_shards, 0, loads);
+  }
+  qsort(hits, N_hits, sizeof(PLAN_HIT), plan_Compare_Shard);
+
+  loads = ERROR_free(loads);
+  heap = ERROR_free(heap);
+}
+
+/*! FUNCTION:  plan_Heap_Down()
+ *  SYNOPSIS:  Sift <i_root> of <heap> of shard ids down, until subheap is ordered by <loads> (ties by shard id).
+ */
+static void
+plan_Heap_Down(int* heap,
+               int N_heap,
+               int i_root,
+               double* loads) {
+  int i = i_root;
+  while (true) {
+    int min = i;
+    int left = 2 * i + 1;
+    int right = 2 * i + 2;
+    if (left < N_heap &&
+        (loads[heap[left]] < loads[heap[min]] ||
+         (loads[heap[left]] == loads[heap[min]] && heap[left] < heap[min]))) {
+      min = left;
+    }
+    if (right < N_heap &&
+        (loads[heap[right]] < loads[heap[min]] ||
+         (loads[heap[right]] == loads[heap[min]] && heap[right] < heap[min]))) {
+      min = right;
+    }
+    if (min == i) {
+      break;
+    }
+    int tmp = heap[i];
+    heap[i] = heap[min];
+    heap[min] = tmp;
+    i = min;
+  }
+}
+
+/*! FUNCTION:  plan_Compare_Cost()
+ *  SYNOPSIS:  Compare PLAN_HIT <a> and <b>, for sorting by descending cost (ties by result id).
+ */
+static int
+plan_Compare_Cost(const void* a,
+                  const void* b) {
+  const PLAN_HIT* hit_a = a;
+  const PLAN_HIT* hit_b = b;
+  if (hit_a->cost != hit_b->cost) {
+    return (hit_a->cost > hit_b->cost ? -1 : 1);
+  }
+  return hit_a->result_id - hit_b->result_id;
+}
+
+/*! FUNCTION:  plan_Compare_Shard()
+ *  SYNOPSIS:  Compare PLAN_HIT <a> and <b>, for sorting by shard, then by result id.
+ */
+static int
+plan_Compare_Shard(const void* a,
+                   const void* b) {
+  const PLAN_HIT* hit_a = a;
+  const PLAN_HIT* hit_b = b;
+  if (hit_a->shard_id != hit_b->shard_id) {
+    return hit_a->shard_id - hit_b->shard_id;
+  }
+  return hit_a->result_id - hit_b->result_id;
+}
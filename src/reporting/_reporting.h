@@ -20,5 +20,9 @@
 #include "myout.h"
 #include "mythreshout.h"
 #include "mytimeout.h"
+#include "perfout.h"
+#include "traceout.h"
+/* Binary output format */
+#include "binout.h"
 
 #endif /* _REPORTING_H */
@@ -0,0 +1,308 @@
+/*******************************************************************************
+ *  - FILE:  binout.c
+ *  - DESC:  Reporting functions for generating binary results (binout) output.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+
+/* header */
+#include "_reporting.h"
+#include "binout.h"
+
+/* private functions */
+static void
+REPORT_binout_write(FILE* fp, const void* data, size_t size);
+static void
+REPORT_binout_write_int(FILE* fp, int val);
+static void
+REPORT_binout_write_flt(FILE* fp, float val);
+static void
+REPORT_binout_write_bool(FILE* fp, bool val);
+static void
+REPORT_binout_write_str(FILE* fp, const char* str);
+static void
+REPORT_binout_write_range(FILE* fp, RANGE range);
+static void
+REPORT_binout_write_chars(FILE* fp, VECTOR_CHAR* vec);
+static void
+REPORT_binout_write_alignment(FILE* fp, ALIGNMENT* aln);
+
+/* === BINOUT OUTPUT === */
+/* Compact binary copy of results, which can be rendered to any text report by `mmoreseqs convert`.
+   Description: Stream of fixed-layout records, written natively (byte order and struct sizes are
+   recorded in header and checked on read). Ints are int32, bools are uint8, strings are an int32
+   length (-1 for NULL) followed by characters without terminator.
+   - header:  signature, version, byte order, sizes of SCORES/ALL_SCORES/TIMES/STATS,
+              pipeline name, input files, and run options which change report layout.
+   - entry:   'R' tag, then every RESULT field, in struct order.
+              SCORES/ALL_SCORES/TIMES are written as raw structs (all floats).
+              Alignments only keep the reported [beg,end] window of traces (rebased to 0),
+              the alignment regions, and the alignment strings.
+   - footer:  'F' tag, then STATS and total TIMES as raw structs.
+ */
+
+/*!  FUNCTION:    REPORT_binout_header()
+ *   SYNOPSIS:    Write binout header to <fp>: format signature, struct sizes,
+ *                input files and options needed to render text reports.
+ */
+STATUS_FLAG
+REPORT_binout_header(WORKER* worker,
+                     FILE* fp) {
+  ARGS* args = worker->args;
+
+  /* format */
+  REPORT_binout_write(fp, BINOUT_MAGIC, BINOUT_MAGIC_LEN);
+  REPORT_binout_write_int(fp, BINOUT_VERSION);
+  REPORT_binout_write_int(fp, BINOUT_ENDIAN);
+  REPORT_binout_write_int(fp, sizeof(SCORES));
+  REPORT_binout_write_int(fp, sizeof(ALL_SCORES));
+  REPORT_binout_write_int(fp, sizeof(TIMES));
+  REPORT_binout_write_int(fp, sizeof(STATS));
+  /* input files */
+  REPORT_binout_write_str(fp, PIPELINES[args->pipeline_mode].name);
+  REPORT_binout_write_str(fp, args->t_filein);
+  REPORT_binout_write_str(fp, args->q_filein);
+  REPORT_binout_write_str(fp, args->t_index_filein);
+  REPORT_binout_write_str(fp, args->q_index_filein);
+  REPORT_binout_write_str(fp, args->mmseqs_m8_filein);
+  /* options */
+  REPORT_binout_write_bool(fp, args->is_run_domains);
+  REPORT_binout_write_bool(fp, args->is_run_vitaln);
+  REPORT_binout_write_bool(fp, args->is_run_postaln);
+  REPORT_binout_write_bool(fp, args->is_run_mmseqsaln);
+  REPORT_binout_write_bool(fp, args->adjust_mmseqs_alns);
+
+  return STATUS_SUCCESS;
+}
+
+/*!  FUNCTION:    REPORT_binout_entry()
+ *   SYNOPSIS:    Write <result> record to <fp>.
+ */
+STATUS_FLAG
+REPORT_binout_entry(WORKER* worker,
+                    RESULT* result,
+                    FILE* fp) {
+  fputc(BINOUT_TAG_RESULT, fp);
+  /* ids */
+  REPORT_binout_write_int(fp, result->result_id);
+  REPORT_binout_write_int(fp, result->target_id);
+  REPORT_binout_write_int(fp, result->query_id);
+  /* target/query metadata */
+  REPORT_binout_write_str(fp, result->target_name);
+  REPORT_binout_write_str(fp, result->query_name);
+  REPORT_binout_write_str(fp, result->target_acc);
+  REPORT_binout_write_str(fp, result->target_desc);
+  REPORT_binout_write_str(fp, result->query_acc);
+  REPORT_binout_write_int(fp, result->target_len);
+  REPORT_binout_write_int(fp, result->query_len);
+  /* ranges */
+  REPORT_binout_write_range(fp, result->target_range);
+  REPORT_binout_write_range(fp, result->query_range);
+  REPORT_binout_write_range(fp, result->target_bounds);
+  REPORT_binout_write_range(fp, result->query_bounds);
+  /* alignments */
+  REPORT_binout_write_alignment(fp, result->vit_trace);
+  REPORT_binout_write_alignment(fp, result->post_trace);
+  /* scores */
+  REPORT_binout_write(fp, &result->scores, sizeof(ALL_SCORES));
+  REPORT_binout_write(fp, &result->final_scores, sizeof(SCORES));
+  /* domain summary */
+  REPORT_binout_write_int(fp, result->n_domains);
+  REPORT_binout_write_int(fp, result->dom_best);
+  REPORT_binout_write_range(fp, result->dom_best_range);
+  REPORT_binout_write_flt(fp, result->dom_best_sc);
+  REPORT_binout_write_flt(fp, result->dom_best_presc);
+  REPORT_binout_write_flt(fp, result->dom_best_fwdsc);
+  REPORT_binout_write_flt(fp, result->dom_best_bias);
+  REPORT_binout_write_flt(fp, result->dom_sumsc);
+  /* runtimes */
+  REPORT_binout_write(fp, &result->times, sizeof(TIMES));
+  /* cell counts */
+  REPORT_binout_write_int(fp, result->cpu_cloud_cells);
+  REPORT_binout_write_int(fp, result->cloud_cells);
+  REPORT_binout_write_int(fp, result->cpu_total_cells);
+  REPORT_binout_write_int(fp, result->total_cells);
+  REPORT_binout_write_flt(fp, result->perc_cells);
+  /* threshold filters */
+  REPORT_binout_write_flt(fp, result->threshold_prefilter);
+  REPORT_binout_write_flt(fp, result->score_prefilter);
+  REPORT_binout_write_bool(fp, result->is_passed_prefilter);
+  REPORT_binout_write_flt(fp, result->threshold_viterbi);
+  REPORT_binout_write_flt(fp, result->score_viterbi);
+  REPORT_binout_write_bool(fp, result->is_passed_viterbi);
+  REPORT_binout_write_flt(fp, result->threshold_cloud);
+  REPORT_binout_write_flt(fp, result->score_cloud);
+  REPORT_binout_write_bool(fp, result->is_passed_cloud);
+  REPORT_binout_write_flt(fp, result->threshold_fwdback);
+  REPORT_binout_write_flt(fp, result->score_fwdback);
+  REPORT_binout_write_bool(fp, result->is_passed_fwdback);
+  REPORT_binout_write_flt(fp, result->threshold_report);
+  REPORT_binout_write_flt(fp, result->score_reported);
+  REPORT_binout_write_bool(fp, result->is_passed_report);
+
+  return STATUS_SUCCESS;
+}
+
+/*!  FUNCTION:    REPORT_binout_footer()
+ *   SYNOPSIS:    Write binout footer to <fp>: aggregate stats and total runtimes.
+ */
+STATUS_FLAG
+REPORT_binout_footer(WORKER* worker,
+                     FILE* fp) {
+  fputc(BINOUT_TAG_FOOTER, fp);
+  REPORT_binout_write(fp, worker->stats, sizeof(STATS));
+  REPORT_binout_write(fp, worker->times_totals, sizeof(TIMES));
+
+  return STATUS_SUCCESS;
+}
+
+/*!  FUNCTION:    REPORT_binout_write()
+ *   SYNOPSIS:    Write <size> bytes of <data> to <fp>. Exits on failed write.
+ */
+static void
+REPORT_binout_write(FILE* fp,
+                    const void* data,
+                    size_t size) {
+  if (fwrite(data, 1, size, fp) != size) {
+    fprintf(stderr, "ERROR: Failed to write to binout file.\n");
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+}
+
+/*!  FUNCTION:    REPORT_binout_write_int()
+ *   SYNOPSIS:    Write <val> to <fp> as int32.
+ */
+static void
+REPORT_binout_write_int(FILE* fp,
+                        int val) {
+  int32_t data = val;
+  REPORT_binout_write(fp, &data, sizeof(int32_t));
+}
+
+/*!  FUNCTION:    REPORT_binout_write_flt()
+ *   SYNOPSIS:    Write <val> to <fp> as float.
+ */
+static void
+REPORT_binout_write_flt(FILE* fp,
+                        float val) {
+  REPORT_binout_write(fp, &val, sizeof(float));
+}
+
+/*!  FUNCTION:    REPORT_binout_write_bool()
+ *   SYNOPSIS:    Write <val> to <fp> as uint8.
+ */
+static void
+REPORT_binout_write_bool(FILE* fp,
+                         bool val) {
+  uint8_t data = val;
+  REPORT_binout_write(fp, &data, sizeof(uint8_t));
+}
+
+/*!  FUNCTION:    REPORT_binout_write_str()
+ *   SYNOPSIS:    Write <str> to <fp> as length, followed by characters. NULL has length -1.
+ */
+static void
+REPORT_binout_write_str(FILE* fp,
+                        const char* str) {
+  if (str == NULL) {
+    REPORT_binout_write_int(fp, -1);
+    return;
+  }
+  int len = strlen(str);
+  REPORT_binout_write_int(fp, len);
+  REPORT_binout_write(fp, str, len);
+}
+
+/*!  FUNCTION:    REPORT_binout_write_range()
+ *   SYNOPSIS:    Write <range> to <fp> as <beg,end>.
+ */
+static void
+REPORT_binout_write_range(FILE* fp,
+                          RANGE range) {
+  REPORT_binout_write_int(fp, range.beg);
+  REPORT_binout_write_int(fp, range.end);
+}
+
+/*!  FUNCTION:    REPORT_binout_write_chars()
+ *   SYNOPSIS:    Write <vec> to <fp> as length, followed by characters (including any terminator).
+ */
+static void
+REPORT_binout_write_chars(FILE* fp,
+                          VECTOR_CHAR* vec) {
+  REPORT_binout_write_int(fp, vec->N);
+  REPORT_binout_write(fp, vec->data, vec->N);
+}
+
+/*!  FUNCTION:    REPORT_binout_write_alignment()
+ *   SYNOPSIS:    Write <aln> to <fp>. Only traces in reported window [beg,end] are kept, rebased to 0.
+ */
+static void
+REPORT_binout_write_alignment(FILE* fp,
+                              ALIGNMENT* aln) {
+  int beg, end, num_traces;
+
+  REPORT_binout_write_bool(fp, aln != NULL);
+  if (aln == NULL) {
+    return;
+  }
+  /* cigar covers full traceback, so must be built before traces are cut to window */
+  if (aln->is_cigar_aln == false && aln->traces->N > 0) {
+    ALIGNMENT_Build_MMSEQS_Style(aln, NULL, NULL);
+  }
+
+  /* reported window of traces */
+  beg = aln->beg;
+  end = aln->end;
+  num_traces = 0;
+  if (beg >= 0 && end >= beg && end < aln->traces->N) {
+    num_traces = end - beg + 1;
+  }
+
+  REPORT_binout_write_int(fp, aln->Q);
+  REPORT_binout_write_int(fp, aln->T);
+  REPORT_binout_write_int(fp, aln->full_len);
+  REPORT_binout_write_int(fp, aln->num_alns);
+  REPORT_binout_write_int(fp, aln->best_idx);
+  REPORT_binout_write_int(fp, aln->aln_len);
+  REPORT_binout_write_int(fp, (num_traces > 0 ? 0 : beg));
+  REPORT_binout_write_int(fp, (num_traces > 0 ? end - beg : end));
+  REPORT_binout_write_int(fp, aln->num_gaps);
+  REPORT_binout_write_int(fp, aln->num_misses);
+  REPORT_binout_write_int(fp, aln->num_matches);
+  REPORT_binout_write_flt(fp, aln->perc_id);
+  /* traces */
+  REPORT_binout_write_int(fp, num_traces);
+  for (int i = beg; i < beg + num_traces; i++) {
+    TRACE* tr = &VEC_X(aln->traces, i);
+    REPORT_binout_write_int(fp, tr->q_0);
+    REPORT_binout_write_int(fp, tr->t_0);
+    REPORT_binout_write_int(fp, tr->st);
+  }
+  /* discrete alignment regions, as <beg,end> indexes into window and score */
+  REPORT_binout_write_int(fp, aln->tr_beg->N);
+  for (int i = 0; i < aln->tr_beg->N; i++) {
+    REPORT_binout_write_int(fp, VEC_X(aln->tr_beg, i) - beg);
+    REPORT_binout_write_int(fp, VEC_X(aln->tr_end, i) - beg);
+    REPORT_binout_write_flt(fp, VEC_X(aln->tr_score, i));
+  }
+  /* alignment strings */
+  REPORT_binout_write_bool(fp, aln->is_cigar_aln);
+  REPORT_binout_write_chars(fp, aln->cigar_aln);
+  REPORT_binout_write_bool(fp, aln->is_hmmer_aln);
+  REPORT_binout_write_chars(fp, aln->target_aln);
+  REPORT_binout_write_chars(fp, aln->center_aln);
+  REPORT_binout_write_chars(fp, aln->query_aln);
+  REPORT_binout_write_chars(fp, aln->state_aln);
+}
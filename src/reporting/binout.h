@@ -0,0 +1,30 @@
+/*******************************************************************************
+ *  - FILE:  binout.h
+ *  - DESC:  Reporting Subroutines for generating binary results (binout).
+ *******************************************************************************/
+
+#ifndef _BINOUT_H
+#define _BINOUT_H
+
+/* === BINOUT FUNCTIONS === */
+
+/*!  FUNCTION:    REPORT_binout_header()
+ *   SYNOPSIS:    Write binout header to <fp>: format signature, struct sizes,
+ *                input files and options needed to render text reports.
+ */
+STATUS_FLAG
+REPORT_binout_header(WORKER* worker, FILE* fp);
+
+/*!  FUNCTION:    REPORT_binout_entry()
+ *   SYNOPSIS:    Write <result> record to <fp>.
+ */
+STATUS_FLAG
+REPORT_binout_entry(WORKER* worker, RESULT* result, FILE* fp);
+
+/*!  FUNCTION:    REPORT_binout_footer()
+ *   SYNOPSIS:    Write binout footer to <fp>: aggregate stats and total runtimes.
+ */
+STATUS_FLAG
+REPORT_binout_footer(WORKER* worker, FILE* fp);
+
+#endif /* _BINOUT_H */
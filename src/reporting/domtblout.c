@@ -132,10 +132,10 @@ REPORT_domtblout_entry(WORKER* worker,
 
   fprintf(fp, "%-*s %-*s %-*s %-*s %9.2g %6.1f %5.1f %9.2g %6.1f %5.1f %5.1f %3d %3d %3d %3d %3d %3d %3d %s\n",
           /* query / target data */
-          qnamew, worker->q_seq->name,               /* query name */
-          qaccw, (NULL ? worker->q_seq->acc : "-"),  /* query accession */
-          tnamew, worker->t_prof->name,              /* target name */
-          taccw, (NULL ? worker->t_prof->acc : "-"), /* target accession */
+          qnamew, result->query_name,                /* query name */
+          qaccw, (NULL ? result->query_acc : "-"),   /* query accession */
+          tnamew, result->target_name,               /* target name */
+          taccw, (NULL ? result->target_acc : "-"),  /* target accession */
           /* full sequence */
           result->final_scores.eval,   /* evalue */
           result->final_scores.nat_sc, /* score */
@@ -154,7 +154,7 @@ REPORT_domtblout_entry(WORKER* worker,
           0,   /* number reported */
           0,   /* number included */
           /* target description */
-          (NULL ? worker->t_prof->desc : "--") /* query description */
+          (NULL ? result->target_desc : "--") /* query description */
   );
 }
 
@@ -88,37 +88,36 @@ STATUS_FLAG
 REPORT_m8out_entry(WORKER* worker,
                    RESULT* result,
                    FILE* fp) {
-  HMM_PROFILE* t_prof = worker->t_prof;
-  SEQUENCE* q_seq = worker->q_seq;
   SCORES* finalsc = &result->final_scores;
 
   /* TODO: Insert trace_post */
-  ALIGNMENT* aln = worker->trace_vit;
+  ALIGNMENT* aln = result->vit_trace;
   STR cigar_aln = NULL;
 
   TRACE* beg = &VEC_X(aln->traces, aln->beg);
   TRACE* end = &VEC_X(aln->traces, aln->end);
 
+  /* cigar alignment is only built by reports which print it */
   if (aln->is_cigar_aln == false) {
-    ALIGNMENT_Build_MMSEQS_Style(aln, worker->q_seq, worker->t_prof);
+    ALIGNMENT_Build_MMSEQS_Style(aln, NULL, NULL);
   }
   cigar_aln = VECTOR_CHAR_GetArray(aln->cigar_aln);
   cigar_aln = (STR_GetLength(cigar_aln) > 0 ? cigar_aln : "--");
 
   fprintf(fp, "%s\t%s\t%.3f\t%ld\t%d\t%d\t%d\t%d\t%d\t%d\t%9.2e\t%6.1f\t%s\n",
-          t_prof->name,    /* target name */
-          q_seq->name,     /* query name */
-          aln->perc_id,    /* percent id (number matches) */
-          aln->aln_len,    /* alignment length */
-          aln->num_misses, /* number of mismatches */
-          aln->num_gaps,   /* number of gap openings */
-          beg->t_0,        /* query start */
-          end->t_0,        /* query end */
-          beg->q_0,        /* target start */
-          end->q_0,        /* target end */
-          finalsc->eval,   /* evalue */
-          finalsc->seq_sc, /* bitscore */
-          cigar_aln        /* MMSEQS-style, cigar alignment */
+          result->target_name, /* target name */
+          result->query_name,  /* query name */
+          aln->perc_id,        /* percent id (number matches) */
+          aln->aln_len,        /* alignment length */
+          aln->num_misses,     /* number of mismatches */
+          aln->num_gaps,       /* number of gap openings */
+          beg->t_0,            /* query start */
+          end->t_0,            /* query end */
+          beg->q_0,            /* target start */
+          end->q_0,            /* target end */
+          finalsc->eval,       /* evalue */
+          finalsc->seq_sc,     /* bitscore */
+          cigar_aln            /* MMSEQS-style, cigar alignment */
   );
 }
 
@@ -142,14 +142,8 @@ void REPORT_stdout_header(WORKER* worker,
 void REPORT_stdout_entry(WORKER* worker,
                          RESULT* result,
                          FILE* fp) {
-  TASKS* tasks = worker->tasks;
   ARGS* args = worker->args;
-  BUFFER* buffer = worker->buffer;
   ALIGNMENT* aln;
-  ALIGNMENT* aln_vit = worker->trace_vit;
-  ALIGNMENT* aln_post = worker->trace_post;
-  HMM_PROFILE* t_prof = worker->t_prof;
-  SEQUENCE* q_seq = worker->q_seq;
   ALL_SCORES* scores = &result->scores;
   SCORES* finalsc = &result->final_scores;
 
@@ -181,11 +175,11 @@ void REPORT_stdout_entry(WORKER* worker,
   /* type of alignment, if any */
   if (args->is_run_postaln == true) {
     is_run_aln = true;
-    aln = worker->trace_post;
+    aln = result->post_trace;
   }
   elif (args->is_run_vitaln == true) {
     is_run_aln = true;
-    aln = worker->trace_vit;
+    aln = result->vit_trace;
   }
   elif (args->is_run_mmseqsaln == true) {
     is_run_aln = true;
@@ -196,16 +190,13 @@ void REPORT_stdout_entry(WORKER* worker,
   }
 
   if (is_run_aln == true) {
-    /* if alignemnt strings have not been produced yet, do it now */
+    /* hmmer-style strings were built when result was captured, cigar is built on demand */
     if (aln->is_cigar_aln == false) {
-      ALIGNMENT_Build_MMSEQS_Style(aln, worker->q_seq, worker->t_prof);
+      ALIGNMENT_Build_MMSEQS_Style(aln, NULL, NULL);
     }
     cigar_aln = VECTOR_CHAR_GetArray(aln->cigar_aln);
     cigar_aln = (STR_GetLength(cigar_aln) > 0 ? cigar_aln : "--");
 
-    if (aln->is_hmmer_aln == false) {
-      ALIGNMENT_Build_HMMER_Style(aln, worker->q_seq, worker->t_prof);
-    }
     target_aln = VECTOR_CHAR_GetArray(aln->target_aln);
     query_aln = VECTOR_CHAR_GetArray(aln->query_aln);
     center_aln = VECTOR_CHAR_GetArray(aln->center_aln);
@@ -215,13 +206,13 @@ void REPORT_stdout_entry(WORKER* worker,
   /* Meta Data */
   REPORT_horizontal_rule(fp);
   fprintf(fp, "%*s %s [L=%d]\n",
-          -field_width, "Query:", t_prof->name, t_prof->N);
+          -field_width, "Query:", result->target_name, result->target_len);
   fprintf(fp, "%*s %s [L=%d]\n",
-          -field_width, "Target:", q_seq->name, q_seq->N);
+          -field_width, "Target:", result->query_name, result->query_len);
   fprintf(fp, "%*s %s\n",
-          -field_width, "Accession:", (t_prof->acc ? t_prof->acc : "--"));
+          -field_width, "Accession:", (result->target_acc ? result->target_acc : "--"));
   fprintf(fp, "%*s %s\n",
-          -field_width, "Description:", (t_prof->desc ? t_prof->desc : "--"));
+          -field_width, "Description:", (result->target_desc ? result->target_desc : "--"));
   /* Scores Header */
   fprintf(fp, "== %*s\n",
           0, "Scores for complete sequences:");
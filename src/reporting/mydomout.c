@@ -106,31 +106,27 @@ void REPORT_mydomout_header(WORKER* worker,
 void REPORT_mydomout_entry(WORKER* worker,
                            RESULT* result,
                            FILE* fp) {
-  TIMES* times = worker->times;
-  HMM_PROFILE* t_prof = worker->t_prof;
-  SEQUENCE* q_seq = worker->q_seq;
-  ALIGNMENT* aln = worker->trace_vit;
-  DOMAIN_DEF* dom_def = worker->dom_def;
+  TIMES* times = &result->times;
 
   /* if no domains were found, skip entry */
-  if (dom_def->n_domains <= 0) {
+  if (result->n_domains <= 0) {
     return;
   }
 
-  int best_idx = dom_def->best;
-  RANGE dom_rng = dom_def->best_range;
-  float dom_fwdsc = dom_def->best_fwdsc;
-  float dom_presc = dom_def->best_presc;
-  float dom_bias = dom_def->best_bias;
-  float dom_sc = dom_def->best_sc;
-  float dom_sumsc = dom_def->dom_sumsc;
+  int best_idx = result->dom_best;
+  RANGE dom_rng = result->dom_best_range;
+  float dom_fwdsc = result->dom_best_fwdsc;
+  float dom_presc = result->dom_best_presc;
+  float dom_bias = result->dom_best_bias;
+  float dom_sc = result->dom_best_sc;
+  float dom_sumsc = result->dom_sumsc;
 
   float percent_cells = (float)result->cloud_cells / (float)result->total_cells;
 
   fprintf(fp, "%s\t%s\t%d/%d\t%.3g\t%.3f\t%.3f\t%.3f\t%.3f\t%.3f\t%d\t%d\t%.5f\t%d-%d\t%d-%d\t%.5f\n",
-          t_prof->name,                     /* target name */
-          q_seq->name,                      /* query name */
-          best_idx + 1, dom_def->n_domains, /* domain id */
+          result->target_name,              /* target name */
+          result->query_name,               /* query name */
+          best_idx + 1, result->n_domains,  /* domain id */
           result->final_scores.eval,        /* evalue */
           dom_presc,                        /* seq scores before correction */
           dom_bias,                         /* seq bias */
@@ -85,50 +85,41 @@ void REPORT_myout_header(WORKER* worker,
 void REPORT_myout_entry(WORKER* worker,
                         RESULT* result,
                         FILE* fp) {
-  TIMES* times = worker->times;
-  HMM_PROFILE* t_prof = worker->t_prof;
-  SEQUENCE* q_seq = worker->q_seq;
+  TIMES* times = &result->times;
   ALIGNMENT* aln;
-  ALIGNMENT* aln_mm;
-  ALIGNMENT* aln_vit = worker->trace_vit;
-  ALIGNMENT* aln_fwd = worker->trace_post;
-  DOMAIN_DEF* dom_def = worker->dom_def;
+  ALIGNMENT* aln_vit = result->vit_trace;
+  ALIGNMENT* aln_fwd = result->post_trace;
   ALL_SCORES* scores = &result->scores;
   SCORES* final = &result->final_scores;
 
-  if (aln_fwd->is_hmmer_aln == true) {
+  /* alignment strings are only built when printed, so choose by which alignment was run */
+  if (worker->args->is_run_postaln == true) {
     aln = aln_fwd;
   }
-  elif (aln_vit->is_hmmer_aln == true) {
-    aln = aln_vit;
-  }
   else {
     aln = aln_vit;
   }
 
-  int aln_len = aln->end - aln->beg + 1;
-  TRACE aln_beg = VEC_X(aln->traces, aln->beg);
-  TRACE aln_end = VEC_X(aln->traces, aln->end);
+  /* alignment is empty if none was found */
+  TRACE aln_beg = (aln->beg >= 0 ? VEC_X(aln->traces, aln->beg) : (TRACE){0, 0, X_ST});
+  TRACE aln_end = (aln->end >= 0 ? VEC_X(aln->traces, aln->end) : (TRACE){0, 0, X_ST});
 
-  RANGE q_bounds, t_bounds;
+  RANGE q_bounds = result->query_bounds;
+  RANGE t_bounds = result->target_bounds;
 
   float time_noload = times->loop - times->load_query - times->load_target;
 
-  if (result->target_range.end - result->target_range.beg <= 0) {
-    EDGEBOUNDS_Find_BoundingBox(worker->edg_row, &q_bounds, &t_bounds);
-  }
-
   fprintf(fp, "%d\t%s\t%s\t%d\t%d\t%.2e\t%.3f\t%.3f\t%.3f\t%.3f\t%.2e\t%.2e\t%d\t%d\t%.5f\t%d-%d\t%d-%d\t%d-%d\t%d-%d\t%.5f\t%.5f\n",
-          worker->mmseqs_id,           /* id index in mmseqs list */
-          t_prof->name,                /* target name */
-          q_seq->name,                 /* query name */
-          worker->t_prof->N,           /* target length */
-          worker->q_seq->N,            /* query length */
+          result->result_id,           /* id index in mmseqs list */
+          result->target_name,         /* target name */
+          result->query_name,          /* query name */
+          result->target_len,          /* target length */
+          result->query_len,           /* query length */
           final->eval,                 /* evalue */
           final->pre_sc,               /* seq scores before bias correction (in bits) */
           final->null2_seq_bias_bitsc, /* seq bias (in bits) */
           final->seq_sc,               /* seq score after correction (in bits) */
-          dom_def->dom_sumsc,          /* sum of all domain scores; if domains were not computed, zero */
+          result->dom_sumsc,           /* sum of all domain scores; if domains were not computed, zero */
           final->viterbi_eval,         /* viterbi eval (in mmore, this comes from mmseqs) */
           final->viterbi_mmore_eval,   /* viterbi eval (in mmore, this comes from mmseqs) */
           result->total_cells,         /* total number of cells computed by full viterbi */
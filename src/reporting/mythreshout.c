@@ -56,8 +56,6 @@ void REPORT_mythreshout_header(WORKER* worker,
 void REPORT_mythreshout_entry(WORKER* worker,
                               RESULT* result,
                               FILE* fp) {
-  HMM_PROFILE* t_prof = worker->t_prof;
-  SEQUENCE* q_seq = worker->q_seq;
   ALL_SCORES* scores = &result->scores;
   SCORES* final = &result->final_scores;
 
@@ -72,8 +70,8 @@ void REPORT_mythreshout_entry(WORKER* worker,
   //    final->fwdback_eval );
 
   const GEN fields[] = {
-      GEN_Wrap(&t_prof->name, DATATYPE_STRING, sizeof(char*)),
-      GEN_Wrap(&q_seq->name, DATATYPE_STRING, sizeof(char*)),
+      GEN_Wrap(&result->target_name, DATATYPE_STRING, sizeof(char*)),
+      GEN_Wrap(&result->query_name, DATATYPE_STRING, sizeof(char*)),
       GEN_Wrap(&final->viterbi_eval, DATATYPE_FLOAT_EXP, sizeof(float)),
       GEN_Wrap(&result->is_passed_viterbi, DATATYPE_BOOL, sizeof(float)),
       GEN_Wrap(&final->cloud_eval, DATATYPE_FLOAT_EXP, sizeof(float)),
@@ -94,17 +94,14 @@ STATUS_FLAG
 REPORT_mytimeout_entry(WORKER* worker,
                        RESULT* result,
                        FILE* fp) {
-  HMM_PROFILE* t_prof = worker->t_prof;
-  SEQUENCE* q_seq = worker->q_seq;
-  TIMES* times = worker->times;
-  TIMES* time_totals = worker->times_totals;
+  TIMES* times = &result->times;
 
   const int num_fields = 23;
   const int sig_digits = 7;
 
   const GEN fields[] = {
-      GEN_Wrap(&t_prof->name, DATATYPE_STRING, sizeof(char*)),
-      GEN_Wrap(&q_seq->name, DATATYPE_STRING, sizeof(char*)),
+      GEN_Wrap(&result->target_name, DATATYPE_STRING, sizeof(char*)),
+      GEN_Wrap(&result->query_name, DATATYPE_STRING, sizeof(char*)),
       GEN_Wrap(&times->loop, DATATYPE_FLOAT, sizeof(float)),
       GEN_Wrap(&times->load_target, DATATYPE_FLOAT, sizeof(float)),
       GEN_Wrap(&times->load_query, DATATYPE_FLOAT, sizeof(float)),
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *  - FILE:  perfout.c
+ *  - DESC:  Reporting functions for generating perfout format output.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+
+/* header */
+#include "_reporting.h"
+#include "perfout.h"
+
+/* === PERFOUT FUNCTIONS === */
+
+/* === PERFOUT OUTPUT === */
+/* Custom-style output for per-stage performance counters, reported once at end of run.
+   Description: The summary is a tab-separated table with one row per stage and the following columns:
+   - (1) stage name
+   - (2) number of runs
+   - (3) total time (secs)
+   - (4) mean time (secs)
+   - (5-7) p50/p90/p99 time (secs, from histogram)
+   - (8) max time (secs)
+   - (9) total cells
+   - (10) mean GCUPS (total cells / total time)
+   - (11) p50 GCUPS (from histogram)
+   - (12) total bytes requested from allocator (each realloc counts its full new size, so buffers
+          which grow by doubling count about twice their final size)
+   Histograms follow, with one row per non-empty bin: stage, bin upper edge, run time count, throughput count.
+ */
+
+/*!  FUNCTION:    REPORT_perfout_totals()
+ *   SYNOPSIS:    Print summary table of per-stage performance counters:
+ *                run counts, total/mean/percentile times, cells, GCUPS and bytes requested.
+ */
+STATUS_FLAG
+REPORT_perfout_totals(WORKER* worker,
+                      FILE* fp) {
+  PERF_COUNTERS* perf = worker->perf;
+
+  if (perf == NULL) {
+    return STATUS_FAILURE;
+  }
+
+  fprintf(fp, "#%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n",
+          "stage", "runs", "time-total", "time-mean",
+          "time-p50", "time-p90", "time-p99", "time-max",
+          "cells", "gcups-mean", "gcups-p50", "bytes-req");
+
+  for (PERF_STAGE i = 0; i < NUM_PERF_STAGES; i++) {
+    PERF_STAGE_COUNTER* counter = &perf->stages[i];
+    double mean = (counter->count > 0) ? counter->time / counter->count : 0.0;
+    double gcups = (counter->time > 0) ? (counter->cells / counter->time) / 1e9 : 0.0;
+
+    fprintf(fp, "%s\t%ld\t%.6f\t%.6f\t%.6f\t%.6f\t%.6f\t%.6f\t%ld\t%.4f\t%.4f\t%ld\n",
+            PERF_COUNTERS_GetName(i),
+            counter->count,
+            counter->time,
+            mean,
+            PERF_COUNTERS_GetTime_Percentile(perf, i, 50.0),
+            PERF_COUNTERS_GetTime_Percentile(perf, i, 90.0),
+            PERF_COUNTERS_GetTime_Percentile(perf, i, 99.0),
+            counter->time_max,
+            counter->cells,
+            gcups,
+            PERF_COUNTERS_GetRate_Percentile(perf, i, 50.0),
+            counter->bytes);
+  }
+
+  return STATUS_SUCCESS;
+}
+
+/*!  FUNCTION:    REPORT_perfout_histograms()
+ *   SYNOPSIS:    Print per-stage histograms of run times and throughput.
+ */
+STATUS_FLAG
+REPORT_perfout_histograms(WORKER* worker,
+                          FILE* fp) {
+  PERF_COUNTERS* perf = worker->perf;
+
+  if (perf == NULL) {
+    return STATUS_FAILURE;
+  }
+
+  fprintf(fp, "#%s\t%s\t%s\t%s\n",
+          "stage", "bin-upper", "time-usecs-count", "cells-per-usec-count");
+
+  for (PERF_STAGE i = 0; i < NUM_PERF_STAGES; i++) {
+    PERF_STAGE_COUNTER* counter = &perf->stages[i];
+    for (int j = 0; j < NUM_PERF_BINS; j++) {
+      if (counter->time_hist[j] == 0 && counter->rate_hist[j] == 0) {
+        continue;
+      }
+      fprintf(fp, "%s\t%.4g\t%ld\t%ld\n",
+              PERF_COUNTERS_GetName(i),
+              PERF_COUNTERS_GetBinValue(j),
+              counter->time_hist[j],
+              counter->rate_hist[j]);
+    }
+  }
+
+  return STATUS_SUCCESS;
+}
+
+/*!  FUNCTION:    REPORT_perfout_footer()
+ *   SYNOPSIS:    Print footer.  Gives [ok] to verify file program executed succesfully. And file format type.
+ */
+STATUS_FLAG
+REPORT_perfout_footer(WORKER* worker,
+                      FILE* fp) {
+  fprintf(fp, "# [ok] [perfout]\n");
+
+  return STATUS_SUCCESS;
+}
@@ -0,0 +1,30 @@
+/*******************************************************************************
+ *  - FILE:  perfout.h
+ *  - DESC:  Reporting Subroutines for generating perfout.
+ *******************************************************************************/
+
+#ifndef _PERFOUT_H
+#define _PERFOUT_H
+
+/* === PERFOUT FUNCTIONS === */
+
+/*!  FUNCTION:    REPORT_perfout_totals()
+ *   SYNOPSIS:    Print summary table of per-stage performance counters:
+ *                run counts, total/mean/percentile times, cells, GCUPS and bytes allocated.
+ */
+STATUS_FLAG
+REPORT_perfout_totals(WORKER* worker, FILE* fp);
+
+/*!  FUNCTION:    REPORT_perfout_histograms()
+ *   SYNOPSIS:    Print per-stage histograms of run times and throughput.
+ */
+STATUS_FLAG
+REPORT_perfout_histograms(WORKER* worker, FILE* fp);
+
+/*!  FUNCTION:    REPORT_perfout_footer()
+ *   SYNOPSIS:    Print footer.
+ */
+STATUS_FLAG
+REPORT_perfout_footer(WORKER* worker, FILE* fp);
+
+#endif /* _PERFOUT_H */
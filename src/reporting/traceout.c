@@ -0,0 +1,133 @@
+/*******************************************************************************
+ *  - FILE:  traceout.c
+ *  - DESC:  Reporting functions for generating traceout (JSONL) format output.
+ *******************************************************************************/
+
+/* imports */
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+#include <sys/resource.h>
+
+/* local imports */
+#include "../objects/structs.h"
+#include "../utilities/_utilities.h"
+#include "../objects/_objects.h"
+
+/* header */
+#include "_reporting.h"
+#include "traceout.h"
+
+/* private functions */
+static char*
+REPORT_traceout_escape(const char* src, char* dest, int dest_size);
+
+/* === TRACEOUT OUTPUT === */
+/* Per-search trace for offline performance analysis.
+   Description: One JSON object per line (JSONL), one line per search, with the following fields:
+   - id:          search id (position in mmseqs m8 list)
+   - q_id/t_id:   query/target index ids (-1 if search was filtered before loading)
+   - q_name/t_name: query/target names
+   - Q/T:         query/target lengths (zero if search was filtered before loading)
+   - search_cells: number of cells in forward and backward cloud searches
+   - cloud_cells: number of cells in merged cloud search space (zero if search failed cloud filter)
+   - total_cells: number of cells in full dp matrix
+   - passed:      filter outcomes [viterbi, cloud, bound-fwd, report]
+   - n_domains:   number of domains found
+   - times:       per-stage runtimes (in secs)
+   - mem_hwm_kb:  process memory high-water mark (max resident set size, in kB)
+ */
+
+/*!  FUNCTION:    REPORT_traceout_entry()
+ *   SYNOPSIS:    Write one JSONL trace record for current search to <writer>.
+ *                Called for every search, whether or not it passed the filters.
+ */
+STATUS_FLAG
+REPORT_traceout_entry(WORKER* worker,
+                      RESULT* result,
+                      ASYNC_WRITER* writer) {
+  M8_RESULT* m8 = worker->mmseqs_cur;
+  TIMES* times = worker->times;
+  bool is_loaded = worker->vit_passed;
+  int Q = (is_loaded ? worker->q_seq->N : 0);
+  int T = (is_loaded ? worker->t_prof->N : 0);
+  int q_id = (is_loaded ? worker->q_id : -1);
+  int t_id = (is_loaded ? worker->t_id : -1);
+  int search_cells = 0;
+  size_t total_cells = (size_t)(Q + 1) * (T + 1);
+  int n_domains = 0;
+  struct rusage usage;
+  char q_name[256];
+  char t_name[256];
+  /* hitlist entries have no names, so take them from loaded query/target */
+  STR q_name_in = (m8->query_name == NULL && is_loaded ? worker->q_seq->name : m8->query_name);
+  STR t_name_in = (m8->target_name == NULL && is_loaded ? worker->t_prof->name : m8->target_name);
+
+  if (is_loaded) {
+    search_cells = EDGEBOUNDS_Count(worker->edg_fwd) + EDGEBOUNDS_Count(worker->edg_bck);
+  }
+  if (worker->fwd_passed && worker->args->is_run_domains) {
+    n_domains = worker->dom_def->dom_ranges->N;
+  }
+  getrusage(RUSAGE_SELF, &usage);
+
+  ASYNC_WRITER_Printf(writer,
+                      "{\"id\":%d,\"q_id\":%d,\"t_id\":%d,\"q_name\":\"%s\",\"t_name\":\"%s\","
+                      "\"Q\":%d,\"T\":%d,\"search_cells\":%d,\"cloud_cells\":%d,\"total_cells\":%ld,"
+                      "\"passed\":[%d,%d,%d,%d],\"n_domains\":%d,"
+                      "\"times\":{\"total\":%.6g,\"load_target\":%.6g,\"load_query\":%.6g,"
+                      "\"cloud_fwd\":%.6g,\"cloud_bck\":%.6g,\"merge\":%.6g,\"reorient\":%.6g,"
+                      "\"bound_fwd\":%.6g,\"bound_bck\":%.6g,\"posterior\":%.6g,\"decodedom\":%.6g,"
+                      "\"biascorr\":%.6g,\"dom_total\":%.6g},"
+                      "\"mem_hwm_kb\":%ld}\n",
+                      worker->mmseqs_id, q_id, t_id,
+                      REPORT_traceout_escape(q_name_in, q_name, sizeof(q_name)),
+                      REPORT_traceout_escape(t_name_in, t_name, sizeof(t_name)),
+                      Q, T, search_cells, result->cloud_cells, total_cells,
+                      worker->vit_passed, worker->cld_passed,
+                      worker->fwd_passed, worker->post_passed,
+                      n_domains,
+                      times->loop, times->load_target, times->load_query,
+                      times->lin_cloud_fwd, times->lin_cloud_bck, times->lin_merge, times->lin_reorient,
+                      times->lin_bound_fwd, times->lin_bound_bck, times->sp_posterior, times->sp_decodedom,
+                      times->sp_biascorr, times->dom_total,
+                      usage.ru_maxrss);
+
+  return STATUS_SUCCESS;
+}
+
+/*!  FUNCTION:    REPORT_traceout_escape()
+ *   SYNOPSIS:    Copy <src> into <dest>, escaping characters not allowed in a JSON string.
+ *                Truncates to fit <dest_size>.
+ *   RETURN:      Pointer to <dest>.
+ */
+static char*
+REPORT_traceout_escape(const char* src,
+                       char* dest,
+                       int dest_size) {
+  int j = 0;
+
+  if (src == NULL) {
+    dest[0] = '\0';
+    return dest;
+  }
+  for (int i = 0; src[i] != '\0' && j < dest_size - 2; i++) {
+    if (src[i] == '"' || src[i] == '\\') {
+      dest[j++] = '\\';
+      dest[j++] = src[i];
+    }
+    elif (iscntrl((unsigned char)src[i])) {
+      dest[j++] = ' ';
+    }
+    else {
+      dest[j++] = src[i];
+    }
+  }
+  dest[j] = '\0';
+  return dest;
+}
@@ -0,0 +1,18 @@
+/*******************************************************************************
+ *  - FILE:  traceout.h
+ *  - DESC:  Reporting Subroutines for generating traceout.
+ *******************************************************************************/
+
+#ifndef _TRACEOUT_H
+#define _TRACEOUT_H
+
+/* === TRACEOUT FUNCTIONS === */
+
+/*!  FUNCTION:    REPORT_traceout_entry()
+ *   SYNOPSIS:    Write one JSONL trace record for current search to <writer>.
+ *                Called for every search, whether or not it passed the filters.
+ */
+STATUS_FLAG
+REPORT_traceout_entry(WORKER* worker, RESULT* result, ASYNC_WRITER* writer);
+
+#endif /* _TRACEOUT_H */
@@ -28,6 +28,10 @@
 #include "_utilities.h"
 #include "error_handler.h"
 
+/* cumulative bytes requested by allocations in the current thread (for PERF_COUNTERS).
+ * realloc counts its full new size, not just the growth. */
+static _Thread_local size_t alloc_bytes = 0;
+
 /*!  FUNCTION:  ERRORCHECK_handler()
  *   SYNOPSIS:  Handles errors.
  */
@@ -121,6 +125,7 @@ ERRORCHECK_alloc(void* ptr,
     printf("ERROR_SIZE: %ld\n", size);
     ERRORCHECK_handler(ERROR_MALLOC, _file_, _line_, _func_, NULL);
   }
+  alloc_bytes += size;
   return ptr;
 }
 
@@ -140,6 +145,7 @@ ERRORCHECK_malloc(const size_t size,
     printf("ERROR_SIZE: %ld\n", size);
     ERRORCHECK_handler(ERROR_MALLOC, _file_, _line_, _func_, NULL);
   }
+  alloc_bytes += size;
   return ptr;
 }
 
@@ -159,9 +165,18 @@ ERRORCHECK_realloc(void* ptr,
     printf("ERROR_SIZE: %ld\n", size);
     ERRORCHECK_handler(ERROR_REALLOC, _file_, _line_, _func_, NULL);
   }
+  alloc_bytes += size;
   return ptr;
 }
 
+/*!  FUNCTION:  ERRORCHECK_alloc_bytes()
+ *   SYNOPSIS:  Get cumulative number of bytes requested by allocations in the calling thread.
+ */
+size_t
+ERRORCHECK_alloc_bytes() {
+  return alloc_bytes;
+}
+
 /*!  FUNCTION:  ERRORCHECK_free()
  *   SYNOPSIS:  Frees memory <ptr> and handles potential errors.
  *              Returns NULL pointer.
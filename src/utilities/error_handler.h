@@ -88,6 +88,13 @@ void* ERRORCHECK_free(void* ptr,
                       const int _line_,
                       const char* _func_);
 
+/*! FUNCTION:  ERRORCHECK_alloc_bytes()
+ *  SYNOPSIS:  Get cumulative number of bytes requested through ERRORCHECK_alloc/malloc/realloc()
+ *             by the calling thread. Each realloc counts its full new size, not just the growth.
+ *             Counter is thread-local, so no locking is required.
+ */
+size_t ERRORCHECK_alloc_bytes();
+
 /*! FUNCTION:  ERRORCHECK_boundscheck()
  *  SYNOPSIS:
  */
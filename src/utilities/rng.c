@@ -27,6 +27,13 @@ void RNG_Init() {
   srand(time(NULL));
 }
 
+/*! FUNCTION:  RNG_Init_Seed()
+ *  SYNOPSIS:  Initializes random number generator with fixed <seed>, for reproducible runs.
+ */
+void RNG_Init_Seed(unsigned int seed) {
+  srand(seed);
+}
+
 /*! FUNCTION:  RNG_Generate()
  *  SYNOPSIS:  Generate random number.
  */
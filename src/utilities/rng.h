@@ -11,6 +11,11 @@
  */
 void RNG_Init();
 
+/*! FUNCTION:  RNG_Init_Seed()
+ *  SYNOPSIS:  Initializes random number generator with fixed <seed>, for reproducible runs.
+ */
+void RNG_Init_Seed(unsigned int seed);
+
 /*! FUNCTION:  RNG_Generate()
  *  SYNOPSIS:  Generate random number.
  */
@@ -36,4 +41,14 @@ INT RNG_INT();
  */
 INT RNG_INT_Range(INT beg, INT end);
 
+/*! FUNCTION:  RNG_FLT()
+ *  SYNOPSIS:  Generate random float.
+ */
+FLT RNG_FLT();
+
+/*! FUNCTION:  RNG_FLT_Range()
+ *  SYNOPSIS:  Generate random float in range [beg, end]
+ */
+FLT RNG_FLT_Range(FLT beg, FLT end);
+
 #endif /* _RNG_H */
@@ -76,10 +76,12 @@ void WORK_bound_fwdback_linear(WORKER* worker) {
   /* linear bounded forward */
   if (tasks->lin_bound_fwd) {
     printf_vall("# ==> bound forward (linear)...\n");
+    PERF_COUNTERS_Begin(worker->perf, PERF_BOUND_FWD_LIN);
     CLOCK_Start(worker->timer);
     run_Bound_Forward_Linear(q_seq, t_prof, Q, T, st_MX3_fwd, sp_MX_fwd, edg_row, &sc);
     CLOCK_Stop(worker->timer);
     times->lin_bound_fwd = CLOCK_Duration(worker->timer);
+    PERF_COUNTERS_End(worker->perf, PERF_BOUND_FWD_LIN, times->lin_bound_fwd, result->cloud_cells);
     scores->lin_bound_fwd = sc;
 
 #if DEBUG
@@ -94,10 +96,12 @@ void WORK_bound_fwdback_linear(WORKER* worker) {
   /* linear bounded backward */
   if (tasks->lin_bound_bck) {
     printf_vall("# ==> bound backward (linear)...\n");
+    PERF_COUNTERS_Begin(worker->perf, PERF_BOUND_BCK_LIN);
     CLOCK_Start(worker->timer);
     run_Bound_Backward_Linear(q_seq, t_prof, Q, T, st_MX3, sp_MX_bck, edg_row, &sc);
     CLOCK_Stop(worker->timer);
     times->lin_bound_bck = CLOCK_Duration(worker->timer);
+    PERF_COUNTERS_End(worker->perf, PERF_BOUND_BCK_LIN, times->lin_bound_bck, result->cloud_cells);
     scores->lin_bound_bck = sc;
 
 #if DEBUG
@@ -197,17 +201,20 @@ void WORK_bound_fwdback_sparse(WORKER* worker) {
   RESULT* result = worker->result;
   ALL_SCORES* scores = &result->scores;
   SCORES* finalsc = &result->final_scores;
+  DOMAIN_DEF* dom_def = worker->dom_def;
   float sc;
 
   /* sparse bounded forward */
   if (tasks->sparse_bound_fwd) {
     printf_vall("# ==> bound forward (sparse)...\n");
+    PERF_COUNTERS_Begin(worker->perf, PERF_BOUND_FWD_SP);
     CLOCK_Start(timer);
     run_Bound_Forward_Sparse(
         q_seq, t_prof, Q, T, st_SMX_fwd, sp_MX_fwd, edg_row, NULL, &sc);
     scores->sparse_bound_fwd = sc;
     CLOCK_Stop(timer);
     times->sp_bound_fwd = CLOCK_Duration(timer);
+    PERF_COUNTERS_End(worker->perf, PERF_BOUND_FWD_SP, times->sp_bound_fwd, result->cloud_cells);
     scores->sparse_bound_fwd = sc;
 #if DEBUG
     {
@@ -222,11 +229,13 @@ void WORK_bound_fwdback_sparse(WORKER* worker) {
   /* sparse bounded backward */
   if (tasks->sparse_bound_bck) {
     printf_vall("# ==> bound backward (sparse)...\n");
+    PERF_COUNTERS_Begin(worker->perf, PERF_BOUND_BCK_SP);
     CLOCK_Start(timer);
     run_Bound_Backward_Sparse(
-        q_seq, t_prof, Q, T, st_SMX_bck, sp_MX_bck, edg_row, NULL, &sc);
+        q_seq, t_prof, Q, T, st_SMX_bck, sp_MX_bck, edg_row, NULL, &sc, sp_MX_fwd, dom_def);
     CLOCK_Stop(timer);
     times->sp_bound_bck = CLOCK_Duration(timer);
+    PERF_COUNTERS_End(worker->perf, PERF_BOUND_BCK_SP, times->sp_bound_bck, result->cloud_cells);
     scores->sparse_bound_bck = sc;
 #if DEBUG
     {
@@ -49,12 +49,8 @@ void WORK_cloud_merge_and_reorient(WORKER* worker) {
   EDGEBOUNDS* edg_bck = worker->edg_bck;
   EDGEBOUNDS* edg_diag = worker->edg_diag;
   EDGEBOUNDS* edg_row = worker->edg_row;
-  EDGEBOUND_ROWS* edg_builder = worker->edg_rows_tmp;
   /* output data */
   TIMES* times = worker->times;
-  RESULT* result = worker->result;
-  ALL_SCORES* scores = &result->scores;
-  SCORES* final = &result->final_scores;
 
   /* if performing linear fb-pruner, run cloud search  */
   if (tasks->lin_cloud_fwd || tasks->lin_cloud_bck) {
@@ -76,6 +72,88 @@ void WORK_cloud_merge_and_reorient(WORKER* worker) {
     }
 #endif
 
+    /* reorient edgebounds */
+    WORK_cloud_reorient(worker);
+  }
+}
+
+/*! FUNCTION:  	WORK_cloud_merge_anchor()
+ *  SYNOPSIS:  	Merge forward and backward clouds of anchor alignment <anchor_id> into its own cloud in <edg_anchors>.
+ *                Caller must have run WORK_cloud_search_linear() for anchor, and WORK_cloud_merge_anchors()
+ *                once all anchors of the same target/query pair are merged.
+ */
+void WORK_cloud_merge_anchor(WORKER* worker,
+                             int anchor_id) {
+  ARGS* args = worker->args;
+  TASKS* tasks = worker->tasks;
+  /* input data */
+  int Q = worker->q_seq->N;
+  int T = worker->t_prof->N;
+  /* working data */
+  EDGEBOUNDS* edg_fwd = worker->edg_fwd;
+  EDGEBOUNDS* edg_bck = worker->edg_bck;
+  VECTOR_PTR* edg_anchors = worker->edg_anchors;
+  /* output data */
+  TIMES* times = worker->times;
+
+  if (tasks->lin_cloud_fwd || tasks->lin_cloud_bck) {
+    printf_vall("# ==> merge (anchor)...\n");
+    CLOCK_Start(worker->timer);
+    while (VECTOR_PTR_GetSize(edg_anchors) <= anchor_id) {
+      VECTOR_PTR_Pushback(edg_anchors, EDGEBOUNDS_Create());
+    }
+    EDGEBOUNDS_Union(Q, T, edg_fwd, edg_bck, VEC_X(edg_anchors, anchor_id));
+    CLOCK_Stop(worker->timer);
+    times->lin_merge += CLOCK_Duration(worker->timer);
+  }
+}
+
+/*! FUNCTION:  	WORK_cloud_merge_anchors()
+ *  SYNOPSIS:  	Union the clouds of the first <N> anchors in <edg_anchors> into <edg_diag>, in a single sweep.
+ *                Caller must have run WORK_cloud_merge_anchor() for each anchor.
+ */
+void WORK_cloud_merge_anchors(WORKER* worker,
+                              int N) {
+  ARGS* args = worker->args;
+  TASKS* tasks = worker->tasks;
+  /* input data */
+  int Q = worker->q_seq->N;
+  int T = worker->t_prof->N;
+  /* working data */
+  EDGEBOUNDS** edg_in = (EDGEBOUNDS**)VECTOR_PTR_GetArray(worker->edg_anchors);
+  EDGEBOUNDS* edg_diag = worker->edg_diag;
+  /* output data */
+  TIMES* times = worker->times;
+
+  if (tasks->lin_cloud_fwd || tasks->lin_cloud_bck) {
+    printf_vall("# ==> merge (all anchors)...\n");
+    CLOCK_Start(worker->timer);
+    EDGEBOUNDS_Union_Multi(Q, T, edg_in, N, edg_diag);
+    CLOCK_Stop(worker->timer);
+    times->lin_merge += CLOCK_Duration(worker->timer);
+  }
+}
+
+/*! FUNCTION:  	WORK_cloud_reorient()
+ *  SYNOPSIS:  	Reorient merged cloud <edg_diag> from antidiagonal-wise to row-wise <edg_row>.
+ *                Caller must have run WORK_cloud_merge_and_reorient() or WORK_cloud_merge_anchors().
+ */
+void WORK_cloud_reorient(WORKER* worker) {
+  ARGS* args = worker->args;
+  TASKS* tasks = worker->tasks;
+  CLOCK* timer = worker->timer;
+  /* input data */
+  int Q = worker->q_seq->N;
+  int T = worker->t_prof->N;
+  /* working data */
+  EDGEBOUNDS* edg_diag = worker->edg_diag;
+  EDGEBOUNDS* edg_row = worker->edg_row;
+  EDGEBOUND_ROWS* edg_builder = worker->edg_rows_tmp;
+  /* output data */
+  TIMES* times = worker->times;
+  RESULT* result = worker->result;
+
+  if (tasks->lin_cloud_fwd || tasks->lin_cloud_bck) {
     /* reorient edgebounds */
     printf_vall("# ==> reorient...\n");
     CLOCK_Start(timer);
@@ -102,3 +180,116 @@ void WORK_cloud_merge_and_reorient(WORKER* worker) {
 #endif
   }
 }
+
+/*! FUNCTION:  	WORK_cloud_cache_load()
+ *  SYNOPSIS:  	Load cloud of current mmseqs entry from cloud cache <cloudin_file> into <edg_row>, along with
+ *                its cloud search scores, in place of running cloud search, merge and reorient.
+ *                Returns false if cloud cache is not in use or has no cloud for current entry.
+ *                Caller must have run WORK_load_mmseqs_alignment().
+ */
+bool WORK_cloud_cache_load(WORKER* worker) {
+  ARGS* args = worker->args;
+  FILER* cloudin_file = worker->cloudin_file;
+  CLOUD_CACHE* cache = worker->cloudin_cache;
+  /* input data */
+  int Q = worker->q_seq->N;
+  int T = worker->t_prof->N;
+  int result_id = worker->mmseqs_cur->result_id;
+  ALIGNMENT* tr = worker->trace_vit;
+  /* working data */
+  EDGEBOUNDS* edg_row = worker->edg_row;
+  /* output data */
+  TIMES* times = worker->times;
+  RESULT* result = worker->result;
+  ALL_SCORES* scores = &result->scores;
+  SCORES* finalsc = &result->final_scores;
+  TRACE* aln_beg;
+  TRACE* aln_end;
+
+  if (cloudin_file == NULL) {
+    return false;
+  }
+
+  /* records are in order of result id, so read ahead until reaching current entry */
+  while (cloudin_file->is_eof == false && cache->result_id < result_id) {
+    if (CLOUD_CACHE_Read(cache, cloudin_file->fp) == false) {
+      cloudin_file->is_eof = true;
+    }
+  }
+  if (cache->result_id != result_id) {
+    return false;
+  }
+  if (cache->Q != Q || cache->T != T) {
+    fprintf(stderr, "ERROR: cloud cache '%s' does not match inputs (result %d has Q,T = %d,%d, not %d,%d).\n",
+            args->cloudin_filein, result_id, cache->Q, cache->T, Q, T);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+
+  printf_vall("# ==> cloud cache...\n");
+  CLOCK_Start(worker->timer);
+  if (CLOUD_CACHE_Decode(cache, edg_row) == false) {
+    fprintf(stderr, "ERROR: cloud cache '%s' has corrupt cloud for result %d.\n",
+            args->cloudin_filein, result_id);
+    ERRORCHECK_exit(EXIT_FAILURE);
+  }
+  CLOCK_Stop(worker->timer);
+  /* loading stands in for reorient */
+  times->lin_reorient = CLOCK_Duration(worker->timer);
+
+  scores->lin_cloud_fwd = cache->lin_cloud_fwd;
+  scores->lin_cloud_bck = cache->lin_cloud_bck;
+  scores->threshold_cloud_max = cache->threshold_cloud_max;
+  scores->threshold_cloud_compo = cache->threshold_cloud_compo;
+  finalsc->cloud_natsc = cache->cloud_natsc;
+  result->is_cloud_i16 = cache->is_i16;
+  /* cloud search clips endpoints of seed alignment to matrix, which are reported */
+  aln_beg = &VEC_X(tr->traces, tr->beg);
+  aln_end = &VEC_X(tr->traces, tr->end);
+  aln_beg->q_0 = cache->q_beg;
+  aln_beg->t_0 = cache->t_beg;
+  aln_end->q_0 = cache->q_end;
+  aln_end->t_0 = cache->t_end;
+
+  /* compute the number of cells in matrix computed */
+  result->cloud_cells = EDGEBOUNDS_Count(edg_row);
+  result->total_cells = (Q + 1) * (T + 1);
+  result->perc_cells = (float)result->cloud_cells / (float)result->total_cells;
+
+  return true;
+}
+
+/*! FUNCTION:  	WORK_cloud_cache_save()
+ *  SYNOPSIS:  	Write cloud <edg_row> of current mmseqs entry, along with its cloud search scores,
+ *                to cloud cache <cloudout_file>, if in use.
+ *                Caller must have run WORK_cloud_reorient() or WORK_cloud_cache_load().
+ */
+void WORK_cloud_cache_save(WORKER* worker) {
+  ARGS* args = worker->args;
+  CLOUD_CACHE* cache = worker->cloudout_cache;
+  /* input data */
+  ALIGNMENT* tr = worker->trace_vit;
+  /* working data */
+  EDGEBOUNDS* edg_row = worker->edg_row;
+  /* output data */
+  RESULT* result = worker->result;
+  ALL_SCORES* scores = &result->scores;
+  SCORES* finalsc = &result->final_scores;
+
+  if (args->is_cloudout == false) {
+    return;
+  }
+
+  cache->result_id = worker->mmseqs_cur->result_id;
+  cache->q_beg = VEC_X(tr->traces, tr->beg).q_0;
+  cache->t_beg = VEC_X(tr->traces, tr->beg).t_0;
+  cache->q_end = VEC_X(tr->traces, tr->end).q_0;
+  cache->t_end = VEC_X(tr->traces, tr->end).t_0;
+  cache->lin_cloud_fwd = scores->lin_cloud_fwd;
+  cache->lin_cloud_bck = scores->lin_cloud_bck;
+  cache->threshold_cloud_max = scores->threshold_cloud_max;
+  cache->threshold_cloud_compo = scores->threshold_cloud_compo;
+  cache->cloud_natsc = finalsc->cloud_natsc;
+  cache->is_i16 = result->is_cloud_i16;
+  CLOUD_CACHE_Encode(cache, edg_row);
+  CLOUD_CACHE_Write(cache, worker->cloudout_file->fp);
+}
@@ -16,4 +16,41 @@
  */
 void WORK_cloud_merge_and_reorient(WORKER* worker);
 
+/*! FUNCTION:  	WORK_cloud_merge_anchor()
+ *  SYNOPSIS:  	Merge forward and backward clouds of anchor alignment <anchor_id>
+ * into its own cloud in <edg_anchors>. Caller must have run
+ * WORK_cloud_search_linear() for anchor, and WORK_cloud_merge_anchors() once
+ * all anchors of the same target/query pair are merged.
+ */
+void WORK_cloud_merge_anchor(WORKER* worker, int anchor_id);
+
+/*! FUNCTION:  	WORK_cloud_merge_anchors()
+ *  SYNOPSIS:  	Union the clouds of the first <N> anchors in <edg_anchors> into
+ * <edg_diag>, in a single sweep. Caller must have run WORK_cloud_merge_anchor()
+ * for each anchor.
+ */
+void WORK_cloud_merge_anchors(WORKER* worker, int N);
+
+/*! FUNCTION:  	WORK_cloud_reorient()
+ *  SYNOPSIS:  	Reorient merged cloud <edg_diag> from antidiagonal-wise to
+ * row-wise <edg_row>. Caller must have run WORK_cloud_merge_and_reorient() or
+ * WORK_cloud_merge_anchors().
+ */
+void WORK_cloud_reorient(WORKER* worker);
+
+/*! FUNCTION:  	WORK_cloud_cache_load()
+ *  SYNOPSIS:  	Load cloud of current mmseqs entry from cloud cache <cloudin_file> into <edg_row>, along with
+ *                its cloud search scores, in place of running cloud search, merge and reorient.
+ *                Returns false if cloud cache is not in use or has no cloud for current entry.
+ *                Caller must have run WORK_load_mmseqs_alignment().
+ */
+bool WORK_cloud_cache_load(WORKER* worker);
+
+/*! FUNCTION:  	WORK_cloud_cache_save()
+ *  SYNOPSIS:  	Write cloud <edg_row> of current mmseqs entry, along with its cloud search scores,
+ *                to cloud cache <cloudout_file>, if in use.
+ *                Caller must have run WORK_cloud_reorient() or WORK_cloud_cache_load().
+ */
+void WORK_cloud_cache_save(WORKER* worker);
+
 #endif /* _WORK_CLOUD_MERGE */
@@ -62,6 +62,8 @@ void WORK_cloud_search_linear(WORKER* worker) {
   EDGEBOUND_ROWS* edg_rows_tmp = worker->edg_rows_tmp;
   EDGEBOUNDS* edg_fwd = worker->edg_fwd;
   EDGEBOUNDS* edg_bck = worker->edg_bck;
+  EDGEBOUNDS* edg_diag = worker->edg_diag;
+  MATRIX_I16* i16_MX = worker->i16_MX;
   /* output data */
   TIMES* times = worker->times;
   RESULT* result = worker->result;
@@ -71,16 +73,31 @@ void WORK_cloud_search_linear(WORKER* worker) {
   float inner_fwdsc, inner_bcksc, outer_fwdsc, outer_bcksc;
   float max_fwdsc, max_bcksc, inner_maxsc, outer_maxsc;
   float max_sc, sum_sc, compo_sc1, compo_sc2;
+  bool is_saturated;
 
   /* if running linear cloud search  */
   if (tasks->lin_cloud_fwd || tasks->lin_cloud_bck) {
     /* cloud forward */
     // printf_vall("# ==> cloud forward (linear)...\n");
+    PERF_COUNTERS_Begin(worker->perf, PERF_CLOUD);
     CLOCK_Start(worker->timer);
+    /* reduced-precision prefilter: float search is then pruned to int16 cloud (unless int16 range saturates) */
+    result->is_cloud_i16 = false;
+    is_saturated = true;
+    if (cloud_params->is_i16 == true) {
+      run_Cloud_Forward_Linear_I16(
+          q_seq, t_prof, Q, T, i16_MX, tr, edg_rows_tmp, edg_diag, cloud_params, &inner_fwdsc, &max_fwdsc, &is_saturated);
+    }
+    if (is_saturated == false) {
+      cloud_params->edg_lim = edg_diag;
+      result->is_cloud_i16 = true;
+    }
     run_Cloud_Forward_Linear(
         q_seq, t_prof, Q, T, st_MX3, sp_MX, tr, edg_rows_tmp, edg_fwd, cloud_params, &inner_fwdsc, &max_fwdsc);
+    cloud_params->edg_lim = NULL;
     CLOCK_Stop(worker->timer);
     times->lin_cloud_fwd = CLOCK_Duration(worker->timer);
+    PERF_COUNTERS_End(worker->perf, PERF_CLOUD, times->lin_cloud_fwd, EDGEBOUNDS_Count(edg_fwd));
     scores->lin_cloud_fwd = max_fwdsc;
 #if DEBUG
     {
@@ -92,11 +109,23 @@ void WORK_cloud_search_linear(WORKER* worker) {
 
     /* cloud backward */
     // printf_vall("# ==> cloud backward (linear)...\n");
+    PERF_COUNTERS_Begin(worker->perf, PERF_CLOUD);
     CLOCK_Start(worker->timer);
+    is_saturated = true;
+    if (cloud_params->is_i16 == true) {
+      run_Cloud_Backward_Linear_I16(
+          q_seq, t_prof, Q, T, i16_MX, tr, edg_rows_tmp, edg_diag, cloud_params, &inner_bcksc, &max_bcksc, &is_saturated);
+    }
+    if (is_saturated == false) {
+      cloud_params->edg_lim = edg_diag;
+      result->is_cloud_i16 = true;
+    }
     run_Cloud_Backward_Linear(
         q_seq, t_prof, Q, T, st_MX3, sp_MX, tr, edg_rows_tmp, edg_bck, cloud_params, &inner_bcksc, &max_bcksc);
+    cloud_params->edg_lim = NULL;
     CLOCK_Stop(worker->timer);
     times->lin_cloud_bck = CLOCK_Duration(worker->timer);
+    PERF_COUNTERS_End(worker->perf, PERF_CLOUD, times->lin_cloud_bck, EDGEBOUNDS_Count(edg_bck));
     scores->lin_cloud_bck = max_bcksc;
 #if DEBUG
     {
@@ -140,6 +169,136 @@ void WORK_cloud_search_linear(WORKER* worker) {
   }
 }
 
+/*! FUNCTION:  	WORK_cloud_adapt_params()
+ *  SYNOPSIS:  	Scale x-drops (alpha, beta) of <cloud_params> to current mmseqs entry, by <cloud_policy>.
+ *                Does nothing unless policy is adaptive.
+ *                Caller must have loaded target and query.
+ */
+void WORK_cloud_adapt_params(WORKER* worker) {
+  ARGS* args = worker->args;
+  CLOUD_POLICY* policy = &(worker->cloud_policy);
+  CLOUD_PARAMS* cloud_params = &(worker->cloud_params);
+  float margin, cover, scale;
+
+  if (policy->is_adaptive == false) {
+    return;
+  }
+
+  WORK_cloud_policy_features(worker, &margin, &cover);
+  scale = WORK_cloud_policy_scale(policy, margin, cover);
+  cloud_params->alpha = args->alpha * scale;
+  cloud_params->beta = args->beta * scale;
+  printf_vall("# cloud policy: margin = %.2f bits, cover = %.3f => x-drop scale = %.3f\n", margin, cover, scale);
+}
+
+/*! FUNCTION:  	WORK_cloud_policy_features()
+ *  SYNOPSIS:  	Get features of current mmseqs entry which are known before cloud search:
+ *                <margin> of its e-value under reporting threshold (in bits), and <cover> of
+ *                the shorter of query and target by its alignment (from 0 to 1).
+ *                Entries without a score (from hitlist) have no <margin>.
+ *                Caller must have loaded target and query.
+ */
+void WORK_cloud_policy_features(WORKER* worker,
+                                float* margin,
+                                float* cover) {
+  ARGS* args = worker->args;
+  M8_RESULT* mm_m8 = worker->mmseqs_cur;
+  int Q = worker->q_seq->N;
+  int T = worker->t_prof->N;
+  int span;
+
+  /* e-value scales with 2^(-bitscore), so its ratio to threshold is the margin in bits */
+  if (mm_m8->eval > 0.0f) {
+    *margin = log2f(args->threshold_report_eval / mm_m8->eval);
+  }
+  /* e-value of strong hit underflowed */
+  elif (mm_m8->bitsc > 0.0f) {
+    *margin = INF;
+  }
+  /* hitlist entries without score: no margin, so use widest x-drops */
+  else {
+    *margin = 0.0f;
+  }
+  /* hitlist entries without alignment window span full target and query */
+  if (mm_m8->t_beg < 0 || mm_m8->q_beg < 0) {
+    *cover = 1.0f;
+  } else {
+    span = MAX(mm_m8->q_end - mm_m8->q_beg, mm_m8->t_end - mm_m8->t_beg) + 1;
+    *cover = MIN(1.0f, (float)span / (float)MAX(1, MIN(Q, T)));
+  }
+}
+
+/*! FUNCTION:  	WORK_cloud_policy_scale()
+ *  SYNOPSIS:  	Get x-drop scale of <policy> for hit with <margin> and <cover> (see WORK_cloud_policy_features()).
+ *                Scale goes from <scale_max> at reporting threshold to <scale_min> at <policy->margin> bits
+ *                above it, then is widened for alignments which cover little of the query or target.
+ */
+float WORK_cloud_policy_scale(const CLOUD_POLICY* policy,
+                              float margin,
+                              float cover) {
+  float w, scale;
+
+  if (policy->margin > 0.0f) {
+    w = margin / policy->margin;
+  } else {
+    w = (margin > 0.0f ? 1.0f : 0.0f);
+  }
+  w = MAX(0.0f, MIN(1.0f, w));
+  scale = policy->scale_max + (policy->scale_min - policy->scale_max) * w;
+  scale *= 1.0f + policy->cover * (1.0f - cover);
+
+  return scale;
+}
+
+/*! FUNCTION:  	WORK_cloud_search_anchors()
+ *  SYNOPSIS:  	Run linear-space "cloud search" from each of <N> mmseqs entries starting at <id>, which are
+ *                alignments of the same target/query pair, and union their clouds into <edg_diag>.
+ *                Keeps the cloud scores of the best-scoring anchor.
+ *                Caller must have loaded target and query. On return, <mmseqs_cur> and <trace_vit> are restored.
+ */
+void WORK_cloud_search_anchors(WORKER* worker,
+                               int id,
+                               int N) {
+  M8_RESULT* mm_m8 = worker->mmseqs_cur;
+  /* output data */
+  TIMES* times = worker->times;
+  RESULT* result = worker->result;
+  ALL_SCORES* scores = &result->scores;
+  SCORES* finalsc = &result->final_scores;
+  /* best anchor scores */
+  ALL_SCORES best_scores;
+  float best_natsc = -INF;
+  float fwd_time = 0.0f;
+  float bck_time = 0.0f;
+  bool is_i16 = false;
+
+  for (int i = 0; i < N; i++) {
+    worker->mmseqs_cur = &VEC_X(worker->mmseqs_data, id + i);
+    WORK_load_mmseqs_alignment(worker);
+    WORK_cloud_search_linear(worker);
+    WORK_cloud_merge_anchor(worker, i);
+
+    fwd_time += times->lin_cloud_fwd;
+    bck_time += times->lin_cloud_bck;
+    is_i16 = (is_i16 || result->is_cloud_i16);
+    if (i == 0 || finalsc->cloud_natsc > best_natsc) {
+      best_natsc = finalsc->cloud_natsc;
+      best_scores = *scores;
+    }
+  }
+  WORK_cloud_merge_anchors(worker, N);
+
+  /* report best anchor and total time of all anchors */
+  *scores = best_scores;
+  finalsc->cloud_natsc = best_natsc;
+  result->is_cloud_i16 = is_i16;
+  times->lin_cloud_fwd = fwd_time;
+  times->lin_cloud_bck = bck_time;
+
+  worker->mmseqs_cur = mm_m8;
+  WORK_load_mmseqs_alignment(worker);
+}
+
 /*! FUNCTION:  	WORK_cloud_search_quadratic()
  *  SYNOPSIS:  	Run quadratic-space "cloud search" step of pruned forward/backward (aka adaptive-band forward/backward).
  *                Depends on <task> settings in <worker>.
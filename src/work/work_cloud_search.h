@@ -21,6 +21,39 @@ void WORK_cloud_search(WORKER* worker);
  */
 void WORK_cloud_search_linear(WORKER* worker);
 
+/*! FUNCTION:  	WORK_cloud_adapt_params()
+ *  SYNOPSIS:  	Scale x-drops (alpha, beta) of <cloud_params> to current mmseqs
+ * entry, by <cloud_policy>. Does nothing unless policy is adaptive. Caller must
+ * have loaded target and query.
+ */
+void WORK_cloud_adapt_params(WORKER* worker);
+
+/*! FUNCTION:  	WORK_cloud_policy_features()
+ *  SYNOPSIS:  	Get features of current mmseqs entry which are known before
+ * cloud search: <margin> of its e-value under reporting threshold (in bits),
+ * and <cover> of the shorter of query and target by its alignment (from 0 to 1).
+ * Entries without a score (from hitlist) have no <margin>.
+ * Caller must have loaded target and query.
+ */
+void WORK_cloud_policy_features(WORKER* worker, float* margin, float* cover);
+
+/*! FUNCTION:  	WORK_cloud_policy_scale()
+ *  SYNOPSIS:  	Get x-drop scale of <policy> for hit with <margin> and <cover>
+ * (see WORK_cloud_policy_features()). Scale goes from <scale_max> at reporting
+ * threshold to <scale_min> at <policy->margin> bits above it, then is widened
+ * for alignments which cover little of the query or target.
+ */
+float WORK_cloud_policy_scale(const CLOUD_POLICY* policy, float margin, float cover);
+
+/*! FUNCTION:  	WORK_cloud_search_anchors()
+ *  SYNOPSIS:  	Run linear-space "cloud search" from each of <N> mmseqs entries
+ * starting at <id>, which are alignments of the same target/query pair, and
+ * union their clouds into <edg_diag>. Keeps the cloud scores of the
+ * best-scoring anchor. Caller must have loaded target and query. On return,
+ * <mmseqs_cur> and <trace_vit> are restored.
+ */
+void WORK_cloud_search_anchors(WORKER* worker, int id, int N);
+
 /*! FUNCTION:  	WORK_cloud_search_quadratic()
  *  SYNOPSIS:  	Run quadratic-space "cloud search" step of pruned
  * forward/backward (aka adaptive-band forward/backward). Depends on <task>
@@ -32,17 +32,30 @@
 
 /*! FUNCTION:  	WORK_load_indexes()
  *  SYNOPSIS:  	Load or build target and query index files <t_index> for <q_index>.
- *                Stored in <worker>.
+ *                Stored in <worker>. Sorted by id for hitlist input, otherwise by name.
+ *                Also loads map of duplicates removed from query file <q_dupmap>, if given.
  */
 void WORK_load_indexes(WORKER* worker) {
+  ARGS* args = worker->args;
   STATS* stats = worker->stats;
 
-  /* load by id */
-  WORK_load_indexes_by_name(worker);
+  /* hitlist entries refer to index entries by id, .m8 entries by name */
+  if (args->hitlist_filein != NULL) {
+    WORK_load_indexes_by_id(worker);
+  }
+  else {
+    WORK_load_indexes_by_name(worker);
+  }
 
   /* pull database size from index */
   stats->n_query_db = worker->q_index->N;
   stats->n_target_db = worker->t_index->N;
+
+  /* duplicates removed from query file still count towards database size */
+  if (args->dupmap_filein != NULL) {
+    worker->q_dupmap = DUP_MAP_Load(worker->q_dupmap, args->dupmap_filein);
+    stats->n_query_db += worker->q_dupmap->N;
+  }
   // printf("INDEX SIZES = %d, %d\n", worker->q_index->N, worker->t_index->N);
 }
 
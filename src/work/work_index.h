@@ -11,6 +11,7 @@
 /*! FUNCTION:  	WORK_load_indexes()
  *  SYNOPSIS:  	Load or build target and query index files <t_index> for
  * <q_index>. Stored in <worker>.
+ *              Also loads map of duplicates removed from query file <q_dupmap>, if given.
  */
 void WORK_load_indexes(WORKER* worker);
 
@@ -4,7 +4,7 @@
  *             WORK interfaces between pipeline WORKER object and various functions.
  *             Loads query sequences and target hmm profiles.
  *  NOTES:
- *    - Currently, the load_by_name() functions are the only ones in use.
+ *    - The load_by_name() functions are used for .m8 input, hitlist input is loaded by id.
  *    - The names could be stored in a map for quicker lookups.
  *  TODOS:
  *    - Eventually, plan for these functions is that state is handled entirely by the
@@ -16,6 +16,7 @@
 #include <unistd.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <string.h>
 #include <math.h>
 #include <ctype.h>
@@ -50,6 +51,8 @@ void WORK_load_args(WORKER* worker) {
 
 /*! FUNCTION:  	WORK_load_mmseqs_file()
  *  SYNOPSIS:  	Loads mmseqs input m8 file into <results_in>, located at <mmseqs_m8_filein>.
+ *                If file is a binary hitlist instead, entries are loaded by target/query id
+ *                and <hitlist_filein> is set, so that indexes are loaded by id.
  *                Verifies that search index range does not exceed bounds of list.
  */
 void WORK_load_mmseqs_file(WORKER* worker) {
@@ -62,21 +65,98 @@ void WORK_load_mmseqs_file(WORKER* worker) {
     args->list_range.end = INT_MAX;
   }
 
+  /* .m8 from a pipe is read as entries arrive, by WORK_load_mmseqs_ahead() (checked first, as pipe can only be read once) */
+  if (RESULTS_M8_Is_Stream(args->mmseqs_m8_filein)) {
+    if (args->idlist_filein != NULL) {
+      fprintf(stderr, "ERROR: --idlist is not supported when .m8 input is a pipe.\n");
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+    FILER_Open(worker->mmseqs_file);
+    worker->is_mmseqs_stream = true;
+    args->list_range.beg = MAX(args->list_range.beg, 0);
+    worker->n_searches = 0;
+    stats->n_searches = 0;
+    return;
+  }
+  /* load binary hitlist from index range [list_range.beg, list_range.end) */
+  elif (RESULTS_HITLIST_Is_Hitlist(args->mmseqs_m8_filein)) {
+    args->hitlist_filein = STR_Set(args->hitlist_filein, args->mmseqs_m8_filein);
+    RESULTS_HITLIST_Parse(
+        worker->mmseqs_data, args->hitlist_filein, args->list_range.beg, args->list_range.end);
+  }
   /* load .m8 file from index range (list_range.beg, list_range.end) */
-  RESULTS_M8_Parse(
-      worker->mmseqs_data, args->mmseqs_m8_filein, args->list_range.beg, args->list_range.end);
-  /* this is a fix because query and target are cross-labeled between MMSEQS and MMORE */
-  M8_RESULTS_Swap_Target_and_Query(worker->mmseqs_data);
+  else {
+    RESULTS_M8_Parse(
+        worker->mmseqs_data, args->mmseqs_m8_filein, args->list_range.beg, args->list_range.end);
+    /* this is a fix because query and target are cross-labeled between MMSEQS and MMORE */
+    M8_RESULTS_Swap_Target_and_Query(worker->mmseqs_data);
+  }
 
   /* Truncate or extract valid result range */
   args->list_range.beg = MAX(args->list_range.beg, 0);
   args->list_range.end = MIN(args->list_range.end, worker->mmseqs_data->N + args->list_range.beg);
+  /* if id list was given, only search listed results within range */
+  if (args->idlist_filein != NULL) {
+    VECTOR_INT* ids = VECTOR_INT_Create();
+    RESULTS_M8_Parse_Idlist(ids, args->idlist_filein);
+    /* drop ids outside of range */
+    int N_ids = 0;
+    for (int i = 0; i < VECTOR_INT_GetSize(ids); i++) {
+      int id = VEC_X(ids, i);
+      if (id >= args->list_range.beg && id < args->list_range.end) {
+        VEC_X(ids, N_ids++) = id;
+      }
+    }
+    VECTOR_INT_SetSize(ids, N_ids);
+    M8_RESULTS_Select_Ids(worker->mmseqs_data, ids);
+    VECTOR_INT_Destroy(ids);
+    /* searches are now over selected results */
+    args->list_range.end = args->list_range.beg + worker->mmseqs_data->N;
+  }
+
   /* Compute number of searches */
   int num_searches = args->list_range.end - args->list_range.beg;
   worker->n_searches = num_searches;
   stats->n_searches = num_searches;
 }
 
+/*! FUNCTION:  	WORK_load_mmseqs_ahead()
+ *  SYNOPSIS:  	Make sure the first <N> entries of search range are loaded in <mmseqs_data>.
+ *                If .m8 is read from a pipe, reads entries until there are <N>, waiting for them to arrive.
+ *                When pipe is closed, search range is truncated to entries read.
+ *                Returns whether <N> entries are loaded.
+ */
+bool WORK_load_mmseqs_ahead(WORKER* worker,
+                            int N) {
+  ARGS* args = worker->args;
+  STATS* stats = worker->stats;
+  M8_RESULTS* m8_data = worker->mmseqs_data;
+  /* current entries, as offsets in case list moves while growing */
+  ptrdiff_t cur_off = (worker->mmseqs_cur != NULL ? worker->mmseqs_cur - m8_data->data : -1);
+  ptrdiff_t prv_off = (worker->mmseqs_prv != NULL ? worker->mmseqs_prv - m8_data->data : -1);
+
+  if (worker->is_mmseqs_stream == false) {
+    return (N <= m8_data->N);
+  }
+
+  while (m8_data->N < N) {
+    if (RESULTS_M8_Parse_Next(m8_data, worker->mmseqs_file->fp, args->list_range.beg, args->list_range.end) == false) {
+      /* end of pipe */
+      args->list_range.end = args->list_range.beg + m8_data->N;
+      break;
+    }
+    /* this is a fix because query and target are cross-labeled between MMSEQS and MMORE */
+    M8_RESULT_Swap_Target_and_Query(&VEC_X(m8_data, m8_data->N - 1));
+  }
+  worker->n_searches = m8_data->N;
+  stats->n_searches = m8_data->N;
+
+  worker->mmseqs_cur = (cur_off >= 0 ? m8_data->data + cur_off : NULL);
+  worker->mmseqs_prv = (prv_off >= 0 ? m8_data->data + prv_off : NULL);
+
+  return (N <= m8_data->N);
+}
+
 /*! FUNCTION:  	WORK_load_mmseqs_by_id()
  *  SYNOPSIS:  	Load <i>th mmseqs input from .m8 <mmseqs_data> list into <worker>.
  */
@@ -121,24 +201,51 @@ void WORK_load_mmseqs_alignment(WORKER* worker) {
   }
 
   /* load viterbi alignment */
+  ALIGNMENT* tr = worker->trace_vit;
   TRACE aln_beg, aln_end;
-  ALIGNMENT_Reuse(worker->trace_vit, Q, T);
+  int N;
+  ALIGNMENT_Reuse(tr, Q, T);
+  /* if cloud search is pruned to path, seed with full path of cigar alignment */
+  if (args->cloud_path_band >= 0 && mm_m8->cigar_aln != NULL) {
+    if (ALIGNMENT_Build_From_MMSEQS_Cigar(tr, mm_m8->cigar_aln, mm_m8->q_beg, mm_m8->t_beg) == true) {
+      N = tr->traces->N;
+      aln_end = tr->traces->data[N - 1];
+      /* path must end at the end of the alignment, inside the matrix */
+      if (aln_end.st == M_ST &&
+          aln_end.q_0 == mm_m8->q_end && aln_end.t_0 == mm_m8->t_end &&
+          aln_end.q_0 <= Q && aln_end.t_0 <= T) {
+        ALIGNMENT_AddRegion(tr, 0, N - 1, mm_m8->eval);
+        ALIGNMENT_SetRegion(tr, 0);
+        return;
+      }
+    }
+    /* otherwise, fall back to endpoints */
+    ALIGNMENT_Reuse(tr, Q, T);
+  }
   /* if no cigar alignment, just use the beginning and end of the alignment */
   aln_beg.t_0 = mm_m8->t_beg;
   aln_beg.q_0 = mm_m8->q_beg;
-  aln_beg.st = M_ST;
-  ALIGNMENT_AddTrace(worker->trace_vit, aln_beg);
   aln_end.t_0 = mm_m8->t_end;
   aln_end.q_0 = mm_m8->q_end;
+  /* hitlist entries without alignment window use best scoring region of viterbi alignment */
+  if (mm_m8->t_beg < 0 || mm_m8->q_beg < 0) {
+    WORK_viterbi_traceback_full(worker);
+    aln_beg = tr->traces->data[tr->beg];
+    aln_end = tr->traces->data[tr->end];
+    ALIGNMENT_Reuse(tr, Q, T);
+  }
+  aln_beg.st = M_ST;
+  ALIGNMENT_AddTrace(tr, aln_beg);
   aln_end.st = M_ST;
-  ALIGNMENT_AddTrace(worker->trace_vit, aln_end);
+  ALIGNMENT_AddTrace(tr, aln_end);
   /* since only start and end point of alignment is known, set endpoints by default */
-  ALIGNMENT_AddRegion(worker->trace_vit, 0, 1, mm_m8->eval);
-  ALIGNMENT_SetRegion(worker->trace_vit, 0);
+  ALIGNMENT_AddRegion(tr, 0, 1, mm_m8->eval);
+  ALIGNMENT_SetRegion(tr, 0);
 }
 
 /*! FUNCTION:  	WORK_load_target()
  *  SYNOPSIS:  	Loads <target> HMM_PROFILE by <mmseqs_data>'s target name field.
+ *                For hitlist entries, loads by target id field instead.
  */
 void WORK_load_target(WORKER* worker) {
   ARGS* args = worker->args;
@@ -149,13 +256,26 @@ void WORK_load_target(WORKER* worker) {
 
   CLOCK_Start(timer);
 
-  /* update target entry name */
-  worker->t_name_prv = worker->t_name;
-  worker->t_name = worker->mmseqs_cur->target_name;
-  /* if current and previous mmseqs entry targets are not the same, then load new target */
-  if (STRING_Equal(worker->t_name, worker->t_name_prv) == false) {
-    /* load new target */
-    WORK_load_target_by_name(worker, worker->t_name);
+  /* hitlist entries are loaded directly by id, skipping name lookup */
+  if (args->hitlist_filein != NULL) {
+    int t_id = worker->mmseqs_cur->target_id;
+    if (t_id < 0 || t_id >= worker->t_index->N) {
+      fprintf(stderr, "ERROR: Target id '%d' not found in F_INDEX.\n", t_id);
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+    if (t_id != worker->t_id) {
+      WORK_load_target_by_findex_id(worker, t_id);
+    }
+  }
+  else {
+    /* update target entry name */
+    worker->t_name_prv = worker->t_name;
+    worker->t_name = worker->mmseqs_cur->target_name;
+    /* if current and previous mmseqs entry targets are not the same, then load new target */
+    if (STRING_Equal(worker->t_name, worker->t_name_prv) == false) {
+      /* load new target */
+      WORK_load_target_by_name(worker, worker->t_name);
+    }
   }
 
   CLOCK_Stop(timer);
@@ -171,6 +291,7 @@ void WORK_load_target(WORKER* worker) {
 
 /*! FUNCTION:  	WORK_load_query()
  *  SYNOPSIS:  	Loads <query> HMM_PROFILE by <mmseqs_data>'s query name field.
+ *                For hitlist entries, loads by query id field instead.
  */
 void WORK_load_query(WORKER* worker) {
   ARGS* args = worker->args;
@@ -182,13 +303,26 @@ void WORK_load_query(WORKER* worker) {
 
   CLOCK_Start(timer);
 
-  /* update query entry name */
-  worker->q_name_prv = worker->q_name;
-  worker->q_name = worker->mmseqs_cur->query_name;
-  /* if current and previous mmseqs entry targets are not the same */
-  if (STRING_Equal(worker->q_name, worker->q_name_prv) == false) {
-    /* load new target */
-    WORK_load_query_by_name(worker, worker->q_name);
+  /* hitlist entries are loaded directly by id, skipping name lookup */
+  if (args->hitlist_filein != NULL) {
+    int q_id = worker->mmseqs_cur->query_id;
+    if (q_id < 0 || q_id >= worker->q_index->N) {
+      fprintf(stderr, "ERROR: Query id '%d' not found in F_INDEX.\n", q_id);
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+    if (q_id != worker->q_id) {
+      WORK_load_query_by_findex_id(worker, q_id);
+    }
+  }
+  else {
+    /* update query entry name */
+    worker->q_name_prv = worker->q_name;
+    worker->q_name = worker->mmseqs_cur->query_name;
+    /* if current and previous mmseqs entry targets are not the same */
+    if (STRING_Equal(worker->q_name, worker->q_name_prv) == false) {
+      /* load new target */
+      WORK_load_query_by_name(worker, worker->q_name);
+    }
   }
 
   CLOCK_Stop(timer);
@@ -268,10 +402,13 @@ void WORK_load_target_by_findex_id(WORKER* worker,
       // HMM_PROFILE_Dump( worker->t_prof, stdout );
     } break;
     case FILE_FASTA: {
+      /* build profile from single target sequence */
+      if (worker->t_builder == NULL) {
+        worker->t_builder = SEQ_BUILDER_Create();
+      }
       SEQUENCE_Fasta_Parse(worker->t_seq, args->t_filein, my_idx->offset);
-      SEQUENCE_to_HMM_PROFILE(worker->t_seq, worker->t_prof);
-      HMM_PROFILE_Dump(worker->t_prof, stdout);
-      ERRORCHECK_exit(EXIT_SUCCESS);
+      SEQUENCE_to_HMM_PROFILE(worker->t_builder, worker->t_seq, worker->t_prof);
+      HMM_PROFILE_Config(worker->t_prof, args->search_mode);
     } break;
     default: {
       fprintf(stderr, "ERROR: Only HMM and FASTA filetypes are supported for targets.\n");
@@ -15,6 +15,14 @@
  */
 void WORK_load_mmseqs_file(WORKER* worker);
 
+/*! FUNCTION:  	WORK_load_mmseqs_ahead()
+ *  SYNOPSIS:  	Make sure the first <N> entries of search range are loaded in <mmseqs_data>.
+ *                If .m8 is read from a pipe, reads entries until there are <N>, waiting for them to arrive.
+ *                When pipe is closed, search range is truncated to entries read.
+ *                Returns whether <N> entries are loaded.
+ */
+bool WORK_load_mmseqs_ahead(WORKER* worker, int N);
+
 /*! FUNCTION:  	WORK_load_mmseqs_by_id()
  *  SYNOPSIS:  	Load <i>th mmseqs input from .m8 <mmseqs_data> list into
  * <worker>.
@@ -82,8 +82,12 @@ void WORK_preiter(WORKER* worker) {
   /* init threshold tests */
   result->is_passed_viterbi = false;
   result->is_passed_cloud = false;
+  result->is_cloud_i16 = false;
   result->is_passed_fwdback = false;
   result->is_passed_report = false;
+  /* init cell counts */
+  result->cloud_cells = 0;
+  result->total_cells = 0;
 
   /* start timer for iteration */
   times->loop_start = CLOCK_GetTime(worker->timer);
@@ -129,4 +133,7 @@ void WORK_postloop(WORKER* worker) {
 
   /* report total times */
   REPORT_mytimeout_totals(worker, result, stdout);
+  if (worker->args->verbose_level >= VERBOSE_HIGH) {
+    REPORT_perfout_totals(worker, stdout);
+  }
 }
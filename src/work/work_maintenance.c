@@ -50,6 +50,9 @@ void WORK_init(WORKER* worker) {
   worker->q_index_file = FILER_Create(args->q_index_filein, read_mode);
   worker->t_index_file = FILER_Create(args->t_index_filein, read_mode);
   worker->mmseqs_file = FILER_Create(args->mmseqs_m8_filein, read_mode);
+  if (args->cloudin_filein != NULL) {
+    worker->cloudin_file = FILER_Create(args->cloudin_filein, read_mode);
+  }
   // worker->hitlist_file       = FILER_Create( args->hitlist_filein, read_mode );
   /* output files */
   worker->output_file = FILER_Create(args->stdout_fileout, write_mode);
@@ -74,6 +77,18 @@ void WORK_init(WORKER* worker) {
   if (args->mythresh_fileout != NULL) {
     worker->mythreshout_file = FILER_Create(args->mythresh_fileout, write_mode);
   }
+  if (args->perf_fileout != NULL) {
+    worker->perfout_file = FILER_Create(args->perf_fileout, write_mode);
+  }
+  if (args->trace_fileout != NULL) {
+    worker->traceout_file = FILER_Create(args->trace_fileout, write_mode);
+  }
+  if (args->binout_fileout != NULL) {
+    worker->binout_file = FILER_Create(args->binout_fileout, write_mode);
+  }
+  if (args->cloudout_fileout != NULL) {
+    worker->cloudout_file = FILER_Create(args->cloudout_fileout, write_mode);
+  }
 
   /* target and profile structures */
   worker->q_seq = SEQUENCE_Create();
@@ -86,10 +101,15 @@ void WORK_init(WORKER* worker) {
   /* results in from mmseqs and out for general searches */
   worker->mmseqs_data = M8_RESULTS_Create();
   worker->results = RESULTS_Create();
-  worker->result = ERROR_malloc(sizeof(RESULT));
+  RESULTS_SetMaxInQueue(worker->results, args->report_queue);
+  worker->result = RESULT_Create();
   /* data structs for viterbi alignment search */
   worker->trace_vit = ALIGNMENT_Create();
   worker->trace_post = ALIGNMENT_Create();
+  worker->vit_ptrs = VITERBI_PTRS_Create();
+  worker->i16_MX = MATRIX_I16_Create();
+  worker->cloudin_cache = CLOUD_CACHE_Create();
+  worker->cloudout_cache = CLOUD_CACHE_Create();
   /* data structs for cloud edgebounds */
   worker->edg_fwd = EDGEBOUNDS_Create();
   worker->edg_bck = EDGEBOUNDS_Create();
@@ -97,6 +117,8 @@ void WORK_init(WORKER* worker) {
   worker->edg_row = EDGEBOUNDS_Create();
   /* row-wise edgebounds */
   worker->edg_rows_tmp = EDGEBOUND_ROWS_Create();
+  /* per-anchor clouds, created as needed */
+  worker->edg_anchors = VECTOR_PTR_Create();
   for (int i = 0; i < 3; i++) {
     worker->lb_vec[i] = VECTOR_INT_Create();
     worker->rb_vec[i] = VECTOR_INT_Create();
@@ -106,6 +128,15 @@ void WORK_init(WORKER* worker) {
   worker->cloud_params.beta = worker->args->beta;
   worker->cloud_params.gamma = worker->args->gamma;
   worker->cloud_params.hard_limit = worker->args->hard_limit;
+  worker->cloud_params.is_i16 = worker->args->is_cloud_i16;
+  worker->cloud_params.i16_margin = worker->args->cloud_i16_margin;
+  worker->cloud_params.path_band = worker->args->cloud_path_band;
+  /* cloud search policy, for scaling parameters to each hit */
+  worker->cloud_policy.is_adaptive = worker->args->is_cloud_adaptive;
+  worker->cloud_policy.margin = worker->args->cloud_adapt_margin;
+  worker->cloud_policy.scale_min = worker->args->cloud_adapt_min;
+  worker->cloud_policy.scale_max = worker->args->cloud_adapt_max;
+  worker->cloud_policy.cover = worker->args->cloud_adapt_cover;
   /* create necessary dp matrices */
   /* quadratic */
   worker->st_MX_fwd = MATRIX_3D_Create(NUM_NORMAL_STATES, 1, 1);
@@ -229,6 +260,7 @@ void WORK_cleanup(WORKER* worker) {
   worker->t_index_file = FILER_Destroy(worker->t_index_file);
   worker->mmseqs_file = FILER_Destroy(worker->mmseqs_file);
   worker->hitlist_file = FILER_Destroy(worker->hitlist_file);
+  worker->cloudin_file = FILER_Destroy(worker->cloudin_file);
   /* output files */
   worker->output_file = FILER_Destroy(worker->output_file);
   worker->tblout_file = FILER_Destroy(worker->tblout_file);
@@ -238,24 +270,33 @@ void WORK_cleanup(WORKER* worker) {
   worker->mytimeout_file = FILER_Destroy(worker->mytimeout_file);
   worker->mythreshout_file = FILER_Destroy(worker->mythreshout_file);
   worker->hmmerout_file = FILER_Destroy(worker->hmmerout_file);
+  worker->perfout_file = FILER_Destroy(worker->perfout_file);
+  worker->traceout_file = FILER_Destroy(worker->traceout_file);
+  worker->binout_file = FILER_Destroy(worker->binout_file);
+  worker->cloudout_file = FILER_Destroy(worker->cloudout_file);
 
   /* target and profile structures */
   worker->q_seq = SEQUENCE_Destroy(worker->q_seq);
   worker->t_seq = SEQUENCE_Destroy(worker->t_seq);
   worker->t_prof = HMM_PROFILE_Destroy(worker->t_prof);
   worker->hmm_bg = HMM_BG_Destroy(worker->hmm_bg);
+  worker->t_builder = SEQ_BUILDER_Destroy(worker->t_builder);
   /* target and profile indexes */
   worker->q_index = F_INDEX_Destroy(worker->q_index);
   worker->t_index = F_INDEX_Destroy(worker->t_index);
+  worker->q_dupmap = DUP_MAP_Destroy(worker->q_dupmap);
   /* results in from mmseqs and out for general searches */
   worker->mmseqs_data = M8_RESULTS_Destroy(worker->mmseqs_data);
   worker->results = RESULTS_Destroy(worker->results);
   /* free single result */
-  ERROR_free(worker->result);
-  worker->result = NULL;
+  worker->result = RESULT_Destroy(worker->result);
   /* data structs for viterbi alignment */
   worker->trace_vit = ALIGNMENT_Destroy(worker->trace_vit);
   worker->trace_post = ALIGNMENT_Destroy(worker->trace_post);
+  worker->vit_ptrs = VITERBI_PTRS_Destroy(worker->vit_ptrs);
+  worker->i16_MX = MATRIX_I16_Destroy(worker->i16_MX);
+  worker->cloudin_cache = CLOUD_CACHE_Destroy(worker->cloudin_cache);
+  worker->cloudout_cache = CLOUD_CACHE_Destroy(worker->cloudout_cache);
   /* data structs for cloud edgebounds */
   worker->edg_fwd = EDGEBOUNDS_Destroy(worker->edg_fwd);
   worker->edg_bck = EDGEBOUNDS_Destroy(worker->edg_bck);
@@ -263,6 +304,11 @@ void WORK_cleanup(WORKER* worker) {
   worker->edg_row = EDGEBOUNDS_Destroy(worker->edg_row);
   /* row-wise edgebounds */
   worker->edg_rows_tmp = EDGEBOUND_ROWS_Destroy(worker->edg_rows_tmp);
+  /* per-anchor clouds */
+  for (int i = 0; i < VECTOR_PTR_GetSize(worker->edg_anchors); i++) {
+    EDGEBOUNDS_Destroy(VEC_X(worker->edg_anchors, i));
+  }
+  worker->edg_anchors = VECTOR_PTR_Destroy(worker->edg_anchors);
   for (int i = 0; i < 3; i++) {
     worker->lb_vec[i] = VECTOR_INT_Destroy(worker->lb_vec[i]);
     worker->rb_vec[i] = VECTOR_INT_Destroy(worker->rb_vec[i]);
@@ -31,83 +31,14 @@
 
 /*! FUNCTION:  	WORK_optimal_accuracy()
  *  SYNOPSIS:  	Run Optimal Accuracy algorithm of Posterior.
+ *                Finds optimal accuracy alignment in linear memory, storing traceback in <trace_post>.
+ *                One core model alignment is found in each domain found by WORK_decode_domains().
+ *                If no alignment is found, <trace_post> is left empty and search continues.
  *                Depends on <task> settings in <worker>.
  */
 void WORK_optimal_accuracy(WORKER* worker) {
   FILE* fp = NULL;
   ARGS* args = worker->args;
-  TASKS* tasks = worker->tasks;
-  CLOCK* timer = worker->timer;
-  /* input data */
-  SEQUENCE* q_seq = worker->q_seq;
-  int Q = q_seq->N;
-  HMM_PROFILE* t_prof = worker->t_prof;
-  int T = t_prof->N;
-  EDGEBOUNDS* edg = worker->edg_row;
-  /* working data */
-  MATRIX_3D_SPARSE* st_SMX = worker->st_SMX;
-  MATRIX_3D_SPARSE* st_SMX_post = worker->st_SMX_post;
-  MATRIX_3D_SPARSE* st_SMX_opt = worker->st_SMX_optacc;
-  MATRIX_2D* sp_MX = worker->sp_MX;
-  MATRIX_2D* sp_MX_post = worker->sp_MX_post;
-  /** TODO: this should use the optimal accuracy special mx, but is throwing errors */
-  MATRIX_2D* sp_MX_opt = worker->sp_MX_fwd;
-  /* output data */
-  TIMES* times = worker->times;
-  RESULT* result = worker->result;
-  ALL_SCORES* scores = &result->scores;
-  SCORES* final_scores = &result->final_scores;
-  float opt_sc;
-
-  CLOCK_Start(timer);
-
-  /* we need posterior in log space for computing the optimal accuraccy */
-  MATRIX_3D_SPARSE_Log(st_SMX_post);
-  MATRIX_2D_Log(sp_MX_post);
-  MATRIX_3D_SPARSE_Fill(st_SMX_opt, 0.0f);
-  MATRIX_2D_Fill(sp_MX_opt, 0.0f);
-
-#if DEBUG
-{
-  printf("debug_folder: " DEBUG_FOLDER);
-  fp = fopen(DEBUG_FOLDER "/my.optacc_postout.sp.000.mx", "w+");
-  MATRIX_3D_SPARSE_Embed(Q, T, st_SMX_post, debugger->test_MX);
-  DP_MATRIX_Dump(Q, T, debugger->test_MX, sp_MX_post, fp);
-  fclose(fp);
-
-  fp = fopen(DEBUG_FOLDER "/my.optacc_optout.sp.000.mx", "w+");
-  MATRIX_3D_SPARSE_Embed(Q, T, st_SMX_opt, debugger->test_MX);
-  DP_MATRIX_Dump(Q, T, debugger->test_MX, sp_MX_opt, fp);
-  fclose(fp);
-}
-#endif
-
-  run_OptimalAccuracy_Sparse(
-      q_seq, t_prof, Q, T, edg, NULL,
-      st_SMX_post, sp_MX_post, st_SMX_opt, sp_MX_opt, &opt_sc);
-
-  CLOCK_Stop(timer);
-  times->sp_optacc = CLOCK_Duration(timer);
-
-  fprintf(stdout, "# ==> Optimal Accuracy (full cloud): %11.4f\n", opt_sc);
-#if DEBUG
-  {
-    fp = fopen(DEBUG_FOLDER "/my.optacc.sp.000.mx", "w+");
-    MATRIX_3D_SPARSE_Embed(Q, T, st_SMX_opt, debugger->test_MX);
-    DP_MATRIX_Dump(Q, T, debugger->test_MX, sp_MX_opt, fp);
-    fclose(fp);
-  }
-#endif
-}
-
-/*! FUNCTION:  	WORK_optacc_traceback()
- *  SYNOPSIS:  	Run Traceback algorithm of Optimal Accuracy / Posterior.
- *                Depends on <task> settings in <worker>.
- */
-void WORK_optacc_traceback(WORKER* worker) {
-  FILE* fp = NULL;
-  ARGS* args = worker->args;
-  TASKS* tasks = worker->tasks;
   CLOCK* timer = worker->timer;
   /* input data */
   SEQUENCE* q_seq = worker->q_seq;
@@ -115,34 +46,30 @@ void WORK_optacc_traceback(WORKER* worker) {
   HMM_PROFILE* t_prof = worker->t_prof;
   int T = t_prof->N;
   EDGEBOUNDS* edg = worker->edg_row;
+  DOMAIN_DEF* dom_def = worker->dom_def;
   ALIGNMENT* aln = worker->trace_post;
   /* working data */
-  MATRIX_3D_SPARSE* st_SMX = worker->st_SMX;
   MATRIX_3D_SPARSE* st_SMX_post = worker->st_SMX_post;
-  MATRIX_3D_SPARSE* st_SMX_opt = worker->st_SMX_optacc;
-  MATRIX_2D* sp_MX = worker->sp_MX;
   MATRIX_2D* sp_MX_post = worker->sp_MX_post;
-  /** TODO: this should use the optimal accuracy special mx, but is throwing errors */
-  MATRIX_2D* sp_MX_opt = worker->sp_MX_fwd;
   /* output data */
   TIMES* times = worker->times;
-  RESULT* result = worker->result;
-  ALL_SCORES* scores = &result->scores;
-  SCORES* final_scores = &result->final_scores;
   float opt_sc;
+  STATUS_FLAG status;
 
-  /* Optimal Alignment Traceback */
   CLOCK_Start(timer);
 
-  run_OptimalAccuracy_Traceback_Sparse(
-      q_seq, t_prof, Q, T, edg, NULL,
-      st_SMX_post, sp_MX_post, st_SMX_opt, sp_MX_opt, aln);
-  ALIGNMENT_Build_MMSEQS_Style(aln, q_seq, t_prof);
-  ALIGNMENT_Build_HMMER_Style(aln, q_seq, t_prof);
+  status = run_OptimalAccuracy_Sparse(
+      q_seq, t_prof, Q, T, edg, dom_def->dom_ranges,
+      st_SMX_post, sp_MX_post, aln, &opt_sc);
+  if (status != STATUS_SUCCESS) {
+    fprintf(stderr, "WARNING: No optimal accuracy alignment found in cloud (query: %s, target: %s).\n",
+            q_seq->name, t_prof->name);
+  }
 
   CLOCK_Stop(timer);
-  times->sp_optacc += CLOCK_Duration(timer);
+  times->sp_optacc = CLOCK_Duration(timer);
 
+  printf_vhi("# ==> Optimal Accuracy (full cloud): %11.4f\n", opt_sc);
 #if DEBUG
   {
     fp = fopen(DEBUG_FOLDER "/my.optacc_traceback.sp.000.mx", "w+");
@@ -13,10 +13,4 @@
  */
 void WORK_optimal_accuracy(WORKER* worker);
 
-/*! FUNCTION:  	WORK_optacc_traceback()
- *  SYNOPSIS:  	Run traceback of optimal accuracy / posterior.
- *                Depends on <task> settings in <worker>.
- */
-void WORK_optacc_traceback(WORKER* worker);
-
 #endif /* _WORK_OPTACC */
@@ -64,12 +64,8 @@ void WORK_posterior_sparse(WORKER* worker) {
   /* compute posterior alignment */
   if (args->is_run_postaln == true || args->is_run_optacc == true) {
     printf_vhi("POSTERIOR ALIGNMENT!!!\n");
-    /* compute optimal accuracy from posterior */
+    /* compute optimal accuracy from posterior, with its traceback */
     WORK_optimal_accuracy(worker);
-    /* backtrace optimal accuracy for posterior alignment */
-    if (args->is_run_postaln == true) {
-      WORK_optacc_traceback(worker);
-    }
   }
 
   /* compute viterbi alignment */
@@ -134,6 +130,8 @@ void WORK_null1_hmm_bias(WORKER* worker) {
 
 /*! FUNCTION:  WORK_decode_domains()
  *  SYNOPSIS:  Find domain ranges in posterior.
+ *             Per-row domain data is already decoded during backward by WORK_bound_fwdback_sparse(),
+ *             so only the scan for domain ranges remains.
  */
 void WORK_decode_domains(WORKER* worker) {
   FILE* fp = NULL;
@@ -143,12 +141,6 @@ void WORK_decode_domains(WORKER* worker) {
   /* input data */
   SEQUENCE* q_seq = worker->q_seq;
   int Q = q_seq->N;
-  HMM_PROFILE* t_prof = worker->t_prof;
-  int T = t_prof->N;
-  EDGEBOUNDS* edg = worker->edg_row;
-  /* working data */
-  MATRIX_2D* sp_MX_fwd = worker->sp_MX_fwd;
-  MATRIX_2D* sp_MX_bck = worker->sp_MX_bck;
   /* output data */
   TIMES* times = worker->times;
   RESULT* result = worker->result;
@@ -160,8 +152,7 @@ void WORK_decode_domains(WORKER* worker) {
   /* find Domain ranges */
   CLOCK_Start(timer);
 
-  run_Decode_Domains(
-      q_seq, t_prof, Q, T, edg, sp_MX_fwd, sp_MX_bck, dom_def);
+  run_Decode_Domains_Regions(Q, dom_def);
   stats->n_reported_domains += dom_def->dom_ranges->N;
   CLOCK_Stop(timer);
   times->sp_decodedom = CLOCK_Duration(timer);
@@ -206,12 +197,14 @@ void WORK_decode_posterior(WORKER* worker) {
   float sc;
 
   /* compute Posterior */
+  PERF_COUNTERS_Begin(worker->perf, PERF_POSTERIOR);
   CLOCK_Start(timer);
   run_Decode_Posterior_Sparse(
       q_seq, t_prof, Q, T, edg, NULL,
-      st_SMX_fwd, sp_MX_fwd, st_SMX_bck, sp_MX_bck, st_SMX_post, sp_MX_post);
+      st_SMX_fwd, sp_MX_fwd, st_SMX_bck, sp_MX_bck, st_SMX_post, sp_MX_post, worker->dom_def);
   CLOCK_Stop(timer);
   times->sp_posterior = CLOCK_Duration(timer);
+  PERF_COUNTERS_End(worker->perf, PERF_POSTERIOR, times->sp_posterior, result->cloud_cells);
 
   // fprintf(stdout, "# ==> Posterior (full cloud)\n");
 #if DEBUG
@@ -231,8 +224,9 @@ void WORK_decode_posterior(WORKER* worker) {
 #endif
 }
 
-/*! FUNCTION:  WORK_decode_posterior()
+/*! FUNCTION:  WORK_null2_seq_bias()
  *  SYNOPSIS:  Compute the correction bias for the sequence.
+ *             Posterior must already be summed for null2 by WORK_decode_posterior().
  */
 void WORK_null2_seq_bias(WORKER* worker) {
   FILE* fp = NULL;
@@ -245,10 +239,7 @@ void WORK_null2_seq_bias(WORKER* worker) {
   HMM_PROFILE* t_prof = worker->t_prof;
   int T = t_prof->N;
   MATRIX_3D_SPARSE* st_SMX = worker->st_SMX;
-  MATRIX_3D_SPARSE* st_SMX_post = worker->st_SMX_post;
   MATRIX_2D* sp_MX = worker->sp_MX;
-  MATRIX_2D* sp_MX_post = worker->sp_MX_post;
-  EDGEBOUNDS* edg = worker->edg_row;
   /* output data */
   TIMES* times = worker->times;
   RESULT* result = worker->result;
@@ -259,9 +250,8 @@ void WORK_null2_seq_bias(WORKER* worker) {
 
   /* Composition Bias */
   CLOCK_Start(timer);
-  run_Null2_ByExpectation_Sparse(
-      q_seq, t_prof, Q, T, edg, NULL, NULL, NULL,
-      st_SMX_post, sp_MX_post, dom_def, &null2_seq_bias);
+  run_Null2_ByExpectation_FromFreq(
+      q_seq, t_prof, Q, T, NULL, NULL, NULL, dom_def, &null2_seq_bias);
   CLOCK_Stop(timer);
   times->sp_biascorr = CLOCK_Duration(timer);
   scores->null2_seq_bias = null2_seq_bias;
@@ -93,6 +93,7 @@ void WORK_posterior_sparse_bydom(WORKER* worker) {
   float null1_hmm_bias, null2_seq_bias;
   float pre_sc, fwd_sc, bck_sc;
   float post_sc, opt_sc, dom_sc;
+  size_t dom_cells = 0;
 
   /* run through Domains and compute score, bias correction, and optimal alignment */
   if (args->is_run_domains == true) {
@@ -101,6 +102,7 @@ void WORK_posterior_sparse_bydom(WORKER* worker) {
     dom_def->dom_sumbias = 0.0f;
     dom_def->n_residues = 0;
     null1_hmm_bias = dom_def->null1_hmm_bias;
+    PERF_COUNTERS_Begin(worker->perf, PERF_DOMAIN);
     times->dom_start = CLOCK_GetTime(timer);
 
     /* TODO: fix null1 bias computation */
@@ -115,6 +117,7 @@ void WORK_posterior_sparse_bydom(WORKER* worker) {
 
       // /* Reparameterize sequence to only cover domain range. */
       D_size = D_range.end - D_range.beg + 1;
+      dom_cells += EDGEBOUNDS_Count_in_Range(edg, D_range);
       // SEQUENCE_SetDomain( q_seq, D_range );
       // EDGEBOUNDS_SetDomain( edg, edg_dom, D_range );
       // HMM_PROFILE_ReconfigLength( t_prof, q_seq->N );
@@ -150,7 +153,7 @@ void WORK_posterior_sparse_bydom(WORKER* worker) {
       /* compute Forward/Backward for the domain range */
       CLOCK_Start(timer);
       run_Bound_Backward_Sparse(
-          q_seq, t_prof, Q, T, st_SMX_bck, sp_MX_bck, edg, &D_range, &bck_sc);
+          q_seq, t_prof, Q, T, st_SMX_bck, sp_MX_bck, edg, &D_range, &bck_sc, NULL, NULL);
       CLOCK_Stop(timer);
       times->dom_bound_bck += CLOCK_Duration(timer);
 
@@ -171,7 +174,7 @@ void WORK_posterior_sparse_bydom(WORKER* worker) {
       CLOCK_Start(timer);
       run_Decode_Posterior_Sparse(
           q_seq, t_prof, Q, T, edg, &D_range,
-          st_SMX_fwd, sp_MX_fwd, st_SMX_bck, sp_MX_bck, st_SMX_post, sp_MX_post);
+          st_SMX_fwd, sp_MX_fwd, st_SMX_bck, sp_MX_bck, st_SMX_post, sp_MX_post, dom_def);
       CLOCK_Stop(timer);
       times->dom_posterior += CLOCK_Duration(timer);
 
@@ -192,8 +195,8 @@ void WORK_posterior_sparse_bydom(WORKER* worker) {
 
       /* run Null2 Score to compute Composition Bias */
       CLOCK_Start(timer);
-      run_Null2_ByExpectation_Sparse(q_seq, t_prof, Q, T, edg, &D_range, NULL, NULL,
-                                     st_SMX_post, sp_MX_post, dom_def, &null2_seq_bias);
+      run_Null2_ByExpectation_FromFreq(q_seq, t_prof, Q, T, &D_range, NULL, NULL,
+                                       dom_def, &null2_seq_bias);
       CLOCK_Stop(timer);
       times->dom_biascorr += CLOCK_Duration(timer);
 
@@ -240,6 +243,7 @@ void WORK_posterior_sparse_bydom(WORKER* worker) {
     /* total dom-scoring time */
     times->dom_end = CLOCK_GetTime(timer);
     times->dom_total = CLOCK_GetDiff(timer, times->dom_start, times->dom_end);
+    PERF_COUNTERS_End(worker->perf, PERF_DOMAIN, times->dom_total, dom_cells);
   }
 }
 
@@ -367,12 +371,14 @@ void WORK_decode_posterior_bydom(WORKER* worker) {
   float sc;
 
   /* compute Posterior */
+  PERF_COUNTERS_Begin(worker->perf, PERF_POSTERIOR);
   CLOCK_Start(timer);
   run_Decode_Posterior_Sparse(
       q_seq, t_prof, Q, T, edg, NULL,
-      st_SMX_fwd, sp_MX_fwd, st_SMX_bck, sp_MX_bck, st_SMX_post, sp_MX_post);
+      st_SMX_fwd, sp_MX_fwd, st_SMX_bck, sp_MX_bck, st_SMX_post, sp_MX_post, worker->dom_def);
   CLOCK_Stop(timer);
   times->sp_posterior = CLOCK_Duration(timer);
+  PERF_COUNTERS_End(worker->perf, PERF_POSTERIOR, times->sp_posterior, result->cloud_cells);
 
   // fprintf(stdout, "# ==> Posterior (full cloud)\n");
 #if DEBUG
@@ -402,10 +408,7 @@ void WORK_null2_seq_bias_bydom(WORKER* worker) {
   HMM_PROFILE* t_prof = worker->t_prof;
   int T = t_prof->N;
   MATRIX_3D_SPARSE* st_SMX = worker->st_SMX;
-  MATRIX_3D_SPARSE* st_SMX_post = worker->st_SMX_post;
   MATRIX_2D* sp_MX = worker->sp_MX;
-  MATRIX_2D* sp_MX_post = worker->sp_MX_post;
-  EDGEBOUNDS* edg = worker->edg_row;
   /* output data */
   TIMES* times = worker->times;
   RESULT* result = worker->result;
@@ -416,9 +419,8 @@ void WORK_null2_seq_bias_bydom(WORKER* worker) {
 
   /* Composition Bias */
   CLOCK_Start(timer);
-  run_Null2_ByExpectation_Sparse(
-      q_seq, t_prof, Q, T, edg, NULL, NULL, NULL,
-      st_SMX_post, sp_MX_post, dom_def, &null2_seq_bias);
+  run_Null2_ByExpectation_FromFreq(
+      q_seq, t_prof, Q, T, NULL, NULL, NULL, dom_def, &null2_seq_bias);
   CLOCK_Stop(timer);
   times->sp_biascorr = CLOCK_Duration(timer);
   scores->null2_seq_bias = null2_seq_bias;
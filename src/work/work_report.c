@@ -14,6 +14,7 @@
 #include <math.h>
 #include <ctype.h>
 #include <time.h>
+#include <pthread.h>
 
 /* local imports */
 #include "../objects/structs.h"
@@ -30,6 +31,12 @@
 #include "_work.h"
 #include "work_report.h"
 
+/* private functions */
+static void*
+WORK_report_writer(void* arg);
+static void
+WORK_report_writer_stop(WORKER* worker);
+
 /*! FUNCTION:  	WORK_open()
  *  SYNOPSIS:  	Open all valid files in <worker>.
  */
@@ -39,24 +46,53 @@ void WORK_open(WORKER* worker) {
   /* open file pointers */
   if (args->is_redirect_stdout) {
     FILER_Open(worker->output_file);
+    FILER_SetBuffer(worker->output_file, REPORT_FILE_BUFSIZE);
   }
   if (worker->hmmerout_file != NULL && args->is_hmmerout) {
     FILER_Open(worker->hmmerout_file);
+    FILER_SetBuffer(worker->hmmerout_file, REPORT_FILE_BUFSIZE);
   }
   if (worker->m8out_file != NULL && args->is_m8out) {
     FILER_Open(worker->m8out_file);
+    FILER_SetBuffer(worker->m8out_file, REPORT_FILE_BUFSIZE);
   }
   if (worker->myout_file != NULL && args->is_myout) {
     FILER_Open(worker->myout_file);
+    FILER_SetBuffer(worker->myout_file, REPORT_FILE_BUFSIZE);
   }
   if (worker->mydomout_file != NULL && args->is_mydom) {
     FILER_Open(worker->mydomout_file);
+    FILER_SetBuffer(worker->mydomout_file, REPORT_FILE_BUFSIZE);
   }
   if (worker->mytimeout_file != NULL && args->is_mytimeout) {
     FILER_Open(worker->mytimeout_file);
+    FILER_SetBuffer(worker->mytimeout_file, REPORT_FILE_BUFSIZE);
   }
   if (worker->mythreshout_file != NULL && args->is_mythreshout) {
     FILER_Open(worker->mythreshout_file);
+    FILER_SetBuffer(worker->mythreshout_file, REPORT_FILE_BUFSIZE);
+  }
+  if (worker->perfout_file != NULL && args->is_perfout) {
+    FILER_Open(worker->perfout_file);
+    FILER_SetBuffer(worker->perfout_file, REPORT_FILE_BUFSIZE);
+  }
+  if (worker->traceout_file != NULL && args->is_traceout) {
+    FILER_Open(worker->traceout_file);
+    worker->traceout_writer = ASYNC_WRITER_Create(worker->traceout_file->fp, ASYNC_WRITER_BUFSIZE);
+  }
+  if (worker->binout_file != NULL && args->is_binout) {
+    FILER_Open(worker->binout_file);
+    FILER_SetBuffer(worker->binout_file, REPORT_FILE_BUFSIZE);
+  }
+  /* cloud cache is written and read on search thread, as clouds are found */
+  if (worker->cloudout_file != NULL && args->is_cloudout) {
+    FILER_Open(worker->cloudout_file);
+    FILER_SetBuffer(worker->cloudout_file, REPORT_FILE_BUFSIZE);
+    CLOUD_CACHE_Write_Header(worker->cloudout_file->fp);
+  }
+  if (worker->cloudin_file != NULL) {
+    FILER_Open(worker->cloudin_file);
+    CLOUD_CACHE_Read_Header(worker->cloudin_file->fp, args->cloudin_filein);
   }
 }
 
@@ -88,6 +124,23 @@ void WORK_close(WORKER* worker) {
   if (args->is_mythreshout) {
     FILER_Close(worker->mythreshout_file);
   }
+  if (args->is_perfout) {
+    FILER_Close(worker->perfout_file);
+  }
+  if (args->is_traceout) {
+    /* drain pending trace data before closing */
+    worker->traceout_writer = ASYNC_WRITER_Destroy(worker->traceout_writer);
+    FILER_Close(worker->traceout_file);
+  }
+  if (args->is_binout) {
+    FILER_Close(worker->binout_file);
+  }
+  if (args->is_cloudout) {
+    FILER_Close(worker->cloudout_file);
+  }
+  if (args->cloudin_filein != NULL) {
+    FILER_Close(worker->cloudin_file);
+  }
 }
 
 /*! FUNCTION:  	WORK_report_header()
@@ -117,46 +170,224 @@ void WORK_report_header(WORKER* worker) {
   if (args->is_mydom && args->is_run_domains) {
     REPORT_domtblout_header(worker, worker->mydomout_file->fp);
   }
+  if (args->is_binout) {
+    REPORT_binout_header(worker, worker->binout_file->fp);
+  }
+
+  /* entries are written by writer thread from here until footer */
+  if (args->report_queue > 0) {
+    if (pthread_create(&worker->results_writer, NULL, WORK_report_writer, worker) != 0) {
+      fprintf(stderr, "ERROR: Unable to start report writer thread.\n");
+      ERRORCHECK_exit(EXIT_FAILURE);
+    }
+    worker->is_results_writer = true;
+  }
 }
 
 /*! FUNCTION:  	WORK_report_result_current()
- *  SYNOPSIS:  	Write current result entry to all open files in <worker>.
+ *  SYNOPSIS:  	Capture current result into a self-contained record and queue it to be written
+ *              to all open files in <worker>. If there is no writer thread, it is written immediately.
+ *              If current query has duplicates in <q_dupmap>, result is also queued under each duplicate name.
  */
 void WORK_report_result_current(WORKER* worker) {
+  RESULTS* results = worker->results;
+  DUP_MAP* dupmap = worker->q_dupmap;
+  STR q_name = worker->q_seq->name;
+  RESULT* record;
+
+  /* blocks if writer thread has fallen <report_queue> results behind */
+  record = RESULTS_Queue_Back(results);
+  WORK_report_capture_result(worker, record);
+  WORK_report_result_push(worker);
+
+  /* duplicates of query were removed from query file, so share its result */
+  if (dupmap == NULL) {
+    return;
+  }
+  for (int i = DUP_MAP_Search(dupmap, q_name); i >= 0 && i < dupmap->N; i++) {
+    if (STR_Equals(dupmap->nodes[i].canon_name, q_name) == false) {
+      break;
+    }
+    record = RESULTS_Queue_Back(results);
+    WORK_report_capture_result(worker, record);
+    record->query_name = STR_Set(record->query_name, dupmap->nodes[i].dup_name);
+    WORK_report_result_push(worker);
+  }
+}
+
+/*! FUNCTION:  	WORK_report_result_push()
+ *  SYNOPSIS:  	Commit record filled in slot from RESULTS_Queue_Back() to be written to all open files in <worker>.
+ *              If there is no writer thread, it is written immediately.
+ */
+void WORK_report_result_push(WORKER* worker) {
+  RESULTS_Queue_Push(worker->results);
+
+  if (worker->is_results_writer == false) {
+    WORK_report_result_all(worker);
+  }
+}
+
+/*! FUNCTION:  	WORK_report_result_all()
+ *  SYNOPSIS:  	Write all result entries in queue to all open files in <worker>.
+ *              Only valid when there is no writer thread draining the queue.
+ */
+void WORK_report_result_all(WORKER* worker) {
+  RESULTS* results = worker->results;
+
+  while (results->N > 0) {
+    WORK_report_result(worker, RESULTS_Queue_Front(results));
+    RESULTS_Queue_Pop(results);
+  }
+}
+
+/*! FUNCTION:  	WORK_report_capture_result()
+ *  SYNOPSIS:  	Copy current result, along with all data needed by reports from the current query, target,
+ *              alignments and domains in <worker>, into self-contained <record>.
+ *              HMMER-style strings need query and target, so are built here, but only if a report prints them.
+ *              They are built directly into the alignments of <record>, which are reused across results.
+ *              Cigar strings only need traces, so are left to the reports which print them.
+ */
+void WORK_report_capture_result(WORKER* worker,
+                                RESULT* record) {
+  ARGS* args = worker->args;
+  HMM_PROFILE* t_prof = worker->t_prof;
+  SEQUENCE* q_seq = worker->q_seq;
+  DOMAIN_DEF* dom_def = worker->dom_def;
+  ALIGNMENT* aln = NULL;
+
+  /* scores, cell counts and filter results */
+  RESULT_Copy(record, worker->result);
+  /* id is index in full mmseqs list (not in search range), so results of range shards can be merged */
+  record->result_id = worker->mmseqs_cur->result_id;
+  record->target_id = worker->t_id;
+  record->query_id = worker->q_id;
+
+  /* target/query metadata */
+  record->target_name = STR_Set(record->target_name, t_prof->name);
+  record->target_acc = STR_Set(record->target_acc, t_prof->acc);
+  record->target_desc = STR_Set(record->target_desc, t_prof->desc);
+  record->target_len = t_prof->N;
+  record->query_name = STR_Set(record->query_name, q_seq->name);
+  record->query_acc = STR_Set(record->query_acc, q_seq->acc);
+  record->query_len = q_seq->N;
+
+  /* bounds of cloud search area */
+  if (record->target_range.end - record->target_range.beg <= 0) {
+    EDGEBOUNDS_Find_BoundingBox(worker->edg_row, &record->query_bounds, &record->target_bounds);
+  }
+
+  /* domain summary */
+  record->n_domains = dom_def->n_domains;
+  record->dom_best = dom_def->best;
+  record->dom_best_range = dom_def->best_range;
+  record->dom_best_sc = dom_def->best_sc;
+  record->dom_best_presc = dom_def->best_presc;
+  record->dom_best_fwdsc = dom_def->best_fwdsc;
+  record->dom_best_bias = dom_def->best_bias;
+  record->dom_sumsc = dom_def->dom_sumsc;
+
+  /* runtimes */
+  record->times = *worker->times;
+
+  /* alignments */
+  record->vit_trace = ALIGNMENT_Copy(record->vit_trace, worker->trace_vit);
+  record->post_trace = ALIGNMENT_Copy(record->post_trace, worker->trace_post);
+
+  /* alignment strings and stats of reported alignment */
+  if (args->is_run_postaln == true) {
+    aln = record->post_trace;
+  }
+  elif (args->is_run_vitaln == true) {
+    aln = record->vit_trace;
+  }
+  /* alignment is printed by stdout and hmmerout (with domains), and kept by binout for merging (if one was found) */
+  if (aln != NULL && aln->beg >= 0 &&
+      (args->is_run_domains == true || args->is_hmmerout == true || args->is_binout == true)) {
+    ALIGNMENT_Build_HMMER_Style(aln, q_seq, t_prof);
+  }
+  /* m8out only prints stats of viterbi alignment */
+  if (args->is_run_vitaln == true && args->is_m8out == true && record->vit_trace->is_hmmer_aln == false) {
+    ALIGNMENT_Build_Stats(record->vit_trace, q_seq, t_prof);
+  }
+}
+
+/*! FUNCTION:  	WORK_report_result()
+ *  SYNOPSIS:  	Write <record> entry to all open files in <worker>.
+ *              Reads only <record> and <worker> args and files, so it can be run by writer thread.
+ */
+void WORK_report_result(WORKER* worker,
+                        RESULT* record) {
   ARGS* args = worker->args;
-  RESULT* result = worker->result;
 
   /* only add entry to these reports if search passed reporting threshold */
-  if (result->is_passed_fwdback == true) {
-    REPORT_stdout_entry(worker, worker->result, worker->output_file->fp);
+  if (record->is_passed_fwdback == true) {
+    REPORT_stdout_entry(worker, record, worker->output_file->fp);
 
     if (args->is_hmmerout) {
-      REPORT_hmmerout_entry(worker, worker->result, worker->hmmerout_file->fp);
+      REPORT_hmmerout_entry(worker, record, worker->hmmerout_file->fp);
     }
     if (args->is_m8out) {
-      REPORT_m8out_entry(worker, worker->result, worker->m8out_file->fp);
+      REPORT_m8out_entry(worker, record, worker->m8out_file->fp);
     }
     if (args->is_myout) {
-      REPORT_myout_entry(worker, worker->result, worker->myout_file->fp);
+      REPORT_myout_entry(worker, record, worker->myout_file->fp);
     }
     if (args->is_mydom && args->is_run_domains) {
-      REPORT_domtblout_entry(worker, worker->result, worker->mydomout_file->fp);
+      REPORT_domtblout_entry(worker, record, worker->mydomout_file->fp);
     }
   }
 
   if (args->is_mytimeout) {
-    REPORT_mytimeout_entry(worker, worker->result, worker->mytimeout_file->fp);
+    REPORT_mytimeout_entry(worker, record, worker->mytimeout_file->fp);
   }
   if (args->is_mythreshout) {
-    REPORT_mythreshout_entry(worker, worker->result, worker->mythreshout_file->fp);
+    REPORT_mythreshout_entry(worker, record, worker->mythreshout_file->fp);
+  }
+  if (args->is_binout) {
+    REPORT_binout_entry(worker, record, worker->binout_file->fp);
   }
 }
 
-/*! FUNCTION:  	WORK_report_result_all()
- *  SYNOPSIS:  	Write all result entries in queue to all open files in <worker>.
+/*! FUNCTION:  	WORK_report_writer()
+ *  SYNOPSIS:  	Writer thread. Writes queued records until queue is closed and empty.
  */
-void WORK_report_result_all(WORKER* worker) {
+static void*
+WORK_report_writer(void* arg) {
+  WORKER* worker = (WORKER*)arg;
+  RESULTS* results = worker->results;
+  RESULT* record;
+
+  while ((record = RESULTS_Queue_Front(results)) != NULL) {
+    WORK_report_result(worker, record);
+    RESULTS_Queue_Pop(results);
+  }
+
+  return NULL;
+}
+
+/*! FUNCTION:  	WORK_report_writer_stop()
+ *  SYNOPSIS:  	Close results queue and wait for writer thread to write all remaining records.
+ */
+static void
+WORK_report_writer_stop(WORKER* worker) {
+  if (worker->is_results_writer == false) {
+    return;
+  }
+
+  RESULTS_Queue_Close(worker->results);
+  pthread_join(worker->results_writer, NULL);
+  worker->is_results_writer = false;
+}
+
+/*! FUNCTION:  	WORK_report_trace()
+ *  SYNOPSIS:  	Write per-search trace entry for current search, whether or not it passed filters.
+ */
+void WORK_report_trace(WORKER* worker) {
   ARGS* args = worker->args;
+
+  if (args->is_traceout) {
+    REPORT_traceout_entry(worker, worker->result, worker->traceout_writer);
+  }
 }
 
 /*! FUNCTION:  	WORK_report_footer()
@@ -165,6 +396,10 @@ void WORK_report_result_all(WORKER* worker) {
 void WORK_report_footer(WORKER* worker) {
   ARGS* args = worker->args;
 
+  /* finish writing all entries before footers */
+  WORK_report_writer_stop(worker);
+  WORK_report_result_all(worker);
+
   /* print footers to all open pointers */
   REPORT_stdout_footer(worker, worker->output_file->fp);
 
@@ -186,4 +421,12 @@ void WORK_report_footer(WORKER* worker) {
   if (args->is_mydom && args->is_run_domains) {
     REPORT_domtblout_footer(worker, worker->mydomout_file->fp);
   }
+  if (args->is_binout) {
+    REPORT_binout_footer(worker, worker->binout_file->fp);
+  }
+  if (args->is_perfout) {
+    REPORT_perfout_totals(worker, worker->perfout_file->fp);
+    REPORT_perfout_histograms(worker, worker->perfout_file->fp);
+    REPORT_perfout_footer(worker, worker->perfout_file->fp);
+  }
 }
@@ -24,15 +24,40 @@ void WORK_close(WORKER* worker);
 void WORK_report_header(WORKER* worker);
 
 /*! FUNCTION:  	WORK_report_result_current()
- *  SYNOPSIS:  	Write current result entry to all open files in <worker>.
+ *  SYNOPSIS:  	Capture current result into a self-contained record and queue it to be written
+ *              to all open files in <worker>. If there is no writer thread, it is written immediately.
+ *              If current query has duplicates in <q_dupmap>, result is also queued under each duplicate name.
  */
 void WORK_report_result_current(WORKER* worker);
 
+/*! FUNCTION:  	WORK_report_result_push()
+ *  SYNOPSIS:  	Commit record filled in slot from RESULTS_Queue_Back() to be written to all open files in <worker>.
+ *              If there is no writer thread, it is written immediately.
+ */
+void WORK_report_result_push(WORKER* worker);
+
 /*! FUNCTION:  	WORK_report_result_all()
- *  SYNOPSIS:  	Write all result entries to all open files in <worker>.
+ *  SYNOPSIS:  	Write all result entries in queue to all open files in <worker>.
+ *              Only valid when there is no writer thread draining the queue.
  */
 void WORK_report_result_all(WORKER* worker);
 
+/*! FUNCTION:  	WORK_report_capture_result()
+ *  SYNOPSIS:  	Copy current result, along with all data needed by reports from the current query, target,
+ *              alignments and domains in <worker>, into self-contained <record>.
+ */
+void WORK_report_capture_result(WORKER* worker, RESULT* record);
+
+/*! FUNCTION:  	WORK_report_result()
+ *  SYNOPSIS:  	Write <record> entry to all open files in <worker>.
+ */
+void WORK_report_result(WORKER* worker, RESULT* record);
+
+/*! FUNCTION:  	WORK_report_trace()
+ *  SYNOPSIS:  	Write per-search trace entry for current search, whether or not it passed filters.
+ */
+void WORK_report_trace(WORKER* worker);
+
 /* print header for results file (default) */
 /*! FUNCTION:  	WORK_report_footer()
  *  SYNOPSIS:  	Write all report footers to all open files in <worker>.
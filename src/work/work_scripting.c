@@ -66,6 +66,8 @@ void WORK_load_script_env_args(WORKER* worker) {
   SCRIPTRUNNER_Add_Env_Variable(runner, "DO_RM_TEMP", INT_ToString(args->tmp_remove, buffer));
   SCRIPTRUNNER_Add_Env_Variable(runner, "DO_PREP", INT_ToString(args->is_run_prep, buffer));
   SCRIPTRUNNER_Add_Env_Variable(runner, "DO_COPY", INT_ToString(args->is_prep_copy, buffer));
+  SCRIPTRUNNER_Add_Env_Variable(runner, "DO_DEDUP", INT_ToString(args->is_prep_dedup, buffer));
+  SCRIPTRUNNER_Add_Env_Variable(runner, "DO_NATIVE", INT_ToString(args->is_prep_native, buffer));
   // SCRIPTRUNNER_Add_Env_Variable( runner, "DO_OVERWRITE", INT_ToString(args->is_overwrite, buffer));
   // SCRIPTRUNNER_Add_Env_Variable( runner, "DO_IGNORE_WARNINGS", INT_ToString(args->is_ignore_warnings, buffer ));
   /* SEARCH OPTIONS */
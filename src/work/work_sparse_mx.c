@@ -72,10 +72,6 @@ void WORK_build_sparse_matrix(WORKER* worker) {
     MATRIX_3D_SPARSE_Copy(worker->st_SMX_post, worker->st_SMX_fwd);
     // MATRIX_3D_SPARSE_Shape_Like_Matrix( worker->st_SMX_post, worker->st_SMX_fwd );
     // MATRIX_3D_SPARSE_Fill( worker->st_SMX_post, -INF );
-
-    MATRIX_3D_SPARSE_Copy(worker->st_SMX_optacc, worker->st_SMX_fwd);
-    // MATRIX_3D_SPARSE_Shape_Like_Matrix( worker->st_SMX_optacc, worker->st_SMX_fwd );
-    // MATRIX_3D_SPARSE_Fill( worker->st_SMX_optacc, -INF );
   }
 
   CLOCK_Stop(worker->timer);
@@ -57,6 +57,7 @@ void WORK_viterbi_mmore(WORKER* worker) {
 
   /* Viterbi */
   // printf_vall("# ==> viterbi (linear)...\n");
+  PERF_COUNTERS_Begin(worker->perf, PERF_VITERBI_LIN);
   CLOCK_Start(timer);
   run_Viterbi_Linear(q_seq, t_prof, Q, T, st_MX3, sp_MX, &sc);
   CLOCK_Stop(timer);
@@ -64,6 +65,7 @@ void WORK_viterbi_mmore(WORKER* worker) {
   // printf_vall("VITERBI_MMORE_SCORES: %.3f\n", sc);
 
   times->lin_vit = CLOCK_Duration(timer);
+  PERF_COUNTERS_End(worker->perf, PERF_VITERBI_LIN, times->lin_vit, (size_t)(Q + 1) * (T + 1));
   scores->lin_vit = sc;
   finalsc->viterbi_mmore_natsc = sc;
 
@@ -166,9 +168,7 @@ void WORK_viterbi_sparse(WORKER* worker) {
   int T = t_prof->N;
   EDGEBOUNDS* edg = worker->edg_row;
   /* working data */
-  MATRIX_3D_SPARSE* st_SMX = worker->st_SMX;
-  MATRIX_3D_SPARSE* st_SMX_vit = worker->st_SMX_optacc;
-  MATRIX_2D* sp_MX = worker->sp_MX;
+  VITERBI_PTRS* vit_ptrs = worker->vit_ptrs;
   MATRIX_2D* sp_MX_vit = worker->sp_MX_optacc;
   /* output data */
   TIMES* times = worker->times;
@@ -177,25 +177,20 @@ void WORK_viterbi_sparse(WORKER* worker) {
   SCORES* finalsc = &result->final_scores;
   float sc;
 
+  /* only backpointers are kept for normal states, traceback follows them */
+  PERF_COUNTERS_Begin(worker->perf, PERF_VITERBI_SP);
   CLOCK_Start(timer);
-  run_Bound_Viterbi_Sparse(
-      q_seq, t_prof, Q, T, edg, NULL,
-      st_SMX_vit, sp_MX_vit, &sc);
+  run_Bound_Viterbi_Sparse_Ptrs(
+      q_seq, t_prof, Q, T, edg,
+      vit_ptrs, sp_MX_vit, &sc);
   CLOCK_Stop(timer);
 
   times->sp_vit = CLOCK_Duration(timer);
+  PERF_COUNTERS_End(worker->perf, PERF_VITERBI_SP, times->sp_vit, result->cloud_cells);
   scores->sparse_vit = sc;
   finalsc->viterbi_natsc = sc;
 
   // fprintf(stdout, "# ==> Viterbi (full cloud): %11.4f\n", sc);
-#if DEBUG
-  {
-    fp = fopen(DEBUG_FOLDER "/my.vit.sparse.000.mx", "w+");
-    MATRIX_3D_SPARSE_Embed(Q, T, st_SMX_vit, debugger->test_MX);
-    DP_MATRIX_Dump(Q, T, debugger->test_MX, sp_MX_vit, fp);
-    fclose(fp);
-  }
-#endif
 }
 
 /*! FUNCTION:  WORK_viterbi_traceback_sparse()
@@ -215,9 +210,7 @@ void WORK_viterbi_traceback_sparse(WORKER* worker) {
   EDGEBOUNDS* edg = worker->edg_row;
   ALIGNMENT* aln = worker->trace_vit;
   /* working data */
-  MATRIX_3D_SPARSE* st_SMX = worker->st_SMX;
-  MATRIX_3D_SPARSE* st_SMX_vit = worker->st_SMX_optacc;
-  MATRIX_2D* sp_MX = worker->sp_MX;
+  VITERBI_PTRS* vit_ptrs = worker->vit_ptrs;
   MATRIX_2D* sp_MX_vit = worker->sp_MX_optacc;
   /* output data */
   TIMES* times = worker->times;
@@ -229,11 +222,9 @@ void WORK_viterbi_traceback_sparse(WORKER* worker) {
   /* Optimal Alignment Traceback */
   CLOCK_Start(timer);
 
-  run_Viterbi_Traceback_Sparse(
-      q_seq, t_prof, Q, T, edg, NULL,
-      st_SMX_vit, sp_MX_vit, aln);
-  ALIGNMENT_Build_MMSEQS_Style(aln, q_seq, t_prof);
-  ALIGNMENT_Build_HMMER_Style(aln, q_seq, t_prof);
+  run_Viterbi_Traceback_Sparse_Ptrs(
+      q_seq, t_prof, Q, T, edg,
+      vit_ptrs, sp_MX_vit, aln);
 
   CLOCK_Stop(timer);
   times->sp_vit_trace += CLOCK_Duration(timer);
@@ -246,3 +237,38 @@ void WORK_viterbi_traceback_sparse(WORKER* worker) {
   }
 #endif
 }
+
+/*! FUNCTION:  WORK_viterbi_traceback_full()
+ *  SYNOPSIS:  Run Viterbi and Traceback over the full dp matrix, and store optimal alignment in <trace_vit>.
+ *             For seeding cloud search when input gives no alignment (hitlist entries without a window).
+ *             Only backpointers are kept for normal states, so memory is 4 bits per state per cell.
+ *             Uses <edg_row> as working space, and leaves it cleared.
+ */
+void WORK_viterbi_traceback_full(WORKER* worker) {
+  CLOCK* timer = worker->timer;
+  /* input data */
+  SEQUENCE* q_seq = worker->q_seq;
+  int Q = q_seq->N;
+  HMM_PROFILE* t_prof = worker->t_prof;
+  int T = t_prof->N;
+  ALIGNMENT* aln = worker->trace_vit;
+  /* working data */
+  EDGEBOUNDS* edg = worker->edg_row;
+  VITERBI_PTRS* vit_ptrs = worker->vit_ptrs;
+  MATRIX_2D* sp_MX_vit = worker->sp_MX_optacc;
+  float sc;
+
+  PERF_COUNTERS_Begin(worker->perf, PERF_VITERBI_SP);
+  CLOCK_Start(timer);
+  EDGEBOUNDS_Cover_Matrix(edg, Q, T);
+  MATRIX_2D_Reuse(sp_MX_vit, NUM_SPECIAL_STATES, Q + 1);
+  run_Bound_Viterbi_Sparse_Ptrs(
+      q_seq, t_prof, Q, T, edg,
+      vit_ptrs, sp_MX_vit, &sc);
+  run_Viterbi_Traceback_Sparse_Ptrs(
+      q_seq, t_prof, Q, T, edg,
+      vit_ptrs, sp_MX_vit, aln);
+  EDGEBOUNDS_Reuse(edg, Q, T);
+  CLOCK_Stop(timer);
+  PERF_COUNTERS_End(worker->perf, PERF_VITERBI_SP, CLOCK_Duration(timer), (size_t)(Q + 1) * (T + 1));
+}
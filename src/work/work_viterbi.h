@@ -32,4 +32,12 @@ void WORK_viterbi_sparse(WORKER* worker);
  */
 void WORK_viterbi_traceback_sparse(WORKER* worker);
 
+/*! FUNCTION:  WORK_viterbi_traceback_full()
+ *  SYNOPSIS:  Run Viterbi and Traceback over the full dp matrix, and store optimal alignment in <trace_vit>.
+ *             For seeding cloud search when input gives no alignment (hitlist entries without a window).
+ *             Only backpointers are kept for normal states, so memory is 4 bits per state per cell.
+ *             Uses <edg_row> as working space, and leaves it cleared.
+ */
+void WORK_viterbi_traceback_full(WORKER* worker);
+
 #endif /* _WORK_VITERBI */
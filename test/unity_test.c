@@ -6,6 +6,8 @@
 /* import stdlib */
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 
 /* import local libs */
 #include "unity.h"
@@ -13,6 +15,21 @@
 
 /* import local files */
 #include "../src/macros/_macros.h"
+#include "../src/objects/structs.h"
+#include "../src/utilities/_utilities.h"
+#include "../src/objects/_objects.h"
+#include "../src/parsers/_parsers.h"
+#include "../src/reporting/_reporting.h"
+#include "../src/algs_linear/_algs_linear.h"
+#include "../src/algs_sparse/_algs_sparse.h"
+#include "../src/work/_work.h"
+
+/* size of buffer for rendered report lines */
+#define TEST_REPORT_MAX 1024
+/* example database, relative to repository root */
+#ifndef TEST_GOLDEN_DIR
+#define TEST_GOLDEN_DIR "example/tmp-mmoreseqs-golden"
+#endif
 
 
 void setUp(void)
@@ -52,6 +69,493 @@ void test_SimpleTestSegfault(void)
   TEST_ASSERT_INT_ARRAY_WITHIN(1, d, c, 5);
 }
 
+/* read report written to temp file <fp> into <buf>, and close it */
+static void
+test_read_report(FILE* fp,
+                 char* buf)
+{
+  size_t len;
+
+  rewind(fp);
+  len = fread(buf, 1, TEST_REPORT_MAX - 1, fp);
+  buf[len] = '\0';
+  fclose(fp);
+}
+
+/* build small result with a viterbi alignment */
+static RESULT*
+test_make_result(void)
+{
+  RESULT* result = RESULT_Create();
+  ALIGNMENT* aln = ALIGNMENT_Create();
+  TRACE traces[] = {
+      {0, 0, B_ST}, {1, 1, M_ST}, {2, 2, M_ST}, {3, 2, I_ST}, {4, 3, M_ST}, {4, 3, E_ST}};
+
+  result->result_id = 3;
+  result->target_id = 7;
+  result->query_id = 11;
+  result->target_name = STR_Create("fam1");
+  result->query_name = STR_Create("seq1");
+  result->target_len = 40;
+  result->query_len = 52;
+  result->target_bounds = (RANGE){1, 4};
+  result->query_bounds = (RANGE){1, 5};
+  result->final_scores.eval = 1.5e-8;
+  result->final_scores.seq_sc = 31.25;
+  result->final_scores.pre_sc = 32.5;
+  result->cloud_cells = 120;
+  result->total_cells = 2080;
+  result->perc_cells = 120.0 / 2080.0;
+
+  ALIGNMENT_Reuse(aln, result->query_len, result->target_len);
+  for (int i = 0; i < 6; i++) {
+    ALIGNMENT_AddTrace(aln, traces[i]);
+  }
+  ALIGNMENT_AddRegion(aln, 1, 4, 12.5);
+  aln->beg = 1;
+  aln->end = 4;
+  aln->aln_len = 4;
+  aln->num_matches = 2;
+  aln->num_misses = 1;
+  aln->num_gaps = 1;
+  aln->perc_id = 0.5;
+  result->vit_trace = aln;
+
+  return result;
+}
+
+void test_BinoutRoundTrip(void)
+{
+  WORKER* worker = WORKER_Create();
+  RESULT* result = test_make_result();
+  RESULT* parsed = RESULT_Create();
+  STATS stats_in;
+  TIMES times_in;
+  char text_in[TEST_REPORT_MAX];
+  char text_out[TEST_REPORT_MAX];
+  FILE* fp = tmpfile();
+
+  WORKER_Init(worker);
+
+  /* write binout */
+  REPORT_binout_header(worker, fp);
+  REPORT_binout_entry(worker, result, fp);
+  REPORT_binout_footer(worker, fp);
+
+  /* read it back */
+  rewind(fp);
+  BINOUT_Parse_Header(worker->args, fp);
+  TEST_ASSERT_TRUE(BINOUT_Parse_Entry(parsed, fp));
+  TEST_ASSERT_FALSE(BINOUT_Parse_Entry(parsed, fp));
+  BINOUT_Parse_Footer(&stats_in, &times_in, fp);
+  fclose(fp);
+
+  TEST_ASSERT_EQUAL_INT(result->result_id, parsed->result_id);
+  TEST_ASSERT_EQUAL_INT(result->target_id, parsed->target_id);
+  TEST_ASSERT_EQUAL_INT(result->query_id, parsed->query_id);
+  TEST_ASSERT_EQUAL_STRING(result->target_name, parsed->target_name);
+  TEST_ASSERT_EQUAL_STRING(result->query_name, parsed->query_name);
+  TEST_ASSERT_NULL(parsed->target_acc);
+  TEST_ASSERT_NULL(parsed->post_trace);
+  TEST_ASSERT_EQUAL_MEMORY(&result->final_scores, &parsed->final_scores, sizeof(SCORES));
+  TEST_ASSERT_EQUAL_MEMORY(worker->stats, &stats_in, sizeof(STATS));
+  /* only reported window of traces is kept */
+  TEST_ASSERT_EQUAL_INT(4, parsed->vit_trace->traces->N);
+  TEST_ASSERT_EQUAL_INT(0, parsed->vit_trace->beg);
+  TEST_ASSERT_EQUAL_INT(3, parsed->vit_trace->end);
+
+  /* converted text reports match reports of original result */
+  fp = tmpfile();
+  REPORT_m8out_entry(worker, result, fp);
+  test_read_report(fp, text_in);
+  fp = tmpfile();
+  REPORT_m8out_entry(worker, parsed, fp);
+  test_read_report(fp, text_out);
+  TEST_ASSERT_EQUAL_STRING(text_in, text_out);
+  fp = tmpfile();
+  REPORT_myout_entry(worker, result, fp);
+  test_read_report(fp, text_in);
+  fp = tmpfile();
+  REPORT_myout_entry(worker, parsed, fp);
+  test_read_report(fp, text_out);
+  TEST_ASSERT_EQUAL_STRING(text_in, text_out);
+
+  result = RESULT_Destroy(result);
+  parsed = RESULT_Destroy(parsed);
+  worker = WORKER_Destroy(worker);
+}
+
+/* write binary hitlist with <flags> to temp file <filename>, with <N> records of <rec_size> fields */
+static void
+test_write_hitlist(char* filename,
+                   int flags,
+                   int32_t* recs,
+                   int N,
+                   int rec_size)
+{
+  int32_t header[3] = {HITLIST_VERSION, HITLIST_ENDIAN, flags};
+  int fd = mkstemp(filename);
+  FILE* fp = fdopen(fd, "w");
+
+  fwrite(HITLIST_MAGIC, 1, HITLIST_MAGIC_LEN, fp);
+  fwrite(header, sizeof(int32_t), 3, fp);
+  fwrite(recs, sizeof(int32_t), N * rec_size, fp);
+  fclose(fp);
+}
+
+void test_HitlistParse(void)
+{
+  char filename[] = "/tmp/mmore_test_hitlist_XXXXXX";
+  M8_RESULTS* results = NULL;
+  M8_RESULT* res = NULL;
+  float eval = 1.0e-5;
+  float bitsc = 42.0;
+  int32_t eval_bits, bitsc_bits;
+
+  memcpy(&eval_bits, &eval, sizeof(float));
+  memcpy(&bitsc_bits, &bitsc, sizeof(float));
+
+  /* id-only records: no score or alignment window */
+  {
+    int32_t recs[] = {4, 0, 2, 1, 9, 3};
+    test_write_hitlist(filename, 0, recs, 3, 2);
+    TEST_ASSERT_TRUE(RESULTS_HITLIST_Is_Hitlist(filename));
+    results = M8_RESULTS_Create();
+    RESULTS_HITLIST_Parse(results, filename, 0, INT_MAX);
+    remove(filename);
+
+    TEST_ASSERT_EQUAL_INT(3, results->N);
+    TEST_ASSERT_EQUAL_INT(3, results->num_searches);
+    res = M8_RESULTS_GetX(results, 2);
+    TEST_ASSERT_EQUAL_INT(2, res->result_id);
+    TEST_ASSERT_EQUAL_INT(9, res->target_id);
+    TEST_ASSERT_EQUAL_INT(3, res->query_id);
+    TEST_ASSERT_NULL(res->target_name);
+    TEST_ASSERT_TRUE(res->eval == 0.0);
+    TEST_ASSERT_EQUAL_INT(-1, res->t_beg);
+    TEST_ASSERT_EQUAL_INT(-1, res->q_end);
+    results = M8_RESULTS_Destroy(results);
+  }
+
+  /* unscored records with window, parsed over sub-range */
+  {
+    int32_t recs[] = {1, 2, 3, 40, 5, 60,
+                      7, 8, 9, 90, 11, 120,
+                      13, 14, 15, 150, 17, 180};
+    strcpy(filename, "/tmp/mmore_test_hitlist_XXXXXX");
+    test_write_hitlist(filename, HITLIST_HAS_WINDOW, recs, 3, 6);
+    results = M8_RESULTS_Create();
+    RESULTS_HITLIST_Parse(results, filename, 1, 2);
+    remove(filename);
+
+    TEST_ASSERT_EQUAL_INT(1, results->N);
+    res = M8_RESULTS_GetX(results, 0);
+    TEST_ASSERT_EQUAL_INT(1, res->result_id);
+    TEST_ASSERT_EQUAL_INT(7, res->target_id);
+    TEST_ASSERT_EQUAL_INT(8, res->query_id);
+    TEST_ASSERT_TRUE(res->eval == 0.0);
+    TEST_ASSERT_EQUAL_INT(9, res->t_beg);
+    TEST_ASSERT_EQUAL_INT(90, res->t_end);
+    TEST_ASSERT_EQUAL_INT(11, res->q_beg);
+    TEST_ASSERT_EQUAL_INT(120, res->q_end);
+    results = M8_RESULTS_Destroy(results);
+  }
+
+  /* scored records with window */
+  {
+    int32_t recs[] = {5, 6, eval_bits, bitsc_bits, 1, 30, 2, 31};
+    strcpy(filename, "/tmp/mmore_test_hitlist_XXXXXX");
+    test_write_hitlist(filename, HITLIST_HAS_SCORE | HITLIST_HAS_WINDOW, recs, 1, 8);
+    results = M8_RESULTS_Create();
+    RESULTS_HITLIST_Parse(results, filename, 0, INT_MAX);
+    remove(filename);
+
+    TEST_ASSERT_EQUAL_INT(1, results->N);
+    res = M8_RESULTS_GetX(results, 0);
+    TEST_ASSERT_EQUAL_INT(5, res->target_id);
+    TEST_ASSERT_EQUAL_INT(6, res->query_id);
+    TEST_ASSERT_EQUAL_FLOAT(eval, res->eval);
+    TEST_ASSERT_EQUAL_FLOAT(bitsc, res->bitsc);
+    TEST_ASSERT_EQUAL_INT(1, res->t_beg);
+    TEST_ASSERT_EQUAL_INT(31, res->q_end);
+    results = M8_RESULTS_Destroy(results);
+  }
+}
+
+/* fill <edg> with random row-wise cloud: up to <max_row> sorted, non-overlapping bounds on a random subset of rows */
+static void
+test_random_cloud(EDGEBOUNDS* edg,
+                  int Q,
+                  int T,
+                  int max_row)
+{
+  BOUND bnd;
+
+  EDGEBOUNDS_Reuse(edg, Q, T);
+  edg->edg_mode = EDG_ROW;
+  for (int q_0 = 0; q_0 <= Q; q_0++) {
+    if (rand() % 4 == 0) {
+      continue;
+    }
+    int t_0 = rand() % (T / 2);
+    int N_row = 1 + rand() % max_row;
+    for (int i = 0; i < N_row && t_0 < T; i++) {
+      bnd.id = q_0;
+      bnd.lb = t_0;
+      int len = 1 + rand() % 20;
+      bnd.rb = MIN(T + 1, t_0 + len);
+      EDGEBOUNDS_Pushback(edg, bnd);
+      t_0 = bnd.rb + 1 + rand() % 10;
+    }
+  }
+}
+
+void test_CloudCacheRoundTrip(void)
+{
+  char filename[] = "/tmp/mmore_test_cache_XXXXXX";
+  CLOUD_CACHE* cache_out = CLOUD_CACHE_Create();
+  CLOUD_CACHE* cache_in = CLOUD_CACHE_Create();
+  EDGEBOUNDS* edg = EDGEBOUNDS_Create();
+  EDGEBOUNDS* edg_dec = EDGEBOUNDS_Create();
+  int fd;
+  FILE* fp;
+
+  srand(7);
+  test_random_cloud(edg, 120, 300, 3);
+
+  /* encode/decode in memory */
+  CLOUD_CACHE_Encode(cache_out, edg);
+  TEST_ASSERT_EQUAL_INT(EDGEBOUNDS_GetSize(edg), cache_out->N_bounds);
+  TEST_ASSERT_TRUE(CLOUD_CACHE_Decode(cache_out, edg_dec));
+  TEST_ASSERT_EQUAL_INT(EDG_ROW, edg_dec->edg_mode);
+  TEST_ASSERT_EQUAL_INT(0, EDGEBOUNDS_Compare(edg, edg_dec));
+
+  /* write/read through file */
+  cache_out->result_id = 11;
+  cache_out->q_beg = 3;
+  cache_out->t_beg = 4;
+  cache_out->q_end = 100;
+  cache_out->t_end = 250;
+  cache_out->lin_cloud_fwd = 12.5;
+  cache_out->lin_cloud_bck = 13.25;
+  cache_out->threshold_cloud_max = 1.5;
+  cache_out->threshold_cloud_compo = 2.75;
+  cache_out->cloud_natsc = -3.125;
+  cache_out->is_i16 = true;
+
+  fd = mkstemp(filename);
+  fp = fdopen(fd, "w");
+  CLOUD_CACHE_Write_Header(fp);
+  CLOUD_CACHE_Write(cache_out, fp);
+  fclose(fp);
+
+  fp = fopen(filename, "r");
+  CLOUD_CACHE_Read_Header(fp, filename);
+  TEST_ASSERT_TRUE(CLOUD_CACHE_Read(cache_in, fp));
+  TEST_ASSERT_FALSE(CLOUD_CACHE_Read(cache_in, fp));
+  fclose(fp);
+  remove(filename);
+
+  TEST_ASSERT_EQUAL_INT(11, cache_in->result_id);
+  TEST_ASSERT_EQUAL_INT(120, cache_in->Q);
+  TEST_ASSERT_EQUAL_INT(300, cache_in->T);
+  TEST_ASSERT_EQUAL_INT(3, cache_in->q_beg);
+  TEST_ASSERT_EQUAL_INT(4, cache_in->t_beg);
+  TEST_ASSERT_EQUAL_INT(100, cache_in->q_end);
+  TEST_ASSERT_EQUAL_INT(250, cache_in->t_end);
+  TEST_ASSERT_EQUAL_FLOAT(12.5, cache_in->lin_cloud_fwd);
+  TEST_ASSERT_EQUAL_FLOAT(13.25, cache_in->lin_cloud_bck);
+  TEST_ASSERT_EQUAL_FLOAT(1.5, cache_in->threshold_cloud_max);
+  TEST_ASSERT_EQUAL_FLOAT(2.75, cache_in->threshold_cloud_compo);
+  TEST_ASSERT_EQUAL_FLOAT(-3.125, cache_in->cloud_natsc);
+  TEST_ASSERT_TRUE(cache_in->is_i16);
+  TEST_ASSERT_EQUAL_INT(cache_out->N_bounds, cache_in->N_bounds);
+  TEST_ASSERT_EQUAL_INT(cache_out->data->N, cache_in->data->N);
+  TEST_ASSERT_EQUAL_MEMORY(cache_out->data->data, cache_in->data->data, cache_in->data->N);
+  TEST_ASSERT_TRUE(CLOUD_CACHE_Decode(cache_in, edg_dec));
+  TEST_ASSERT_EQUAL_INT(0, EDGEBOUNDS_Compare(edg, edg_dec));
+
+  /* truncated data is rejected */
+  cache_in->data->N -= 1;
+  TEST_ASSERT_FALSE(CLOUD_CACHE_Decode(cache_in, edg_dec));
+
+  cache_out = CLOUD_CACHE_Destroy(cache_out);
+  cache_in = CLOUD_CACHE_Destroy(cache_in);
+  edg = EDGEBOUNDS_Destroy(edg);
+  edg_dec = EDGEBOUNDS_Destroy(edg_dec);
+}
+
+void test_PaddedEdgeboundsOptimal(void)
+{
+  EDGEBOUNDS* edg_inner = EDGEBOUNDS_Create();
+  EDGEBOUNDS* edg_naive = NULL;
+  EDGEBOUNDS* edg_optimal = NULL;
+
+  srand(11);
+  for (int i = 0; i < 50; i++) {
+    test_random_cloud(edg_inner, 10 + rand() % 100, 20 + rand() % 200, 3);
+    edg_naive = EDGEBOUNDS_Create_Padded_Edgebounds_Naive(edg_inner, edg_naive);
+    edg_optimal = EDGEBOUNDS_Create_Padded_Edgebounds_Optimal(edg_inner, edg_optimal);
+    TEST_ASSERT_EQUAL_INT(edg_naive->edg_mode, edg_optimal->edg_mode);
+    TEST_ASSERT_EQUAL_INT(0, EDGEBOUNDS_Compare(edg_naive, edg_optimal));
+  }
+
+  edg_inner = EDGEBOUNDS_Destroy(edg_inner);
+  edg_naive = EDGEBOUNDS_Destroy(edg_naive);
+  edg_optimal = EDGEBOUNDS_Destroy(edg_optimal);
+}
+
+/* brute-force union of cells of <N> row-wise edgebounds <edg_in> over rows less than <id_end> */
+static void
+test_union_cells(EDGEBOUNDS** edg_in,
+                 int N,
+                 int id_end,
+                 EDGEBOUNDS* edg_out)
+{
+  int Q = edg_in[0]->Q;
+  int T = edg_in[0]->T;
+  bool* cells = calloc(T + 3, sizeof(bool));
+
+  EDGEBOUNDS_Reuse(edg_out, Q, T);
+  edg_out->edg_mode = EDG_ROW;
+  for (int q_0 = 0; q_0 < id_end; q_0++) {
+    memset(cells, 0, (T + 3) * sizeof(bool));
+    for (int i = 0; i < N; i++) {
+      for (int r_0 = 0; r_0 < EDGEBOUNDS_GetSize(edg_in[i]); r_0++) {
+        BOUND* bnd = EDGEBOUNDS_GetX(edg_in[i], r_0);
+        for (int t_0 = bnd->lb; bnd->id == q_0 && t_0 < bnd->rb; t_0++) {
+          cells[t_0] = true;
+        }
+      }
+    }
+    for (int t_0 = 0; t_0 <= T + 1; t_0++) {
+      if (cells[t_0] == true) {
+        int t_b = t_0;
+        while (cells[t_0] == true) {
+          t_0++;
+        }
+        EDGEBOUNDS_Pushback(edg_out, (BOUND){q_0, t_b, t_0});
+      }
+    }
+  }
+  free(cells);
+}
+
+void test_EdgeboundsUnion(void)
+{
+  EDGEBOUNDS* edg_in[3];
+  EDGEBOUNDS* edg_old = EDGEBOUNDS_Create();
+  EDGEBOUNDS* edg_new = EDGEBOUNDS_Create();
+  int Q, T, id_end;
+
+  for (int i = 0; i < 3; i++) {
+    edg_in[i] = EDGEBOUNDS_Create();
+  }
+
+  srand(13);
+  for (int i = 0; i < 50; i++) {
+    Q = 10 + rand() % 100;
+    T = 20 + rand() % 200;
+
+    /* one bound per row: same as old union (which leaves bounds within row unordered) */
+    test_random_cloud(edg_in[0], Q, T, 1);
+    test_random_cloud(edg_in[1], Q, T, 1);
+    EDGEBOUNDS_Union_byRow_Old(Q, T, edg_in[0], edg_in[1], edg_old);
+    EDGEBOUNDS_Sort(edg_old);
+    EDGEBOUNDS_Union(Q, T, edg_in[0], edg_in[1], edg_new);
+    TEST_ASSERT_EQUAL_INT(0, EDGEBOUNDS_Compare(edg_old, edg_new));
+
+    /* several bounds per row: same cells as inputs, up to last row */
+    for (int j = 0; j < 3; j++) {
+      test_random_cloud(edg_in[j], Q, T, 3);
+    }
+    id_end = MAX(EDG_X(edg_in[0], EDGEBOUNDS_GetSize(edg_in[0]) - 1).id,
+                 EDG_X(edg_in[1], EDGEBOUNDS_GetSize(edg_in[1]) - 1).id);
+    test_union_cells(edg_in, 2, id_end, edg_old);
+    EDGEBOUNDS_Union(Q, T, edg_in[0], edg_in[1], edg_new);
+    TEST_ASSERT_EQUAL_INT(0, EDGEBOUNDS_Compare(edg_old, edg_new));
+
+    /* union of several clouds, all rows */
+    test_union_cells(edg_in, 3, Q + 1, edg_old);
+    EDGEBOUNDS_Union_Multi(Q, T, edg_in, 3, edg_new);
+    TEST_ASSERT_EQUAL_INT(0, EDGEBOUNDS_Compare(edg_old, edg_new));
+  }
+
+  for (int i = 0; i < 3; i++) {
+    edg_in[i] = EDGEBOUNDS_Destroy(edg_in[i]);
+  }
+  edg_old = EDGEBOUNDS_Destroy(edg_old);
+  edg_new = EDGEBOUNDS_Destroy(edg_new);
+}
+
+/* offset of <N>th (0-based) sequence of fasta file <filename> */
+static long
+test_fasta_offset(char* filename,
+                  int N)
+{
+  FILE* fp = fopen(filename, "r");
+  char line[TEST_REPORT_MAX];
+  long offset = ftell(fp);
+
+  while (fgets(line, TEST_REPORT_MAX, fp) != NULL) {
+    if (line[0] == '>' && N-- == 0) {
+      break;
+    }
+    offset = ftell(fp);
+  }
+  fclose(fp);
+  return offset;
+}
+
+void test_HitlistWindowlessSeed(void)
+{
+  WORKER* worker = WORKER_Create();
+  M8_RESULT rec;
+  RESULT* result = NULL;
+  float fwd_sc[2];
+  /* second domain of query (2306-2624) is best hit to profile */
+  int window[2][4] = {{1, 312, 2306, 2624}, {-1, -1, -1, -1}};
+
+  WORKER_Init(worker);
+  ARGS_SetDefaults(worker->args);
+  worker->args->verbose_level = VERBOSE_NONE;
+  worker->tasks->linear = true;
+  worker->tasks->sparse = true;
+  worker->tasks->lin_cloud_fwd = true;
+  worker->tasks->lin_cloud_bck = true;
+  worker->tasks->lin_bound_fwd = true;
+  WORK_init(worker);
+  result = worker->result;
+
+  HMM_PROFILE_Parse(worker->t_prof, TEST_GOLDEN_DIR "/mmore/db/target.hmm", 0);
+  HMM_PROFILE_Convert_NegLog_To_Real(worker->t_prof);
+  HMM_PROFILE_Config(worker->t_prof, worker->args->search_mode);
+  SEQUENCE_Fasta_Parse(worker->q_seq, TEST_GOLDEN_DIR "/mmore/db/query.fasta",
+                       test_fasta_offset(TEST_GOLDEN_DIR "/mmore/db/query.fasta", 6));
+  HMM_PROFILE_ReconfigLength(worker->t_prof, worker->q_seq->N);
+
+  /* windowed record, then same record without window */
+  for (int i = 0; i < 2; i++) {
+    memset(&rec, 0, sizeof(M8_RESULT));
+    rec.t_beg = window[i][0];
+    rec.t_end = window[i][1];
+    rec.q_beg = window[i][2];
+    rec.q_end = window[i][3];
+    worker->mmseqs_cur = &rec;
+
+    WORK_reuse(worker);
+    WORK_load_mmseqs_alignment(worker);
+    WORK_cloud_search_linear(worker);
+    WORK_cloud_merge_and_reorient(worker);
+    WORK_bound_fwdback_linear(worker);
+    fwd_sc[i] = result->scores.lin_bound_fwd;
+  }
+  TEST_ASSERT_FLOAT_WITHIN(0.01, fwd_sc[0], fwd_sc[1]);
+
+  WORK_cleanup(worker);
+  worker = WORKER_Destroy(worker);
+}
+
 int main(void) 
 {
   printf(BUILD_COPYRIGHT);
@@ -60,6 +564,12 @@ int main(void)
   RUN_TEST(test_SimpleTestSegfault);
   RUN_TEST(test_SimpleTestPasses);
   RUN_TEST(test_SimpleTestFails);
+  RUN_TEST(test_BinoutRoundTrip);
+  RUN_TEST(test_HitlistParse);
+  RUN_TEST(test_CloudCacheRoundTrip);
+  RUN_TEST(test_PaddedEdgeboundsOptimal);
+  RUN_TEST(test_EdgeboundsUnion);
+  RUN_TEST(test_HitlistWindowlessSeed);
 
   return UNITY_END();
 }